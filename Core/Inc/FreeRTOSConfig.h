@@ -78,6 +78,7 @@
 #define configUSE_RECURSIVE_MUTEXES              1
 #define configUSE_MALLOC_FAILED_HOOK             1
 #define configUSE_APPLICATION_TASK_TAG           1
+#define configUSE_NEWLIB_REENTRANT               1
 #define configUSE_COUNTING_SEMAPHORES            1
 #define configUSE_PORT_OPTIMISED_TASK_SELECTION  0
 /* USER CODE BEGIN MESSAGE_BUFFER_LENGTH_TYPE */
@@ -154,7 +155,7 @@ See http://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html. */
 /* Normal assert() semantics without relying on the provision of an assert.h
 header file. */
 /* USER CODE BEGIN 1 */
-#define configASSERT( x ) if ((x) == 0) {taskDISABLE_INTERRUPTS(); for( ;; );}
+#define configASSERT( x ) if ((x) == 0) { CRASH_Assert(__LINE__); }
 /* USER CODE END 1 */
 
 /* Definitions that map the FreeRTOS port interrupt handlers to their CMSIS
@@ -168,6 +169,24 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* Heap instrumentation, see Peripherals/HEAP/heap_trace.c */
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+  extern void HEAPTRACE_OnMalloc(void *ptr, uint32_t size, void *caller);
+  extern void HEAPTRACE_OnFree(void *ptr, uint32_t size);
+  /* Failed asserts are captured and reset, see Peripherals/SYS/crash.c */
+  extern void CRASH_Assert(uint32_t line);
+#endif
+#define traceMALLOC( pvAddress, uiSize ) HEAPTRACE_OnMalloc( ( pvAddress ), ( uint32_t )( uiSize ), __builtin_return_address( 0 ) )
+#define traceFREE( pvAddress, uiSize )   HEAPTRACE_OnFree( ( pvAddress ), ( uint32_t )( uiSize ) )
+/* Run time accounting in DWT cycles, for the idle time of RTOS_GetCpuLoad() */
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+  extern void DWT_Init(void);
+  extern uint32_t RTOS_GetRunTimeCounter(void);
+#endif
+#define configGENERATE_RUN_TIME_STATS            1
+#define INCLUDE_xTaskGetIdleTaskHandle           1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() DWT_Init()
+#define portGET_RUN_TIME_COUNTER_VALUE()         RTOS_GetRunTimeCounter()
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
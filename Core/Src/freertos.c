@@ -24,6 +24,9 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "../../Peripherals/RTOS/stack_monitor.h"
+#include "../../Peripherals/HEAP/heap_trace.h"
+#include "../../Peripherals/STDIO/stdio_retarget.h"
 
 /* USER CODE END Includes */
 
@@ -69,6 +72,7 @@ void vApplicationIdleHook( void )
    important that vApplicationIdleHook() is permitted to return to its calling
    function, because it is the responsibility of the idle task to clean up
    memory allocated by the kernel to any task that has since been deleted. */
+   STDIO_Poll();
 }
 /* USER CODE END 2 */
 
@@ -78,6 +82,7 @@ void vApplicationStackOverflowHook(xTaskHandle xTask, signed char *pcTaskName)
    /* Run time stack overflow checking is performed if
    configCHECK_FOR_STACK_OVERFLOW is defined to 1 or 2. This hook function is
    called if a stack overflow is detected. */
+   STACKMON_OverflowCapture(xTask, (const char *)pcTaskName);
 }
 /* USER CODE END 4 */
 
@@ -94,6 +99,7 @@ void vApplicationMallocFailedHook(void)
    FreeRTOSConfig.h, and the xPortGetFreeHeapSize() API function can be used
    to query the size of free heap space that remains (although it does not
    provide information on how the remaining heap might be fragmented). */
+   HEAPTRACE_Report();
 }
 /* USER CODE END 5 */
 
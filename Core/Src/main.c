@@ -19,15 +19,13 @@
 
 /* Include modular peripheral headers */
 #include "../../Peripherals/SYS/sys.h"
+#include "../../Peripherals/SYS/crash.h"
+#include "../../Peripherals/BOOT/boot_init.h"
+#include "../../Peripherals/BOOT/boot_time.h"
 #include "../../Peripherals/RTOS/rtos.h"
 #include "../../Peripherals/GPIO/gpio.h"
-#include "../../Peripherals/CRC/crc.h"
-#include "../../Peripherals/DMA2D/dma2d.h"
-#include "../../Peripherals/FMC/fmc.h"
-#include "../../Peripherals/I2C/i2c.h"
-#include "../../Peripherals/LTDC/ltdc.h"
-#include "../../Peripherals/SPI/spi.h"
-#include "../../Peripherals/TIM/tim.h"
+#include "../../Peripherals/MEMPOOL/mempool.h"
+#include "../../Peripherals/TIM/timebase.h"
 #include "../../Peripherals/UART/uart_example.h"
 
 
@@ -35,6 +33,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include <stdio.h>
 
 /* USER CODE END Includes */
 
@@ -48,28 +47,43 @@ int main(void)
 
   /* USER CODE END 1 */
 
+  /* .data, .bss and the static constructors since SystemInit() */
+  BOOTTIME_Mark("C runtime");
+
   /* Initialize system components */
   SYS_Init();
 
+  /* Fault capture to the backup SRAM, and the reset cause of this boot */
+  CRASH_Init();
+  BOOTTIME_Mark("CRASH_Init");
+
+  /* Start the microsecond clock first so every later stage can timestamp */
+  TIMEBASE_Init();
+  BOOTTIME_AttachTimebase();
+  BOOTTIME_Mark("TIMEBASE_Init");
+
   /* USER CODE BEGIN SysInit */
 
   /* USER CODE END SysInit */
 
-  /* Initialize all peripherals using the modular architecture */
+  /* Only what the console needs comes up here; the other peripherals are
+     brought up on first use or in the background (boot_init.c) */
   GPIO_Init();
-  CRC_Init();
-  DMA2D_Init();
-  FMC_Init();
-  I2C_Init();
-  LTDC_Init();
-  SPI_Init();
-  TIM_Init();
+  BOOTTIME_Mark("GPIO_Init");
+  MEMPOOL_Init();
+  BOOTTIME_Mark("MEMPOOL_Init");
+  if (UART_Example_Init() != UART_OK)
+  {
+    Error_Handler();
+  }
+  BOOTTIME_Mark("console");
 
   /* Initialize and start RTOS */
   RTOS_Init();
-  //RTOS_Start();
+  BOOTTIME_Mark("RTOS_Init");
+  RTOS_Start();
 
-  /* Infinite loop */
+  /* Only reached if the scheduler did not start: keep the console up */
   /* USER CODE BEGIN WHILE */
  /* USER CODE BEGIN 3 */
     UART_Example_MainLoop();
@@ -21,7 +21,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 /* USER CODE BEGIN Includes */
-
+#include "../../Peripherals/UART/uart_config.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -581,8 +581,8 @@ void HAL_UART_MspInit(UART_HandleTypeDef* huart)
         GPIO_InitStruct.Alternate = GPIO_AF7_USART1;
         HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
-        /* USART1 interrupt Init */
-        HAL_NVIC_SetPriority(USART1_IRQn, 0, 0);
+        /* USART1 interrupt Init, FreeRTOS safe, same level as its DMA streams */
+        HAL_NVIC_SetPriority(USART1_IRQn, UART_IRQ_PRIORITY, 0);
         HAL_NVIC_EnableIRQ(USART1_IRQn);
     }
 }
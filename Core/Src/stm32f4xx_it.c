@@ -21,6 +21,11 @@
 #include "main.h"
 #include "stm32f4xx_it.h"
 #include "uart.h"
+#include "timebase.h"
+#include "crash.h"
+#include "profiler.h"
+#include "placement.h"
+#include "dwt.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 /* USER CODE END Includes */
@@ -64,6 +69,13 @@ extern UART_Handle_t uartHandle;
 /* DMA handles */
 extern DMA_HandleTypeDef hdma_uart1_tx;  /* UART TX DMA handle */
 extern DMA_HandleTypeDef hdma_uart1_rx;  /* UART RX DMA handle */
+extern DMA_HandleTypeDef hdma_spi5_rx;   /* SPI5 RX DMA handle */
+extern DMA_HandleTypeDef hdma_spi5_tx;   /* SPI5 TX DMA handle */
+extern I2C_HandleTypeDef hi2c3;          /* I2C3 handle */
+extern TIM_HandleTypeDef htim1;          /* Acquisition sample clock */
+extern DMA_HandleTypeDef hdma_adc1;      /* ADC1 DMA handle */
+extern DMA_HandleTypeDef hdma_i2c3_rx;   /* I2C3 RX DMA handle */
+extern DMA_HandleTypeDef hdma_i2c3_tx;   /* I2C3 TX DMA handle */
 
 /* USER CODE BEGIN EV */
 
@@ -90,61 +102,45 @@ void NMI_Handler(void)
 /**
   * @brief This function handles Hard fault interrupt.
   */
-void HardFault_Handler(void)
+__attribute__((naked)) void HardFault_Handler(void)
 {
   /* USER CODE BEGIN HardFault_IRQn 0 */
-
+  /* Save the state to the backup SRAM and reset, see crash.c */
+  CRASH_TRAMPOLINE(CRASH_CAUSE_HARDFAULT);
   /* USER CODE END HardFault_IRQn 0 */
-  while (1)
-  {
-    /* USER CODE BEGIN W1_HardFault_IRQn 0 */
-    /* USER CODE END W1_HardFault_IRQn 0 */
-  }
 }
 
 /**
   * @brief This function handles Memory management fault.
   */
-void MemManage_Handler(void)
+__attribute__((naked)) void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
-
+  /* Save the state to the backup SRAM and reset, see crash.c */
+  CRASH_TRAMPOLINE(CRASH_CAUSE_MEMMANAGE);
   /* USER CODE END MemoryManagement_IRQn 0 */
-  while (1)
-  {
-    /* USER CODE BEGIN W1_MemoryManagement_IRQn 0 */
-    /* USER CODE END W1_MemoryManagement_IRQn 0 */
-  }
 }
 
 /**
   * @brief This function handles Pre-fetch fault, memory access fault.
   */
-void BusFault_Handler(void)
+__attribute__((naked)) void BusFault_Handler(void)
 {
   /* USER CODE BEGIN BusFault_IRQn 0 */
-
+  /* Save the state to the backup SRAM and reset, see crash.c */
+  CRASH_TRAMPOLINE(CRASH_CAUSE_BUSFAULT);
   /* USER CODE END BusFault_IRQn 0 */
-  while (1)
-  {
-    /* USER CODE BEGIN W1_BusFault_IRQn 0 */
-    /* USER CODE END W1_BusFault_IRQn 0 */
-  }
 }
 
 /**
   * @brief This function handles Undefined instruction or illegal state.
   */
-void UsageFault_Handler(void)
+__attribute__((naked)) void UsageFault_Handler(void)
 {
   /* USER CODE BEGIN UsageFault_IRQn 0 */
-
+  /* Save the state to the backup SRAM and reset, see crash.c */
+  CRASH_TRAMPOLINE(CRASH_CAUSE_USAGEFAULT);
   /* USER CODE END UsageFault_IRQn 0 */
-  while (1)
-  {
-    /* USER CODE BEGIN W1_UsageFault_IRQn 0 */
-    /* USER CODE END W1_UsageFault_IRQn 0 */
-  }
 }
 
 /**
@@ -224,11 +220,11 @@ void DMA2D_IRQHandler(void)
 }
 
 /**
-  * @brief This function handles EXTI line[15:10] interrupts.
+  * @brief This function handles EXTI line[15:10] interrupts (touch controller).
   */
 void EXTI15_10_IRQHandler(void)
 {
-  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_13);
+  HAL_GPIO_EXTI_IRQHandler(TP_INT1_Pin);
 }
 
 /**
@@ -240,6 +236,95 @@ void EXTI0_IRQHandler(void)
 
 }
 
+/**
+  * @brief This function handles EXTI line2 interrupt (gyro FIFO watermark).
+  */
+void EXTI2_IRQHandler(void)
+{
+  HAL_GPIO_EXTI_IRQHandler(MEMS_INT2_Pin);
+}
+
+/**
+  * @brief This function handles DMA2 Stream3 global interrupt (SPI5 RX).
+  */
+void DMA2_Stream3_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_spi5_rx);
+}
+
+/**
+  * @brief This function handles DMA2 Stream6 global interrupt (SPI5 TX).
+  */
+void DMA2_Stream6_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_spi5_tx);
+}
+
+/**
+  * @brief This function handles TIM1 update and TIM10 global interrupt.
+  */
+void TIM1_UP_TIM10_IRQHandler(void)
+{
+  HAL_TIM_IRQHandler(&htim1);
+}
+
+/**
+  * @brief This function handles TIM2 global interrupt (microsecond timebase).
+  */
+void TIM2_IRQHandler(void)
+{
+  TIMEBASE_IrqHandler();
+}
+
+/**
+  * @brief This function handles TIM7 global interrupt (sampling profiler).
+  */
+__attribute__((naked)) void TIM7_IRQHandler(void)
+{
+  /* Count the interrupted PC, see profiler.c */
+  PROF_TRAMPOLINE();
+}
+
+/**
+  * @brief This function handles DMA2 Stream0 global interrupt (ADC1).
+  */
+void DMA2_Stream0_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_adc1);
+}
+
+/**
+  * @brief This function handles I2C3 event interrupt.
+  */
+void I2C3_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&hi2c3);
+}
+
+/**
+  * @brief This function handles I2C3 error interrupt.
+  */
+void I2C3_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&hi2c3);
+}
+
+/**
+  * @brief This function handles DMA1 Stream2 global interrupt (I2C3 RX).
+  */
+void DMA1_Stream2_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_i2c3_rx);
+}
+
+/**
+  * @brief This function handles DMA1 Stream4 global interrupt (I2C3 TX).
+  */
+void DMA1_Stream4_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_i2c3_tx);
+}
+
 /**
   * @brief  DMA stream interrupt handlers
   */
@@ -258,7 +343,11 @@ void DMA2_Stream7_IRQHandler(void)
   */
 void USART1_IRQHandler(void)
 {
+  /* Cost per interrupt, the before/after of hot_functions.ld */
+  const uint32_t start = DWT_GetCycles();
+
   HAL_UART_IRQHandler(uartHandle.huart);
+  PLACE_RecordUartIsr(DWT_GetCycles() - start);
 }
 
 /**
@@ -23,12 +23,19 @@
 /* Includes */
 #include <errno.h>
 #include <stdint.h>
+#include "../../Peripherals/HEAP/heap_trace.h"
 
 /**
  * Pointer to the current high watermark of the heap usage
  */
 static uint8_t *__sbrk_heap_end = NULL;
 
+/**
+ * Newlib heap usage counters, read through HEAPTRACE_GetSbrkStats()
+ */
+static uint32_t __sbrk_calls = 0;
+static uint32_t __sbrk_failures = 0;
+
 /**
  * @brief _sbrk() allocates memory to the newlib heap and is used by malloc
  *        and others from the C library
@@ -59,6 +66,8 @@ void *_sbrk(ptrdiff_t incr)
   const uint8_t *max_heap = (uint8_t *)stack_limit;
   uint8_t *prev_heap_end;
 
+  __sbrk_calls++;
+
   /* Initialize heap end at first call */
   if (NULL == __sbrk_heap_end)
   {
@@ -68,6 +77,7 @@ void *_sbrk(ptrdiff_t incr)
   /* Protect heap from growing into the reserved MSP stack */
   if (__sbrk_heap_end + incr > max_heap)
   {
+    __sbrk_failures++;
     errno = ENOMEM;
     return (void *)-1;
   }
@@ -77,3 +87,22 @@ void *_sbrk(ptrdiff_t incr)
 
   return (void *)prev_heap_end;
 }
+
+/**
+ * @brief Reports newlib heap usage for the heap instrumentation
+ *
+ * @param stats Destination
+ */
+void HEAPTRACE_GetSbrkStats(HEAPTRACE_SbrkStats_t *stats)
+{
+  extern uint8_t _end; /* Symbol defined in the linker script */
+  extern uint8_t _estack; /* Symbol defined in the linker script */
+  extern uint32_t _Min_Stack_Size; /* Symbol defined in the linker script */
+  const uint32_t stack_limit = (uint32_t)&_estack - (uint32_t)&_Min_Stack_Size;
+  const uint8_t *heap_end = (NULL == __sbrk_heap_end) ? &_end : __sbrk_heap_end;
+
+  stats->usedBytes = (uint32_t)(heap_end - &_end);
+  stats->limitBytes = stack_limit - (uint32_t)&_end;
+  stats->calls = __sbrk_calls;
+  stats->failures = __sbrk_failures;
+}
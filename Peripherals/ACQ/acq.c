@@ -0,0 +1,469 @@
+/**
+  ******************************************************************************
+  * @file    acq.c
+  * @brief   Hardware timed acquisition scheduler implementation
+  * @details This file provides the ADC1 scan chain triggered by TIM1 CC1 and
+  *          the bus job dispatcher on the TIM1 update interrupt.
+  *
+  *          ADC1 scans VREFINT and the temperature sensor on every trigger.
+  *          DMA2 Stream0 fills a circular buffer of two blocks; the half and
+  *          full transfer interrupts hand the finished block to the consumer
+  *          while the other one is being filled, i.e. one interrupt per
+  *          ACQ_BLOCK_SAMPLES samples instead of one per sample.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "acq.h"
+#include "../TIM/tim.h"
+#include "../TIM/timebase.h"
+#include "stm32f4xx_ll_adc.h"
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Registered bus job
+ */
+typedef struct
+{
+  ACQ_JobFn_t fn;
+  void *context;
+  uint32_t divider;
+} ACQ_Job_t;
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   ADC1 handle and its DMA stream (DMA2 Stream0 channel 0)
+ */
+ADC_HandleTypeDef hadc1;
+DMA_HandleTypeDef hdma_adc1;
+
+/**
+ * @brief   Circular DMA target, two blocks of scans
+ */
+static uint16_t dmaBuffer[2U * ACQ_BLOCK_SAMPLES * ACQ_CHANNELS] __attribute__((aligned(4)));
+
+static ACQ_Sample_t block[ACQ_BLOCK_SAMPLES];
+static ACQ_Sample_t latest;
+static volatile uint8_t haveLatest;
+
+static uint64_t sampleIndex;      /* Trigger of the next scan delivered */
+static uint64_t tickIndex;        /* Update events since start */
+static uint64_t epochUs;          /* Timebase time of the first trigger */
+static uint32_t periodUs = TIM_SAMPLE_PERIOD_DEFAULT_US;
+static volatile uint8_t running;
+
+static ACQ_BlockCallback_t blockCallback;
+static void *blockContext;
+
+static ACQ_Job_t jobs[ACQ_MAX_JOBS];
+static uint32_t jobCount;
+
+static ACQ_Stats_t stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static void ACQ_DeliverBlock(const uint16_t *raw);
+static void ACQ_Resync(void);
+
+/**
+  * @brief  ADC1 and DMA initialization
+  * @param  None
+  * @retval None
+  */
+void ACQ_Init(void)
+{
+  ADC_ChannelConfTypeDef sConfig = {0};
+
+  __HAL_RCC_ADC1_CLK_ENABLE();
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  /* ADC1: 21 MHz, 12-bit scan of two channels per TIM1 CC1 rising edge */
+  hadc1.Instance = ADC1;
+  hadc1.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
+  hadc1.Init.Resolution = ADC_RESOLUTION_12B;
+  hadc1.Init.ScanConvMode = ENABLE;
+  hadc1.Init.ContinuousConvMode = DISABLE;
+  hadc1.Init.DiscontinuousConvMode = DISABLE;
+  hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+  hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T1_CC1;
+  hadc1.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+  hadc1.Init.NbrOfConversion = ACQ_CHANNELS;
+  hadc1.Init.DMAContinuousRequests = ENABLE;
+  hadc1.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+  if (HAL_ADC_Init(&hadc1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* The internal channels need at least 10 us sampling time */
+  sConfig.Channel = ADC_CHANNEL_VREFINT;
+  sConfig.Rank = 1;
+  sConfig.SamplingTime = ADC_SAMPLETIME_480CYCLES;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sConfig.Channel = ADC_CHANNEL_TEMPSENSOR;
+  sConfig.Rank = 2;
+  if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* ADC1 DMA: peripheral to memory, half-words, circular */
+  hdma_adc1.Instance = DMA2_Stream0;
+  hdma_adc1.Init.Channel = DMA_CHANNEL_0;
+  hdma_adc1.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_adc1.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_adc1.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_adc1.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  hdma_adc1.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  hdma_adc1.Init.Mode = DMA_CIRCULAR;
+  hdma_adc1.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_adc1.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_adc1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(&hadc1, DMA_Handle, hdma_adc1);
+
+  HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, ACQ_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+  HAL_NVIC_SetPriority(TIM1_UP_TIM10_IRQn, ACQ_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(TIM1_UP_TIM10_IRQn);
+}
+
+/**
+  * @brief  Start sampling
+  * @param  period  Sample period in microseconds
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ACQ_Start(uint32_t period)
+{
+  if ((period < ACQ_MIN_PERIOD_US) || (period > 65536U) || running)
+  {
+    return HAL_ERROR;
+  }
+
+  periodUs = period;
+  sampleIndex = 0U;
+  tickIndex = 0U;
+  stats.periodUs = period;
+
+  __HAL_TIM_SET_AUTORELOAD(&htim1, period - 1U);
+  __HAL_TIM_SET_COUNTER(&htim1, 0U);
+  htim1.Instance->EGR = TIM_EGR_UG;           /* Load ARR/PSC now */
+  __HAL_TIM_CLEAR_FLAG(&htim1, TIM_FLAG_UPDATE);
+
+  if (HAL_ADC_Start_DMA(&hadc1, (uint32_t *)dmaBuffer,
+                        (uint32_t)(sizeof(dmaBuffer) / sizeof(dmaBuffer[0]))) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (jobCount > 0U)
+  {
+    __HAL_TIM_ENABLE_IT(&htim1, TIM_IT_UPDATE);
+  }
+
+  running = 1U;
+  epochUs = TIMEBASE_GetUs() + TIM_TRIGGER_PULSE_US;
+  if (HAL_TIM_PWM_Start(&htim1, TIM_CHANNEL_1) != HAL_OK)
+  {
+    running = 0U;
+    (void)HAL_ADC_Stop_DMA(&hadc1);
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop sampling
+  * @param  None
+  * @retval None
+  */
+void ACQ_Stop(void)
+{
+  if (!running)
+  {
+    return;
+  }
+
+  (void)HAL_TIM_PWM_Stop(&htim1, TIM_CHANNEL_1);
+  __HAL_TIM_DISABLE_IT(&htim1, TIM_IT_UPDATE);
+  (void)HAL_ADC_Stop_DMA(&hadc1);
+  running = 0U;
+}
+
+/**
+  * @brief  Register the block consumer
+  * @param  callback  Consumer
+  * @param  context   Consumer context
+  * @retval None
+  */
+void ACQ_SetBlockCallback(ACQ_BlockCallback_t callback, void *context)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  blockCallback = callback;
+  blockContext = context;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Register a bus job
+  * @param  fn       Job
+  * @param  context  Job context
+  * @param  divider  Tick divider
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ACQ_AddJob(ACQ_JobFn_t fn, void *context, uint32_t divider)
+{
+  uint32_t primask;
+
+  if ((fn == NULL) || (divider == 0U) || (jobCount >= ACQ_MAX_JOBS))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  jobs[jobCount].fn = fn;
+  jobs[jobCount].context = context;
+  jobs[jobCount].divider = divider;
+  jobCount++;
+  if (running)
+  {
+    __HAL_TIM_ENABLE_IT(&htim1, TIM_IT_UPDATE);
+  }
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  TIM1 update hook
+  * @details The counter value at entry is the time elapsed since the
+  *          update event, i.e. the interrupt latency in microseconds.
+  * @param  None
+  * @retval None
+  */
+void ACQ_TimerTick(void)
+{
+  uint32_t latency = __HAL_TIM_GET_COUNTER(&htim1);
+  uint64_t tickUs;
+  uint32_t i;
+
+  tickIndex++;
+  tickUs = epochUs - TIM_TRIGGER_PULSE_US + (tickIndex * periodUs);
+
+  stats.ticks++;
+  stats.latencyLastUs = latency;
+  if (latency > stats.latencyMaxUs)
+  {
+    stats.latencyMaxUs = latency;
+  }
+
+  for (i = 0; i < jobCount; i++)
+  {
+    if ((tickIndex % jobs[i].divider) == 0U)
+    {
+      jobs[i].fn(tickUs, jobs[i].context);
+      stats.jobRuns++;
+    }
+  }
+}
+
+/**
+  * @brief  Most recent scan
+  * @param  sample  Destination
+  * @retval HAL_OK or HAL_ERROR
+  */
+HAL_StatusTypeDef ACQ_GetLatest(ACQ_Sample_t *sample)
+{
+  uint32_t primask;
+
+  if (!haveLatest)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *sample = latest;
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Die temperature of a scan
+  * @param  sample  Scan
+  * @retval Temperature in 0.01 degC
+  */
+int32_t ACQ_ToCentiCelsius(const ACQ_Sample_t *sample)
+{
+  int32_t cal1 = (int32_t)*TEMPSENSOR_CAL1_ADDR;
+  int32_t cal2 = (int32_t)*TEMPSENSOR_CAL2_ADDR;
+  int32_t vref = (sample->raw[0] != 0U) ? (int32_t)sample->raw[0] : 1;
+  int32_t sense;
+
+  /* Rescale the sensor reading to the 3.3 V calibration conditions */
+  sense = ((int32_t)sample->raw[1] * (int32_t)*VREFINT_CAL_ADDR) / vref;
+
+  return (((sense - cal1) * (TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP) * 100) /
+          (cal2 - cal1)) + (TEMPSENSOR_CAL1_TEMP * 100);
+}
+
+/**
+  * @brief  Read the scheduler statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void ACQ_GetStats(ACQ_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  ADC half transfer callback, first block is complete
+  * @param  hadc  ADC handle
+  * @retval None
+  */
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  if (hadc == &hadc1)
+  {
+    ACQ_DeliverBlock(&dmaBuffer[0]);
+  }
+}
+
+/**
+  * @brief  ADC transfer complete callback, second block is complete
+  * @param  hadc  ADC handle
+  * @retval None
+  */
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  if (hadc == &hadc1)
+  {
+    ACQ_DeliverBlock(&dmaBuffer[ACQ_BLOCK_SAMPLES * ACQ_CHANNELS]);
+  }
+}
+
+/**
+  * @brief  ADC error callback
+  * @details An overrun stops the DMA requests; restart the scan so
+  *          acquisition continues on the next trigger. The DMA starts over
+  *          at the first block, so the scans of the unfinished block and
+  *          the triggers missed meanwhile are counted as lost and skipped
+  *          in the timestamps.
+  * @param  hadc  ADC handle
+  * @retval None
+  */
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc)
+{
+  if (hadc != &hadc1)
+  {
+    return;
+  }
+
+  stats.adcErrors++;
+  if (running)
+  {
+    (void)HAL_ADC_Stop_DMA(&hadc1);
+    __HAL_ADC_CLEAR_FLAG(&hadc1, ADC_FLAG_STRT);
+    (void)HAL_ADC_Start_DMA(&hadc1, (uint32_t *)dmaBuffer,
+                            (uint32_t)(sizeof(dmaBuffer) / sizeof(dmaBuffer[0])));
+    ACQ_Resync();
+  }
+}
+
+/**
+  * @brief  Find the trigger the restarted scan chain converts first
+  * @details TIM1 keeps running through the restart. Its counter gives the
+  *          phase in the current period and the timebase which period it
+  *          is, rounded to the nearest so the two clocks need not agree to
+  *          the microsecond. STRT tells whether a trigger came after the
+  *          ADC was armed; read on both sides of the counter, a change
+  *          means that trigger is the one of the current period.
+  * @param  None
+  * @retval None
+  */
+static void ACQ_Resync(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t startedBefore;
+  uint8_t startedAfter;
+  uint32_t counter;
+  uint64_t nowUs;
+  uint64_t period;
+  uint64_t first;
+
+  __disable_irq();
+  startedBefore = __HAL_ADC_GET_FLAG(&hadc1, ADC_FLAG_STRT) ? 1U : 0U;
+  counter = __HAL_TIM_GET_COUNTER(&htim1);
+  nowUs = TIMEBASE_GetUs();
+  startedAfter = __HAL_ADC_GET_FLAG(&hadc1, ADC_FLAG_STRT) ? 1U : 0U;
+  __set_PRIMASK(primask);
+
+  /* Period n starts with the update at epochUs - pulse + n * periodUs */
+  period = (nowUs - counter - (epochUs - TIM_TRIGGER_PULSE_US) + (periodUs / 2U)) / periodUs;
+
+  if (startedBefore != startedAfter)
+  {
+    first = period;
+  }
+  else if (startedAfter)
+  {
+    first = (counter >= TIM_TRIGGER_PULSE_US) ? period : period - 1U;
+  }
+  else
+  {
+    first = (counter >= TIM_TRIGGER_PULSE_US) ? period + 1U : period;
+  }
+
+  if (first > sampleIndex)
+  {
+    stats.samplesLost += (uint32_t)(first - sampleIndex);
+    sampleIndex = first;
+  }
+}
+
+/**
+  * @brief  Timestamp a finished block and hand it to the consumer
+  * @param  raw  First result of the block
+  * @retval None
+  */
+static void ACQ_DeliverBlock(const uint16_t *raw)
+{
+  uint32_t i;
+  uint32_t ch;
+
+  for (i = 0; i < ACQ_BLOCK_SAMPLES; i++)
+  {
+    block[i].timestampUs = epochUs + ((sampleIndex + i) * periodUs);
+    for (ch = 0; ch < ACQ_CHANNELS; ch++)
+    {
+      block[i].raw[ch] = raw[(i * ACQ_CHANNELS) + ch];
+    }
+  }
+
+  sampleIndex += ACQ_BLOCK_SAMPLES;
+  latest = block[ACQ_BLOCK_SAMPLES - 1U];
+  haveLatest = 1U;
+  stats.samples += ACQ_BLOCK_SAMPLES;
+  stats.blocks++;
+
+  if (blockCallback != NULL)
+  {
+    blockCallback(block, ACQ_BLOCK_SAMPLES, blockContext);
+  }
+}
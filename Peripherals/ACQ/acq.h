@@ -0,0 +1,162 @@
+/**
+  ******************************************************************************
+  * @file    acq.h
+  * @brief   Hardware timed acquisition scheduler interface
+  * @details This file contains the types and function prototypes of the
+  *          acquisition scheduler. TIM1 is the sample clock:
+  *          - Its channel 1 compare event starts an ADC1 scan in hardware;
+  *            DMA moves the results into a circular double buffer, so no
+  *            CPU is involved per sample and the sampling instants are
+  *            exact to one timer count
+  *          - Its update event drives TRGO for slave timers and, while bus
+  *            jobs are registered, an interrupt that submits SPI/I2C
+  *            transactions. Those jobs receive the tick time from the timer,
+  *            not the interrupt entry time, and the interrupt latency is
+  *            measured from the counter
+  *          Samples are timestamped from their index in the hardware
+  *          sequence: sample n was taken exactly n sample periods after the
+  *          first trigger, whose time is taken from the TIMEBASE clock so
+  *          acquisition timestamps compare with all others.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __ACQ_H__
+#define __ACQ_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define ACQ_CHANNELS              2U      /* VREFINT, temperature sensor */
+#define ACQ_BLOCK_SAMPLES         32U     /* Samples per half buffer */
+#define ACQ_MAX_JOBS              4U      /* Bus jobs on the update tick */
+#define ACQ_MIN_PERIOD_US         100U    /* Two 480-cycle conversions fit */
+#define ACQ_IRQ_PRIORITY          6U      /* DMA and TIM1 update, FreeRTOS safe */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   One scan of all channels
+ */
+typedef struct
+{
+  uint64_t timestampUs;           /*!< Trigger time, TIMEBASE_GetUs() clock */
+  uint16_t raw[ACQ_CHANNELS];     /*!< 12-bit results in scan order */
+} ACQ_Sample_t;
+
+/**
+ * @brief   Block consumer
+ * @note    Runs in DMA interrupt context
+ * @param   samples  Samples, oldest first
+ * @param   count    Number of samples
+ * @param   context  Pointer given to ACQ_SetBlockCallback()
+ */
+typedef void (*ACQ_BlockCallback_t)(const ACQ_Sample_t *samples, uint32_t count, void *context);
+
+/**
+ * @brief   Bus job run on the sample tick
+ * @note    Runs in the TIM1 update interrupt; submit a queued transaction
+ *          and return
+ * @param   tickUs   Time of the tick, TIMEBASE_GetUs() clock
+ * @param   context  Pointer given to ACQ_AddJob()
+ */
+typedef void (*ACQ_JobFn_t)(uint64_t tickUs, void *context);
+
+/**
+ * @brief   Scheduler statistics
+ */
+typedef struct
+{
+  uint32_t samples;           /*!< Scans completed */
+  uint32_t blocks;            /*!< Half buffers delivered */
+  uint32_t adcErrors;         /*!< ADC overruns and DMA errors */
+  uint32_t samplesLost;       /*!< Triggers without a delivered scan, from errors */
+  uint32_t ticks;             /*!< Update interrupts serviced */
+  uint32_t jobRuns;           /*!< Bus jobs started */
+  uint32_t latencyLastUs;     /*!< Update interrupt latency, last */
+  uint32_t latencyMaxUs;      /*!< Update interrupt latency, worst */
+  uint32_t periodUs;          /*!< Current sample period */
+} ACQ_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes ADC1 and its DMA stream for triggered scans
+ * @note    TIM_Init() must have run
+ * @param   None
+ * @retval  None
+ */
+void ACQ_Init(void);
+
+/**
+ * @brief   Starts sampling
+ * @param   periodUs  Sample period in microseconds, >= ACQ_MIN_PERIOD_US
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef ACQ_Start(uint32_t periodUs);
+
+/**
+ * @brief   Stops sampling
+ * @param   None
+ * @retval  None
+ */
+void ACQ_Stop(void);
+
+/**
+ * @brief   Registers the block consumer
+ * @param   callback  Consumer, NULL to drop blocks
+ * @param   context   Passed back to the consumer
+ * @retval  None
+ */
+void ACQ_SetBlockCallback(ACQ_BlockCallback_t callback, void *context);
+
+/**
+ * @brief   Registers a bus job on the sample tick
+ * @details Enables the TIM1 update interrupt with the first job
+ * @param   fn       Job
+ * @param   context  Passed back to the job
+ * @param   divider  Run every divider-th tick, >= 1
+ * @retval  HAL_OK, or HAL_ERROR when the table is full
+ */
+HAL_StatusTypeDef ACQ_AddJob(ACQ_JobFn_t fn, void *context, uint32_t divider);
+
+/**
+ * @brief   TIM1 update hook
+ * @note    Called from HAL_TIM_PeriodElapsedCallback()
+ * @param   None
+ * @retval  None
+ */
+void ACQ_TimerTick(void);
+
+/**
+ * @brief   Returns the most recent scan
+ * @param   sample  Destination
+ * @retval  HAL_OK, or HAL_ERROR before the first block
+ */
+HAL_StatusTypeDef ACQ_GetLatest(ACQ_Sample_t *sample);
+
+/**
+ * @brief   Converts a scan to die temperature
+ * @details Uses the factory calibration points and VREFINT to compensate
+ *          for the actual VDDA
+ * @param   sample  Scan
+ * @retval  Temperature in 0.01 degC
+ */
+int32_t ACQ_ToCentiCelsius(const ACQ_Sample_t *sample);
+
+/**
+ * @brief   Reads the scheduler statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void ACQ_GetStats(ACQ_Stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ACQ_H__ */
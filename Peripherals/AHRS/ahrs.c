@@ -0,0 +1,346 @@
+/**
+  ******************************************************************************
+  * @file    ahrs.c
+  * @brief   Attitude and heading reference service implementation
+  * @details This file provides the AHRS task. The gyro callback runs in the
+  *          SPI DMA interrupt, so it only queues the samples; the task runs
+  *          the filter steps, which keeps the floating point work out of
+  *          interrupt context. Step lengths come from the sample timestamps,
+  *          so a late or skipped burst does not distort the integration.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ahrs.h"
+#include "cmsis_os.h"
+#include "stack_monitor.h"
+#include "../L3GD20/l3gd20.h"
+#include "../SYS/dwt.h"
+#include "../TIM/timebase.h"
+#include <stddef.h>
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Latest auxiliary sensor reading
+ */
+typedef struct
+{
+  float32_t value[3];
+  uint64_t timestampUs;
+  uint8_t valid;
+} AHRS_Aux_t;
+
+/* Private variables ---------------------------------------------------------*/
+static osThreadId_t ahrsTaskHandle;
+static const osThreadAttr_t ahrsTask_attributes = {
+  .name = "ahrsTask",
+  .stack_size = AHRS_TASK_STACK_SIZE,
+  .priority = (osPriority_t) osPriorityAboveNormal,
+};
+
+static osMessageQueueId_t sampleQueue;
+
+static AHRS_Filter_t filter;
+static AHRS_Attitude_t latest;
+static uint8_t haveLatest;
+
+static AHRS_Aux_t accelReading;
+static AHRS_Aux_t magReading;
+
+static AHRS_Callback_t attitudeCallback;
+static void *attitudeContext;
+
+static float32_t biasSum[3];
+static uint32_t biasCount;
+
+static AHRS_Stats_t stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static void AHRS_Task(void *argument);
+static void AHRS_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context);
+static void AHRS_Process(const L3GD20_Sample_t *sample, uint64_t *lastUs);
+static uint8_t AHRS_TakeAux(AHRS_Aux_t *reading, uint64_t nowUs, float32_t out[3]);
+static void AHRS_StoreAux(AHRS_Aux_t *reading, const float32_t value[3]);
+
+/**
+  * @brief  AHRS initialization
+  * @param  type  Filter algorithm
+  * @retval None
+  */
+void AHRS_Init(AHRS_FilterType_t type)
+{
+  AHRS_Filter_Init(&filter, type);
+
+  sampleQueue = osMessageQueueNew(AHRS_QUEUE_DEPTH, sizeof(L3GD20_Sample_t), NULL);
+  ahrsTaskHandle = osThreadNew(AHRS_Task, NULL, &ahrsTask_attributes);
+  if ((sampleQueue == NULL) || (ahrsTaskHandle == NULL))
+  {
+    Error_Handler();
+  }
+  STACKMON_Watch(ahrsTaskHandle, ahrsTask_attributes.stack_size);
+
+  DWT_Init();
+  if (L3GD20_AddCallback(AHRS_GyroCallback, NULL) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Store an accelerometer reading
+  * @param  accel  Acceleration
+  * @retval None
+  */
+void AHRS_SetAccel(const float32_t accel[3])
+{
+  AHRS_StoreAux(&accelReading, accel);
+}
+
+/**
+  * @brief  Store a magnetometer reading
+  * @param  mag  Magnetic field
+  * @retval None
+  */
+void AHRS_SetMag(const float32_t mag[3])
+{
+  AHRS_StoreAux(&magReading, mag);
+}
+
+/**
+  * @brief  Register the attitude consumer
+  * @param  callback  Consumer
+  * @param  context   Consumer context
+  * @retval None
+  */
+void AHRS_SetCallback(AHRS_Callback_t callback, void *context)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  attitudeCallback = callback;
+  attitudeContext = context;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Most recent attitude
+  * @param  attitude  Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AHRS_GetAttitude(AHRS_Attitude_t *attitude)
+{
+  uint32_t primask;
+
+  if (!haveLatest)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *attitude = latest;
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Service statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void AHRS_GetStats(AHRS_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  AHRS task
+  * @param  argument  Unused
+  * @retval None
+  */
+static void AHRS_Task(void *argument)
+{
+  L3GD20_Sample_t sample;
+  uint64_t lastUs = 0U;
+
+  (void)argument;
+
+  for (;;)
+  {
+    if (osMessageQueueGet(sampleQueue, &sample, NULL, osWaitForever) == osOK)
+    {
+      AHRS_Process(&sample, &lastUs);
+    }
+  }
+}
+
+/**
+  * @brief  Gyro batch consumer
+  * @details Runs in the SPI DMA interrupt; only queues the samples.
+  * @param  samples  Samples
+  * @param  count    Number of samples
+  * @param  context  Unused
+  * @retval None
+  */
+static void AHRS_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context)
+{
+  uint32_t i;
+
+  (void)context;
+
+  for (i = 0; i < count; i++)
+  {
+    if (osMessageQueuePut(sampleQueue, &samples[i], 0U, 0U) != osOK)
+    {
+      stats.dropped++;
+    }
+  }
+}
+
+/**
+  * @brief  Calibrate or run one filter step for a gyro sample
+  * @param  sample  Gyro sample
+  * @param  lastUs  Timestamp of the previous step, updated
+  * @retval None
+  */
+static void AHRS_Process(const L3GD20_Sample_t *sample, uint64_t *lastUs)
+{
+  float32_t gyro[3];
+  float32_t accel[3];
+  float32_t mag[3];
+  const float32_t *pAccel = NULL;
+  const float32_t *pMag = NULL;
+  AHRS_Attitude_t attitude;
+  AHRS_Callback_t callback;
+  float32_t dt;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t primask;
+
+  if (!stats.biasValid)
+  {
+    biasSum[0] += sample->x;
+    biasSum[1] += sample->y;
+    biasSum[2] += sample->z;
+    if (++biasCount >= AHRS_BIAS_SAMPLES)
+    {
+      stats.bias[0] = biasSum[0] / (float32_t)biasCount;
+      stats.bias[1] = biasSum[1] / (float32_t)biasCount;
+      stats.bias[2] = biasSum[2] / (float32_t)biasCount;
+      stats.biasValid = 1U;
+
+      /* Start from the measured attitude rather than level */
+      if (AHRS_TakeAux(&accelReading, sample->timestampUs, accel))
+      {
+        (void)AHRS_Filter_Align(&filter, accel,
+                                AHRS_TakeAux(&magReading, sample->timestampUs, mag) ? mag : NULL);
+      }
+    }
+    *lastUs = sample->timestampUs;
+    return;
+  }
+
+  dt = (float32_t)(sample->timestampUs - *lastUs) * 1.0e-6f;
+  if ((dt <= 0.0f) || (dt > 0.1f))
+  {
+    dt = 1.0f / (float32_t)L3GD20_GetOdrHz();
+  }
+  *lastUs = sample->timestampUs;
+
+  gyro[0] = (sample->x - stats.bias[0]) * (PI / 180.0f);
+  gyro[1] = (sample->y - stats.bias[1]) * (PI / 180.0f);
+  gyro[2] = (sample->z - stats.bias[2]) * (PI / 180.0f);
+
+  if (AHRS_TakeAux(&accelReading, sample->timestampUs, accel))
+  {
+    pAccel = accel;
+    if (AHRS_TakeAux(&magReading, sample->timestampUs, mag))
+    {
+      pMag = mag;
+    }
+  }
+
+  start = DWT_GetCycles();
+  AHRS_Filter_Update(&filter, gyro, pAccel, pMag, dt);
+  cycles = DWT_GetCycles() - start;
+
+  attitude.timestampUs = sample->timestampUs;
+  attitude.q[0] = filter.q[0];
+  attitude.q[1] = filter.q[1];
+  attitude.q[2] = filter.q[2];
+  attitude.q[3] = filter.q[3];
+  AHRS_Filter_GetEuler(&filter, &attitude.euler);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  latest = attitude;
+  haveLatest = 1U;
+  stats.updates++;
+  stats.cyclesLast = cycles;
+  if (cycles > stats.cyclesMax)
+  {
+    stats.cyclesMax = cycles;
+  }
+  stats.cyclesAvg = (stats.cyclesAvg == 0U) ? cycles
+                  : (stats.cyclesAvg - (stats.cyclesAvg / 64U) + (cycles / 64U));
+  callback = attitudeCallback;
+  __set_PRIMASK(primask);
+
+  if (callback != NULL)
+  {
+    callback(&attitude, attitudeContext);
+  }
+}
+
+/**
+  * @brief  Copy an auxiliary reading if it is fresh
+  * @param  reading  Stored reading
+  * @param  nowUs    Time of the gyro sample
+  * @param  out      Destination
+  * @retval 1 if a fresh reading was copied
+  */
+static uint8_t AHRS_TakeAux(AHRS_Aux_t *reading, uint64_t nowUs, float32_t out[3])
+{
+  uint8_t fresh;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  fresh = (reading->valid &&
+           ((nowUs < reading->timestampUs) ||
+            ((nowUs - reading->timestampUs) <= AHRS_AUX_MAX_AGE_US))) ? 1U : 0U;
+  if (fresh)
+  {
+    out[0] = reading->value[0];
+    out[1] = reading->value[1];
+    out[2] = reading->value[2];
+  }
+  __set_PRIMASK(primask);
+
+  return fresh;
+}
+
+/**
+  * @brief  Store an auxiliary reading
+  * @param  reading  Destination
+  * @param  value    Vector
+  * @retval None
+  */
+static void AHRS_StoreAux(AHRS_Aux_t *reading, const float32_t value[3])
+{
+  uint64_t now = TIMEBASE_GetUs();
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  reading->value[0] = value[0];
+  reading->value[1] = value[1];
+  reading->value[2] = value[2];
+  reading->timestampUs = now;
+  reading->valid = 1U;
+  __set_PRIMASK(primask);
+}
@@ -0,0 +1,119 @@
+/**
+  ******************************************************************************
+  * @file    ahrs.h
+  * @brief   Attitude and heading reference service interface
+  * @details This file contains the types and function prototypes of the
+  *          AHRS service. It takes the L3GD20 sample batches, removes the
+  *          gyro bias measured at start-up, runs one quaternion filter step
+  *          per gyro sample and publishes the attitude at the gyro rate
+  *          (760 Hz), timestamped with the sample time.
+  *
+  *          The board has no accelerometer or magnetometer; a driver for an
+  *          external I2C one hands its readings in with AHRS_SetAccel() and
+  *          AHRS_SetMag() and they are used while fresh. Without them the
+  *          attitude is pure gyro integration and drifts.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __AHRS_H__
+#define __AHRS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "ahrs_filter.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define AHRS_QUEUE_DEPTH          64U       /* Gyro samples buffered for the task */
+#define AHRS_BIAS_SAMPLES         760U      /* Bias averaging window, 1 s */
+#define AHRS_AUX_MAX_AGE_US       100000U   /* Accel/mag older than this is ignored */
+#define AHRS_TASK_STACK_SIZE      (256U * 4U)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Published attitude
+ */
+typedef struct
+{
+  uint64_t timestampUs;         /*!< Time of the gyro sample, TIMEBASE clock */
+  float32_t q[4];               /*!< Orientation quaternion, w x y z */
+  AHRS_Euler_t euler;           /*!< Same orientation as Euler angles */
+} AHRS_Attitude_t;
+
+/**
+ * @brief   Attitude consumer
+ * @note    Runs in the AHRS task after every update
+ * @param   attitude  New attitude
+ * @param   context   Pointer given to AHRS_SetCallback()
+ */
+typedef void (*AHRS_Callback_t)(const AHRS_Attitude_t *attitude, void *context);
+
+/**
+ * @brief   Service statistics
+ */
+typedef struct
+{
+  uint32_t updates;             /*!< Filter steps run */
+  uint32_t dropped;             /*!< Gyro samples lost to a full queue */
+  uint32_t cyclesLast;          /*!< CPU cycles of the last step */
+  uint32_t cyclesMax;           /*!< CPU cycles of the slowest step */
+  uint32_t cyclesAvg;           /*!< Running average, cycles per step */
+  uint8_t biasValid;            /*!< Bias calibration finished */
+  float32_t bias[3];            /*!< Gyro bias, deg/s */
+} AHRS_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Creates the AHRS task and subscribes to the gyro
+ * @note    Keep the board still for AHRS_BIAS_SAMPLES samples after start
+ * @param   type  Filter algorithm
+ * @retval  None
+ */
+void AHRS_Init(AHRS_FilterType_t type);
+
+/**
+ * @brief   Hands in an accelerometer reading
+ * @param   accel  Acceleration, sensor frame, any unit
+ * @retval  None
+ */
+void AHRS_SetAccel(const float32_t accel[3]);
+
+/**
+ * @brief   Hands in a magnetometer reading
+ * @param   mag  Magnetic field, sensor frame, any unit
+ * @retval  None
+ */
+void AHRS_SetMag(const float32_t mag[3]);
+
+/**
+ * @brief   Registers the attitude consumer
+ * @param   callback  Consumer, NULL to remove
+ * @param   context   Passed back to the consumer
+ * @retval  None
+ */
+void AHRS_SetCallback(AHRS_Callback_t callback, void *context);
+
+/**
+ * @brief   Returns the most recent attitude
+ * @param   attitude  Destination
+ * @retval  HAL_OK, or HAL_ERROR before the first update
+ */
+HAL_StatusTypeDef AHRS_GetAttitude(AHRS_Attitude_t *attitude);
+
+/**
+ * @brief   Reads the service statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void AHRS_GetStats(AHRS_Stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __AHRS_H__ */
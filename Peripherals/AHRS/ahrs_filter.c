@@ -0,0 +1,345 @@
+/**
+  ******************************************************************************
+  * @file    ahrs_filter.c
+  * @brief   Quaternion orientation filters implementation
+  * @details This file provides the Madgwick gradient descent filter and the
+  *          Mahony complementary filter.
+  *
+  *          Both start from the rotation matrix of the current estimate
+  *          (arm_quaternion2rotation_f32): its last row is gravity as the
+  *          sensor should see it, and rows combined with the earth field
+  *          reference give the expected magnetometer direction. Madgwick
+  *          descends along the gradient of the mismatch; Mahony feeds the
+  *          cross product error back into the angular rate through a PI
+  *          controller, which also tracks slow gyro bias. The rate is then
+  *          integrated as q' = q (x) (0, w) / 2 with the CMSIS-DSP
+  *          quaternion product and the result renormalized.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ahrs_filter.h"
+#include <stddef.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t AHRS_Normalize3(const float32_t in[3], float32_t out[3]);
+static void AHRS_Cross3(const float32_t a[3], const float32_t b[3], float32_t out[3]);
+static void AHRS_MadgwickStep(AHRS_Filter_t *filter, const float32_t r[9], const float32_t *a,
+                              const float32_t *m, float32_t bx, float32_t bz, float32_t step[4]);
+static void AHRS_MahonyStep(AHRS_Filter_t *filter, const float32_t r[9], const float32_t *a,
+                            const float32_t *m, float32_t bx, float32_t bz, float32_t rate[3],
+                            float32_t dt);
+
+/**
+  * @brief  Filter initialization
+  * @param  filter  State
+  * @param  type    Algorithm
+  * @retval None
+  */
+void AHRS_Filter_Init(AHRS_Filter_t *filter, AHRS_FilterType_t type)
+{
+  filter->type = type;
+  filter->q[0] = 1.0f;
+  filter->q[1] = 0.0f;
+  filter->q[2] = 0.0f;
+  filter->q[3] = 0.0f;
+  filter->beta = AHRS_MADGWICK_BETA_DEFAULT;
+  filter->kp = AHRS_MAHONY_KP_DEFAULT;
+  filter->ki = AHRS_MAHONY_KI_DEFAULT;
+  filter->integral[0] = 0.0f;
+  filter->integral[1] = 0.0f;
+  filter->integral[2] = 0.0f;
+}
+
+/**
+  * @brief  Orientation from one reading
+  * @details The rows of the rotation matrix are the earth axes seen from the
+  *          sensor: up is the measured gravity, west is up x field and north
+  *          completes the frame.
+  * @param  filter  State
+  * @param  accel   Acceleration
+  * @param  mag     Magnetic field or NULL
+  * @retval 1 on success, 0 otherwise
+  */
+uint8_t AHRS_Filter_Align(AHRS_Filter_t *filter, const float32_t accel[3], const float32_t *mag)
+{
+  const float32_t axisX[3] = {1.0f, 0.0f, 0.0f};
+  const float32_t axisY[3] = {0.0f, 1.0f, 0.0f};
+  float32_t r[9];
+  float32_t west[3];
+
+  if (!AHRS_Normalize3(accel, &r[6]))
+  {
+    return 0U;
+  }
+
+  if (mag != NULL)
+  {
+    AHRS_Cross3(&r[6], mag, west);
+  }
+  else
+  {
+    /* Sensor x axis as north, y if x points straight up or down */
+    AHRS_Cross3(&r[6], axisX, west);
+    if (((west[0] * west[0]) + (west[1] * west[1]) + (west[2] * west[2])) < 0.01f)
+    {
+      AHRS_Cross3(&r[6], axisY, west);
+    }
+  }
+  if (!AHRS_Normalize3(west, &r[3]))
+  {
+    return 0U;
+  }
+  AHRS_Cross3(&r[3], &r[6], &r[0]);
+
+  arm_rotation2quaternion_f32(r, filter->q, 1);
+  arm_quaternion_normalize_f32(filter->q, filter->q, 1);
+  filter->integral[0] = 0.0f;
+  filter->integral[1] = 0.0f;
+  filter->integral[2] = 0.0f;
+  return 1U;
+}
+
+/**
+  * @brief  One filter step
+  * @param  filter  State
+  * @param  gyro    Angular rate, rad/s
+  * @param  accel   Acceleration or NULL
+  * @param  mag     Magnetic field or NULL
+  * @param  dt      Step in seconds
+  * @retval None
+  */
+void AHRS_Filter_Update(AHRS_Filter_t *filter, const float32_t gyro[3],
+                        const float32_t *accel, const float32_t *mag, float32_t dt)
+{
+  float32_t r[9];
+  float32_t a[3];
+  float32_t m[3];
+  float32_t h[3];
+  float32_t rate[4];
+  float32_t qDot[4];
+  float32_t step[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float32_t bx = 0.0f;
+  float32_t bz = 0.0f;
+  const float32_t *pa = NULL;
+  const float32_t *pm = NULL;
+  uint32_t i;
+
+  arm_quaternion2rotation_f32(filter->q, r, 1);
+
+  if ((accel != NULL) && AHRS_Normalize3(accel, a))
+  {
+    pa = a;
+
+    if ((mag != NULL) && AHRS_Normalize3(mag, m))
+    {
+      /* Field in the earth frame; keep only its horizontal and vertical
+         magnitude so the magnetometer cannot disturb roll and pitch */
+      pm = m;
+      h[0] = (r[0] * m[0]) + (r[1] * m[1]) + (r[2] * m[2]);
+      h[1] = (r[3] * m[0]) + (r[4] * m[1]) + (r[5] * m[2]);
+      h[2] = (r[6] * m[0]) + (r[7] * m[1]) + (r[8] * m[2]);
+      (void)arm_sqrt_f32((h[0] * h[0]) + (h[1] * h[1]), &bx);
+      bz = h[2];
+    }
+  }
+
+  rate[0] = 0.0f;
+  rate[1] = gyro[0];
+  rate[2] = gyro[1];
+  rate[3] = gyro[2];
+
+  if (filter->type == AHRS_FILTER_MAHONY)
+  {
+    if (pa != NULL)
+    {
+      AHRS_MahonyStep(filter, r, pa, pm, bx, bz, &rate[1], dt);
+    }
+  }
+  else if (pa != NULL)
+  {
+    AHRS_MadgwickStep(filter, r, pa, pm, bx, bz, step);
+  }
+
+  arm_quaternion_product_single_f32(filter->q, rate, qDot);
+
+  for (i = 0; i < 4U; i++)
+  {
+    filter->q[i] += ((0.5f * qDot[i]) - (filter->beta * step[i])) * dt;
+  }
+
+  arm_quaternion_normalize_f32(filter->q, filter->q, 1);
+}
+
+/**
+  * @brief  Roll, pitch and yaw of the estimate
+  * @param  filter  State
+  * @param  euler   Destination
+  * @retval None
+  */
+void AHRS_Filter_GetEuler(const AHRS_Filter_t *filter, AHRS_Euler_t *euler)
+{
+  float32_t r[9];
+  float32_t sinPitch;
+
+  arm_quaternion2rotation_f32(filter->q, r, 1);
+
+  sinPitch = -r[6];
+  if (sinPitch > 1.0f)
+  {
+    sinPitch = 1.0f;
+  }
+  else if (sinPitch < -1.0f)
+  {
+    sinPitch = -1.0f;
+  }
+
+  euler->roll = atan2f(r[7], r[8]);
+  euler->pitch = asinf(sinPitch);
+  euler->yaw = atan2f(r[3], r[0]);
+}
+
+/**
+  * @brief  Madgwick correction direction
+  * @details Normalized gradient J^T f of the squared mismatch between the
+  *          measured and the predicted gravity (and field) directions.
+  * @param  filter  State
+  * @param  r       Rotation matrix of the estimate, row order
+  * @param  a       Normalized acceleration
+  * @param  m       Normalized field or NULL
+  * @param  bx      Earth field, horizontal component
+  * @param  bz      Earth field, vertical component
+  * @param  step    Destination, left zero when the gradient vanishes
+  * @retval None
+  */
+static void AHRS_MadgwickStep(AHRS_Filter_t *filter, const float32_t r[9], const float32_t *a,
+                              const float32_t *m, float32_t bx, float32_t bz, float32_t step[4])
+{
+  const float32_t q0 = filter->q[0];
+  const float32_t q1 = filter->q[1];
+  const float32_t q2 = filter->q[2];
+  const float32_t q3 = filter->q[3];
+  float32_t f0 = r[6] - a[0];
+  float32_t f1 = r[7] - a[1];
+  float32_t f2 = r[8] - a[2];
+  float32_t g[4];
+  float32_t norm;
+  uint32_t i;
+
+  g[0] = (-2.0f * q2 * f0) + (2.0f * q1 * f1);
+  g[1] = (2.0f * q3 * f0) + (2.0f * q0 * f1) - (4.0f * q1 * f2);
+  g[2] = (-2.0f * q0 * f0) + (2.0f * q3 * f1) - (4.0f * q2 * f2);
+  g[3] = (2.0f * q1 * f0) + (2.0f * q2 * f1);
+
+  if (m != NULL)
+  {
+    f0 = (bx * r[0]) + (bz * r[6]) - m[0];
+    f1 = (bx * r[1]) + (bz * r[7]) - m[1];
+    f2 = (bx * r[2]) + (bz * r[8]) - m[2];
+
+    g[0] += (-2.0f * bz * q2 * f0) +
+            (((-2.0f * bx * q3) + (2.0f * bz * q1)) * f1) +
+            (2.0f * bx * q2 * f2);
+    g[1] += (2.0f * bz * q3 * f0) +
+            (((2.0f * bx * q2) + (2.0f * bz * q0)) * f1) +
+            (((2.0f * bx * q3) - (4.0f * bz * q1)) * f2);
+    g[2] += (((-4.0f * bx * q2) - (2.0f * bz * q0)) * f0) +
+            (((2.0f * bx * q1) + (2.0f * bz * q3)) * f1) +
+            (((2.0f * bx * q0) - (4.0f * bz * q2)) * f2);
+    g[3] += (((-4.0f * bx * q3) + (2.0f * bz * q1)) * f0) +
+            (((-2.0f * bx * q0) + (2.0f * bz * q2)) * f1) +
+            (2.0f * bx * q1 * f2);
+  }
+
+  (void)arm_sqrt_f32((g[0] * g[0]) + (g[1] * g[1]) + (g[2] * g[2]) + (g[3] * g[3]), &norm);
+  if (norm <= 0.0f)
+  {
+    return;
+  }
+
+  for (i = 0; i < 4U; i++)
+  {
+    step[i] = g[i] / norm;
+  }
+}
+
+/**
+  * @brief  Mahony rate correction
+  * @details The error is the cross product of measured and predicted
+  *          directions; its integral absorbs the gyro bias.
+  * @param  filter  State
+  * @param  r       Rotation matrix of the estimate, row order
+  * @param  a       Normalized acceleration
+  * @param  m       Normalized field or NULL
+  * @param  bx      Earth field, horizontal component
+  * @param  bz      Earth field, vertical component
+  * @param  rate    Angular rate, corrected in place
+  * @param  dt      Step in seconds
+  * @retval None
+  */
+static void AHRS_MahonyStep(AHRS_Filter_t *filter, const float32_t r[9], const float32_t *a,
+                            const float32_t *m, float32_t bx, float32_t bz, float32_t rate[3],
+                            float32_t dt)
+{
+  float32_t e[3];
+  float32_t w[3];
+  uint32_t i;
+
+  e[0] = (a[1] * r[8]) - (a[2] * r[7]);
+  e[1] = (a[2] * r[6]) - (a[0] * r[8]);
+  e[2] = (a[0] * r[7]) - (a[1] * r[6]);
+
+  if (m != NULL)
+  {
+    w[0] = (bx * r[0]) + (bz * r[6]);
+    w[1] = (bx * r[1]) + (bz * r[7]);
+    w[2] = (bx * r[2]) + (bz * r[8]);
+    e[0] += (m[1] * w[2]) - (m[2] * w[1]);
+    e[1] += (m[2] * w[0]) - (m[0] * w[2]);
+    e[2] += (m[0] * w[1]) - (m[1] * w[0]);
+  }
+
+  for (i = 0; i < 3U; i++)
+  {
+    filter->integral[i] += filter->ki * e[i] * dt;
+    rate[i] += (filter->kp * e[i]) + filter->integral[i];
+  }
+}
+
+/**
+  * @brief  Normalize a 3-vector
+  * @param  in   Vector
+  * @param  out  Unit vector
+  * @retval 1 on success, 0 for a zero vector
+  */
+static uint8_t AHRS_Normalize3(const float32_t in[3], float32_t out[3])
+{
+  float32_t norm;
+
+  (void)arm_sqrt_f32((in[0] * in[0]) + (in[1] * in[1]) + (in[2] * in[2]), &norm);
+  if (norm <= 0.0f)
+  {
+    return 0U;
+  }
+
+  out[0] = in[0] / norm;
+  out[1] = in[1] / norm;
+  out[2] = in[2] / norm;
+  return 1U;
+}
+
+/**
+  * @brief  Cross product of 3-vectors
+  * @param  a    Left operand
+  * @param  b    Right operand
+  * @param  out  a x b, must not alias the operands
+  * @retval None
+  */
+static void AHRS_Cross3(const float32_t a[3], const float32_t b[3], float32_t out[3])
+{
+  out[0] = (a[1] * b[2]) - (a[2] * b[1]);
+  out[1] = (a[2] * b[0]) - (a[0] * b[2]);
+  out[2] = (a[0] * b[1]) - (a[1] * b[0]);
+}
@@ -0,0 +1,117 @@
+/**
+  ******************************************************************************
+  * @file    ahrs_filter.h
+  * @brief   Quaternion orientation filters interface
+  * @details This file contains the types and function prototypes of the
+  *          Madgwick and Mahony attitude filters. They integrate the angular
+  *          rate and, when available, pull the estimate towards the measured
+  *          gravity (accelerometer) and magnetic field (magnetometer).
+  *
+  *          The filters only depend on CMSIS-DSP, not on the HAL or the
+  *          RTOS, so the same code runs on target and on a host against
+  *          recorded data.
+  *
+  *          Quaternions are stored in CMSIS-DSP order (w, x, y, z) and rotate
+  *          sensor frame vectors into the earth frame (x north, z up).
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __AHRS_FILTER_H__
+#define __AHRS_FILTER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define AHRS_MADGWICK_BETA_DEFAULT  0.1f    /* Gradient step, rad/s */
+#define AHRS_MAHONY_KP_DEFAULT      1.0f    /* Proportional gain */
+#define AHRS_MAHONY_KI_DEFAULT      0.02f   /* Integral gain (bias tracking) */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Filter algorithm
+ */
+typedef enum
+{
+  AHRS_FILTER_MADGWICK = 0,
+  AHRS_FILTER_MAHONY
+} AHRS_FilterType_t;
+
+/**
+ * @brief   Filter state
+ */
+typedef struct
+{
+  AHRS_FilterType_t type;
+  float32_t q[4];               /*!< Orientation, w x y z */
+  float32_t beta;               /*!< Madgwick gradient step */
+  float32_t kp;                 /*!< Mahony proportional gain */
+  float32_t ki;                 /*!< Mahony integral gain */
+  float32_t integral[3];        /*!< Mahony integrated error, rad/s */
+} AHRS_Filter_t;
+
+/**
+ * @brief   Attitude as Euler angles
+ */
+typedef struct
+{
+  float32_t roll;               /*!< About x, radians */
+  float32_t pitch;              /*!< About y, radians */
+  float32_t yaw;                /*!< About z, radians */
+} AHRS_Euler_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes a filter to identity orientation with default gains
+ * @param   filter  State
+ * @param   type    Algorithm
+ * @retval  None
+ */
+void AHRS_Filter_Init(AHRS_Filter_t *filter, AHRS_FilterType_t type);
+
+/**
+ * @brief   Sets the orientation from one accelerometer reading
+ * @details Tilt from the measured gravity, heading from the magnetometer or,
+ *          without one, that of the sensor x axis. Clears the Mahony
+ *          integral. A filter started level needs tens of seconds to correct
+ *          a large heading error, and the Mahony integral winds up over it.
+ * @param   filter  State
+ * @param   accel   Acceleration in any unit
+ * @param   mag     Magnetic field in any unit, NULL when not available
+ * @retval  1 on success, 0 if the readings give no orientation
+ */
+uint8_t AHRS_Filter_Align(AHRS_Filter_t *filter, const float32_t accel[3], const float32_t *mag);
+
+/**
+ * @brief   Runs one filter step
+ * @param   filter  State
+ * @param   gyro    Angular rate in rad/s, sensor frame
+ * @param   accel   Acceleration in any unit, NULL when not available
+ * @param   mag     Magnetic field in any unit, NULL when not available;
+ *                  only used together with accel
+ * @param   dt      Time since the previous step in seconds
+ * @retval  None
+ */
+void AHRS_Filter_Update(AHRS_Filter_t *filter, const float32_t gyro[3],
+                        const float32_t *accel, const float32_t *mag, float32_t dt);
+
+/**
+ * @brief   Converts the orientation to roll, pitch and yaw
+ * @param   filter  State
+ * @param   euler   Destination
+ * @retval  None
+ */
+void AHRS_Filter_GetEuler(const AHRS_Filter_t *filter, AHRS_Euler_t *euler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __AHRS_FILTER_H__ */
@@ -0,0 +1,316 @@
+/**
+  ******************************************************************************
+  * @file    boot_init.c
+  * @brief   Deferred peripheral initialization implementation
+  * @details This file provides the bring-up table. An entry is claimed
+  *          with interrupts masked, so a first use and the background
+  *          bring-up never run the same init twice; a caller that finds the
+  *          entry being brought up by the other waits for it.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "boot_init.h"
+#include "boot_time.h"
+#include "cmsis_os.h"
+#include "stack_monitor.h"
+#include "../ACQ/acq.h"
+#include "../CRC/crc.h"
+#include "../DMA2D/dma2d.h"
+#include "../DSP/dsp_chain.h"
+#include "../FMC/fmc.h"
+#include "../I2C/i2c.h"
+#include "../I2C/i2c_bus.h"
+#include "../L3GD20/l3gd20.h"
+#include "../LTDC/ltdc.h"
+#include "../SPI/spi.h"
+#include "../SPI/spi_bus.h"
+#include "../STMPE811/stmpe811.h"
+#include "../TIM/tim.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define BOOTINIT_DEP(id)          (1UL << (id))
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Table entry
+ */
+typedef struct
+{
+  const char *name;
+  HAL_StatusTypeDef (*init)(void);
+  uint32_t deps;                /*!< BOOTINIT_DEP() of the entries needed first */
+} BOOTINIT_Entry_t;
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef BOOTINIT_Tim(void);
+static HAL_StatusTypeDef BOOTINIT_Acq(void);
+static HAL_StatusTypeDef BOOTINIT_Spi(void);
+static HAL_StatusTypeDef BOOTINIT_Gyro(void);
+static HAL_StatusTypeDef BOOTINIT_I2c(void);
+static HAL_StatusTypeDef BOOTINIT_Touch(void);
+static HAL_StatusTypeDef BOOTINIT_Crc(void);
+static HAL_StatusTypeDef BOOTINIT_Fmc(void);
+static HAL_StatusTypeDef BOOTINIT_Dma2d(void);
+static HAL_StatusTypeDef BOOTINIT_Ltdc(void);
+static HAL_StatusTypeDef BOOTINIT_Run(BOOTINIT_Id_t id, uint8_t onDemand);
+static void BOOTINIT_Task(void *argument);
+
+/* Private variables ---------------------------------------------------------*/
+static const BOOTINIT_Entry_t table[BOOTINIT_COUNT] = {
+  [BOOTINIT_TIM]   = { "TIM",      BOOTINIT_Tim,   0U },
+  [BOOTINIT_ACQ]   = { "ACQ",      BOOTINIT_Acq,   BOOTINIT_DEP(BOOTINIT_TIM) },
+  [BOOTINIT_SPI]   = { "SPI",      BOOTINIT_Spi,   0U },
+  [BOOTINIT_GYRO]  = { "L3GD20",   BOOTINIT_Gyro,  BOOTINIT_DEP(BOOTINIT_SPI) },
+  [BOOTINIT_I2C]   = { "I2C",      BOOTINIT_I2c,   0U },
+  [BOOTINIT_TOUCH] = { "STMPE811", BOOTINIT_Touch, BOOTINIT_DEP(BOOTINIT_I2C) },
+  [BOOTINIT_CRC]   = { "CRC",      BOOTINIT_Crc,   0U },
+  [BOOTINIT_FMC]   = { "FMC",      BOOTINIT_Fmc,   0U },
+  [BOOTINIT_DMA2D] = { "DMA2D",    BOOTINIT_Dma2d, 0U },
+  /* The layer scans the SDRAM framebuffer */
+  [BOOTINIT_LTDC]  = { "LTDC",     BOOTINIT_Ltdc,  BOOTINIT_DEP(BOOTINIT_FMC) },
+};
+
+static volatile BOOTINIT_State_t state[BOOTINIT_COUNT];
+static uint8_t onDemand[BOOTINIT_COUNT];
+static uint32_t startUs[BOOTINIT_COUNT];
+static uint32_t durationUs[BOOTINIT_COUNT];
+static uint8_t finished;
+
+static osThreadId_t bootInitTaskHandle;
+static const osThreadAttr_t bootInitTask_attributes = {
+  .name = "bootInit",
+  .stack_size = BOOTINIT_TASK_STACK_SIZE,
+  .priority = (osPriority_t) osPriorityLow,
+};
+
+/**
+  * @brief  Bring up an entry and its dependencies
+  * @param  id  Entry
+  * @retval HAL status
+  */
+HAL_StatusTypeDef BOOTINIT_Require(BOOTINIT_Id_t id)
+{
+  if (id >= BOOTINIT_COUNT)
+  {
+    return HAL_ERROR;
+  }
+  if (state[id] == BOOTINIT_STATE_UP)
+  {
+    return HAL_OK;
+  }
+  if (__get_IPSR() != 0U)
+  {
+    return (state[id] == BOOTINIT_STATE_FAILED) ? HAL_ERROR : HAL_BUSY;
+  }
+  return BOOTINIT_Run(id, 1U);
+}
+
+/**
+  * @brief  Bring up the next entry still down
+  * @param  None
+  * @retval 1 while entries remain
+  */
+uint8_t BOOTINIT_Poll(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < BOOTINIT_COUNT; i++)
+  {
+    if (state[i] == BOOTINIT_STATE_DOWN)
+    {
+      (void)BOOTINIT_Run((BOOTINIT_Id_t)i, 0U);
+      return 1U;
+    }
+  }
+
+  if (!finished)
+  {
+    finished = 1U;
+    BOOTTIME_Mark("deferred init");
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Create the background bring-up task
+  * @param  None
+  * @retval None
+  */
+void BOOTINIT_StartTask(void)
+{
+  bootInitTaskHandle = osThreadNew(BOOTINIT_Task, NULL, &bootInitTask_attributes);
+  if (bootInitTaskHandle == NULL)
+  {
+    Error_Handler();
+  }
+  STACKMON_Watch(bootInitTaskHandle, bootInitTask_attributes.stack_size);
+}
+
+/**
+  * @brief  Read an entry report
+  * @param  id    Entry
+  * @param  info  Destination
+  * @retval None
+  */
+void BOOTINIT_GetInfo(BOOTINIT_Id_t id, BOOTINIT_Info_t *info)
+{
+  info->name = table[id].name;
+  info->state = state[id];
+  info->onDemand = onDemand[id];
+  info->startUs = startUs[id];
+  info->durationUs = durationUs[id];
+}
+
+/**
+  * @brief  Run an entry once
+  * @param  id        Entry
+  * @param  demand    1 for a first use
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef BOOTINIT_Run(BOOTINIT_Id_t id, uint8_t demand)
+{
+  HAL_StatusTypeDef status;
+  uint64_t start;
+  uint32_t primask;
+  uint32_t i;
+  uint8_t claimed = 0U;
+
+  for (i = 0; i < BOOTINIT_COUNT; i++)
+  {
+    if (((table[id].deps & BOOTINIT_DEP(i)) != 0U) && (BOOTINIT_Run((BOOTINIT_Id_t)i, demand) != HAL_OK))
+    {
+      /* The dependency is down for good: so is this entry */
+      state[id] = BOOTINIT_STATE_FAILED;
+      return HAL_ERROR;
+    }
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (state[id] == BOOTINIT_STATE_DOWN)
+  {
+    state[id] = BOOTINIT_STATE_RUNNING;
+    claimed = 1U;
+  }
+  __set_PRIMASK(primask);
+
+  if (claimed)
+  {
+    start = BOOTTIME_NowUs();
+    status = table[id].init();
+    startUs[id] = (uint32_t)start;
+    durationUs[id] = (uint32_t)(BOOTTIME_NowUs() - start);
+    onDemand[id] = demand;
+    state[id] = (status == HAL_OK) ? BOOTINIT_STATE_UP : BOOTINIT_STATE_FAILED;
+  }
+
+  /* Claimed by the other context: only possible with the scheduler running */
+  while (state[id] == BOOTINIT_STATE_RUNNING)
+  {
+    osDelay(1U);
+  }
+
+  return (state[id] == BOOTINIT_STATE_UP) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Background bring-up task
+  * @param  argument  Unused
+  * @retval None
+  */
+static void BOOTINIT_Task(void *argument)
+{
+  (void)argument;
+
+  while (BOOTINIT_Poll() != 0U)
+  {
+  }
+  osThreadExit();
+}
+
+/**
+  * @brief  Entry init functions
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef BOOTINIT_Tim(void)
+{
+  TIM_Init();
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Acq(void)
+{
+  ACQ_Init();
+  if (DSPCHAIN_StartSensorChains() != HAL_OK)
+  {
+    printf("Sensor filter chains rejected\r\n");
+  }
+  if (ACQ_Start(TIM_SAMPLE_PERIOD_DEFAULT_US) != HAL_OK)
+  {
+    printf("Acquisition scheduler failed to start\r\n");
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Spi(void)
+{
+  SPI_Init();
+  SPIBUS_Init();
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Gyro(void)
+{
+  if (L3GD20_Init(L3GD20_FS_2000DPS) != HAL_OK)
+  {
+    printf("L3GD20 gyroscope not found\r\n");
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_I2c(void)
+{
+  I2C_Init();
+  I2CBUS_Init();
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Touch(void)
+{
+  if (STMPE811_Init() != HAL_OK)
+  {
+    printf("STMPE811 touch controller not found\r\n");
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Crc(void)
+{
+  CRC_Init();
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Fmc(void)
+{
+  FMC_Init();
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Dma2d(void)
+{
+  DMA2D_Init();
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef BOOTINIT_Ltdc(void)
+{
+  LTDC_Init();
+  return HAL_OK;
+}
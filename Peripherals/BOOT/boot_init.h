@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    boot_init.h
+  * @brief   Deferred peripheral initialization interface
+  * @details This file contains the table driven bring-up of the peripherals
+  *          the console does not need. main() only starts what the console
+  *          depends on; every other peripheral comes up either
+  *          - on first use: BOOTINIT_Require() brings up the entry and its
+  *            dependencies before returning, or
+  *          - in the background: BOOTINIT_Poll() brings up the next entry
+  *            still down, one per call, from a low priority task or from the
+  *            console loop, so the console answers between entries.
+  *          Each entry is brought up once, by whichever comes first.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __BOOT_INIT_H__
+#define __BOOT_INIT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define BOOTINIT_TASK_STACK_SIZE  (256 * 4)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Table entries, in background bring-up order
+ */
+typedef enum
+{
+  BOOTINIT_TIM = 0,             /*!< TIM1, the sample clock */
+  BOOTINIT_ACQ,                 /*!< ADC scheduler, filter chains, started */
+  BOOTINIT_SPI,                 /*!< SPI5 and its bus queue */
+  BOOTINIT_GYRO,                /*!< L3GD20 */
+  BOOTINIT_I2C,                 /*!< I2C3 and its bus queue */
+  BOOTINIT_TOUCH,               /*!< STMPE811 */
+  BOOTINIT_CRC,
+  BOOTINIT_FMC,                 /*!< SDRAM */
+  BOOTINIT_DMA2D,
+  BOOTINIT_LTDC,
+  BOOTINIT_COUNT
+} BOOTINIT_Id_t;
+
+/**
+ * @brief   Entry state
+ */
+typedef enum
+{
+  BOOTINIT_STATE_DOWN = 0,
+  BOOTINIT_STATE_RUNNING,
+  BOOTINIT_STATE_UP,
+  BOOTINIT_STATE_FAILED         /*!< Init reported an error, not retried */
+} BOOTINIT_State_t;
+
+/**
+ * @brief   Entry report
+ */
+typedef struct
+{
+  const char *name;
+  BOOTINIT_State_t state;
+  uint8_t onDemand;             /*!< Brought up by BOOTINIT_Require() */
+  uint32_t startUs;             /*!< Since reset */
+  uint32_t durationUs;
+} BOOTINIT_Info_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Brings up an entry and its dependencies
+ * @details In interrupt context nothing is started; the call only tells
+ *          whether the entry is up.
+ * @note    May block for the duration of the init functions
+ * @param   id  Entry
+ * @retval  HAL_OK when up, HAL_BUSY from an interrupt while not up,
+ *          HAL_ERROR if the init failed
+ */
+HAL_StatusTypeDef BOOTINIT_Require(BOOTINIT_Id_t id);
+
+/**
+ * @brief   Brings up the next entry still down
+ * @note    Thread context
+ * @param   None
+ * @retval  1 while entries remain
+ */
+uint8_t BOOTINIT_Poll(void);
+
+/**
+ * @brief   Creates the background bring-up task
+ * @note    Call from RTOS_Init(); the task exits when the table is done
+ * @param   None
+ * @retval  None
+ */
+void BOOTINIT_StartTask(void);
+
+/**
+ * @brief   Reads an entry report
+ * @param   id    Entry
+ * @param   info  Destination
+ * @retval  None
+ */
+void BOOTINIT_GetInfo(BOOTINIT_Id_t id, BOOTINIT_Info_t *info);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_INIT_H__ */
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    boot_time.c
+  * @brief   Boot stage timestamps implementation
+  * @details This file provides the boot profile. The reset to SystemInit()
+  *          path is a handful of instructions and is counted as zero.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "boot_time.h"
+#include "../SYS/mem_sections.h"
+#include "../TIM/timebase.h"
+#include <stdio.h>
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Profile state, set by BOOTTIME_Start() before the C runtime
+ */
+static BOOTTIME_Mark_t marks[BOOTTIME_MAX_MARKS] NOINIT;
+static uint32_t markCount NOINIT;
+static uint32_t lastCycles NOINIT;
+static uint32_t lastHclkHz NOINIT;
+static uint64_t lastUs NOINIT;
+static uint64_t timebaseOffsetUs NOINIT;
+static uint32_t timebaseAttached NOINIT;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t BOOTTIME_HclkHz(void);
+
+/**
+  * @brief  Start the profile
+  * @param  None
+  * @retval None
+  */
+void BOOTTIME_Start(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  markCount = 0U;
+  lastCycles = 0U;
+  lastHclkHz = BOOTTIME_HclkHz();
+  lastUs = 0U;
+  timebaseOffsetUs = 0U;
+  timebaseAttached = 0U;
+}
+
+/**
+  * @brief  Close a boot stage
+  * @param  stage  Stage name
+  * @retval None
+  */
+void BOOTTIME_Mark(const char *stage)
+{
+  const uint64_t now = BOOTTIME_NowUs();
+
+  if (markCount < BOOTTIME_MAX_MARKS)
+  {
+    marks[markCount].stage = stage;
+    marks[markCount].atUs = (uint32_t)now;
+    marks[markCount].durationUs = (markCount == 0U) ? (uint32_t)now
+                                : (uint32_t)now - marks[markCount - 1U].atUs;
+    markCount++;
+  }
+
+  /* The next stage runs at the clock in effect now */
+  lastCycles = DWT->CYCCNT;
+  lastHclkHz = BOOTTIME_HclkHz();
+  lastUs = now;
+}
+
+/**
+  * @brief  Move the clock to TIMEBASE
+  * @param  None
+  * @retval None
+  */
+void BOOTTIME_AttachTimebase(void)
+{
+  const uint64_t now = BOOTTIME_NowUs();
+
+  timebaseOffsetUs = now - TIMEBASE_GetUs();
+  timebaseAttached = 1U;
+}
+
+/**
+  * @brief  Time since reset
+  * @param  None
+  * @retval Microseconds
+  */
+uint64_t BOOTTIME_NowUs(void)
+{
+  if (timebaseAttached)
+  {
+    return timebaseOffsetUs + TIMEBASE_GetUs();
+  }
+  return lastUs + (((uint64_t)(DWT->CYCCNT - lastCycles) * 1000000U) / lastHclkHz);
+}
+
+/**
+  * @brief  Number of marks
+  * @param  None
+  * @retval Marks recorded
+  */
+uint32_t BOOTTIME_GetCount(void)
+{
+  return markCount;
+}
+
+/**
+  * @brief  Read a mark
+  * @param  index  Mark index
+  * @param  mark   Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef BOOTTIME_GetMark(uint32_t index, BOOTTIME_Mark_t *mark)
+{
+  if (index >= markCount)
+  {
+    return HAL_ERROR;
+  }
+  *mark = marks[index];
+  return HAL_OK;
+}
+
+/**
+  * @brief  Print the boot stages
+  * @param  None
+  * @retval None
+  */
+void BOOTTIME_Report(void)
+{
+  uint32_t i;
+
+  printf("\r\nBoot stage               Took us   At us\r\n");
+  for (i = 0; i < markCount; i++)
+  {
+    printf("%-22s %9lu %7lu\r\n", marks[i].stage,
+           (unsigned long)marks[i].durationUs, (unsigned long)marks[i].atUs);
+  }
+}
+
+/**
+  * @brief  Current HCLK from the RCC registers
+  * @details SystemCoreClock is not usable before the C runtime has run
+  * @param  None
+  * @retval HCLK in Hz
+  */
+static uint32_t BOOTTIME_HclkHz(void)
+{
+  return HAL_RCC_GetSysClockFreq() >> AHBPrescTable[(RCC->CFGR & RCC_CFGR_HPRE) >> RCC_CFGR_HPRE_Pos];
+}
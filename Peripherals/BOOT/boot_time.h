@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    boot_time.h
+  * @brief   Boot stage timestamps interface
+  * @details This file contains the function prototypes of the boot profile.
+  *          BOOTTIME_Start() runs first thing in SystemInit() and starts the
+  *          DWT cycle counter; every BOOTTIME_Mark() then closes a stage.
+  *          Cycles are converted with the HCLK read from RCC at the start of
+  *          each stage, so the stages before and after the PLL switch are
+  *          both right. Once TIM2 runs, BOOTTIME_AttachTimebase() moves the
+  *          clock over to TIMEBASE, which does not wrap.
+  *
+  *          The records live in no-init RAM: the first ones are taken before
+  *          the startup code copies .data and clears .bss.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __BOOT_TIME_H__
+#define __BOOT_TIME_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define BOOTTIME_MAX_MARKS        24U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Closed boot stage
+ */
+typedef struct
+{
+  const char *stage;            /*!< Stage name, a string literal */
+  uint32_t atUs;                /*!< End of the stage, since reset */
+  uint32_t durationUs;          /*!< Since the previous mark */
+} BOOTTIME_Mark_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Starts the profile at reset
+ * @note    Called from SystemInit(), before .data and .bss exist
+ * @param   None
+ * @retval  None
+ */
+void BOOTTIME_Start(void);
+
+/**
+ * @brief   Closes a boot stage
+ * @note    Before main() only from SystemInit(); never from interrupts
+ * @param   stage  Stage name, a string literal
+ * @retval  None
+ */
+void BOOTTIME_Mark(const char *stage);
+
+/**
+ * @brief   Switches the clock over to TIMEBASE
+ * @note    Call right after TIMEBASE_Init()
+ * @param   None
+ * @retval  None
+ */
+void BOOTTIME_AttachTimebase(void);
+
+/**
+ * @brief   Time since reset
+ * @param   None
+ * @retval  Microseconds
+ */
+uint64_t BOOTTIME_NowUs(void);
+
+/**
+ * @brief   Number of marks
+ * @param   None
+ * @retval  Marks recorded
+ */
+uint32_t BOOTTIME_GetCount(void);
+
+/**
+ * @brief   Reads a mark
+ * @param   index  Mark index, in order
+ * @param   mark   Destination
+ * @retval  HAL_OK, HAL_ERROR past the last mark
+ */
+HAL_StatusTypeDef BOOTTIME_GetMark(uint32_t index, BOOTTIME_Mark_t *mark);
+
+/**
+ * @brief   Prints the boot stages
+ * @param   None
+ * @retval  None
+ */
+void BOOTTIME_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_TIME_H__ */
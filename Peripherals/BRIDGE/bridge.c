@@ -0,0 +1,659 @@
+/**
+  ******************************************************************************
+  * @file    bridge.c
+  * @brief   USART1 to USB CDC bridge implementation
+  * @details This file provides the bridge task. The interrupt hooks and the
+  *          CDC listener only move counters and wake the task; the task
+  *          starts every transfer, so each buffer has a single owner at any
+  *          time: the UART DMA, the ring waiting for USB, the CDC class, or
+  *          the UART TX DMA.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "bridge.h"
+#include "cmsis_os.h"
+#include "stack_monitor.h"
+#include "uart_dma.h"
+#include "uart_example.h"
+#include "../CDC/cdc_stream.h"
+#include "../STDIO/stdio_retarget.h"
+#include "../TIM/timebase.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define BRIDGE_FLAG_START         0x01U
+#define BRIDGE_FLAG_STOP          0x02U
+#define BRIDGE_FLAG_UART_RX       0x04U
+#define BRIDGE_FLAG_UART_TX       0x08U
+#define BRIDGE_FLAG_USB           0x10U
+#define BRIDGE_FLAGS_ALL          0x1FU
+
+#define BRIDGE_XON                0x11U
+#define BRIDGE_XOFF               0x13U
+
+#define BRIDGE_UART_TX_IDLE       0U
+#define BRIDGE_UART_TX_DATA       1U
+#define BRIDGE_UART_TX_CONTROL    2U
+
+/* Private variables ---------------------------------------------------------*/
+static osThreadId_t bridgeTaskHandle;
+static const osThreadAttr_t bridgeTask_attributes = {
+  .name = "bridgeTask",
+  .stack_size = BRIDGE_TASK_STACK_SIZE,
+  .priority = (osPriority_t) osPriorityAboveNormal,
+};
+
+/**
+ * @brief   UART RX DMA ring, in SRAM for the DMA
+ */
+static uint8_t uartRing[BRIDGE_UART_RING_SIZE] __attribute__((aligned(4)));
+
+static volatile uint8_t active;
+static volatile uint32_t ringHead;        /* Bytes written by the DMA, free running */
+static uint32_t ringTail;                 /* Bytes sent to USB, free running */
+static uint32_t ringPos;                  /* DMA write position, ringHead modulo the ring */
+static volatile uint8_t ringOverrun;
+static volatile uint64_t rxEventUs;       /* Last reception event */
+static volatile uint64_t rxQuietUs;       /* Silence before the last event */
+static volatile uint32_t rxEventBytes;    /* Bytes of the last event */
+
+static volatile uint8_t usbTxBusy;
+static volatile uint8_t usbTxDone;
+static uint32_t usbTxLen;
+static uint64_t usbTxDataUs;
+
+static volatile uint8_t uartTxState;
+static volatile uint8_t uartTxDone;
+static uint32_t uartTxLen;
+static uint64_t uartTxDataUs;
+static uint8_t controlByte;
+static uint8_t controlPending;
+static uint8_t xoffSent;
+static uint8_t peerPaused;
+
+static uint32_t requestedBaud;
+static BRIDGE_Flow_t requestedFlow;
+static uint32_t savedBaud;
+static STDIO_Sink_t savedSink;
+static uint64_t startUs;
+static uint64_t latencySum[2];
+
+static BRIDGE_Stats_t stats;
+
+/* External variables --------------------------------------------------------*/
+extern UART_Handle_t uartHandle;
+
+/* Private function prototypes -----------------------------------------------*/
+static void BRIDGE_Task(void *argument);
+static void BRIDGE_Enter(void);
+static void BRIDGE_Leave(void);
+static uint8_t BRIDGE_Pump(void);
+static uint8_t BRIDGE_ToUsb(void);
+static void BRIDGE_ToUart(void);
+static void BRIDGE_Latency(BRIDGE_DirStats_t *dir, uint64_t *sum, uint64_t sinceUs);
+static void BRIDGE_UsbListener(uint32_t events, void *context);
+static void BRIDGE_UartRxEvent(UART_HandleTypeDef *huart, uint16_t size);
+
+/**
+  * @brief  Bridge initialization
+  * @param  None
+  * @retval None
+  */
+void BRIDGE_Init(void)
+{
+  bridgeTaskHandle = osThreadNew(BRIDGE_Task, NULL, &bridgeTask_attributes);
+  if (bridgeTaskHandle == NULL)
+  {
+    Error_Handler();
+  }
+  STACKMON_Watch(bridgeTaskHandle, bridgeTask_attributes.stack_size);
+}
+
+/**
+  * @brief  Request the bridge
+  * @param  baudRate  USART1 baud rate, 0 keeps it
+  * @param  flow      Flow control
+  * @retval HAL status
+  */
+HAL_StatusTypeDef BRIDGE_Start(uint32_t baudRate, BRIDGE_Flow_t flow)
+{
+  if (active)
+  {
+    return HAL_BUSY;
+  }
+  if (!CDCSTREAM_IsConnected())
+  {
+    return HAL_ERROR;
+  }
+
+  requestedBaud = baudRate;
+  requestedFlow = flow;
+  (void)osThreadFlagsSet(bridgeTaskHandle, BRIDGE_FLAG_START);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Request the end of the bridge
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef BRIDGE_Stop(void)
+{
+  if (!active)
+  {
+    return HAL_ERROR;
+  }
+  (void)osThreadFlagsSet(bridgeTaskHandle, BRIDGE_FLAG_STOP);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Bridge running
+  * @param  None
+  * @retval 1 if running
+  */
+uint8_t BRIDGE_IsActive(void)
+{
+  return active;
+}
+
+/**
+  * @brief  Bridge statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void BRIDGE_GetStats(BRIDGE_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint64_t elapsedUs;
+
+  __disable_irq();
+  *dest = stats;
+  dest->active = active;
+  if (active)
+  {
+    dest->elapsedMs = (uint32_t)TIMEBASE_UsToMs(TIMEBASE_GetUs() - startUs);
+  }
+  __set_PRIMASK(primask);
+
+  elapsedUs = (uint64_t)dest->elapsedMs * 1000U;
+  if (elapsedUs != 0U)
+  {
+    dest->toUsb.KBps = (uint32_t)(((uint64_t)dest->toUsb.bytes * 1000U) / elapsedUs);
+    dest->toUart.KBps = (uint32_t)(((uint64_t)dest->toUart.bytes * 1000U) / elapsedUs);
+  }
+}
+
+/**
+  * @brief  UART reception event, registered with the continuous reception
+  * @note   Runs in the USART1 or DMA2 Stream5 interrupt (UART_IRQ_PRIORITY)
+  * @param  huart  UART handle
+  * @param  size   DMA write position
+  * @retval None
+  */
+static void BRIDGE_UartRxEvent(UART_HandleTypeDef *huart, uint16_t size)
+{
+  uint32_t bytes;
+  uint64_t now;
+
+  if (!active || (huart != uartHandle.huart))
+  {
+    return;
+  }
+
+  /* Half, full and idle events: the position only moves forward around the ring */
+  bytes = (size >= ringPos) ? (size - ringPos) : ((size + BRIDGE_UART_RING_SIZE) - ringPos);
+  ringPos = (size >= BRIDGE_UART_RING_SIZE) ? 0U : size;
+  if (bytes == 0U)
+  {
+    return;
+  }
+
+  now = TIMEBASE_GetUs();
+  rxQuietUs = now - rxEventUs;
+  rxEventUs = now;
+  rxEventBytes = bytes;
+  ringHead += bytes;
+  if ((ringHead - ringTail) > BRIDGE_UART_RING_SIZE)
+  {
+    ringOverrun = 1U;
+  }
+  (void)osThreadFlagsSet(bridgeTaskHandle, BRIDGE_FLAG_UART_RX);
+}
+
+/**
+  * @brief  UART transmit complete hook
+  * @param  huart  UART handle
+  * @retval None
+  */
+void BRIDGE_UartTxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (active && (huart == uartHandle.huart) && (uartTxState != BRIDGE_UART_TX_IDLE))
+  {
+    uartTxDone = 1U;
+    (void)osThreadFlagsSet(bridgeTaskHandle, BRIDGE_FLAG_UART_TX);
+  }
+}
+
+/**
+  * @brief  UART error hook
+  * @details Restarts the reception at the start of the ring; what was
+  *          waiting in the ring is dropped as the DMA position jumped.
+  * @param  huart  UART handle
+  * @retval 1 if handled
+  */
+uint8_t BRIDGE_UartErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (!active || (huart != uartHandle.huart))
+  {
+    return 0U;
+  }
+
+  stats.uartErrors++;
+  __HAL_UART_CLEAR_OREFLAG(huart);
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    ringHead += (BRIDGE_UART_RING_SIZE - ringPos) % BRIDGE_UART_RING_SIZE;
+    ringPos = 0U;
+    ringOverrun = 1U;
+    (void)HAL_UARTEx_ReceiveToIdle_DMA(huart, uartRing, BRIDGE_UART_RING_SIZE);
+  }
+  if ((huart->gState == HAL_UART_STATE_READY) && (uartTxState != BRIDGE_UART_TX_IDLE))
+  {
+    /* The transmission was aborted with the error */
+    uartTxDone = 1U;
+  }
+  (void)osThreadFlagsSet(bridgeTaskHandle, BRIDGE_FLAG_UART_RX | BRIDGE_FLAG_UART_TX);
+  return 1U;
+}
+
+/**
+  * @brief  Bridge task
+  * @param  argument  Unused
+  * @retval None
+  */
+static void BRIDGE_Task(void *argument)
+{
+  uint32_t flags;
+
+  (void)argument;
+
+  for (;;)
+  {
+    flags = osThreadFlagsWait(BRIDGE_FLAGS_ALL, osFlagsWaitAny, osWaitForever);
+    if ((flags & osFlagsError) != 0U)
+    {
+      continue;
+    }
+
+    if (((flags & BRIDGE_FLAG_START) != 0U) && !active)
+    {
+      BRIDGE_Enter();
+    }
+    if (active && (((flags & BRIDGE_FLAG_STOP) != 0U) || (BRIDGE_Pump() != 0U)))
+    {
+      BRIDGE_Leave();
+    }
+  }
+}
+
+/**
+  * @brief  Take over USART1 and the CDC stream
+  * @param  None
+  * @retval None
+  */
+static void BRIDGE_Enter(void)
+{
+  UART_HandleTypeDef *huart = uartHandle.huart;
+  uint32_t waited = 0U;
+
+  if (!CDCSTREAM_IsConnected())
+  {
+    return;
+  }
+
+  /* Let the console reply go out first */
+  while ((huart->gState != HAL_UART_STATE_READY) && (waited < 100U))
+  {
+    osDelay(1U);
+    waited++;
+  }
+
+  /* stdout must not write into the bridged streams */
+  savedSink = STDIO_GetSink();
+  STDIO_SetSink(STDIO_SINK_SWO);
+  (void)CDCSTREAM_Flush(100U);
+
+  savedBaud = huart->Init.BaudRate;
+  if ((requestedBaud != 0U) && (requestedBaud != savedBaud))
+  {
+    huart->Init.BaudRate = requestedBaud;
+    (void)HAL_UART_Init(huart);
+  }
+
+  memset(&stats, 0, sizeof(stats));
+  stats.sessions++;
+  stats.flow = (uint8_t)requestedFlow;
+  stats.baudRate = huart->Init.BaudRate;
+  latencySum[0] = 0U;
+  latencySum[1] = 0U;
+  ringHead = 0U;
+  ringTail = 0U;
+  ringPos = 0U;
+  ringOverrun = 0U;
+  rxEventUs = TIMEBASE_GetUs();
+  rxEventBytes = 0U;
+  usbTxBusy = 0U;
+  usbTxDone = 0U;
+  uartTxState = BRIDGE_UART_TX_IDLE;
+  uartTxDone = 0U;
+  controlPending = 0U;
+  xoffSent = 0U;
+  peerPaused = 0U;
+  startUs = rxEventUs;
+
+  CDCSTREAM_SetListener(BRIDGE_UsbListener, NULL);
+  active = 1U;
+  if (UART_DMA_ReceiveToIdle(&uartHandle, uartRing, BRIDGE_UART_RING_SIZE, BRIDGE_UartRxEvent) != UART_OK)
+  {
+    BRIDGE_Leave();
+    return;
+  }
+  (void)osThreadFlagsSet(bridgeTaskHandle, BRIDGE_FLAG_USB);
+}
+
+/**
+  * @brief  Give USART1 and the CDC stream back
+  * @param  None
+  * @retval None
+  */
+static void BRIDGE_Leave(void)
+{
+  UART_HandleTypeDef *huart = uartHandle.huart;
+  uint32_t waited = 0U;
+
+  active = 0U;
+  (void)HAL_UART_Abort(huart);
+  if (uartTxState == BRIDGE_UART_TX_DATA)
+  {
+    /* Hand the whole borrowed block back, the rest is not sent */
+    CDCSTREAM_ReturnRx(uartTxLen);
+  }
+  uartTxState = BRIDGE_UART_TX_IDLE;
+
+  /* The ring is read by the class until the segment is sent */
+  while (usbTxBusy && !usbTxDone && CDCSTREAM_IsConnected() && (waited < 100U))
+  {
+    osDelay(1U);
+    waited++;
+  }
+  CDCSTREAM_SetListener(NULL, NULL);
+  usbTxBusy = 0U;
+
+  stats.elapsedMs = (uint32_t)TIMEBASE_UsToMs(TIMEBASE_GetUs() - startUs);
+
+  if (huart->Init.BaudRate != savedBaud)
+  {
+    huart->Init.BaudRate = savedBaud;
+    (void)HAL_UART_Init(huart);
+  }
+  STDIO_SetSink(savedSink);
+
+  /* Back to the console */
+  if (uartHandle.config.mode == UART_MODE_DMA) {
+    (void)UART_DMA_Receive(&uartHandle, uartHandle.rxBuffer, uartHandle.rxSize, 0U);
+  } else if (uartHandle.config.mode == UART_MODE_INTERRUPT) {
+    (void)HAL_UART_Receive_IT(huart, uartHandle.rxBuffer, 1U);
+  }
+  (void)UART_Example_SendMessage(ANSI_COLOR_GREEN "\r\nBridge stopped\r\n" ANSI_COLOR_RESET "> ");
+}
+
+/**
+  * @brief  Complete the finished transfers and start the next ones
+  * @param  None
+  * @retval 1 if the bridge must stop
+  */
+static uint8_t BRIDGE_Pump(void)
+{
+  uint8_t stop;
+
+  if (!CDCSTREAM_IsConnected())
+  {
+    return 1U;
+  }
+
+  stop = BRIDGE_ToUsb();
+  BRIDGE_ToUart();
+  return stop;
+}
+
+/**
+  * @brief  UART to USB direction
+  * @param  None
+  * @retval 1 on the escape sequence
+  */
+static uint8_t BRIDGE_ToUsb(void)
+{
+  const uint32_t head = ringHead;
+  uint32_t pending;
+  uint32_t offset;
+  uint32_t len;
+  uint32_t i;
+  uint8_t stop = 0U;
+  HAL_StatusTypeDef status;
+
+  if (usbTxDone)
+  {
+    usbTxDone = 0U;
+    usbTxBusy = 0U;
+    ringTail += usbTxLen;
+    stats.toUsb.bytes += usbTxLen;
+    stats.toUsb.transfers++;
+    BRIDGE_Latency(&stats.toUsb, &latencySum[0], usbTxDataUs);
+  }
+
+  if (usbTxBusy)
+  {
+    return 0U;
+  }
+
+  if (ringOverrun)
+  {
+    /* The DMA overwrote bytes before they were sent: resynchronize */
+    ringOverrun = 0U;
+    ringTail = head;
+    stats.toUsb.overruns++;
+  }
+
+  pending = head - ringTail;
+
+  /* Escape: "+++" alone after a quiet line */
+  if ((rxEventBytes == 3U) && (pending >= 3U) &&
+      (rxQuietUs >= TIMEBASE_MsToUs(BRIDGE_ESCAPE_GUARD_MS)) &&
+      (uartRing[(head - 1U) % BRIDGE_UART_RING_SIZE] == '+') &&
+      (uartRing[(head - 2U) % BRIDGE_UART_RING_SIZE] == '+') &&
+      (uartRing[(head - 3U) % BRIDGE_UART_RING_SIZE] == '+'))
+  {
+    rxEventBytes = 0U;
+    stop = 1U;
+  }
+
+  if (stats.flow == BRIDGE_FLOW_XONXOFF)
+  {
+    if ((pending >= BRIDGE_XOFF_LEVEL) && !xoffSent)
+    {
+      controlByte = BRIDGE_XOFF;
+      controlPending = 1U;
+    }
+    else if ((pending <= BRIDGE_XON_LEVEL) && xoffSent)
+    {
+      controlByte = BRIDGE_XON;
+      controlPending = 1U;
+    }
+  }
+
+  if ((pending == 0U) || stop)
+  {
+    return stop;
+  }
+
+  offset = ringTail % BRIDGE_UART_RING_SIZE;
+  len = BRIDGE_UART_RING_SIZE - offset;
+  if (len > pending)
+  {
+    len = pending;
+  }
+  if (len > BRIDGE_USB_CHUNK)
+  {
+    len = BRIDGE_USB_CHUNK;
+  }
+
+  if (stats.flow == BRIDGE_FLOW_XONXOFF)
+  {
+    /* The peer's own flow control, read in place */
+    for (i = 0; i < len; i++)
+    {
+      if (uartRing[offset + i] == BRIDGE_XOFF)
+      {
+        peerPaused = 1U;
+        stats.peerPauses++;
+      }
+      else if (uartRing[offset + i] == BRIDGE_XON)
+      {
+        peerPaused = 0U;
+      }
+    }
+  }
+
+  usbTxLen = len;
+  usbTxDataUs = rxEventUs;
+  usbTxBusy = 1U;
+  status = CDCSTREAM_SendBuffer(&uartRing[offset], len);
+  if (status != HAL_OK)
+  {
+    /* OUT pipe busy with the stream ring: retried on its completion */
+    usbTxBusy = 0U;
+    stats.toUsb.stalls++;
+  }
+  return stop;
+}
+
+/**
+  * @brief  USB to UART direction
+  * @param  None
+  * @retval None
+  */
+static void BRIDGE_ToUart(void)
+{
+  UART_HandleTypeDef *huart = uartHandle.huart;
+  const uint8_t *data;
+  uint64_t receivedUs;
+  uint32_t len;
+
+  if (uartTxDone)
+  {
+    uartTxDone = 0U;
+    if (uartTxState == BRIDGE_UART_TX_DATA)
+    {
+      CDCSTREAM_ReturnRx(uartTxLen);
+      stats.toUart.bytes += uartTxLen;
+      stats.toUart.transfers++;
+      BRIDGE_Latency(&stats.toUart, &latencySum[1], uartTxDataUs);
+    }
+    else if (uartTxState == BRIDGE_UART_TX_CONTROL)
+    {
+      xoffSent = (controlByte == BRIDGE_XOFF) ? 1U : 0U;
+      stats.xoffSent += xoffSent;
+    }
+    uartTxState = BRIDGE_UART_TX_IDLE;
+  }
+
+  if (uartTxState != BRIDGE_UART_TX_IDLE)
+  {
+    return;
+  }
+
+  if (controlPending)
+  {
+    controlPending = 0U;
+    uartTxState = BRIDGE_UART_TX_CONTROL;
+    if (HAL_UART_Transmit_DMA(huart, &controlByte, 1U) != HAL_OK)
+    {
+      uartTxState = BRIDGE_UART_TX_IDLE;
+      controlPending = 1U;
+    }
+    return;
+  }
+
+  if (peerPaused)
+  {
+    stats.toUart.stalls++;
+    return;
+  }
+
+  len = CDCSTREAM_LendRx(&data, &receivedUs);
+  if (len == 0U)
+  {
+    return;
+  }
+  if ((stats.flow == BRIDGE_FLOW_XONXOFF) && (len > BRIDGE_FLOW_UART_CHUNK))
+  {
+    /* Short blocks, so an XOFF does not wait behind a whole buffer */
+    len = BRIDGE_FLOW_UART_CHUNK;
+  }
+  else if (len > 0xFFFFU)
+  {
+    len = 0xFFFFU;
+  }
+
+  uartTxLen = len;
+  uartTxDataUs = receivedUs;
+  uartTxState = BRIDGE_UART_TX_DATA;
+  if (HAL_UART_Transmit_DMA(huart, (uint8_t *)(uintptr_t)data, (uint16_t)len) != HAL_OK)
+  {
+    uartTxState = BRIDGE_UART_TX_IDLE;
+    stats.toUart.stalls++;
+  }
+}
+
+/**
+  * @brief  Account the latency of a forwarded block
+  * @param  dir      Direction counters
+  * @param  sum      Latency sum of the direction
+  * @param  sinceUs  Reception of the block
+  * @retval None
+  */
+static void BRIDGE_Latency(BRIDGE_DirStats_t *dir, uint64_t *sum, uint64_t sinceUs)
+{
+  const uint32_t latency = (uint32_t)(TIMEBASE_GetUs() - sinceUs);
+
+  *sum += latency;
+  dir->latencyUsLast = latency;
+  if (latency > dir->latencyUsMax)
+  {
+    dir->latencyUsMax = latency;
+  }
+  dir->latencyUsAvg = (uint32_t)(*sum / dir->transfers);
+}
+
+/**
+  * @brief  CDC transfer listener
+  * @note   Runs in the USB host thread
+  * @param  events   CDCSTREAM_EVENT_* bits
+  * @param  context  Unused
+  * @retval None
+  */
+static void BRIDGE_UsbListener(uint32_t events, void *context)
+{
+  (void)context;
+
+  /* Nothing else starts on the OUT pipe while a segment is in flight */
+  if (((events & CDCSTREAM_EVENT_TX_DONE) != 0U) && usbTxBusy)
+  {
+    usbTxDone = 1U;
+  }
+  (void)osThreadFlagsSet(bridgeTaskHandle, BRIDGE_FLAG_USB);
+}
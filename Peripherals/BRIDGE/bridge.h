@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file    bridge.h
+  * @brief   USART1 to USB CDC bridge interface
+  * @details This file contains the types and function prototypes of the
+  *          transparent bridge between USART1 and the CDC device attached to
+  *          USB_OTG_HS. While it runs, the console and the stdout sinks give
+  *          up USART1 and the CDC stream to the bridge.
+  *
+  *          No byte is copied on the way through:
+  *          - UART to USB: the RX DMA writes a circular ring continuously;
+  *            every half, full or idle line event makes the new bytes a
+  *            segment that the CDC class sends straight from the ring
+  *            (CDCSTREAM_SendBuffer). The ring owns the bytes again once the
+  *            transfer completed.
+  *          - USB to UART: the CDC ping-pong RX buffer is lent to the UART
+  *            TX DMA (CDCSTREAM_LendRx) and returned when the DMA is done; the
+  *            class receives into the other buffer meanwhile and NAKs the
+  *            device when both are still in use.
+  *
+  *          Flow control: the USB side throttles through the NAKs. Towards
+  *          the UART peer the bridge sends XOFF when the ring is three
+  *          quarters full and XON below a quarter (BRIDGE_FLOW_XONXOFF),
+  *          and pauses its own UART output on XOFF from the peer; the
+  *          control characters are forwarded like any other byte. USART1 has
+  *          no RTS/CTS on this board (the pins carry the LTDC).
+  *
+  *          The bridge stops on "+++" preceded by BRIDGE_ESCAPE_GUARD_MS of
+  *          silence on the UART, or when the CDC device is removed.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __BRIDGE_H__
+#define __BRIDGE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define BRIDGE_UART_RING_SIZE     4096U     /* UART RX DMA ring */
+#define BRIDGE_USB_CHUNK          (BRIDGE_UART_RING_SIZE / 2U) /* Longest USB segment */
+#define BRIDGE_FLOW_UART_CHUNK    256U      /* Longest UART block with XON/XOFF */
+#define BRIDGE_XOFF_LEVEL         ((BRIDGE_UART_RING_SIZE * 3U) / 4U)
+#define BRIDGE_XON_LEVEL          (BRIDGE_UART_RING_SIZE / 4U)
+#define BRIDGE_ESCAPE_GUARD_MS    1000U
+#define BRIDGE_TASK_STACK_SIZE    (256U * 4U)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Flow control towards the UART peer
+ */
+typedef enum
+{
+  BRIDGE_FLOW_NONE = 0,
+  BRIDGE_FLOW_XONXOFF
+} BRIDGE_Flow_t;
+
+/**
+ * @brief   Counters of one direction
+ */
+typedef struct
+{
+  uint32_t bytes;               /*!< Bytes forwarded */
+  uint32_t transfers;           /*!< DMA or USB transfers */
+  uint32_t KBps;                /*!< Average over the session, KB/s (1000 B) */
+  uint32_t latencyUsLast;       /*!< Reception to end of forwarding */
+  uint32_t latencyUsMax;
+  uint32_t latencyUsAvg;
+  uint32_t stalls;              /*!< Waits for the other side */
+  uint32_t overruns;            /*!< UART to USB: ring overwritten, data lost */
+} BRIDGE_DirStats_t;
+
+/**
+ * @brief   Bridge statistics
+ */
+typedef struct
+{
+  uint8_t active;               /*!< Bridge running */
+  uint8_t flow;                 /*!< BRIDGE_Flow_t */
+  uint32_t baudRate;            /*!< USART1 baud rate */
+  uint32_t elapsedMs;           /*!< Session duration */
+  BRIDGE_DirStats_t toUsb;      /*!< UART to USB */
+  BRIDGE_DirStats_t toUart;     /*!< USB to UART */
+  uint32_t xoffSent;            /*!< XOFF sent to the UART peer */
+  uint32_t peerPauses;          /*!< XOFF received from the UART peer */
+  uint32_t uartErrors;          /*!< Framing, noise and overrun errors */
+  uint32_t sessions;            /*!< Bridge sessions started */
+} BRIDGE_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the bridge task
+ * @param   None
+ * @retval  None
+ */
+void BRIDGE_Init(void);
+
+/**
+ * @brief   Requests the bridge
+ * @note    Any context; the bridge task takes over USART1 once the console
+ *          reply is sent
+ * @param   baudRate  USART1 baud rate, 0 keeps the current one
+ * @param   flow      Flow control towards the UART peer
+ * @retval  HAL_OK, HAL_BUSY if running, HAL_ERROR without a CDC device
+ */
+HAL_StatusTypeDef BRIDGE_Start(uint32_t baudRate, BRIDGE_Flow_t flow);
+
+/**
+ * @brief   Requests the end of the bridge
+ * @note    Any context
+ * @param   None
+ * @retval  HAL_OK, or HAL_ERROR if not running
+ */
+HAL_StatusTypeDef BRIDGE_Stop(void);
+
+/**
+ * @brief   Tells whether the bridge owns USART1
+ * @param   None
+ * @retval  1 if running
+ */
+uint8_t BRIDGE_IsActive(void);
+
+/**
+ * @brief   Reads the statistics of the current or last session
+ * @param   stats  Destination
+ * @retval  None
+ */
+void BRIDGE_GetStats(BRIDGE_Stats_t *stats);
+
+/**
+ * @brief   UART transmit complete hook
+ * @note    Called from HAL_UART_TxCpltCallback()
+ * @param   huart  UART handle
+ * @retval  None
+ */
+void BRIDGE_UartTxCpltCallback(UART_HandleTypeDef *huart);
+
+/**
+ * @brief   UART error hook
+ * @note    Called from HAL_UART_ErrorCallback()
+ * @param   huart  UART handle
+ * @retval  1 if the bridge handled the error
+ */
+uint8_t BRIDGE_UartErrorCallback(UART_HandleTypeDef *huart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BRIDGE_H__ */
@@ -0,0 +1,662 @@
+/**
+  ******************************************************************************
+  * @file    cdc_stream.c
+  * @brief   USB host CDC streaming layer implementation
+  * @details This file provides the CDC stream and the class callbacks
+  *          USBH_CDC_TransmitCallback() and USBH_CDC_ReceiveCallback().
+  *
+  *          TX follows the stdout rings: one claim at a time, taken inside a
+  *          critical section and started outside it. The transmit callback
+  *          releases the claim and starts the next transfer directly, so
+  *          the OUT pipe only idles when the ring is empty.
+  *
+  *          RX buffers are FREE, ARMED (owned by the class) or FULL (owned
+  *          by the reader). The reader takes them in arming order, which is
+  *          plain alternation with two buffers.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "cdc_stream.h"
+#include "cmsis_os.h"
+#include "usb_host.h"
+#include "usbh_cdc.h"
+#include "../STDIO/stdio_retarget.h"
+#include "../TIM/timebase.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define CDCSTREAM_FLAG_TX_SPACE   0x01U
+#define CDCSTREAM_FLAG_RX_DATA    0x02U
+
+#define CDCSTREAM_RX_FREE         0U
+#define CDCSTREAM_RX_ARMED        1U
+#define CDCSTREAM_RX_FULL         2U
+#define CDCSTREAM_RX_NONE         0xFFU
+
+#define CDCSTREAM_BENCH_BLOCK     256U
+#define CDCSTREAM_BENCH_TIMEOUT   100U      /* ms without ring space */
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t txRing[CDCSTREAM_TX_RING_SIZE] __attribute__((aligned(4)));
+static volatile uint32_t txHead;
+static volatile uint32_t txTail;
+static volatile uint32_t txInFlight;
+static volatile uint8_t txExternal;       /* In-flight transfer is a SendBuffer() */
+
+static uint8_t rxBuffer[2][CDCSTREAM_RX_BUFFER_SIZE] __attribute__((aligned(4)));
+static volatile uint32_t rxLength[2];
+static uint64_t rxTimeUs[2];
+static volatile uint8_t rxState[2];
+static volatile uint8_t rxArmed = CDCSTREAM_RX_NONE;
+static uint8_t rxRead;
+static uint32_t rxOffset;
+
+static volatile uint8_t connected;
+static osEventFlagsId_t streamEvents;
+static CDCSTREAM_Listener_t listener;
+static void *listenerContext;
+
+static CDCSTREAM_Stats_t stats;
+
+/* External variables --------------------------------------------------------*/
+extern USBH_HandleTypeDef hUsbHostHS;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t CDCSTREAM_Put(const uint8_t *data, uint32_t len);
+static void CDCSTREAM_Kick(void);
+static void CDCSTREAM_Arm(uint8_t index);
+static void CDCSTREAM_Consume(uint32_t count);
+static void CDCSTREAM_Notify(uint32_t events);
+static void CDCSTREAM_Wait(uint32_t flags, uint32_t start, uint32_t timeoutMs);
+
+/**
+  * @brief  CDC stream initialization
+  * @param  None
+  * @retval None
+  */
+void CDCSTREAM_Init(void)
+{
+  streamEvents = osEventFlagsNew(NULL);
+  if (streamEvents == NULL)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Device ready: arm the first reception
+  * @param  None
+  * @retval None
+  */
+void CDCSTREAM_OnConnect(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  rxState[0] = CDCSTREAM_RX_FREE;
+  rxState[1] = CDCSTREAM_RX_FREE;
+  rxRead = 0U;
+  rxOffset = 0U;
+  connected = 1U;
+  stats.connects++;
+  __set_PRIMASK(primask);
+
+  CDCSTREAM_Arm(0U);
+  CDCSTREAM_Kick();
+}
+
+/**
+  * @brief  Device removed: drop pending data and wake the waiters
+  * @param  None
+  * @retval None
+  */
+void CDCSTREAM_OnDisconnect(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  connected = 0U;
+  txTail = txHead;
+  txInFlight = 0U;
+  txExternal = 0U;
+  rxState[0] = CDCSTREAM_RX_FREE;
+  rxState[1] = CDCSTREAM_RX_FREE;
+  rxArmed = CDCSTREAM_RX_NONE;
+  __set_PRIMASK(primask);
+
+  (void)osEventFlagsSet(streamEvents, CDCSTREAM_FLAG_TX_SPACE | CDCSTREAM_FLAG_RX_DATA);
+  CDCSTREAM_Notify(CDCSTREAM_EVENT_TX_DONE | CDCSTREAM_EVENT_RX_DATA);
+}
+
+/**
+  * @brief  Device ready
+  * @param  None
+  * @retval 1 if connected
+  */
+uint8_t CDCSTREAM_IsConnected(void)
+{
+  return connected;
+}
+
+/**
+  * @brief  Queue data for the device
+  * @param  data       Data
+  * @param  len        Length
+  * @param  timeoutMs  Timeout
+  * @retval Bytes accepted
+  */
+uint32_t CDCSTREAM_Write(const void *data, uint32_t len, uint32_t timeoutMs)
+{
+  const uint8_t *src = (const uint8_t *)data;
+  uint32_t start = HAL_GetTick();
+  uint32_t accepted = 0U;
+  uint32_t copied;
+
+  while (connected && (accepted < len))
+  {
+    copied = CDCSTREAM_Put(&src[accepted], len - accepted);
+    accepted += copied;
+    CDCSTREAM_Kick();
+
+    if ((copied == 0U) && ((__get_IPSR() != 0U) || ((HAL_GetTick() - start) >= timeoutMs)))
+    {
+      break;
+    }
+    if (accepted < len)
+    {
+      CDCSTREAM_Wait(CDCSTREAM_FLAG_TX_SPACE, start, timeoutMs);
+    }
+  }
+
+  return accepted;
+}
+
+/**
+  * @brief  Read received data
+  * @note   Single reader
+  * @param  data       Destination
+  * @param  len        Size of the destination
+  * @param  timeoutMs  Timeout
+  * @retval Bytes read
+  */
+uint32_t CDCSTREAM_Read(void *data, uint32_t len, uint32_t timeoutMs)
+{
+  uint32_t start = HAL_GetTick();
+  uint32_t count;
+
+  while (rxState[rxRead] != CDCSTREAM_RX_FULL)
+  {
+    if (!connected || ((HAL_GetTick() - start) >= timeoutMs))
+    {
+      return 0U;
+    }
+    if ((rxArmed == CDCSTREAM_RX_NONE) && (rxState[rxRead] == CDCSTREAM_RX_FREE))
+    {
+      /* An earlier re-arm was refused by the class */
+      CDCSTREAM_Arm(rxRead);
+    }
+    CDCSTREAM_Wait(CDCSTREAM_FLAG_RX_DATA, start, timeoutMs);
+  }
+
+  count = rxLength[rxRead] - rxOffset;
+  if (count > len)
+  {
+    count = len;
+  }
+  memcpy(data, &rxBuffer[rxRead][rxOffset], count);
+  CDCSTREAM_Consume(count);
+
+  return count;
+}
+
+/**
+  * @brief  Send a caller buffer without copying it
+  * @param  data  Data
+  * @param  len   Length
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CDCSTREAM_SendBuffer(const uint8_t *data, uint32_t len)
+{
+  uint32_t primask;
+
+  if (!connected || (__get_IPSR() != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((txInFlight != 0U) || (txHead != txTail))
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+  txInFlight = len;
+  txExternal = 1U;
+  __set_PRIMASK(primask);
+
+  /* The class only reads from the buffer */
+  if (USBH_CDC_Transmit(&hUsbHostHS, (uint8_t *)(uintptr_t)data, len) != USBH_OK)
+  {
+    txExternal = 0U;
+    txInFlight = 0U;
+    stats.txBusy++;
+    return HAL_BUSY;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Borrow the oldest received data
+  * @param  data         Received data
+  * @param  timestampUs  Reception time
+  * @retval Bytes available
+  */
+uint32_t CDCSTREAM_LendRx(const uint8_t **data, uint64_t *timestampUs)
+{
+  if (rxState[rxRead] != CDCSTREAM_RX_FULL)
+  {
+    if (connected && (rxArmed == CDCSTREAM_RX_NONE) && (rxState[rxRead] == CDCSTREAM_RX_FREE))
+    {
+      /* An earlier re-arm was refused by the class */
+      CDCSTREAM_Arm(rxRead);
+    }
+    return 0U;
+  }
+
+  *data = &rxBuffer[rxRead][rxOffset];
+  if (timestampUs != NULL)
+  {
+    *timestampUs = rxTimeUs[rxRead];
+  }
+  return rxLength[rxRead] - rxOffset;
+}
+
+/**
+  * @brief  Return borrowed data
+  * @param  count  Bytes consumed
+  * @retval None
+  */
+void CDCSTREAM_ReturnRx(uint32_t count)
+{
+  if (rxState[rxRead] == CDCSTREAM_RX_FULL)
+  {
+    CDCSTREAM_Consume(count);
+  }
+}
+
+/**
+  * @brief  Register the transfer listener
+  * @param  callback  Listener
+  * @param  context   Listener context
+  * @retval None
+  */
+void CDCSTREAM_SetListener(CDCSTREAM_Listener_t callback, void *context)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  listener = callback;
+  listenerContext = context;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Wait until the TX ring is sent
+  * @param  timeoutMs  Timeout
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CDCSTREAM_Flush(uint32_t timeoutMs)
+{
+  uint32_t start = HAL_GetTick();
+
+  while (txHead != txTail)
+  {
+    if (!connected)
+    {
+      return HAL_ERROR;
+    }
+    if ((HAL_GetTick() - start) >= timeoutMs)
+    {
+      return HAL_TIMEOUT;
+    }
+    CDCSTREAM_Kick();
+    CDCSTREAM_Wait(CDCSTREAM_FLAG_TX_SPACE, start, timeoutMs);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start transmissions queued from interrupt context
+  * @note   Called from STDIO_Poll() in the idle task
+  * @param  None
+  * @retval None
+  */
+void CDCSTREAM_Poll(void)
+{
+  CDCSTREAM_Kick();
+}
+
+/**
+  * @brief  Stream counters
+  * @param  dest  Destination
+  * @retval None
+  */
+void CDCSTREAM_GetStats(CDCSTREAM_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  dest->txPending = txHead - txTail;
+  dest->connected = connected;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Bulk throughput benchmark
+  * @param  bytes   Bytes to send
+  * @param  result  Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CDCSTREAM_Benchmark(uint32_t bytes, CDCSTREAM_Bench_t *result)
+{
+  static uint8_t pattern[2U * CDCSTREAM_BENCH_BLOCK];
+  static uint8_t discard[64];
+  uint32_t rxBefore = stats.rxBytes;
+  uint32_t sent = 0U;
+  uint32_t block;
+  uint32_t accepted;
+  uint64_t start;
+  uint64_t elapsed;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t i;
+
+  memset(result, 0, sizeof(*result));
+  if (!connected)
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0; i < sizeof(pattern); i++)
+  {
+    pattern[i] = (uint8_t)i;
+  }
+
+  start = TIMEBASE_GetUs();
+  while (sent < bytes)
+  {
+    block = ((bytes - sent) < CDCSTREAM_BENCH_BLOCK) ? (bytes - sent) : CDCSTREAM_BENCH_BLOCK;
+    accepted = CDCSTREAM_Write(&pattern[sent % CDCSTREAM_BENCH_BLOCK], block, CDCSTREAM_BENCH_TIMEOUT);
+    sent += accepted;
+    while (CDCSTREAM_Read(discard, sizeof(discard), 0U) != 0U)
+    {
+    }
+    if (accepted == 0U)
+    {
+      status = HAL_TIMEOUT;
+      break;
+    }
+  }
+  if (status == HAL_OK)
+  {
+    status = CDCSTREAM_Flush(1000U);
+  }
+  elapsed = TIMEBASE_GetUs() - start;
+
+  result->txBytes = sent;
+  result->rxBytes = stats.rxBytes - rxBefore;
+  result->elapsedUs = (uint32_t)elapsed;
+  if (elapsed != 0U)
+  {
+    result->txKBps = (uint32_t)(((uint64_t)result->txBytes * 1000U) / elapsed);
+    result->rxKBps = (uint32_t)(((uint64_t)result->rxBytes * 1000U) / elapsed);
+  }
+  return status;
+}
+
+/**
+  * @brief  USB host CDC transmit complete callback
+  * @note   Runs in the USB host thread
+  * @param  phost  Host handle
+  * @retval None
+  */
+void USBH_CDC_TransmitCallback(USBH_HandleTypeDef *phost)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  (void)phost;
+
+  __disable_irq();
+  if (!txExternal)
+  {
+    txTail += txInFlight;
+  }
+  stats.txBytes += txInFlight;
+  stats.txTransfers++;
+  txInFlight = 0U;
+  txExternal = 0U;
+  __set_PRIMASK(primask);
+
+  CDCSTREAM_Kick();
+  (void)osEventFlagsSet(streamEvents, CDCSTREAM_FLAG_TX_SPACE);
+  STDIO_UsbTxCpltCallback();
+  CDCSTREAM_Notify(CDCSTREAM_EVENT_TX_DONE);
+}
+
+/**
+  * @brief  USB host CDC receive complete callback
+  * @details The class ends a transfer on a short packet or when the buffer
+  *          is full; it only reports the size of the last packet, the rest
+  *          follows from how far the class advanced in the buffer.
+  * @note   Runs in the USB host thread
+  * @param  phost  Host handle
+  * @retval None
+  */
+void USBH_CDC_ReceiveCallback(USBH_HandleTypeDef *phost)
+{
+  CDC_HandleTypeDef *cdc = (CDC_HandleTypeDef *)phost->pActiveClass->pData;
+  uint8_t index = rxArmed;
+  uint32_t length;
+  uint32_t primask;
+
+  if (index == CDCSTREAM_RX_NONE)
+  {
+    return;
+  }
+
+  length = (uint32_t)(cdc->pRxData - rxBuffer[index]) + USBH_CDC_GetLastReceivedDataSize(phost);
+  if (length == 0U)
+  {
+    /* Zero length packet: keep the buffer */
+    CDCSTREAM_Arm(index);
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  rxLength[index] = length;
+  rxTimeUs[index] = TIMEBASE_GetUs();
+  rxState[index] = CDCSTREAM_RX_FULL;
+  rxArmed = CDCSTREAM_RX_NONE;
+  stats.rxBytes += length;
+  stats.rxTransfers++;
+  __set_PRIMASK(primask);
+
+  if (rxState[index ^ 1U] == CDCSTREAM_RX_FREE)
+  {
+    CDCSTREAM_Arm(index ^ 1U);
+  }
+  else
+  {
+    stats.rxStalls++;
+  }
+  (void)osEventFlagsSet(streamEvents, CDCSTREAM_FLAG_RX_DATA);
+  CDCSTREAM_Notify(CDCSTREAM_EVENT_RX_DATA);
+}
+
+/**
+  * @brief  Copy data into the TX ring
+  * @param  data  Data
+  * @param  len   Length
+  * @retval Bytes copied
+  */
+static uint32_t CDCSTREAM_Put(const uint8_t *data, uint32_t len)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t space;
+  uint32_t first;
+  uint32_t offset;
+
+  __disable_irq();
+
+  space = CDCSTREAM_TX_RING_SIZE - (txHead - txTail);
+  if (len > space)
+  {
+    len = space;
+  }
+
+  offset = txHead & (CDCSTREAM_TX_RING_SIZE - 1U);
+  first = CDCSTREAM_TX_RING_SIZE - offset;
+  if (first > len)
+  {
+    first = len;
+  }
+
+  memcpy(&txRing[offset], data, first);
+  memcpy(txRing, data + first, len - first);
+  txHead += len;
+
+  __set_PRIMASK(primask);
+
+  return len;
+}
+
+/**
+  * @brief  Start the next transfer if the OUT pipe is idle
+  * @note   Thread context only, the class posts to the host thread queue
+  * @param  None
+  * @retval None
+  */
+static void CDCSTREAM_Kick(void)
+{
+  uint32_t primask;
+  uint32_t offset = 0U;
+  uint32_t count = 0U;
+
+  if (!connected || (__get_IPSR() != 0U))
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (txInFlight == 0U)
+  {
+    offset = txTail & (CDCSTREAM_TX_RING_SIZE - 1U);
+    count = txHead - txTail;
+    if (count > (CDCSTREAM_TX_RING_SIZE - offset))
+    {
+      count = CDCSTREAM_TX_RING_SIZE - offset;
+    }
+    if (count > CDCSTREAM_TX_CHUNK)
+    {
+      count = CDCSTREAM_TX_CHUNK;
+    }
+    txInFlight = count;
+  }
+  __set_PRIMASK(primask);
+
+  if ((count != 0U) && (USBH_CDC_Transmit(&hUsbHostHS, &txRing[offset], count) != USBH_OK))
+  {
+    /* Class busy with a control request: retry from the next kick */
+    txInFlight = 0U;
+    stats.txBusy++;
+  }
+}
+
+/**
+  * @brief  Hand a free RX buffer to the class
+  * @param  index  Buffer
+  * @retval None
+  */
+static void CDCSTREAM_Arm(uint8_t index)
+{
+  rxState[index] = CDCSTREAM_RX_ARMED;
+  rxArmed = index;
+  if (USBH_CDC_Receive(&hUsbHostHS, rxBuffer[index], CDCSTREAM_RX_BUFFER_SIZE) != USBH_OK)
+  {
+    rxState[index] = CDCSTREAM_RX_FREE;
+    rxArmed = CDCSTREAM_RX_NONE;
+    stats.rxStalls++;
+  }
+}
+
+/**
+  * @brief  Consume received bytes, freeing the buffer once all are read
+  * @param  count  Bytes consumed from the current buffer
+  * @retval None
+  */
+static void CDCSTREAM_Consume(uint32_t count)
+{
+  uint32_t primask;
+  uint8_t freed;
+  uint8_t stalled;
+
+  rxOffset += count;
+  if (rxOffset < rxLength[rxRead])
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  freed = rxRead;
+  rxState[freed] = CDCSTREAM_RX_FREE;
+  rxRead ^= 1U;
+  rxOffset = 0U;
+  stalled = (rxArmed == CDCSTREAM_RX_NONE) ? 1U : 0U;
+  __set_PRIMASK(primask);
+
+  /* Both buffers were full: the freed one is the next to receive */
+  if (stalled && connected)
+  {
+    CDCSTREAM_Arm(freed);
+  }
+}
+
+/**
+  * @brief  Call the transfer listener
+  * @param  events  CDCSTREAM_EVENT_* bits
+  * @retval None
+  */
+static void CDCSTREAM_Notify(uint32_t events)
+{
+  CDCSTREAM_Listener_t callback = listener;
+
+  if (callback != NULL)
+  {
+    callback(events, listenerContext);
+  }
+}
+
+/**
+  * @brief  Wait for a stream event until the timeout
+  * @param  flags      Event
+  * @param  start      Tick when the operation started
+  * @param  timeoutMs  Timeout of the operation
+  * @retval None
+  */
+static void CDCSTREAM_Wait(uint32_t flags, uint32_t start, uint32_t timeoutMs)
+{
+  uint32_t elapsed = HAL_GetTick() - start;
+
+  if ((__get_IPSR() == 0U) && (elapsed < timeoutMs))
+  {
+    (void)osEventFlagsWait(streamEvents, flags, osFlagsWaitAny, timeoutMs - elapsed);
+  }
+}
@@ -0,0 +1,220 @@
+/**
+  ******************************************************************************
+  * @file    cdc_stream.h
+  * @brief   USB host CDC streaming layer interface
+  * @details This file contains the types and function prototypes of the
+  *          byte stream over the CDC device attached to USB_OTG_HS.
+  *
+  *          The CDC class moves one bulk transfer of any length per call,
+  *          packet by packet from the USB host thread, and idles between
+  *          transfers until the application starts the next one. This layer
+  *          keeps both directions busy:
+  *          - TX: writers copy into a ring; the drain sends the contiguous
+  *            pending data as one transfer of up to CDCSTREAM_TX_CHUNK bytes
+  *            and starts the next one from the transmit callback, while the
+  *            writers keep filling the ring.
+  *          - RX: two buffers in ping-pong; the receive callback re-arms the
+  *            reception into the free buffer before the full one is handed
+  *            to the reader, so the device is only NAKed when the reader
+  *            falls a whole buffer behind.
+  *
+  *          The class functions run in the USB host thread (callbacks) or in
+  *          the reader and writer threads (re-arming a stalled direction);
+  *          interrupt context may only write without blocking.
+  *
+  *          For zero-copy forwarding a single client may also send its own
+  *          buffers (CDCSTREAM_SendBuffer) and borrow the received buffers in
+  *          place (CDCSTREAM_LendRx/CDCSTREAM_ReturnRx); a listener tells it
+  *          when a transfer completed.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __CDC_STREAM_H__
+#define __CDC_STREAM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define CDCSTREAM_TX_RING_SIZE    8192U     /* Power of two */
+#define CDCSTREAM_TX_CHUNK        4096U     /* Longest transfer, multiple of 64 */
+#define CDCSTREAM_RX_BUFFER_SIZE  2048U     /* Per ping-pong buffer, multiple of 64 */
+
+#define CDCSTREAM_EVENT_TX_DONE   0x01U     /* Listener: a transfer completed */
+#define CDCSTREAM_EVENT_RX_DATA   0x02U     /* Listener: a buffer was received */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Transfer listener
+ * @note    Runs in the USB host thread, and from OnDisconnect()
+ * @param   events   CDCSTREAM_EVENT_* bits
+ * @param   context  Pointer given to CDCSTREAM_SetListener()
+ */
+typedef void (*CDCSTREAM_Listener_t)(uint32_t events, void *context);
+
+/**
+ * @brief   Stream counters
+ */
+typedef struct
+{
+  uint32_t txBytes;             /*!< Bytes sent to the device */
+  uint32_t rxBytes;             /*!< Bytes received from the device */
+  uint32_t txTransfers;         /*!< Bulk OUT transfers completed */
+  uint32_t rxTransfers;         /*!< Bulk IN transfers completed */
+  uint32_t txPending;           /*!< Bytes waiting in the TX ring */
+  uint32_t txBusy;              /*!< Transfers refused by the class, retried */
+  uint32_t rxStalls;            /*!< Receptions not re-armed, no free buffer */
+  uint32_t connects;            /*!< CDC devices attached */
+  uint8_t connected;            /*!< CDC device ready */
+} CDCSTREAM_Stats_t;
+
+/**
+ * @brief   Benchmark result
+ */
+typedef struct
+{
+  uint32_t txBytes;             /*!< Bytes written and sent */
+  uint32_t rxBytes;             /*!< Bytes received meanwhile */
+  uint32_t elapsedUs;           /*!< Until the last byte was sent */
+  uint32_t txKBps;              /*!< TX throughput, KB/s (1000 B) */
+  uint32_t rxKBps;              /*!< RX throughput, KB/s (1000 B) */
+} CDCSTREAM_Bench_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the stream
+ * @note    Call before MX_USB_HOST_Init()
+ * @param   None
+ * @retval  None
+ */
+void CDCSTREAM_Init(void);
+
+/**
+ * @brief   Device ready hook
+ * @note    Called from USBH_UserProcess() on HOST_USER_CLASS_ACTIVE
+ * @param   None
+ * @retval  None
+ */
+void CDCSTREAM_OnConnect(void);
+
+/**
+ * @brief   Device removed hook
+ * @note    Called from USBH_UserProcess() on HOST_USER_DISCONNECTION
+ * @param   None
+ * @retval  None
+ */
+void CDCSTREAM_OnDisconnect(void);
+
+/**
+ * @brief   Tells whether a CDC device is ready
+ * @param   None
+ * @retval  1 if connected
+ */
+uint8_t CDCSTREAM_IsConnected(void);
+
+/**
+ * @brief   Queues data for the device
+ * @details Accepts what fits into the TX ring and waits up to timeoutMs for
+ *          room for the rest. Nothing is accepted while no device is ready.
+ * @param   data       Data
+ * @param   len        Length
+ * @param   timeoutMs  Longest wait for ring space, 0 in interrupt context
+ * @retval  Bytes accepted
+ */
+uint32_t CDCSTREAM_Write(const void *data, uint32_t len, uint32_t timeoutMs);
+
+/**
+ * @brief   Reads received data
+ * @details Returns as soon as some data is available or the timeout expired
+ * @param   data       Destination
+ * @param   len        Size of the destination
+ * @param   timeoutMs  Longest wait for data
+ * @retval  Bytes read
+ */
+uint32_t CDCSTREAM_Read(void *data, uint32_t len, uint32_t timeoutMs);
+
+/**
+ * @brief   Sends a caller buffer without copying it
+ * @details Only starts when the TX ring is empty and no transfer runs. The
+ *          buffer belongs to the class until the listener gets
+ *          CDCSTREAM_EVENT_TX_DONE.
+ * @note    Thread context
+ * @param   data  Data
+ * @param   len   Length
+ * @retval  HAL_OK, HAL_BUSY if the OUT pipe is in use, HAL_ERROR without a
+ *          device
+ */
+HAL_StatusTypeDef CDCSTREAM_SendBuffer(const uint8_t *data, uint32_t len);
+
+/**
+ * @brief   Borrows the oldest received data in place
+ * @details The data stays valid and the buffer is not re-armed until it is
+ *          returned with CDCSTREAM_ReturnRx(); the reception continues into
+ *          the other buffer meanwhile.
+ * @note    Thread context, single reader (not mixed with CDCSTREAM_Read)
+ * @param   data         Received data
+ * @param   timestampUs  Time base when the buffer was received, may be NULL
+ * @retval  Bytes available, 0 if nothing was received
+ */
+uint32_t CDCSTREAM_LendRx(const uint8_t **data, uint64_t *timestampUs);
+
+/**
+ * @brief   Returns borrowed data
+ * @param   count  Bytes consumed; the buffer is re-armed once all are
+ * @retval  None
+ */
+void CDCSTREAM_ReturnRx(uint32_t count);
+
+/**
+ * @brief   Registers the transfer listener
+ * @param   listener  Listener, NULL to remove
+ * @param   context   Listener context
+ * @retval  None
+ */
+void CDCSTREAM_SetListener(CDCSTREAM_Listener_t listener, void *context);
+
+/**
+ * @brief   Waits until the TX ring is sent
+ * @param   timeoutMs  Timeout
+ * @retval  HAL_OK, HAL_TIMEOUT, or HAL_ERROR without a device
+ */
+HAL_StatusTypeDef CDCSTREAM_Flush(uint32_t timeoutMs);
+
+/**
+ * @brief   Starts transmissions queued from interrupt context
+ * @note    Called from STDIO_Poll()
+ * @param   None
+ * @retval  None
+ */
+void CDCSTREAM_Poll(void);
+
+/**
+ * @brief   Reads the stream counters
+ * @param   stats  Destination
+ * @retval  None
+ */
+void CDCSTREAM_GetStats(CDCSTREAM_Stats_t *stats);
+
+/**
+ * @brief   Measures the bulk throughput
+ * @details Streams a counting pattern to the device as fast as the ring
+ *          accepts it and discards what the device sends back meanwhile (a
+ *          loopback device gives the RX rate at the same time)
+ * @param   bytes   Bytes to send
+ * @param   result  Destination
+ * @retval  HAL_OK, HAL_TIMEOUT if the device stopped accepting data,
+ *          HAL_ERROR without a device
+ */
+HAL_StatusTypeDef CDCSTREAM_Benchmark(uint32_t bytes, CDCSTREAM_Bench_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CDC_STREAM_H__ */
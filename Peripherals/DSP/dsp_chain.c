@@ -0,0 +1,414 @@
+/**
+  ******************************************************************************
+  * @file    dsp_chain.c
+  * @brief   Streaming filter chain implementation
+  * @details This file provides the chain builder and the block processor.
+  *
+  *          Stages of a channel run one after the other on the whole block,
+  *          ping-ponging between two scratch buffers, so each CMSIS-DSP call
+  *          works on as many samples as possible. Every FIR decimator
+  *          shortens the block for the stages after it.
+  *
+  *          The moving average keeps a running sum over a ring of the last
+  *          window samples. The sum is rebuilt from the ring once per wrap
+  *          so float rounding cannot accumulate.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dsp_chain.h"
+#include "../SYS/dwt.h"
+#include "../SYS/mem_sections.h"
+#include <stddef.h>
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Moving average state
+ */
+typedef struct
+{
+  float32_t *ring;
+  uint16_t window;
+  uint16_t index;
+  float32_t sum;
+} DSPCHAIN_Average_t;
+
+/**
+ * @brief   Run time state of one stage
+ */
+typedef struct
+{
+  DSPCHAIN_StageType_t type;
+  uint16_t blockIn;                 /*!< Samples in per block */
+  uint16_t blockOut;                /*!< Samples out per block */
+  union
+  {
+    arm_biquad_cascade_df2T_instance_f32 biquad;
+    arm_fir_decimate_instance_f32 fir;
+    DSPCHAIN_Average_t average;
+  } u;
+} DSPCHAIN_StageState_t;
+
+/**
+ * @brief   Run time state of one channel
+ */
+typedef struct
+{
+  const DSPCHAIN_Channel_t *config;
+  DSPCHAIN_StageState_t stages[DSPCHAIN_MAX_STAGES];
+  DSPCHAIN_Stats_t stats;
+  uint64_t cyclesTotal;
+} DSPCHAIN_ChannelState_t;
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Filter states and block scratch
+ * @details Touched on every sample by the CPU only, so they live in CCM RAM
+ *          away from the ADC and UART DMA; zeroed by DSPCHAIN_Alloc() and
+ *          written before read respectively.
+ */
+CCM_BSS static float32_t stateArena[DSPCHAIN_STATE_WORDS];
+static uint32_t arenaUsed;
+
+static DSPCHAIN_ChannelState_t channels[DSPCHAIN_MAX_CHANNELS];
+static uint32_t channelCount;
+
+CCM_BSS static float32_t scratch[2][DSPCHAIN_MAX_BLOCK];
+
+static DSPCHAIN_OutputFn_t outputCallback;
+static void *outputContext;
+
+/* Private function prototypes -----------------------------------------------*/
+static float32_t *DSPCHAIN_Alloc(uint32_t words);
+static HAL_StatusTypeDef DSPCHAIN_BuildChannel(DSPCHAIN_ChannelState_t *state,
+                                               const DSPCHAIN_Channel_t *config);
+static void DSPCHAIN_Average(DSPCHAIN_Average_t *average, const float32_t *in, float32_t *out,
+                             uint32_t count);
+
+/**
+  * @brief  Build the chain table
+  * @param  table  Channel descriptors
+  * @param  count  Number of channels
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DSPCHAIN_Init(const DSPCHAIN_Channel_t *table, uint32_t count)
+{
+  uint32_t i;
+
+  if (count > DSPCHAIN_MAX_CHANNELS)
+  {
+    return HAL_ERROR;
+  }
+
+  DWT_Init();
+  arenaUsed = 0U;
+  channelCount = 0U;
+
+  for (i = 0; i < count; i++)
+  {
+    if (DSPCHAIN_BuildChannel(&channels[i], &table[i]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  channelCount = count;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Filter a run of input samples
+  * @param  channel  Channel index
+  * @param  in       Input samples
+  * @param  count    Number of input samples
+  * @param  out      Output samples or NULL
+  * @retval Number of output samples
+  */
+uint32_t DSPCHAIN_Process(uint32_t channel, const float32_t *in, uint32_t count, float32_t *out)
+{
+  DSPCHAIN_ChannelState_t *state;
+  DSPCHAIN_StageState_t *stage;
+  const float32_t *src;
+  float32_t *dst;
+  uint32_t produced = 0U;
+  uint32_t blockSize;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t length;
+  uint32_t s;
+
+  if ((channel >= channelCount) || (in == NULL))
+  {
+    return 0U;
+  }
+
+  state = &channels[channel];
+  blockSize = state->config->blockSize;
+
+  while (count >= blockSize)
+  {
+    start = DWT_GetCycles();
+    src = in;
+    length = blockSize;
+
+    for (s = 0; s < state->config->stageCount; s++)
+    {
+      stage = &state->stages[s];
+      dst = scratch[s & 1U];
+
+      switch (stage->type)
+      {
+        case DSPCHAIN_STAGE_BIQUAD:
+          arm_biquad_cascade_df2T_f32(&stage->u.biquad, src, dst, length);
+          break;
+
+        case DSPCHAIN_STAGE_FIR_DECIMATE:
+          arm_fir_decimate_f32(&stage->u.fir, src, dst, length);
+          break;
+
+        default:
+          DSPCHAIN_Average(&stage->u.average, src, dst, length);
+          break;
+      }
+
+      src = dst;
+      length = stage->blockOut;
+    }
+
+    cycles = DWT_GetCycles() - start;
+
+    if (length > 0U)
+    {
+      state->stats.latest = src[length - 1U];
+      if (out != NULL)
+      {
+        arm_copy_f32(src, &out[produced], length);
+      }
+      if (outputCallback != NULL)
+      {
+        outputCallback(channel, src, length, outputContext);
+      }
+    }
+
+    state->stats.blocks++;
+    state->stats.samplesIn += blockSize;
+    state->stats.samplesOut += length;
+    state->stats.cyclesPerBlock = cycles;
+    state->cyclesTotal += cycles;
+    state->stats.centiCyclesPerSample =
+      (uint32_t)((state->cyclesTotal * 100U) / state->stats.samplesIn);
+
+    produced += length;
+    in += blockSize;
+    count -= blockSize;
+  }
+
+  return produced;
+}
+
+/**
+  * @brief  Register the output consumer
+  * @param  callback  Consumer
+  * @param  context   Consumer context
+  * @retval None
+  */
+void DSPCHAIN_SetOutputCallback(DSPCHAIN_OutputFn_t callback, void *context)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  outputCallback = callback;
+  outputContext = context;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Channel count
+  * @param  None
+  * @retval Channels built
+  */
+uint32_t DSPCHAIN_GetChannelCount(void)
+{
+  return channelCount;
+}
+
+/**
+  * @brief  Channel name
+  * @param  channel  Channel index
+  * @retval Name
+  */
+const char *DSPCHAIN_GetName(uint32_t channel)
+{
+  return (channel < channelCount) ? channels[channel].config->name : "?";
+}
+
+/**
+  * @brief  Channel descriptor
+  * @param  channel  Channel index
+  * @retval Descriptor
+  */
+const DSPCHAIN_Channel_t *DSPCHAIN_GetConfig(uint32_t channel)
+{
+  return (channel < channelCount) ? channels[channel].config : NULL;
+}
+
+/**
+  * @brief  Channel statistics
+  * @param  channel  Channel index
+  * @param  dest     Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DSPCHAIN_GetStats(uint32_t channel, DSPCHAIN_Stats_t *dest)
+{
+  uint32_t primask;
+
+  if (channel >= channelCount)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *dest = channels[channel].stats;
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take words from the state arena
+  * @param  words  Number of floats
+  * @retval Zeroed block, NULL when the arena is exhausted
+  */
+static float32_t *DSPCHAIN_Alloc(uint32_t words)
+{
+  float32_t *block;
+
+  if ((arenaUsed + words) > DSPCHAIN_STATE_WORDS)
+  {
+    return NULL;
+  }
+
+  block = &stateArena[arenaUsed];
+  arenaUsed += words;
+  arm_fill_f32(0.0f, block, words);
+  return block;
+}
+
+/**
+  * @brief  Initialize the stages of one channel
+  * @param  state   Channel state
+  * @param  config  Channel descriptor
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DSPCHAIN_BuildChannel(DSPCHAIN_ChannelState_t *state,
+                                               const DSPCHAIN_Channel_t *config)
+{
+  const DSPCHAIN_Stage_t *desc;
+  DSPCHAIN_StageState_t *stage;
+  float32_t *mem;
+  uint32_t length = config->blockSize;
+  uint32_t decimation = 1U;
+  uint32_t s;
+
+  if ((config->stageCount > DSPCHAIN_MAX_STAGES) || (length == 0U) ||
+      (length > DSPCHAIN_MAX_BLOCK))
+  {
+    return HAL_ERROR;
+  }
+
+  state->config = config;
+  state->cyclesTotal = 0U;
+  state->stats = (DSPCHAIN_Stats_t){0};
+
+  for (s = 0; s < config->stageCount; s++)
+  {
+    desc = &config->stages[s];
+    stage = &state->stages[s];
+    stage->type = desc->type;
+    stage->blockIn = (uint16_t)length;
+
+    if ((desc->length == 0U) || (length == 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    switch (desc->type)
+    {
+      case DSPCHAIN_STAGE_BIQUAD:
+        mem = DSPCHAIN_Alloc(2U * desc->length);
+        if ((mem == NULL) || (desc->coeffs == NULL) || (desc->length > 255U))
+        {
+          return HAL_ERROR;
+        }
+        arm_biquad_cascade_df2T_init_f32(&stage->u.biquad, (uint8_t)desc->length,
+                                         desc->coeffs, mem);
+        break;
+
+      case DSPCHAIN_STAGE_FIR_DECIMATE:
+        mem = DSPCHAIN_Alloc(desc->length + length - 1U);
+        if ((mem == NULL) || (desc->coeffs == NULL) || (desc->decimation == 0U) ||
+            (arm_fir_decimate_init_f32(&stage->u.fir, desc->length, desc->decimation,
+                                       desc->coeffs, mem, length) != ARM_MATH_SUCCESS))
+        {
+          return HAL_ERROR;
+        }
+        length /= desc->decimation;
+        decimation *= desc->decimation;
+        break;
+
+      case DSPCHAIN_STAGE_MOVING_AVERAGE:
+        mem = DSPCHAIN_Alloc(desc->length);
+        if (mem == NULL)
+        {
+          return HAL_ERROR;
+        }
+        stage->u.average.ring = mem;
+        stage->u.average.window = desc->length;
+        stage->u.average.index = 0U;
+        stage->u.average.sum = 0.0f;
+        break;
+
+      default:
+        return HAL_ERROR;
+    }
+
+    stage->blockOut = (uint16_t)length;
+  }
+
+  state->stats.outputRateHz = config->inputRateHz / decimation;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Moving average over a block
+  * @details Starts from zero history, i.e. the first window - 1 outputs
+  *          ramp up like those of an FIR with all taps 1/window.
+  * @param  average  State
+  * @param  in       Input samples
+  * @param  out      Output samples
+  * @param  count    Number of samples
+  * @retval None
+  */
+static void DSPCHAIN_Average(DSPCHAIN_Average_t *average, const float32_t *in, float32_t *out,
+                             uint32_t count)
+{
+  const float32_t scale = 1.0f / (float32_t)average->window;
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    average->sum += in[i] - average->ring[average->index];
+    average->ring[average->index] = in[i];
+
+    if (++average->index >= average->window)
+    {
+      average->index = 0U;
+      arm_mean_f32(average->ring, average->window, &average->sum);
+      average->sum *= (float32_t)average->window;
+    }
+
+    out[i] = average->sum * scale;
+  }
+}
@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file    dsp_chain.h
+  * @brief   Streaming filter chain interface
+  * @details This file contains the types and function prototypes of the
+  *          per-channel filter chains. A channel is a fixed sequence of
+  *          stages described by a const table:
+  *          - Biquad cascade (arm_biquad_cascade_df2T_f32)
+  *          - FIR decimator (arm_fir_decimate_f32)
+  *          - Moving average
+  *          DSPCHAIN_Init() allocates the stage states from a static arena,
+  *          after which a channel consumes whole input blocks straight from
+  *          the producer's DMA buffer and measures its cost in CPU cycles
+  *          per input sample.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __DSP_CHAIN_H__
+#define __DSP_CHAIN_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "arm_math.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define DSPCHAIN_MAX_CHANNELS     4U
+#define DSPCHAIN_MAX_STAGES       4U      /* Per channel */
+#define DSPCHAIN_MAX_BLOCK        64U     /* Input samples per block */
+#define DSPCHAIN_STATE_WORDS      1024U   /* Arena for all stage states */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Stage kind
+ */
+typedef enum
+{
+  DSPCHAIN_STAGE_BIQUAD = 0,        /*!< coeffs: 5 per section, length = sections */
+  DSPCHAIN_STAGE_FIR_DECIMATE,      /*!< coeffs: taps, length = taps, decimation = M */
+  DSPCHAIN_STAGE_MOVING_AVERAGE     /*!< length = window */
+} DSPCHAIN_StageType_t;
+
+/**
+ * @brief   One stage of a channel table
+ * @note    Biquad coefficients are {b0, b1, b2, -a1, -a2} per section as
+ *          CMSIS-DSP expects; FIR taps are in time reversed order
+ */
+typedef struct
+{
+  DSPCHAIN_StageType_t type;
+  const float32_t *coeffs;          /*!< Biquad sections or FIR taps */
+  uint16_t length;                  /*!< Sections, taps or window */
+  uint8_t decimation;               /*!< FIR decimation factor, 1 otherwise */
+} DSPCHAIN_Stage_t;
+
+/**
+ * @brief   One channel of a chain table
+ */
+typedef struct
+{
+  const char *name;
+  uint32_t inputRateHz;             /*!< Rate of the samples fed in */
+  uint16_t blockSize;               /*!< Input samples per block */
+  uint8_t stageCount;
+  const DSPCHAIN_Stage_t *stages;
+} DSPCHAIN_Channel_t;
+
+/**
+ * @brief   Output consumer
+ * @note    Runs in the context that called DSPCHAIN_Process()
+ * @param   channel  Channel index
+ * @param   out      Filtered samples
+ * @param   count    Number of samples
+ * @param   context  Pointer given to DSPCHAIN_SetOutputCallback()
+ */
+typedef void (*DSPCHAIN_OutputFn_t)(uint32_t channel, const float32_t *out, uint32_t count,
+                                    void *context);
+
+/**
+ * @brief   Channel statistics
+ */
+typedef struct
+{
+  uint32_t blocks;                  /*!< Input blocks processed */
+  uint32_t samplesIn;               /*!< Input samples consumed */
+  uint32_t samplesOut;              /*!< Output samples produced */
+  uint32_t outputRateHz;            /*!< Input rate over total decimation */
+  uint32_t cyclesPerBlock;          /*!< CPU cycles of the last block */
+  uint32_t centiCyclesPerSample;    /*!< Average cost per input sample, x100 */
+  float32_t latest;                 /*!< Last output sample */
+} DSPCHAIN_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Builds the channels of a chain table
+ * @details Checks the table (block sizes divisible by the decimation of
+ *          each FIR stage, arena size) and initializes every stage
+ * @param   table  Channel descriptors, must stay valid
+ * @param   count  Number of channels
+ * @retval  HAL_OK, or HAL_ERROR for an invalid table
+ */
+HAL_StatusTypeDef DSPCHAIN_Init(const DSPCHAIN_Channel_t *table, uint32_t count);
+
+/**
+ * @brief   Filters input samples of one channel
+ * @note    Channels share the scratch buffers: call it for all channels
+ *          from the same context
+ * @param   channel  Channel index
+ * @param   in       Input samples; count must be a multiple of the block size
+ * @param   count    Number of input samples
+ * @param   out      Output samples, NULL to only keep the latest value
+ * @retval  Number of output samples
+ */
+uint32_t DSPCHAIN_Process(uint32_t channel, const float32_t *in, uint32_t count, float32_t *out);
+
+/**
+ * @brief   Registers the output consumer
+ * @param   callback  Consumer, NULL to remove
+ * @param   context   Passed back to the consumer
+ * @retval  None
+ */
+void DSPCHAIN_SetOutputCallback(DSPCHAIN_OutputFn_t callback, void *context);
+
+/**
+ * @brief   Number of channels built by DSPCHAIN_Init()
+ * @param   None
+ * @retval  Channel count
+ */
+uint32_t DSPCHAIN_GetChannelCount(void);
+
+/**
+ * @brief   Name of a channel
+ * @param   channel  Channel index
+ * @retval  Name, or "?" for an invalid index
+ */
+const char *DSPCHAIN_GetName(uint32_t channel);
+
+/**
+ * @brief   Table entry a channel was built from
+ * @param   channel  Channel index
+ * @retval  Descriptor, NULL for an invalid index
+ */
+const DSPCHAIN_Channel_t *DSPCHAIN_GetConfig(uint32_t channel);
+
+/**
+ * @brief   Reads the statistics of a channel
+ * @param   channel  Channel index
+ * @param   stats    Destination
+ * @retval  HAL_OK, or HAL_ERROR for an invalid index
+ */
+HAL_StatusTypeDef DSPCHAIN_GetStats(uint32_t channel, DSPCHAIN_Stats_t *stats);
+
+/**
+ * @brief   Builds the board channel table and feeds it from the ACQ blocks
+ * @details Defined in dsp_chain_table.c
+ * @note    ACQ_Init() must have run
+ * @param   None
+ * @retval  HAL status of DSPCHAIN_Init()
+ */
+HAL_StatusTypeDef DSPCHAIN_StartSensorChains(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DSP_CHAIN_H__ */
@@ -0,0 +1,127 @@
+/**
+  ******************************************************************************
+  * @file    dsp_chain_table.c
+  * @brief   Board filter chain table
+  * @details This file declares the filter chains of the on-chip sensor
+  *          channels sampled by the acquisition scheduler (1 kHz, blocks of
+  *          ACQ_BLOCK_SAMPLES) and feeds them from the ACQ block callback.
+  *
+  *          Both channels are decimated by 8 first so the remaining stages
+  *          run at 125 Hz:
+  *          - "vdda_mV": analog supply from VREFINT, 16-point moving average
+  *          - "temp_C":  die temperature, 5 Hz 4th order Butterworth low pass
+  *                       and a 4-point moving average
+  *          Coefficients were designed offline: bilinear (RBJ) Butterworth
+  *          sections, and a 32-tap Hamming windowed sinc with its cutoff at
+  *          0.8 of the output Nyquist frequency.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dsp_chain.h"
+#include "../ACQ/acq.h"
+#include "stm32f4xx_ll_adc.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define DSPCHAIN_TABLE_RATE_HZ    1000U
+#define DSPCHAIN_CH_VDDA          0U
+#define DSPCHAIN_CH_TEMP          1U
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Decimate-by-8 anti-alias FIR, 32 taps, symmetric
+ */
+static const float32_t decimate8Taps[32] = {
+  -1.646695031e-03f, -1.967447827e-03f, -2.500367440e-03f, -2.968427877e-03f,
+  -2.844691717e-03f, -1.427780115e-03f,  2.022558636e-03f,  8.114797534e-03f,
+   1.715526312e-02f,  2.901634884e-02f,  4.307608357e-02f,  5.824870644e-02f,
+   7.310778029e-02f,  8.608407080e-02f,  9.570411108e-02f,  1.008256897e-01f,
+   1.008256897e-01f,  9.570411108e-02f,  8.608407080e-02f,  7.310778029e-02f,
+   5.824870644e-02f,  4.307608357e-02f,  2.901634884e-02f,  1.715526312e-02f,
+   8.114797534e-03f,  2.022558636e-03f, -1.427780115e-03f, -2.844691717e-03f,
+  -2.968427877e-03f, -2.500367440e-03f, -1.967447827e-03f, -1.646695031e-03f,
+};
+
+/**
+ * @brief   5 Hz low pass at 125 Hz, Butterworth, two sections
+ */
+static const float32_t lowpass5HzSections[2 * 5] = {
+  1.277357034e-02f, 2.554714068e-02f, 1.277357034e-02f, 1.575239978e+00f, -6.263342591e-01f,
+  1.434336825e-02f, 2.868673650e-02f, 1.434336825e-02f, 1.768827859e+00f, -8.262013324e-01f,
+};
+
+static const DSPCHAIN_Stage_t vddaStages[] = {
+  { DSPCHAIN_STAGE_FIR_DECIMATE,   decimate8Taps,      32U, 8U },
+  { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,               16U, 1U },
+};
+
+static const DSPCHAIN_Stage_t tempStages[] = {
+  { DSPCHAIN_STAGE_FIR_DECIMATE,   decimate8Taps,      32U, 8U },
+  { DSPCHAIN_STAGE_BIQUAD,         lowpass5HzSections,  2U, 1U },
+  { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,                4U, 1U },
+};
+
+static const DSPCHAIN_Channel_t sensorChains[] = {
+  [DSPCHAIN_CH_VDDA] = { "vdda_mV", DSPCHAIN_TABLE_RATE_HZ, ACQ_BLOCK_SAMPLES,
+                         (uint8_t)(sizeof(vddaStages) / sizeof(vddaStages[0])), vddaStages },
+  [DSPCHAIN_CH_TEMP] = { "temp_C",  DSPCHAIN_TABLE_RATE_HZ, ACQ_BLOCK_SAMPLES,
+                         (uint8_t)(sizeof(tempStages) / sizeof(tempStages[0])), tempStages },
+};
+
+/**
+ * @brief   Per-channel input blocks converted from the DMA block
+ */
+static float32_t vddaIn[ACQ_BLOCK_SAMPLES];
+static float32_t tempIn[ACQ_BLOCK_SAMPLES];
+
+/* Private function prototypes -----------------------------------------------*/
+static void DSPCHAIN_AcqBlock(const ACQ_Sample_t *samples, uint32_t count, void *context);
+
+/**
+  * @brief  Build the board chains and attach them to ACQ
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DSPCHAIN_StartSensorChains(void)
+{
+  if (DSPCHAIN_Init(sensorChains, sizeof(sensorChains) / sizeof(sensorChains[0])) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  ACQ_SetBlockCallback(DSPCHAIN_AcqBlock, NULL);
+  return HAL_OK;
+}
+
+/**
+  * @brief  ACQ block consumer
+  * @details Runs in the ADC DMA interrupt: converts the block to physical
+  *          units and filters it while DMA fills the other half buffer.
+  * @param  samples  Scans, oldest first
+  * @param  count    Number of scans
+  * @param  context  Unused
+  * @retval None
+  */
+static void DSPCHAIN_AcqBlock(const ACQ_Sample_t *samples, uint32_t count, void *context)
+{
+  uint32_t i;
+
+  (void)context;
+
+  if (count > ACQ_BLOCK_SAMPLES)
+  {
+    count = ACQ_BLOCK_SAMPLES;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    vddaIn[i] = (samples[i].raw[0] == 0U) ? 0.0f :
+                (float32_t)__LL_ADC_CALC_VREFANALOG_VOLTAGE(samples[i].raw[0], LL_ADC_RESOLUTION_12B);
+    tempIn[i] = (float32_t)ACQ_ToCentiCelsius(&samples[i]) * 0.01f;
+  }
+
+  (void)DSPCHAIN_Process(DSPCHAIN_CH_VDDA, vddaIn, count, NULL);
+  (void)DSPCHAIN_Process(DSPCHAIN_CH_TEMP, tempIn, count, NULL);
+}
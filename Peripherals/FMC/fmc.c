@@ -27,10 +27,24 @@ SDRAM_HandleTypeDef hsdram1;
  */
 FMC_SDRAM_TimingTypeDef SdramTiming;
 
+/* Private defines -----------------------------------------------------------*/
+/* IS42S16400J mode register: burst length 1, sequential, CAS 3, single write */
+#define SDRAM_MODEREG_BURST_LENGTH_1             0x0000U
+#define SDRAM_MODEREG_BURST_TYPE_SEQUENTIAL      0x0000U
+#define SDRAM_MODEREG_CAS_LATENCY_3              0x0030U
+#define SDRAM_MODEREG_OPERATING_MODE_STANDARD    0x0000U
+#define SDRAM_MODEREG_WRITEBURST_MODE_SINGLE     0x0200U
+
+#define SDRAM_TIMEOUT_CYCLES                     0xFFFFU  /* Command timeout */
+#define SDRAM_REFRESH_PERIOD_US_X1000            15625U   /* 64 ms / 4096 rows = 15.625 us */
+
+/* Private function prototypes -----------------------------------------------*/
+static void FMC_SDRAM_InitSequence(void);
+
 /**
   * @brief  FMC Initialization Function
   * @details Configures the FMC controller for SDRAM operation with the following settings:
-  *          - SDRAM bank: Bank 1
+  *          - SDRAM bank: Bank 2 (SDNE1/SDCKE1 on this board)
   *          - Column address bits: 8
   *          - Row address bits: 12
   *          - Memory data width: 16 bits
@@ -50,6 +64,9 @@ FMC_SDRAM_TimingTypeDef SdramTiming;
   *          - RP delay: 2 cycles
   *          - RCD delay: 2 cycles
   *
+  *          Once the controller is configured the JEDEC power-up sequence is
+  *          issued so the device is usable at FMC_SDRAM_BASE_ADDR on return.
+  *
   * @note   The SDRAM is typically used for LCD framebuffer and for
   *         large data buffers in applications requiring significant RAM
   * @param  None
@@ -64,7 +81,7 @@ void FMC_Init(void)
   hsdram1.Instance = FMC_SDRAM_DEVICE;                         /* Select FMC SDRAM device */
 
   /* Configure SDRAM basic parameters */
-  hsdram1.Init.SDBank = FMC_SDRAM_BANK1;                       /* Use SDRAM bank 1 */
+  hsdram1.Init.SDBank = FMC_SDRAM_BANK2;                       /* SDRAM wired to SDNE1/SDCKE1 */
   hsdram1.Init.ColumnBitsNumber = FMC_SDRAM_COLUMN_BITS_NUM_8; /* 8-bit column addressing */
   hsdram1.Init.RowBitsNumber = FMC_SDRAM_ROW_BITS_NUM_12;      /* 12-bit row addressing */
   hsdram1.Init.MemoryDataWidth = FMC_SDRAM_MEM_BUS_WIDTH_16;   /* 16-bit data bus width */
@@ -89,4 +106,88 @@ void FMC_Init(void)
   {
     Error_Handler();  /* Call error handler if initialization fails */
   }
+
+  /* Bring the device out of power-up and program its mode register */
+  FMC_SDRAM_InitSequence();
+}
+
+/**
+  * @brief  Reprogram the SDRAM auto-refresh counter for the current HCLK
+  * @details COUNT = (refresh period * SDCLK) - 20, with SDCLK = HCLK / 2.
+  *          Must be called again whenever HCLK changes; does nothing
+  *          before FMC_Init().
+  * @param  None
+  * @retval None
+  */
+void FMC_SDRAM_UpdateRefreshRate(void)
+{
+  uint32_t sdclkMHz = (HAL_RCC_GetHCLKFreq() / 2U) / 1000000U;
+  uint32_t count = ((SDRAM_REFRESH_PERIOD_US_X1000 * sdclkMHz) / 1000U) - 20U;
+
+  if (hsdram1.State == HAL_SDRAM_STATE_RESET)
+  {
+    return;
+  }
+
+  if (HAL_SDRAM_ProgramRefreshRate(&hsdram1, count) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  SDRAM power-up sequence
+  * @details Issues clock enable, precharge-all, auto-refresh and load mode
+  *          register commands as required by the JEDEC start-up procedure,
+  *          then programs the refresh counter.
+  * @param  None
+  * @retval None
+  */
+static void FMC_SDRAM_InitSequence(void)
+{
+  FMC_SDRAM_CommandTypeDef command = {0};
+
+  /* Step 1: Clock configuration enable */
+  command.CommandMode = FMC_SDRAM_CMD_CLK_ENABLE;
+  command.CommandTarget = FMC_SDRAM_CMD_TARGET_BANK2;
+  command.AutoRefreshNumber = 1;
+  command.ModeRegisterDefinition = 0;
+  if (HAL_SDRAM_SendCommand(&hsdram1, &command, SDRAM_TIMEOUT_CYCLES) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* Step 2: At least 100 us delay before the first command */
+  HAL_Delay(1);
+
+  /* Step 3: Precharge all banks */
+  command.CommandMode = FMC_SDRAM_CMD_PALL;
+  if (HAL_SDRAM_SendCommand(&hsdram1, &command, SDRAM_TIMEOUT_CYCLES) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* Step 4: Eight consecutive auto-refresh cycles */
+  command.CommandMode = FMC_SDRAM_CMD_AUTOREFRESH_MODE;
+  command.AutoRefreshNumber = 8;
+  if (HAL_SDRAM_SendCommand(&hsdram1, &command, SDRAM_TIMEOUT_CYCLES) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* Step 5: Program the external memory mode register */
+  command.CommandMode = FMC_SDRAM_CMD_LOAD_MODE;
+  command.AutoRefreshNumber = 1;
+  command.ModeRegisterDefinition = SDRAM_MODEREG_BURST_LENGTH_1 |
+                                   SDRAM_MODEREG_BURST_TYPE_SEQUENTIAL |
+                                   SDRAM_MODEREG_CAS_LATENCY_3 |
+                                   SDRAM_MODEREG_OPERATING_MODE_STANDARD |
+                                   SDRAM_MODEREG_WRITEBURST_MODE_SINGLE;
+  if (HAL_SDRAM_SendCommand(&hsdram1, &command, SDRAM_TIMEOUT_CYCLES) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* Step 6: Set the refresh rate counter */
+  FMC_SDRAM_UpdateRefreshRate();
 }
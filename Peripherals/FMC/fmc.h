@@ -21,6 +21,13 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @brief   External SDRAM window (IS42S16400J, 8 MB on FMC SDRAM bank 2)
+ */
+#define FMC_SDRAM_BASE_ADDR   0xD0000000U
+#define FMC_SDRAM_SIZE        0x00800000U
+
 /* Exported functions prototypes ---------------------------------------------*/
 /**
  * @brief   Initializes FMC peripheral used for external memory control
@@ -31,6 +38,15 @@ extern "C" {
  */
 void FMC_Init(void);
 
+/**
+ * @brief   Reprograms the SDRAM refresh counter
+ * @details Recomputes the auto-refresh count from the current HCLK so the
+ *          64 ms / 4096 row refresh requirement is met after a clock change
+ * @param   None
+ * @retval  None
+ */
+void FMC_SDRAM_UpdateRefreshRate(void);
+
 /* Exported variables ---------------------------------------------------------*/
 /**
  * @brief   SDRAM handle structure
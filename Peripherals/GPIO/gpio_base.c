@@ -14,6 +14,8 @@
 #include "main.h"
 #include "stm32f429xx.h"
 #include "stm32f4xx_hal_gpio.h"
+#include "../L3GD20/l3gd20.h"
+#include "../STMPE811/stmpe811.h"
 #include <stdio.h>
 
 /**
@@ -74,6 +76,14 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
   {
     GPIO_Button_Callback();
   }
+  else if(GPIO_Pin == MEMS_INT2_Pin)
+  {
+    L3GD20_IrqHandler();
+  }
+  else if(GPIO_Pin == TP_INT1_Pin)
+  {
+    STMPE811_IrqHandler();
+  }
 }
 
 /**
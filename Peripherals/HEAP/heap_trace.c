@@ -0,0 +1,424 @@
+/**
+  ******************************************************************************
+  * @file    heap_trace.c
+  * @brief   Heap instrumentation implementation
+  * @details This file provides the allocation table behind the heap_4
+  *          trace hooks. Both hooks run inside pvPortMalloc()/vPortFree()
+  *          with the scheduler suspended, so the table needs no further
+  *          locking as long as the heap is never used from interrupts.
+  *
+  *          Every live block keeps its call site, size and allocation tick.
+  *          The report prints the blocks that are still live since the last
+  *          HEAPTRACE_Mark(), which is enough to spot a leaking call site
+  *          after a soak test. Call sites resolve with addr2line against
+  *          the firmware ELF.
+  *
+  *          The newlib wrappers record into the same table with interrupts
+  *          masked instead: the C library heap is used before the scheduler
+  *          starts, and like the FreeRTOS hooks this keeps every other task
+  *          out. Sizes are the usable size of the block, so a free subtracts
+  *          exactly what its allocation added.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "heap_trace.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "../RTOS/newlib_lock.h"
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Live allocation record
+ */
+typedef struct
+{
+  void *ptr;            /*!< Block address, NULL for a free slot */
+  uint32_t size;        /*!< Size including heap_4 header, newlib usable size */
+  uint32_t caller;      /*!< Return address of the allocation call */
+  uint32_t tick;        /*!< HAL tick at allocation */
+  uint8_t newlib;       /*!< 1 for a newlib malloc() block */
+} HEAPTRACE_Record_t;
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Live allocation table and counters
+ */
+static HEAPTRACE_Record_t records[HEAPTRACE_MAX_RECORDS];
+static HEAPTRACE_Metrics_t counters;
+static HEAPTRACE_NewlibMetrics_t newlibCounters;
+
+/**
+ * @brief   Tick of the last HEAPTRACE_Mark()
+ */
+static uint32_t markTick;
+
+/**
+ * @brief   Copy of the table taken by the report, kept off the caller's stack
+ */
+static HEAPTRACE_Record_t snapshot[HEAPTRACE_MAX_RECORDS];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t HEAPTRACE_Add(void *ptr, uint32_t size, void *caller, uint8_t newlib);
+static void HEAPTRACE_Remove(void *ptr);
+static void HEAPTRACE_OnNewlibMalloc(void *ptr, size_t request, void *caller);
+static void HEAPTRACE_OnNewlibFree(void *ptr);
+
+/* Link time wrappers, -Wl,--wrap=malloc,--wrap=free,--wrap=calloc,--wrap=realloc */
+void *__real_malloc(size_t size);
+void __real_free(void *ptr);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__wrap_malloc(size_t size);
+void __wrap_free(void *ptr);
+void *__wrap_calloc(size_t count, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+
+/**
+  * @brief  Record an allocation
+  * @param  ptr     Returned block or NULL
+  * @param  size    Allocated size
+  * @param  caller  Call site
+  * @retval None
+  */
+void HEAPTRACE_OnMalloc(void *ptr, uint32_t size, void *caller)
+{
+  if (ptr == NULL)
+  {
+    counters.failCount++;
+    counters.lastFailSize = size;
+    counters.lastFailCaller = (uint32_t)caller;
+    return;
+  }
+
+  counters.allocCount++;
+  counters.liveBytes += size;
+  if (counters.liveBytes > counters.peakLiveBytes)
+  {
+    counters.peakLiveBytes = counters.liveBytes;
+  }
+
+  if (HEAPTRACE_Add(ptr, size, caller, 0U) == 0U)
+  {
+    counters.untracked++;
+  }
+}
+
+/**
+  * @brief  Record a release
+  * @param  ptr   Released block
+  * @param  size  Block size
+  * @retval None
+  */
+void HEAPTRACE_OnFree(void *ptr, uint32_t size)
+{
+  counters.freeCount++;
+  counters.liveBytes -= (size <= counters.liveBytes) ? size : counters.liveBytes;
+
+  HEAPTRACE_Remove(ptr);
+}
+
+/**
+  * @brief  malloc() of the firmware, recorded
+  * @param  size  Requested size
+  * @retval Block or NULL
+  */
+void *__wrap_malloc(size_t size)
+{
+  void *ptr = __real_malloc(size);
+
+  HEAPTRACE_OnNewlibMalloc(ptr, size, __builtin_return_address(0));
+  return ptr;
+}
+
+/**
+  * @brief  free() of the firmware, recorded
+  * @note   The record goes first: once released the address can be handed
+  *         out again
+  * @param  ptr  Block or NULL
+  * @retval None
+  */
+void __wrap_free(void *ptr)
+{
+  if (ptr != NULL)
+  {
+    HEAPTRACE_OnNewlibFree(ptr);
+  }
+  __real_free(ptr);
+}
+
+/**
+  * @brief  calloc() of the firmware, recorded
+  * @param  count  Elements
+  * @param  size   Element size
+  * @retval Block or NULL
+  */
+void *__wrap_calloc(size_t count, size_t size)
+{
+  void *ptr = __real_calloc(count, size);
+
+  HEAPTRACE_OnNewlibMalloc(ptr, count * size, __builtin_return_address(0));
+  return ptr;
+}
+
+/**
+  * @brief  realloc() of the firmware, recorded as a free and an allocation
+  * @note   On failure the old block stays live and is recorded again, under
+  *         the call site of the realloc()
+  * @param  ptr   Block or NULL
+  * @param  size  New size
+  * @retval Block, NULL on failure or when size 0 freed the block
+  */
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  void *caller = __builtin_return_address(0);
+  void *block;
+
+  if (ptr != NULL)
+  {
+    HEAPTRACE_OnNewlibFree(ptr);
+  }
+  block = __real_realloc(ptr, size);
+
+  if ((block == NULL) && (size != 0U))
+  {
+    HEAPTRACE_OnNewlibMalloc(NULL, size, caller);
+    if (ptr != NULL)
+    {
+      HEAPTRACE_OnNewlibMalloc(ptr, size, caller);
+    }
+  }
+  else if (block != NULL)
+  {
+    HEAPTRACE_OnNewlibMalloc(block, size, caller);
+  }
+  return block;
+}
+
+/**
+  * @brief  Read the newlib malloc metrics
+  * @param  metrics  Destination
+  * @retval None
+  */
+void HEAPTRACE_GetNewlibMetrics(HEAPTRACE_NewlibMetrics_t *metrics)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *metrics = newlibCounters;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Read the FreeRTOS heap metrics
+  * @param  metrics  Destination
+  * @retval None
+  */
+void HEAPTRACE_GetMetrics(HEAPTRACE_Metrics_t *metrics)
+{
+  HeapStats_t stats;
+
+  vPortGetHeapStats(&stats);
+
+  vTaskSuspendAll();
+  *metrics = counters;
+  (void)xTaskResumeAll();
+
+  metrics->freeBytes = stats.xAvailableHeapSpaceInBytes;
+  metrics->minEverFreeBytes = stats.xMinimumEverFreeBytesRemaining;
+  metrics->largestFreeBlock = stats.xSizeOfLargestFreeBlockInBytes;
+  metrics->freeBlocks = stats.xNumberOfFreeBlocks;
+  metrics->fragmentation = (stats.xAvailableHeapSpaceInBytes == 0U) ? 0U :
+      100U - ((stats.xSizeOfLargestFreeBlockInBytes * 100U) / stats.xAvailableHeapSpaceInBytes);
+}
+
+/**
+  * @brief  Start a leak check window
+  * @param  None
+  * @retval None
+  */
+void HEAPTRACE_Mark(void)
+{
+  markTick = HAL_GetTick();
+}
+
+/**
+  * @brief  Print heap metrics and live allocations
+  * @param  None
+  * @retval None
+  */
+void HEAPTRACE_Report(void)
+{
+  HEAPTRACE_Metrics_t metrics;
+  HEAPTRACE_NewlibMetrics_t calls;
+  HEAPTRACE_SbrkStats_t sbrk;
+  struct mallinfo newlib;
+  uint32_t now = HAL_GetTick();
+  uint32_t leaks = 0U;
+  uint32_t i;
+
+  HEAPTRACE_GetMetrics(&metrics);
+  HEAPTRACE_GetNewlibMetrics(&calls);
+  HEAPTRACE_GetSbrkStats(&sbrk);
+  newlib = mallinfo();
+
+  vTaskSuspendAll();
+  for (i = 0; i < HEAPTRACE_MAX_RECORDS; i++)
+  {
+    snapshot[i] = records[i];
+  }
+  (void)xTaskResumeAll();
+
+  printf("\r\nFreeRTOS heap: %lu/%lu free, min %lu, largest %lu, %lu blocks, frag %lu%%\r\n",
+         (unsigned long)metrics.freeBytes, (unsigned long)configTOTAL_HEAP_SIZE,
+         (unsigned long)metrics.minEverFreeBytes, (unsigned long)metrics.largestFreeBlock,
+         (unsigned long)metrics.freeBlocks, (unsigned long)metrics.fragmentation);
+  printf("  allocs %lu frees %lu live %lu B peak %lu B untracked %lu\r\n",
+         (unsigned long)metrics.allocCount, (unsigned long)metrics.freeCount,
+         (unsigned long)metrics.liveBytes, (unsigned long)metrics.peakLiveBytes,
+         (unsigned long)metrics.untracked);
+  if (metrics.failCount != 0U)
+  {
+    printf("  failures %lu, last %lu B from 0x%08lX\r\n",
+           (unsigned long)metrics.failCount, (unsigned long)metrics.lastFailSize,
+           (unsigned long)metrics.lastFailCaller);
+  }
+
+  printf("newlib heap: sbrk %lu/%lu B, %lu calls, %lu refused; in use %lu, free %lu\r\n",
+         (unsigned long)sbrk.usedBytes, (unsigned long)sbrk.limitBytes,
+         (unsigned long)sbrk.calls, (unsigned long)sbrk.failures,
+         (unsigned long)newlib.uordblks, (unsigned long)newlib.fordblks);
+  printf("  malloc %lu free %lu live %lu B peak %lu B untracked %lu\r\n",
+         (unsigned long)calls.allocCount, (unsigned long)calls.freeCount,
+         (unsigned long)calls.liveBytes, (unsigned long)calls.peakLiveBytes,
+         (unsigned long)calls.untracked);
+  if (calls.failCount != 0U)
+  {
+    printf("  failures %lu, last %lu B from 0x%08lX\r\n",
+           (unsigned long)calls.failCount, (unsigned long)calls.lastFailSize,
+           (unsigned long)calls.lastFailCaller);
+  }
+  printf("C library calls from interrupts: %lu\r\n",
+         (unsigned long)NEWLIB_LOCK_GetIsrViolations());
+
+  printf("Live blocks since mark (%lu ms ago):\r\n", (unsigned long)(now - markTick));
+  printf("  address     size  caller      age ms  heap\r\n");
+  for (i = 0; i < HEAPTRACE_MAX_RECORDS; i++)
+  {
+    if ((snapshot[i].ptr == NULL) || ((int32_t)(snapshot[i].tick - markTick) < 0))
+    {
+      continue;
+    }
+
+    leaks++;
+    printf("  0x%08lX %5lu  0x%08lX %7lu  %s\r\n",
+           (unsigned long)snapshot[i].ptr, (unsigned long)snapshot[i].size,
+           (unsigned long)snapshot[i].caller, (unsigned long)(now - snapshot[i].tick),
+           snapshot[i].newlib ? "newlib" : "rtos");
+  }
+  printf("  %lu leak candidate(s)\r\n", (unsigned long)leaks);
+}
+
+/**
+  * @brief  Store a live block in a free slot of the table
+  * @param  ptr     Block
+  * @param  size    Block size
+  * @param  caller  Call site
+  * @param  newlib  1 for a newlib block
+  * @retval 1 if recorded, 0 if the table is full
+  */
+static uint8_t HEAPTRACE_Add(void *ptr, uint32_t size, void *caller, uint8_t newlib)
+{
+  uint32_t i;
+
+  for (i = 0; i < HEAPTRACE_MAX_RECORDS; i++)
+  {
+    if (records[i].ptr == NULL)
+    {
+      records[i].ptr = ptr;
+      records[i].size = size;
+      records[i].caller = (uint32_t)caller;
+      records[i].tick = HAL_GetTick();
+      records[i].newlib = newlib;
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Drop the record of a released block, if it has one
+  * @param  ptr  Block
+  * @retval None
+  */
+static void HEAPTRACE_Remove(void *ptr)
+{
+  uint32_t i;
+
+  for (i = 0; i < HEAPTRACE_MAX_RECORDS; i++)
+  {
+    if (records[i].ptr == ptr)
+    {
+      records[i].ptr = NULL;
+      return;
+    }
+  }
+}
+
+/**
+  * @brief  Record a newlib allocation
+  * @param  ptr      Returned block or NULL
+  * @param  request  Requested size
+  * @param  caller   Call site
+  * @retval None
+  */
+static void HEAPTRACE_OnNewlibMalloc(void *ptr, size_t request, void *caller)
+{
+  /* Outside the critical section: it is a C library call */
+  const uint32_t size = (ptr != NULL) ? (uint32_t)malloc_usable_size(ptr) : 0U;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (ptr == NULL)
+  {
+    newlibCounters.failCount++;
+    newlibCounters.lastFailSize = (uint32_t)request;
+    newlibCounters.lastFailCaller = (uint32_t)caller;
+  }
+  else
+  {
+    newlibCounters.allocCount++;
+    newlibCounters.liveBytes += size;
+    if (newlibCounters.liveBytes > newlibCounters.peakLiveBytes)
+    {
+      newlibCounters.peakLiveBytes = newlibCounters.liveBytes;
+    }
+    if (HEAPTRACE_Add(ptr, size, caller, 1U) == 0U)
+    {
+      newlibCounters.untracked++;
+    }
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Record a newlib release
+  * @param  ptr  Block about to be released
+  * @retval None
+  */
+static void HEAPTRACE_OnNewlibFree(void *ptr)
+{
+  const uint32_t size = (uint32_t)malloc_usable_size(ptr);
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  newlibCounters.freeCount++;
+  newlibCounters.liveBytes -= (size <= newlibCounters.liveBytes) ? size : newlibCounters.liveBytes;
+  HEAPTRACE_Remove(ptr);
+  __set_PRIMASK(primask);
+}
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    heap_trace.h
+  * @brief   Heap instrumentation interface
+  * @details This file contains the function prototypes for the heap
+  *          instrumentation. The FreeRTOS heap_4 allocator reports every
+  *          allocation and release through the traceMALLOC/traceFREE hooks
+  *          defined in FreeRTOSConfig.h; this module records call site, size
+  *          and tick of each live block, derives fragmentation metrics from
+  *          vPortGetHeapStats() and prints leak reports. The newlib heap
+  *          behind _sbrk() is reported alongside; its malloc(), calloc(),
+  *          realloc() and free() are wrapped at link time
+  *          (-Wl,--wrap=malloc,...) and fill the same table.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __HEAP_TRACE_H__
+#define __HEAP_TRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define HEAPTRACE_MAX_RECORDS     64U   /* Live allocations tracked individually */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   FreeRTOS heap metrics
+ */
+typedef struct
+{
+  uint32_t freeBytes;           /*!< Bytes currently free */
+  uint32_t minEverFreeBytes;    /*!< Lowest free byte count since boot */
+  uint32_t largestFreeBlock;    /*!< Largest single free block */
+  uint32_t freeBlocks;          /*!< Number of free blocks */
+  uint32_t fragmentation;       /*!< 100 * (1 - largest / free), in percent */
+  uint32_t liveBytes;           /*!< Bytes held by live allocations */
+  uint32_t peakLiveBytes;       /*!< Highest liveBytes since boot */
+  uint32_t allocCount;          /*!< Successful allocations */
+  uint32_t freeCount;           /*!< Releases */
+  uint32_t failCount;           /*!< Failed allocations */
+  uint32_t lastFailSize;        /*!< Size of the last failed request */
+  uint32_t lastFailCaller;      /*!< Call site of the last failed request */
+  uint32_t untracked;           /*!< Allocations not recorded (table full) */
+} HEAPTRACE_Metrics_t;
+
+/**
+ * @brief   Newlib heap (_sbrk) metrics
+ */
+typedef struct
+{
+  uint32_t usedBytes;           /*!< Bytes handed to newlib by _sbrk() */
+  uint32_t limitBytes;          /*!< Bytes available before the MSP stack */
+  uint32_t calls;               /*!< Calls to _sbrk() */
+  uint32_t failures;            /*!< Calls refused with ENOMEM */
+} HEAPTRACE_SbrkStats_t;
+
+/**
+ * @brief   Newlib malloc metrics, from the link time wrappers
+ * @note    Allocations newlib makes for itself (_malloc_r, e.g. stdio
+ *          buffers) bypass the wrappers and only show in mallinfo()
+ */
+typedef struct
+{
+  uint32_t liveBytes;           /*!< Usable bytes held by live allocations */
+  uint32_t peakLiveBytes;       /*!< Highest liveBytes since boot */
+  uint32_t allocCount;          /*!< Successful allocations, realloc included */
+  uint32_t freeCount;           /*!< Releases, realloc included */
+  uint32_t failCount;           /*!< Failed allocations */
+  uint32_t lastFailSize;        /*!< Size of the last failed request */
+  uint32_t lastFailCaller;      /*!< Call site of the last failed request */
+  uint32_t untracked;           /*!< Allocations not recorded (table full) */
+} HEAPTRACE_NewlibMetrics_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Records an allocation reported by traceMALLOC
+ * @note    Called by heap_4 with the scheduler suspended; ptr is NULL when
+ *          the allocation failed
+ * @param   ptr     Returned block
+ * @param   size    Requested size including the heap_4 header
+ * @param   caller  Return address of the pvPortMalloc() call
+ * @retval  None
+ */
+void HEAPTRACE_OnMalloc(void *ptr, uint32_t size, void *caller);
+
+/**
+ * @brief   Records a release reported by traceFREE
+ * @param   ptr   Released block
+ * @param   size  Block size including the heap_4 header
+ * @retval  None
+ */
+void HEAPTRACE_OnFree(void *ptr, uint32_t size);
+
+/**
+ * @brief   Reads the FreeRTOS heap metrics
+ * @param   metrics  Destination
+ * @retval  None
+ */
+void HEAPTRACE_GetMetrics(HEAPTRACE_Metrics_t *metrics);
+
+/**
+ * @brief   Reads the newlib malloc metrics
+ * @param   metrics  Destination
+ * @retval  None
+ */
+void HEAPTRACE_GetNewlibMetrics(HEAPTRACE_NewlibMetrics_t *metrics);
+
+/**
+ * @brief   Reads the newlib heap metrics
+ * @note    Implemented next to _sbrk() in Core/Src/sysmem.c
+ * @param   stats  Destination
+ * @retval  None
+ */
+void HEAPTRACE_GetSbrkStats(HEAPTRACE_SbrkStats_t *stats);
+
+/**
+ * @brief   Starts a leak check window
+ * @details Allocations made after this call that are still live when
+ *          HEAPTRACE_Report() runs are flagged as leak candidates
+ * @param   None
+ * @retval  None
+ */
+void HEAPTRACE_Mark(void);
+
+/**
+ * @brief   Prints heap metrics and the live allocation table
+ * @param   None
+ * @retval  None
+ */
+void HEAPTRACE_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HEAP_TRACE_H__ */
@@ -20,16 +20,28 @@
  */
 I2C_HandleTypeDef hi2c3;
 
+/**
+ * @brief   I2C3 DMA handles
+ * @details RX on DMA1 Stream2 channel 3, TX on DMA1 Stream4 channel 3
+ */
+DMA_HandleTypeDef hdma_i2c3_rx;
+DMA_HandleTypeDef hdma_i2c3_tx;
+
+/* Private function prototypes -----------------------------------------------*/
+static void I2C_DMA_Init(void);
+
 /**
   * @brief  I2C Initialization Function
   * @details Configures the I2C3 peripheral with the following settings:
-  *          - Clock speed: 100 kHz (standard mode)
-  *          - Duty cycle: 50% (2:1 ratio)
+  *          - Clock speed: 400 kHz (fast mode)
+  *          - Duty cycle: Tlow/Thigh = 2
   *          - 7-bit addressing mode
   *          - Own address: 0x00 (acts as master only)
   *          - Dual addressing mode: Disabled
   *          - General call mode: Disabled
   *          - Clock stretching: Enabled (NOSTRETCH disabled)
+  *          - DMA1 Stream2/Stream4 attached for RX/TX
+  *          - Event and error interrupts enabled for non-blocking transfers
   *
   * @note   I2C3 is commonly used for communication with sensors,
   *         audio codec, or EEPROM on the STM32F429 board
@@ -39,8 +51,8 @@ I2C_HandleTypeDef hi2c3;
 void I2C_Init(void)
 {
   hi2c3.Instance = I2C3;                               /* Select I2C3 peripheral */
-  hi2c3.Init.ClockSpeed = 100000;                      /* 100 kHz clock (standard mode) */
-  hi2c3.Init.DutyCycle = I2C_DUTYCYCLE_2;              /* 50% duty cycle */
+  hi2c3.Init.ClockSpeed = 400000;                      /* 400 kHz clock (fast mode) */
+  hi2c3.Init.DutyCycle = I2C_DUTYCYCLE_2;              /* Tlow/Thigh = 2 */
   hi2c3.Init.OwnAddress1 = 0;                          /* Own address when in slave mode (not used) */
   hi2c3.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT; /* 7-bit addressing mode */
   hi2c3.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE; /* Dual addressing disabled */
@@ -53,4 +65,65 @@ void I2C_Init(void)
   {
     Error_Handler();  /* Call error handler if initialization fails */
   }
+
+  /* Attach DMA streams and enable the interrupts of the transaction engine */
+  I2C_DMA_Init();
+
+  HAL_NVIC_SetPriority(I2C3_EV_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(I2C3_EV_IRQn);
+  HAL_NVIC_SetPriority(I2C3_ER_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(I2C3_ER_IRQn);
+}
+
+/**
+  * @brief  I2C3 DMA Initialization Function
+  * @details Configures DMA1 Stream2 (RX) and Stream4 (TX) for I2C3 in
+  *          normal byte mode and links them to hi2c3. The interrupts use a
+  *          priority at or below configMAX_SYSCALL_INTERRUPT_PRIORITY so the
+  *          completion callbacks may use FreeRTOS FromISR services.
+  * @param  None
+  * @retval None
+  */
+static void I2C_DMA_Init(void)
+{
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* I2C3 RX: peripheral to memory */
+  hdma_i2c3_rx.Instance = DMA1_Stream2;
+  hdma_i2c3_rx.Init.Channel = DMA_CHANNEL_3;
+  hdma_i2c3_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_i2c3_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_i2c3_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_i2c3_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_i2c3_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_i2c3_rx.Init.Mode = DMA_NORMAL;
+  hdma_i2c3_rx.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_i2c3_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_i2c3_rx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(&hi2c3, hdmarx, hdma_i2c3_rx);
+
+  /* I2C3 TX: memory to peripheral */
+  hdma_i2c3_tx.Instance = DMA1_Stream4;
+  hdma_i2c3_tx.Init.Channel = DMA_CHANNEL_3;
+  hdma_i2c3_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_i2c3_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_i2c3_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_i2c3_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_i2c3_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_i2c3_tx.Init.Mode = DMA_NORMAL;
+  hdma_i2c3_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+  hdma_i2c3_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_i2c3_tx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(&hi2c3, hdmatx, hdma_i2c3_tx);
+
+  HAL_NVIC_SetPriority(DMA1_Stream2_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream2_IRQn);
+  HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
 }
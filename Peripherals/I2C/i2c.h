@@ -39,6 +39,13 @@ void I2C_Init(void);
  */
 extern I2C_HandleTypeDef hi2c3;
 
+/**
+ * @brief   I2C3 DMA handles
+ * @details Serviced from DMA1_Stream2_IRQHandler and DMA1_Stream4_IRQHandler
+ */
+extern DMA_HandleTypeDef hdma_i2c3_rx;
+extern DMA_HandleTypeDef hdma_i2c3_tx;
+
 #ifdef __cplusplus
 }
 #endif
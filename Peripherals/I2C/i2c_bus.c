@@ -0,0 +1,824 @@
+/**
+  ******************************************************************************
+  * @file    i2c_bus.c
+  * @brief   I2C3 bus transaction engine implementation
+  * @details This file provides the transaction queue for I2C3. Transactions
+  *          form a singly linked FIFO; the head runs on the interrupt or DMA
+  *          driven HAL calls while the rest wait. The completion callbacks
+  *          record the latency of the device, report the result and start
+  *          the next transaction from interrupt context.
+  *
+  *          A slave that lost a clock edge in the middle of a byte keeps SDA
+  *          low forever, which the peripheral reports as a permanently busy
+  *          bus. Clocking SCL by hand until SDA is released and then issuing
+  *          a STOP returns the slave to idle; SWRST clears the peripheral
+  *          state machine. That takes about 100 us of busy waiting, so it
+  *          never runs in interrupt context: an interrupt that finds the bus
+  *          stuck only marks the recovery pending and parks the queue, and
+  *          the recovery runs in the timer service task, or earlier in the
+  *          next submit or blocking helper called from a task.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "i2c_bus.h"
+#include "i2c.h"
+#include "../SYS/dwt.h"
+#include "cmsis_os.h"
+#include "timers.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define I2CBUS_RECOVERY_CLOCKS    9U
+#define I2CBUS_HALF_BIT_US        5U      /* 100 kHz recovery clock */
+#define I2CBUS_RECOVER_ERRORS     (HAL_I2C_ERROR_BERR | HAL_I2C_ERROR_ARLO | HAL_I2C_ERROR_TIMEOUT)
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Bus ownership
+ */
+typedef enum
+{
+  I2CBUS_OWNER_IDLE = 0,
+  I2CBUS_OWNER_ASYNC,     /* Queue head is running */
+  I2CBUS_OWNER_POLLED,    /* A blocking helper holds the bus */
+  I2CBUS_OWNER_RECOVERY   /* A task is recovering the bus */
+} I2CBUS_Owner_t;
+
+/* Private variables ---------------------------------------------------------*/
+static I2CBUS_Transaction_t *queueHead;
+static I2CBUS_Transaction_t *queueTail;
+static volatile I2CBUS_Owner_t owner = I2CBUS_OWNER_IDLE;
+static volatile uint8_t retimePending;
+static volatile uint8_t recoverPending;
+static volatile uint8_t recoveryQueued;   /* Handed to the timer service task */
+
+static I2CBUS_Stats_t stats;
+static I2CBUS_DeviceStats_t deviceStats[I2CBUS_MAX_DEVICES];
+
+/* Private function prototypes -----------------------------------------------*/
+static void I2CBUS_StartNext(void);
+static void I2CBUS_Complete(HAL_StatusTypeDef status);
+static void I2CBUS_Account(uint8_t address, uint32_t submitCycles, HAL_StatusTypeDef status);
+static HAL_StatusTypeDef I2CBUS_Wait(I2CBUS_Transaction_t *transaction, uint32_t timeoutMs);
+static HAL_StatusTypeDef I2CBUS_Polled(I2CBUS_Transaction_t *transaction, uint32_t timeoutMs);
+static void I2CBUS_DelayUs(uint32_t us);
+static void I2CBUS_DoneCallback(I2CBUS_Transaction_t *transaction);
+static void I2CBUS_ApplyClock(void);
+static void I2CBUS_RequestRecovery(void);
+static void I2CBUS_ServiceRecovery(void);
+static void I2CBUS_RecoveryCallback(void *parameter1, uint32_t parameter2);
+
+/**
+  * @brief  Transaction engine initialization
+  * @param  None
+  * @retval None
+  */
+void I2CBUS_Init(void)
+{
+  DWT_Init();
+
+  queueHead = NULL;
+  queueTail = NULL;
+  owner = I2CBUS_OWNER_IDLE;
+  recoverPending = 0U;
+  memset(&stats, 0, sizeof(stats));
+  memset(deviceStats, 0, sizeof(deviceStats));
+
+  /* A reset in the middle of a read can leave a slave holding SDA */
+  if (__HAL_I2C_GET_FLAG(&hi2c3, I2C_FLAG_BUSY) != RESET)
+  {
+    I2CBUS_Recover();
+  }
+}
+
+/**
+  * @brief  Queue a transaction
+  * @param  transaction  Descriptor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2CBUS_Submit(I2CBUS_Transaction_t *transaction)
+{
+  uint32_t primask;
+
+  if ((transaction == NULL) || (transaction->data == NULL) ||
+      (transaction->length == 0U) || (transaction->regSize > 2U))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (transaction->status == HAL_BUSY)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  transaction->status = HAL_BUSY;
+  transaction->submitCycles = DWT_GetCycles();
+  transaction->next = NULL;
+  if (queueTail == NULL)
+  {
+    queueHead = transaction;
+  }
+  else
+  {
+    queueTail->next = transaction;
+  }
+  queueTail = transaction;
+
+  stats.queueDepth++;
+  if (stats.queueDepth > stats.queuePeak)
+  {
+    stats.queuePeak = stats.queueDepth;
+  }
+
+  if (owner == I2CBUS_OWNER_IDLE)
+  {
+    I2CBUS_StartNext();
+  }
+
+  __set_PRIMASK(primask);
+
+  /* A task can afford the recovery the queue may be waiting for */
+  if ((__get_IPSR() == 0U) && (primask == 0U))
+  {
+    I2CBUS_ServiceRecovery();
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Blocking register read
+  * @param  address    Device address
+  * @param  reg        First register
+  * @param  data       Destination
+  * @param  length     Length
+  * @param  timeoutMs  Timeout
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2CBUS_MemRead(uint8_t address, uint8_t reg, uint8_t *data,
+                                 uint16_t length, uint32_t timeoutMs)
+{
+  I2CBUS_Transaction_t transaction = {0};
+
+  transaction.address = address;
+  transaction.regSize = 1U;
+  transaction.reg = reg;
+  transaction.direction = I2CBUS_READ;
+  transaction.data = data;
+  transaction.length = length;
+
+  return I2CBUS_Wait(&transaction, timeoutMs);
+}
+
+/**
+  * @brief  Blocking register write
+  * @param  address    Device address
+  * @param  reg        First register
+  * @param  data       Bytes to write
+  * @param  length     Length
+  * @param  timeoutMs  Timeout
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2CBUS_MemWrite(uint8_t address, uint8_t reg, const uint8_t *data,
+                                  uint16_t length, uint32_t timeoutMs)
+{
+  I2CBUS_Transaction_t transaction = {0};
+
+  transaction.address = address;
+  transaction.regSize = 1U;
+  transaction.reg = reg;
+  transaction.direction = I2CBUS_WRITE;
+  transaction.data = (uint8_t *)data;
+  transaction.length = length;
+
+  return I2CBUS_Wait(&transaction, timeoutMs);
+}
+
+/**
+  * @brief  Free a stuck bus and reset the peripheral
+  * @param  None
+  * @retval None
+  */
+void I2CBUS_Recover(void)
+{
+  GPIO_InitTypeDef gpio = {0};
+  uint32_t i;
+
+  (void)HAL_I2C_DeInit(&hi2c3);
+
+  /* Take both lines over as open-drain outputs, released */
+  HAL_GPIO_WritePin(I2C3_SCL_GPIO_Port, I2C3_SCL_Pin, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(I2C3_SDA_GPIO_Port, I2C3_SDA_Pin, GPIO_PIN_SET);
+  gpio.Mode = GPIO_MODE_OUTPUT_OD;
+  gpio.Pull = GPIO_PULLUP;
+  gpio.Speed = GPIO_SPEED_FREQ_LOW;
+  gpio.Pin = I2C3_SCL_Pin;
+  HAL_GPIO_Init(I2C3_SCL_GPIO_Port, &gpio);
+  gpio.Pin = I2C3_SDA_Pin;
+  HAL_GPIO_Init(I2C3_SDA_GPIO_Port, &gpio);
+  I2CBUS_DelayUs(I2CBUS_HALF_BIT_US);
+
+  /* Clock out the byte the slave is still sending */
+  for (i = 0; (i < I2CBUS_RECOVERY_CLOCKS) &&
+              (HAL_GPIO_ReadPin(I2C3_SDA_GPIO_Port, I2C3_SDA_Pin) == GPIO_PIN_RESET); i++)
+  {
+    HAL_GPIO_WritePin(I2C3_SCL_GPIO_Port, I2C3_SCL_Pin, GPIO_PIN_RESET);
+    I2CBUS_DelayUs(I2CBUS_HALF_BIT_US);
+    HAL_GPIO_WritePin(I2C3_SCL_GPIO_Port, I2C3_SCL_Pin, GPIO_PIN_SET);
+    I2CBUS_DelayUs(I2CBUS_HALF_BIT_US);
+  }
+
+  /* STOP: SDA rises while SCL is high */
+  HAL_GPIO_WritePin(I2C3_SCL_GPIO_Port, I2C3_SCL_Pin, GPIO_PIN_RESET);
+  I2CBUS_DelayUs(I2CBUS_HALF_BIT_US);
+  HAL_GPIO_WritePin(I2C3_SDA_GPIO_Port, I2C3_SDA_Pin, GPIO_PIN_RESET);
+  I2CBUS_DelayUs(I2CBUS_HALF_BIT_US);
+  HAL_GPIO_WritePin(I2C3_SCL_GPIO_Port, I2C3_SCL_Pin, GPIO_PIN_SET);
+  I2CBUS_DelayUs(I2CBUS_HALF_BIT_US);
+  HAL_GPIO_WritePin(I2C3_SDA_GPIO_Port, I2C3_SDA_Pin, GPIO_PIN_SET);
+  I2CBUS_DelayUs(I2CBUS_HALF_BIT_US);
+
+  /* Clear a BUSY flag latched by the peripheral itself */
+  __HAL_RCC_I2C3_CLK_ENABLE();
+  SET_BIT(hi2c3.Instance->CR1, I2C_CR1_SWRST);
+  CLEAR_BIT(hi2c3.Instance->CR1, I2C_CR1_SWRST);
+
+  /* Restores the alternate function pins */
+  if (HAL_I2C_Init(&hi2c3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  stats.recoveries++;
+}
+
+/**
+  * @brief  Pick up a new APB1 clock
+  * @param  None
+  * @retval None
+  */
+void I2CBUS_UpdateClock(void)
+{
+  retimePending = 1U;
+}
+
+/**
+  * @brief  Read the bus statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void I2CBUS_GetStats(I2CBUS_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Read a latency table entry
+  * @param  index  Entry
+  * @param  dest   Destination
+  * @retval HAL_OK or HAL_ERROR
+  */
+HAL_StatusTypeDef I2CBUS_GetDeviceStats(uint32_t index, I2CBUS_DeviceStats_t *dest)
+{
+  uint32_t primask;
+
+  if ((index >= I2CBUS_MAX_DEVICES) ||
+      ((deviceStats[index].transfers + deviceStats[index].errors) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *dest = deviceStats[index];
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  I2C memory read complete callback
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c3)
+  {
+    I2CBUS_Complete(HAL_OK);
+  }
+}
+
+/**
+  * @brief  I2C memory write complete callback
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c3)
+  {
+    I2CBUS_Complete(HAL_OK);
+  }
+}
+
+/**
+  * @brief  I2C master receive complete callback
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c3)
+  {
+    I2CBUS_Complete(HAL_OK);
+  }
+}
+
+/**
+  * @brief  I2C master transmit complete callback
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c3)
+  {
+    I2CBUS_Complete(HAL_OK);
+  }
+}
+
+/**
+  * @brief  I2C error callback
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c3)
+  {
+    I2CBUS_Complete(HAL_ERROR);
+  }
+}
+
+/**
+  * @brief  I2C abort complete callback
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c == &hi2c3)
+  {
+    I2CBUS_Complete(HAL_ERROR);
+  }
+}
+
+/**
+  * @brief  Start the queue head
+  * @note   Called with interrupts disabled or from the I2C/DMA interrupts,
+  *         while the bus is idle. A head that fails to start is completed
+  *         with an error, which moves on to the next one. On a stuck bus
+  *         nothing starts until I2CBUS_ServiceRecovery() ran.
+  * @param  None
+  * @retval None
+  */
+static void I2CBUS_StartNext(void)
+{
+  I2CBUS_Transaction_t *t = queueHead;
+  uint16_t devAddress;
+  uint16_t memSize;
+  uint8_t useDma;
+  HAL_StatusTypeDef status;
+
+  if (t == NULL)
+  {
+    return;
+  }
+
+  /* Never let the HAL spin on a bus that a slave is holding; the queue
+     waits here until a task has recovered it */
+  if (recoverPending || (__HAL_I2C_GET_FLAG(&hi2c3, I2C_FLAG_BUSY) != RESET))
+  {
+    I2CBUS_RequestRecovery();
+    return;
+  }
+  I2CBUS_ApplyClock();
+
+  owner = I2CBUS_OWNER_ASYNC;
+  devAddress = (uint16_t)(t->address << 1);
+  memSize = (t->regSize == 2U) ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT;
+  useDma = (t->length > I2CBUS_DMA_THRESHOLD) ? 1U : 0U;
+
+  if (t->regSize == 0U)
+  {
+    if (t->direction == I2CBUS_READ)
+    {
+      status = useDma ? HAL_I2C_Master_Receive_DMA(&hi2c3, devAddress, t->data, t->length)
+                      : HAL_I2C_Master_Receive_IT(&hi2c3, devAddress, t->data, t->length);
+    }
+    else
+    {
+      status = useDma ? HAL_I2C_Master_Transmit_DMA(&hi2c3, devAddress, t->data, t->length)
+                      : HAL_I2C_Master_Transmit_IT(&hi2c3, devAddress, t->data, t->length);
+    }
+  }
+  else if (t->direction == I2CBUS_READ)
+  {
+    status = useDma ? HAL_I2C_Mem_Read_DMA(&hi2c3, devAddress, t->reg, memSize, t->data, t->length)
+                    : HAL_I2C_Mem_Read_IT(&hi2c3, devAddress, t->reg, memSize, t->data, t->length);
+  }
+  else
+  {
+    status = useDma ? HAL_I2C_Mem_Write_DMA(&hi2c3, devAddress, t->reg, memSize, t->data, t->length)
+                    : HAL_I2C_Mem_Write_IT(&hi2c3, devAddress, t->reg, memSize, t->data, t->length);
+  }
+
+  if (status != HAL_OK)
+  {
+    I2CBUS_Complete(HAL_ERROR);
+  }
+  else if (useDma)
+  {
+    stats.dmaTransfers++;
+  }
+}
+
+/**
+  * @brief  Finish the running transaction and start the next one
+  * @param  status  Transfer result
+  * @retval None
+  */
+static void I2CBUS_Complete(HAL_StatusTypeDef status)
+{
+  I2CBUS_Transaction_t *t = queueHead;
+  uint32_t errorCode = HAL_I2C_GetError(&hi2c3);
+
+  if ((owner != I2CBUS_OWNER_ASYNC) || (t == NULL))
+  {
+    return;
+  }
+
+  queueHead = t->next;
+  if (queueHead == NULL)
+  {
+    queueTail = NULL;
+  }
+  stats.queueDepth--;
+
+  if (status == HAL_OK)
+  {
+    stats.transactions++;
+  }
+  else
+  {
+    stats.errors++;
+    if ((errorCode & HAL_I2C_ERROR_AF) != 0U)
+    {
+      stats.nacks++;
+    }
+    if ((errorCode & I2CBUS_RECOVER_ERRORS) != 0U)
+    {
+      recoverPending = 1U;
+    }
+  }
+  I2CBUS_Account(t->address, t->submitCycles, status);
+
+  owner = I2CBUS_OWNER_IDLE;
+  t->status = status;
+  if (t->callback != NULL)
+  {
+    t->callback(t);
+  }
+
+  /* A submit from the callback may already have started the next one */
+  if (owner == I2CBUS_OWNER_IDLE)
+  {
+    I2CBUS_StartNext();
+  }
+}
+
+/**
+  * @brief  Update the latency table
+  * @param  address       Device address
+  * @param  submitCycles  Cycle count when the transaction was queued
+  * @param  status        Transfer result
+  * @retval None
+  */
+static void I2CBUS_Account(uint8_t address, uint32_t submitCycles, HAL_StatusTypeDef status)
+{
+  I2CBUS_DeviceStats_t *entry = NULL;
+  uint32_t latencyUs = DWT_CyclesToUs(DWT_GetCycles() - submitCycles);
+  uint32_t i;
+
+  for (i = 0; i < I2CBUS_MAX_DEVICES; i++)
+  {
+    if ((deviceStats[i].transfers + deviceStats[i].errors) == 0U)
+    {
+      entry = &deviceStats[i];
+      entry->address = address;
+      break;
+    }
+    if (deviceStats[i].address == address)
+    {
+      entry = &deviceStats[i];
+      break;
+    }
+  }
+
+  if (entry == NULL)
+  {
+    return;
+  }
+
+  if (status != HAL_OK)
+  {
+    entry->errors++;
+    return;
+  }
+
+  entry->transfers++;
+  entry->lastUs = latencyUs;
+  entry->totalUs += latencyUs;
+  if (latencyUs > entry->maxUs)
+  {
+    entry->maxUs = latencyUs;
+  }
+}
+
+/**
+  * @brief  Run a transaction and wait for it
+  * @details Tasks sleep on a thread flag. If the transaction times out it is
+  *          removed from the queue, and when it was already running the bus
+  *          is recovered by the caller, so the descriptor on the caller's
+  *          stack is never touched after return.
+  * @param  transaction  Descriptor on the caller's stack
+  * @param  timeoutMs    Timeout
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2CBUS_Wait(I2CBUS_Transaction_t *transaction, uint32_t timeoutMs)
+{
+  I2CBUS_Transaction_t **link;
+  uint32_t primask;
+  uint32_t flags;
+
+  if (__get_IPSR() != 0U)
+  {
+    return HAL_ERROR;
+  }
+  if (osKernelGetState() != osKernelRunning)
+  {
+    return I2CBUS_Polled(transaction, timeoutMs);
+  }
+
+  (void)osThreadFlagsClear(I2CBUS_DONE_FLAG);
+  transaction->callback = I2CBUS_DoneCallback;
+  transaction->context = osThreadGetId();
+  if (I2CBUS_Submit(transaction) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  flags = osThreadFlagsWait(I2CBUS_DONE_FLAG, osFlagsWaitAny,
+                            (timeoutMs * osKernelGetTickFreq()) / 1000U + 1U);
+  if ((flags & osFlagsError) == 0U)
+  {
+    return transaction->status;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (transaction->status == HAL_BUSY)
+  {
+    if ((queueHead == transaction) && (owner == I2CBUS_OWNER_ASYNC))
+    {
+      /* Stuck in the middle of the transfer: abandon it, recover below */
+      (void)HAL_DMA_Abort(hi2c3.hdmarx);
+      (void)HAL_DMA_Abort(hi2c3.hdmatx);
+      recoverPending = 1U;
+      I2CBUS_Complete(HAL_TIMEOUT);
+    }
+    else
+    {
+      for (link = &queueHead; *link != NULL; link = &(*link)->next)
+      {
+        if (*link == transaction)
+        {
+          *link = transaction->next;
+          break;
+        }
+      }
+      queueTail = NULL;
+      for (link = &queueHead; *link != NULL; link = &(*link)->next)
+      {
+        queueTail = *link;
+      }
+      stats.queueDepth--;
+    }
+    transaction->status = HAL_TIMEOUT;
+  }
+  __set_PRIMASK(primask);
+
+  I2CBUS_ServiceRecovery();
+  return transaction->status;
+}
+
+/**
+  * @brief  Polled transfer before the scheduler runs
+  * @param  transaction  Descriptor
+  * @param  timeoutMs    Timeout
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2CBUS_Polled(I2CBUS_Transaction_t *transaction, uint32_t timeoutMs)
+{
+  uint32_t tickStart = HAL_GetTick();
+  uint32_t submitCycles = DWT_GetCycles();
+  uint32_t primask;
+  HAL_StatusTypeDef status;
+
+  /* Claim the bus between two queued transactions */
+  for (;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if ((owner == I2CBUS_OWNER_IDLE) && (queueHead == NULL))
+    {
+      owner = I2CBUS_OWNER_POLLED;
+      __set_PRIMASK(primask);
+      break;
+    }
+    __set_PRIMASK(primask);
+
+    if ((HAL_GetTick() - tickStart) >= timeoutMs)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* Thread context and the bus is ours: recover in place */
+  if (recoverPending || (__HAL_I2C_GET_FLAG(&hi2c3, I2C_FLAG_BUSY) != RESET))
+  {
+    recoverPending = 0U;
+    I2CBUS_Recover();
+  }
+  I2CBUS_ApplyClock();
+
+  if (transaction->direction == I2CBUS_READ)
+  {
+    status = HAL_I2C_Mem_Read(&hi2c3, (uint16_t)(transaction->address << 1), transaction->reg,
+                              I2C_MEMADD_SIZE_8BIT, transaction->data, transaction->length, timeoutMs);
+  }
+  else
+  {
+    status = HAL_I2C_Mem_Write(&hi2c3, (uint16_t)(transaction->address << 1), transaction->reg,
+                               I2C_MEMADD_SIZE_8BIT, transaction->data, transaction->length, timeoutMs);
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (status == HAL_OK)
+  {
+    stats.transactions++;
+  }
+  else
+  {
+    stats.errors++;
+  }
+  I2CBUS_Account(transaction->address, submitCycles, status);
+
+  /* Hand the bus back and start whatever queued up meanwhile */
+  owner = I2CBUS_OWNER_IDLE;
+  I2CBUS_StartNext();
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Busy wait based on the cycle counter
+  * @param  us  Microseconds
+  * @retval None
+  */
+static void I2CBUS_DelayUs(uint32_t us)
+{
+  uint32_t start = DWT_GetCycles();
+  uint32_t cycles = us * (SystemCoreClock / 1000000U);
+
+  while ((DWT_GetCycles() - start) < cycles)
+  {
+  }
+}
+
+/**
+  * @brief  Completion of a blocking helper transaction
+  * @param  transaction  Finished transaction, context is the waiting thread
+  * @retval None
+  */
+static void I2CBUS_DoneCallback(I2CBUS_Transaction_t *transaction)
+{
+  (void)osThreadFlagsSet((osThreadId_t)transaction->context, I2CBUS_DONE_FLAG);
+}
+
+/**
+  * @brief  Apply a pending clock change
+  * @details HAL_I2C_Init() recomputes the timings from the current PCLK1
+  * @note   Only while the bus is idle
+  * @param  None
+  * @retval None
+  */
+static void I2CBUS_ApplyClock(void)
+{
+  if (retimePending)
+  {
+    retimePending = 0U;
+    if (HAL_I2C_Init(&hi2c3) != HAL_OK)
+    {
+      Error_Handler();
+    }
+  }
+}
+
+/**
+  * @brief  Mark the bus for recovery and hand the recovery to a task
+  * @details Queues I2CBUS_RecoveryCallback() to the timer service task once
+  *          per recovery, so a queue that only interrupts feed still gets
+  *          going again. Before the scheduler runs the next submit or
+  *          polled helper does it.
+  * @note   Called with interrupts disabled or from the I2C/DMA interrupts
+  * @param  None
+  * @retval None
+  */
+static void I2CBUS_RequestRecovery(void)
+{
+  BaseType_t woken = pdFALSE;
+
+  recoverPending = 1U;
+  if (recoveryQueued || (osKernelGetState() != osKernelRunning))
+  {
+    return;
+  }
+
+  if (__get_IPSR() != 0U)
+  {
+    recoveryQueued = (xTimerPendFunctionCallFromISR(I2CBUS_RecoveryCallback, NULL, 0U,
+                                                    &woken) == pdPASS) ? 1U : 0U;
+    portYIELD_FROM_ISR(woken);
+  }
+  else
+  {
+    recoveryQueued = (xTimerPendFunctionCall(I2CBUS_RecoveryCallback, NULL, 0U, 0U) == pdPASS) ? 1U : 0U;
+  }
+}
+
+/**
+  * @brief  Run a pending recovery and restart the queue
+  * @note   Task context only
+  * @param  None
+  * @retval None
+  */
+static void I2CBUS_ServiceRecovery(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (!recoverPending || (owner != I2CBUS_OWNER_IDLE))
+  {
+    __set_PRIMASK(primask);
+    return;
+  }
+  owner = I2CBUS_OWNER_RECOVERY;
+  recoverPending = 0U;
+  __set_PRIMASK(primask);
+
+  I2CBUS_Recover();
+
+  __disable_irq();
+  owner = I2CBUS_OWNER_IDLE;
+  I2CBUS_StartNext();
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Deferred recovery, runs in the timer service task
+  * @param  parameter1  Unused
+  * @param  parameter2  Unused
+  * @retval None
+  */
+static void I2CBUS_RecoveryCallback(void *parameter1, uint32_t parameter2)
+{
+  (void)parameter1;
+  (void)parameter2;
+
+  recoveryQueued = 0U;
+  I2CBUS_ServiceRecovery();
+}
@@ -0,0 +1,200 @@
+/**
+  ******************************************************************************
+  * @file    i2c_bus.h
+  * @brief   I2C3 bus transaction engine interface
+  * @details This file contains the types and function prototypes of the
+  *          non-blocking transaction queue for I2C3.
+  *
+  *          A transaction addresses one device and either writes a payload
+  *          or performs the usual write-register-then-read sequence with a
+  *          repeated start. Transactions are queued and executed one after
+  *          the other from interrupt context: payloads up to
+  *          I2CBUS_DMA_THRESHOLD bytes use the interrupt driven HAL calls,
+  *          longer ones use DMA. Bus errors, arbitration loss and a bus held
+  *          low by a slave trigger a recovery (nine SCL pulses, STOP, and a
+  *          software reset of the peripheral) before the queue continues.
+  *          The recovery busy-waits, so it runs in task context: the timer
+  *          service task, or the next task that submits or waits on the bus.
+  *
+  *          The blocking helpers I2CBUS_MemRead()/I2CBUS_MemWrite() sleep on
+  *          a thread flag instead of polling, so the calling task gives the
+  *          CPU away for the duration of the transfer.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __I2C_BUS_H__
+#define __I2C_BUS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define I2CBUS_DMA_THRESHOLD      4U      /* Longer payloads use DMA */
+#define I2CBUS_MAX_DEVICES        8U      /* Devices tracked in the latency table */
+#define I2CBUS_DONE_FLAG          0x0100U /* Thread flag used by the blocking helpers */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Transfer direction
+ */
+typedef enum
+{
+  I2CBUS_WRITE = 0,
+  I2CBUS_READ
+} I2CBUS_Direction_t;
+
+struct I2CBUS_Transaction;
+
+/**
+ * @brief   Completion callback
+ * @note    Runs in interrupt context. The transaction may be submitted again
+ *          from inside the callback.
+ * @param   transaction  Finished transaction, status holds the result
+ */
+typedef void (*I2CBUS_Callback_t)(struct I2CBUS_Transaction *transaction);
+
+/**
+ * @brief   Transaction descriptor
+ * @details Owned by the caller and must stay valid until the callback ran.
+ *          Buffers must be DMA reachable (SRAM or SDRAM, not CCM RAM).
+ */
+typedef struct I2CBUS_Transaction
+{
+  uint8_t address;                    /*!< 7-bit device address */
+  uint8_t regSize;                    /*!< Register address bytes: 0, 1 or 2 */
+  uint16_t reg;                       /*!< Register address */
+  I2CBUS_Direction_t direction;       /*!< Write payload or read into data */
+  uint8_t *data;                      /*!< Payload */
+  uint16_t length;                    /*!< Payload length in bytes */
+  I2CBUS_Callback_t callback;         /*!< Completion callback, or NULL */
+  void *context;                      /*!< Free for the submitter */
+  volatile HAL_StatusTypeDef status;  /*!< HAL_BUSY while queued or running */
+  uint32_t submitCycles;              /*!< Queue entry time, internal */
+  struct I2CBUS_Transaction *next;    /*!< Queue link, internal */
+} I2CBUS_Transaction_t;
+
+/**
+ * @brief   Bus statistics
+ */
+typedef struct
+{
+  uint32_t transactions;      /*!< Transactions completed successfully */
+  uint32_t dmaTransfers;      /*!< Of which used DMA */
+  uint32_t errors;            /*!< Failed transactions */
+  uint32_t nacks;             /*!< Of which were not acknowledged */
+  uint32_t recoveries;        /*!< Bus recoveries performed */
+  uint32_t queueDepth;        /*!< Transactions waiting now */
+  uint32_t queuePeak;         /*!< Highest number of waiting transactions */
+} I2CBUS_Stats_t;
+
+/**
+ * @brief   Per-device latency, submit to completion including queueing
+ */
+typedef struct
+{
+  uint8_t address;            /*!< 7-bit device address */
+  uint32_t transfers;         /*!< Transactions completed */
+  uint32_t errors;            /*!< Transactions failed */
+  uint32_t lastUs;            /*!< Latency of the last transaction */
+  uint32_t maxUs;             /*!< Worst latency */
+  uint32_t totalUs;           /*!< Sum of latencies, for the average */
+} I2CBUS_DeviceStats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the transaction engine
+ * @note    I2C_Init() must have run. Frees a stuck bus if needed.
+ * @param   None
+ * @retval  None
+ */
+void I2CBUS_Init(void);
+
+/**
+ * @brief   Queues a transaction
+ * @details Starts it at once when the bus is idle. Safe from tasks and from
+ *          interrupts at or below configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ *          From a task with interrupts enabled it also runs a pending bus
+ *          recovery first.
+ * @param   transaction  Descriptor to queue
+ * @retval  HAL_OK, HAL_BUSY if the descriptor is still pending, or HAL_ERROR
+ *          for an invalid descriptor
+ */
+HAL_StatusTypeDef I2CBUS_Submit(I2CBUS_Transaction_t *transaction);
+
+/**
+ * @brief   Reads registers and waits for the result
+ * @details From a task the caller sleeps until completion. Before the
+ *          scheduler runs the transfer is polled once the queue is empty.
+ *          Must not be called from an interrupt (returns HAL_ERROR).
+ * @param   address    7-bit device address
+ * @param   reg        First register
+ * @param   data       Destination
+ * @param   length     Number of bytes
+ * @param   timeoutMs  Maximum wait
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef I2CBUS_MemRead(uint8_t address, uint8_t reg, uint8_t *data,
+                                 uint16_t length, uint32_t timeoutMs);
+
+/**
+ * @brief   Writes registers and waits for the result
+ * @details Same waiting rules as I2CBUS_MemRead()
+ * @param   address    7-bit device address
+ * @param   reg        First register
+ * @param   data       Bytes to write
+ * @param   length     Number of bytes
+ * @param   timeoutMs  Maximum wait
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef I2CBUS_MemWrite(uint8_t address, uint8_t reg, const uint8_t *data,
+                                  uint16_t length, uint32_t timeoutMs);
+
+/**
+ * @brief   Frees a stuck bus and resets the peripheral
+ * @details Drives up to nine SCL pulses until the slave releases SDA,
+ *          generates a STOP and pulses SWRST before re-initializing I2C3.
+ *          Takes about 100 us.
+ * @note    Only call from a task or before the scheduler, while no
+ *          transaction is running
+ * @param   None
+ * @retval  None
+ */
+void I2CBUS_Recover(void);
+
+/**
+ * @brief   Picks up a new APB1 clock
+ * @details The FREQ, CCR and TRISE timings can only be written with the
+ *          peripheral disabled, so they are recomputed before the next
+ *          transaction starts; the one running finishes at the old timing.
+ * @note    Called by the clock governor after a clock change
+ * @param   None
+ * @retval  None
+ */
+void I2CBUS_UpdateClock(void);
+
+/**
+ * @brief   Reads the bus statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void I2CBUS_GetStats(I2CBUS_Stats_t *stats);
+
+/**
+ * @brief   Reads an entry of the per-device latency table
+ * @param   index  Entry, 0 .. I2CBUS_MAX_DEVICES - 1
+ * @param   stats  Destination
+ * @retval  HAL_OK, or HAL_ERROR if the entry is unused
+ */
+HAL_StatusTypeDef I2CBUS_GetDeviceStats(uint32_t index, I2CBUS_DeviceStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __I2C_BUS_H__ */
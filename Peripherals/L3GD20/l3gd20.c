@@ -0,0 +1,491 @@
+/**
+  ******************************************************************************
+  * @file    l3gd20.c
+  * @brief   L3GD20 gyroscope driver implementation
+  * @details This file provides the FIFO streaming driver for the on-board
+  *          gyroscope. A watermark interrupt runs a two step DMA chain
+  *          through the shared SPI5 bus queue without any blocking transfer
+  *          in interrupt context:
+  *          1. FIFO_SRC is read (2 bytes) to learn how many samples wait
+  *          2. All of them are read in one burst starting at OUT_X_L; with
+  *             the FIFO enabled the auto-incremented address wraps from
+  *             OUT_Z_H back to OUT_X_L, so 6 * n bytes return n samples
+  *          The chain restarts by itself if INT2 is still high afterwards,
+  *          because the rising edge for the next watermark has then already
+  *          been missed.
+  *
+  *          At 760 Hz and a watermark of 16 samples the driver runs about
+  *          48 times per second, each time for two short DMA completions.
+  *          The I3G4250D of later boards has the same register map but runs
+  *          the same DR setting at 800 Hz; WHO_AM_I selects the period.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "l3gd20.h"
+#include "../SPI/spi_bus.h"
+#include "../SYS/dwt.h"
+#include "../TIM/timebase.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define L3GD20_SAMPLE_BYTES       6U
+#define L3GD20_BURST_BYTES        (1U + (L3GD20_FIFO_DEPTH * L3GD20_SAMPLE_BYTES))
+#define L3GD20_SPI_TIMEOUT_MS     10U
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   DMA chain state
+ */
+typedef enum
+{
+  L3GD20_STATE_IDLE = 0,
+  L3GD20_STATE_FIFO_SRC,
+  L3GD20_STATE_BURST
+} L3GD20_State_t;
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Bus settings: 10 MHz at most (5.25 MHz at 168 MHz HCLK), mode 0
+ */
+static const SPIBUS_Device_t gyroDevice =
+{
+  .name = "l3gd20",
+  .csPort = NCS_MEMS_SPI_GPIO_Port,
+  .csPin = NCS_MEMS_SPI_Pin,
+  .maxClockHz = 10000000U,
+  .polarity = SPI_POLARITY_LOW,
+  .phase = SPI_PHASE_1EDGE
+};
+
+/**
+ * @brief   DMA buffers (SRAM, reachable by DMA2)
+ */
+static uint8_t txBuffer[L3GD20_BURST_BYTES] __attribute__((aligned(4)));
+static uint8_t rxBuffer[L3GD20_BURST_BYTES] __attribute__((aligned(4)));
+static uint8_t srcCommand[2] = { L3GD20_REG_FIFO_SRC | L3GD20_SPI_READ, 0x00U };
+
+/**
+ * @brief   Bus transactions of the chain
+ */
+static SPIBUS_Transaction_t fifoSrcTransaction;
+static SPIBUS_Transaction_t burstTransaction;
+
+/**
+ * @brief   Converted samples of the last burst
+ */
+static L3GD20_Sample_t samples[L3GD20_FIFO_DEPTH];
+static L3GD20_Sample_t latest;
+static volatile uint8_t haveLatest;
+
+static volatile L3GD20_State_t state = L3GD20_STATE_IDLE;
+static uint32_t burstCount;
+static uint64_t burstTimestampUs;
+static float sensitivity;          /* deg/s per LSB */
+static uint32_t odrHz = L3GD20_ODR_HZ;
+static uint32_t samplePeriodUs = L3GD20_SAMPLE_PERIOD_US;
+
+static L3GD20_Callback_t sampleCallbacks[L3GD20_MAX_CALLBACKS];
+static void *sampleContexts[L3GD20_MAX_CALLBACKS];
+static uint32_t callbackCount;
+
+static L3GD20_Stats_t stats;
+static uint32_t loadLastCycles;
+static uint32_t loadLastIsrCycles;
+
+/* Private function prototypes -----------------------------------------------*/
+static void L3GD20_StartFifoSrc(void);
+static void L3GD20_StartBurst(uint8_t fifoSrc);
+static void L3GD20_CheckHeadroom(void);
+static void L3GD20_Publish(void);
+static void L3GD20_FifoSrcDone(SPIBUS_Transaction_t *transaction);
+static void L3GD20_BurstDone(SPIBUS_Transaction_t *transaction);
+
+/**
+  * @brief  Gyroscope initialization
+  * @param  fullScale  Measurement range
+  * @retval HAL status
+  */
+HAL_StatusTypeDef L3GD20_Init(L3GD20_FullScale_t fullScale)
+{
+  uint8_t id = 0U;
+  uint8_t ctrl4;
+
+  DWT_Init();
+
+  if (L3GD20_ReadReg(L3GD20_REG_WHO_AM_I, &id) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Only parts whose DR/BW table and FIFO are known; the L3GD20H (0xD7) differs */
+  if (id == L3GD20_ID)
+  {
+    odrHz = L3GD20_ODR_HZ;
+  }
+  else if (id == I3G4250D_ID)
+  {
+    odrHz = I3G4250D_ODR_HZ;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+  samplePeriodUs = 1000000U / odrHz;
+
+  switch (fullScale)
+  {
+    case L3GD20_FS_250DPS:
+      ctrl4 = L3GD20_CTRL4_FS_250;
+      sensitivity = 0.00875f;
+      break;
+    case L3GD20_FS_500DPS:
+      ctrl4 = L3GD20_CTRL4_FS_500;
+      sensitivity = 0.0175f;
+      break;
+    default:
+      ctrl4 = L3GD20_CTRL4_FS_2000;
+      sensitivity = 0.070f;
+      break;
+  }
+
+  /* Power down while configuring, flush the FIFO through bypass mode */
+  if ((L3GD20_WriteReg(L3GD20_REG_CTRL1, 0x00U) != HAL_OK) ||
+      (L3GD20_WriteReg(L3GD20_REG_CTRL2, 0x00U) != HAL_OK) ||
+      (L3GD20_WriteReg(L3GD20_REG_CTRL3, L3GD20_CTRL3_I2_WTM) != HAL_OK) ||
+      (L3GD20_WriteReg(L3GD20_REG_CTRL4, ctrl4) != HAL_OK) ||
+      (L3GD20_WriteReg(L3GD20_REG_FIFO_CTRL, L3GD20_FIFO_MODE_BYPASS) != HAL_OK) ||
+      (L3GD20_WriteReg(L3GD20_REG_FIFO_CTRL,
+                       L3GD20_FIFO_MODE_STREAM | L3GD20_FIFO_WATERMARK) != HAL_OK) ||
+      (L3GD20_WriteReg(L3GD20_REG_CTRL5, L3GD20_CTRL5_FIFO_EN) != HAL_OK) ||
+      (L3GD20_WriteReg(L3GD20_REG_CTRL1, L3GD20_CTRL1_ODR760_BW100 |
+                       L3GD20_CTRL1_PD | L3GD20_CTRL1_XYZ_EN) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The burst command byte never changes, the rest clocks dummy bytes */
+  memset(txBuffer, 0, sizeof(txBuffer));
+  txBuffer[0] = L3GD20_REG_OUT_X_L | L3GD20_SPI_READ | L3GD20_SPI_AUTO_INC;
+
+  fifoSrcTransaction.device = &gyroDevice;
+  fifoSrcTransaction.txData = srcCommand;
+  fifoSrcTransaction.rxData = rxBuffer;
+  fifoSrcTransaction.length = sizeof(srcCommand);
+  fifoSrcTransaction.callback = L3GD20_FifoSrcDone;
+
+  burstTransaction.device = &gyroDevice;
+  burstTransaction.txData = txBuffer;
+  burstTransaction.rxData = rxBuffer;
+  burstTransaction.callback = L3GD20_BurstDone;
+
+  loadLastCycles = DWT_GetCycles();
+  loadLastIsrCycles = 0U;
+
+  HAL_NVIC_SetPriority(EXTI2_IRQn, L3GD20_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(EXTI2_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Add a sample consumer
+  * @param  callback  Consumer
+  * @param  context   Consumer context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef L3GD20_AddCallback(L3GD20_Callback_t callback, void *context)
+{
+  uint32_t primask;
+
+  if ((callback == NULL) || (callbackCount >= L3GD20_MAX_CALLBACKS))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  sampleCallbacks[callbackCount] = callback;
+  sampleContexts[callbackCount] = context;
+  callbackCount++;
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Blocking register read
+  * @param  reg    Register
+  * @param  value  Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef L3GD20_ReadReg(uint8_t reg, uint8_t *value)
+{
+  uint8_t tx[2] = { (uint8_t)(reg | L3GD20_SPI_READ), 0x00U };
+  uint8_t rx[2] = { 0U, 0U };
+  HAL_StatusTypeDef status;
+
+  status = SPIBUS_TransferBlocking(&gyroDevice, tx, rx, 2, L3GD20_SPI_TIMEOUT_MS);
+
+  *value = rx[1];
+  return status;
+}
+
+/**
+  * @brief  Blocking register write
+  * @param  reg    Register
+  * @param  value  Value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef L3GD20_WriteReg(uint8_t reg, uint8_t value)
+{
+  uint8_t tx[2] = { reg, value };
+
+  return SPIBUS_TransferBlocking(&gyroDevice, tx, NULL, 2, L3GD20_SPI_TIMEOUT_MS);
+}
+
+/**
+  * @brief  Watermark interrupt entry
+  * @param  None
+  * @retval None
+  */
+void L3GD20_IrqHandler(void)
+{
+  uint32_t t0 = DWT_GetCycles();
+
+  if (state != L3GD20_STATE_IDLE)
+  {
+    /* The running chain re-checks INT2 when it finishes */
+    stats.busySkips++;
+  }
+  else
+  {
+    L3GD20_StartFifoSrc();
+  }
+
+  stats.isrCycles += DWT_GetCycles() - t0;
+}
+
+/**
+  * @brief  FIFO_SRC read finished
+  * @param  transaction  Bus transaction
+  * @retval None
+  */
+static void L3GD20_FifoSrcDone(SPIBUS_Transaction_t *transaction)
+{
+  uint32_t t0 = DWT_GetCycles();
+
+  if (transaction->status != HAL_OK)
+  {
+    stats.errors++;
+    state = L3GD20_STATE_IDLE;
+  }
+  else
+  {
+    L3GD20_StartBurst(rxBuffer[1]);
+  }
+
+  stats.isrCycles += DWT_GetCycles() - t0;
+}
+
+/**
+  * @brief  Sample burst finished
+  * @param  transaction  Bus transaction
+  * @retval None
+  */
+static void L3GD20_BurstDone(SPIBUS_Transaction_t *transaction)
+{
+  uint32_t t0 = DWT_GetCycles();
+
+  if (transaction->status != HAL_OK)
+  {
+    stats.errors++;
+  }
+  else
+  {
+    L3GD20_CheckHeadroom();
+    L3GD20_Publish();
+  }
+  state = L3GD20_STATE_IDLE;
+
+  /* INT2 still asserted: the FIFO refilled past the watermark meanwhile */
+  if (HAL_GPIO_ReadPin(MEMS_INT2_GPIO_Port, MEMS_INT2_Pin) == GPIO_PIN_SET)
+  {
+    L3GD20_StartFifoSrc();
+  }
+
+  stats.isrCycles += DWT_GetCycles() - t0;
+}
+
+/**
+  * @brief  Read the driver statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void L3GD20_GetStats(L3GD20_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Most recent sample
+  * @param  sample  Destination
+  * @retval HAL_OK or HAL_ERROR
+  */
+HAL_StatusTypeDef L3GD20_GetLatest(L3GD20_Sample_t *sample)
+{
+  uint32_t primask;
+
+  if (!haveLatest)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *sample = latest;
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Output data rate of the detected device
+  * @param  None
+  * @retval Rate in Hz
+  */
+uint32_t L3GD20_GetOdrHz(void)
+{
+  return odrHz;
+}
+
+/**
+  * @brief  Driver CPU load since the previous call
+  * @note   Call at least every 25 s so the cycle counter does not wrap
+  * @param  None
+  * @retval Load in 0.01 %
+  */
+uint32_t L3GD20_GetCpuLoad(void)
+{
+  uint32_t now = DWT_GetCycles();
+  uint32_t isr = stats.isrCycles;
+  uint32_t elapsed = now - loadLastCycles;
+  uint32_t busy = isr - loadLastIsrCycles;
+
+  loadLastCycles = now;
+  loadLastIsrCycles = isr;
+
+  return (elapsed == 0U) ? 0U : (uint32_t)(((uint64_t)busy * 10000U) / elapsed);
+}
+
+/**
+  * @brief  Start the FIFO_SRC read
+  * @param  None
+  * @retval None
+  */
+static void L3GD20_StartFifoSrc(void)
+{
+  state = L3GD20_STATE_FIFO_SRC;
+  if (SPIBUS_Submit(&fifoSrcTransaction) != HAL_OK)
+  {
+    stats.errors++;
+    state = L3GD20_STATE_IDLE;
+  }
+}
+
+/**
+  * @brief  Start the sample burst
+  * @param  fifoSrc  FIFO_SRC register value
+  * @retval None
+  */
+static void L3GD20_StartBurst(uint8_t fifoSrc)
+{
+  burstTimestampUs = TIMEBASE_GetUs();
+
+  if ((fifoSrc & L3GD20_FIFO_SRC_OVRN) != 0U)
+  {
+    stats.overruns++;
+    burstCount = L3GD20_FIFO_DEPTH;
+  }
+  else
+  {
+    burstCount = fifoSrc & L3GD20_FIFO_SRC_FSS;
+  }
+
+  if (burstCount == 0U)
+  {
+    state = L3GD20_STATE_IDLE;
+    return;
+  }
+
+  state = L3GD20_STATE_BURST;
+  burstTransaction.length = (uint16_t)(1U + (burstCount * L3GD20_SAMPLE_BYTES));
+  if (SPIBUS_Submit(&burstTransaction) != HAL_OK)
+  {
+    stats.errors++;
+    state = L3GD20_STATE_IDLE;
+  }
+}
+
+/**
+  * @brief  Re-time a burst that waited too long for the bus
+  * @details The burst reads the oldest samples of the FIFO. If it queued
+  *          behind other bus traffic for longer than the free FIFO levels
+  *          last, the FIFO overflowed meanwhile and those are no longer the
+  *          samples FIFO_SRC counted but the oldest of a full FIFO: they are
+  *          re-stamped from the completion time and counted as an overrun.
+  * @param  None
+  * @retval None
+  */
+static void L3GD20_CheckHeadroom(void)
+{
+  const uint64_t headroomUs = (uint64_t)(L3GD20_FIFO_DEPTH - burstCount) * samplePeriodUs;
+  const uint64_t nowUs = TIMEBASE_GetUs();
+
+  if ((nowUs - burstTimestampUs) > (headroomUs + samplePeriodUs))
+  {
+    stats.overruns++;
+    burstTimestampUs = nowUs - headroomUs;
+  }
+}
+
+/**
+  * @brief  Convert the burst and hand it to the consumer
+  * @details The newest sample is stamped with the time FIFO_SRC was read,
+  *          older ones are spaced one output period apart.
+  * @param  None
+  * @retval None
+  */
+static void L3GD20_Publish(void)
+{
+  const uint8_t *raw = &rxBuffer[1];
+  uint32_t i;
+
+  for (i = 0; i < burstCount; i++, raw += L3GD20_SAMPLE_BYTES)
+  {
+    int16_t x = (int16_t)((uint16_t)raw[0] | ((uint16_t)raw[1] << 8));
+    int16_t y = (int16_t)((uint16_t)raw[2] | ((uint16_t)raw[3] << 8));
+    int16_t z = (int16_t)((uint16_t)raw[4] | ((uint16_t)raw[5] << 8));
+
+    samples[i].timestampUs = burstTimestampUs -
+        ((uint64_t)(burstCount - 1U - i) * samplePeriodUs);
+    samples[i].x = (float)x * sensitivity;
+    samples[i].y = (float)y * sensitivity;
+    samples[i].z = (float)z * sensitivity;
+  }
+
+  latest = samples[burstCount - 1U];
+  haveLatest = 1U;
+  stats.bursts++;
+  stats.samples += burstCount;
+
+  for (i = 0; i < callbackCount; i++)
+  {
+    sampleCallbacks[i](samples, burstCount, sampleContexts[i]);
+  }
+}
@@ -0,0 +1,210 @@
+/**
+  ******************************************************************************
+  * @file    l3gd20.h
+  * @brief   L3GD20 gyroscope driver interface
+  * @details This file contains the register map, types and function
+  *          prototypes of the driver for the on-board L3GD20 (or pin
+  *          compatible I3G4250D) 3-axis gyroscope on SPI5.
+  *
+  *          The device runs its 32-level FIFO in stream mode and raises
+  *          INT2 (PA2 / EXTI2) when the watermark is reached. The interrupt
+  *          reads the FIFO level and drains every stored sample in a single
+  *          SPI DMA burst; the completion converts the raw counts to degrees
+  *          per second, timestamps them and hands them to the registered
+  *          consumer.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __L3GD20_H__
+#define __L3GD20_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @brief   Register map
+ */
+#define L3GD20_REG_WHO_AM_I        0x0FU
+#define L3GD20_REG_CTRL1           0x20U
+#define L3GD20_REG_CTRL2           0x21U
+#define L3GD20_REG_CTRL3           0x22U
+#define L3GD20_REG_CTRL4           0x23U
+#define L3GD20_REG_CTRL5           0x24U
+#define L3GD20_REG_OUT_TEMP        0x26U
+#define L3GD20_REG_STATUS          0x27U
+#define L3GD20_REG_OUT_X_L         0x28U
+#define L3GD20_REG_FIFO_CTRL       0x2EU
+#define L3GD20_REG_FIFO_SRC        0x2FU
+
+/**
+ * @brief   SPI address byte flags
+ */
+#define L3GD20_SPI_READ            0x80U
+#define L3GD20_SPI_AUTO_INC        0x40U
+
+/**
+ * @brief   Identification values
+ */
+#define L3GD20_ID                  0xD4U
+#define I3G4250D_ID                0xD3U   /* Later board revisions */
+
+/**
+ * @brief   Register bit fields
+ */
+#define L3GD20_CTRL1_ODR760_BW100  0xF0U   /* DR=11, BW=11 */
+#define L3GD20_CTRL1_PD            0x08U
+#define L3GD20_CTRL1_XYZ_EN        0x07U
+#define L3GD20_CTRL3_I2_WTM        0x04U
+#define L3GD20_CTRL3_I2_ORUN       0x02U
+#define L3GD20_CTRL4_FS_250        0x00U
+#define L3GD20_CTRL4_FS_500        0x10U
+#define L3GD20_CTRL4_FS_2000       0x20U
+#define L3GD20_CTRL5_BOOT          0x80U
+#define L3GD20_CTRL5_FIFO_EN       0x40U
+#define L3GD20_FIFO_MODE_BYPASS    0x00U
+#define L3GD20_FIFO_MODE_STREAM    0x40U
+#define L3GD20_FIFO_SRC_WTM        0x80U
+#define L3GD20_FIFO_SRC_OVRN       0x40U
+#define L3GD20_FIFO_SRC_EMPTY      0x20U
+#define L3GD20_FIFO_SRC_FSS        0x1FU
+
+/**
+ * @brief   Driver configuration
+ */
+#define L3GD20_FIFO_DEPTH          32U      /* Hardware FIFO levels */
+#define L3GD20_FIFO_WATERMARK      16U      /* Samples per interrupt */
+#define L3GD20_ODR_HZ              760U     /* Output data rate, DR=11 */
+#define I3G4250D_ODR_HZ            800U     /* Same DR=11 setting on the I3G4250D */
+#define L3GD20_SAMPLE_PERIOD_US    (1000000U / L3GD20_ODR_HZ)
+#define L3GD20_IRQ_PRIORITY        6U       /* EXTI2 priority, FreeRTOS safe */
+#define L3GD20_MAX_CALLBACKS       4U       /* Sample consumers */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Full scale selection
+ */
+typedef enum
+{
+  L3GD20_FS_250DPS = 0,
+  L3GD20_FS_500DPS,
+  L3GD20_FS_2000DPS
+} L3GD20_FullScale_t;
+
+/**
+ * @brief   Converted angular rate sample
+ */
+typedef struct
+{
+  uint64_t timestampUs;   /*!< Estimated acquisition time */
+  float x;                /*!< Angular rate about X in deg/s */
+  float y;                /*!< Angular rate about Y in deg/s */
+  float z;                /*!< Angular rate about Z in deg/s */
+} L3GD20_Sample_t;
+
+/**
+ * @brief   Sample consumer
+ * @note    Runs in DMA interrupt context; copy or queue the samples
+ * @param   samples  Converted samples, oldest first
+ * @param   count    Number of samples
+ * @param   context  Pointer given to L3GD20_AddCallback()
+ */
+typedef void (*L3GD20_Callback_t)(const L3GD20_Sample_t *samples, uint32_t count, void *context);
+
+/**
+ * @brief   Driver statistics
+ */
+typedef struct
+{
+  uint32_t bursts;        /*!< FIFO drains completed */
+  uint32_t samples;       /*!< Samples published */
+  uint32_t overruns;      /*!< FIFO overrun flags seen */
+  uint32_t busySkips;     /*!< Watermark interrupts while a burst was running */
+  uint32_t errors;        /*!< SPI errors */
+  uint32_t isrCycles;     /*!< CPU cycles spent in the driver interrupts */
+} L3GD20_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the gyroscope
+ * @details Checks WHO_AM_I (L3GD20 or I3G4250D), configures the highest ODR
+ *          (760 Hz, or 800 Hz on the I3G4250D), the selected full scale,
+ *          the FIFO in stream mode with watermark on INT2, and enables EXTI2
+ * @note    SPI_Init(), SPIBUS_Init() and GPIO_Init() must have run
+ * @param   fullScale  Measurement range
+ * @retval  HAL_OK, or HAL_ERROR if the device does not answer
+ */
+HAL_StatusTypeDef L3GD20_Init(L3GD20_FullScale_t fullScale);
+
+/**
+ * @brief   Adds a sample consumer
+ * @details Consumers are called in registration order with the same batch
+ * @param   callback  Consumer
+ * @param   context   Passed back to the consumer
+ * @retval  HAL_OK, or HAL_ERROR when L3GD20_MAX_CALLBACKS are registered
+ */
+HAL_StatusTypeDef L3GD20_AddCallback(L3GD20_Callback_t callback, void *context);
+
+/**
+ * @brief   Reads a register with a blocking transfer
+ * @param   reg    Register address
+ * @param   value  Destination
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef L3GD20_ReadReg(uint8_t reg, uint8_t *value);
+
+/**
+ * @brief   Writes a register with a blocking transfer
+ * @param   reg    Register address
+ * @param   value  Value
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef L3GD20_WriteReg(uint8_t reg, uint8_t value);
+
+/**
+ * @brief   Watermark interrupt entry
+ * @note    Called from HAL_GPIO_EXTI_Callback() for MEMS_INT2_Pin
+ * @param   None
+ * @retval  None
+ */
+void L3GD20_IrqHandler(void);
+
+/**
+ * @brief   Reads the driver statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void L3GD20_GetStats(L3GD20_Stats_t *stats);
+
+/**
+ * @brief   Returns the most recent sample
+ * @param   sample  Destination
+ * @retval  HAL_OK, or HAL_ERROR if no sample has been received yet
+ */
+HAL_StatusTypeDef L3GD20_GetLatest(L3GD20_Sample_t *sample);
+
+/**
+ * @brief   Output data rate of the detected device
+ * @param   None
+ * @retval  L3GD20_ODR_HZ or I3G4250D_ODR_HZ, L3GD20_ODR_HZ before L3GD20_Init()
+ */
+uint32_t L3GD20_GetOdrHz(void);
+
+/**
+ * @brief   CPU load of the driver in 0.01 % since the previous call
+ * @param   None
+ * @retval  Load in hundredths of a percent
+ */
+uint32_t L3GD20_GetCpuLoad(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __L3GD20_H__ */
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file    block_dev.h
+  * @brief   Block device interface
+  * @details This file contains the sector-level interface the logging
+  *          pipeline writes through. A device is a table of functions on
+  *          whole sectors plus its geometry; the RAM disk (ram_disk.c)
+  *          implements it.
+  *
+  *          The interface does not depend on the HAL or the RTOS, so the
+  *          pipeline core also runs on a host against a RAM disk.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __BLOCK_DEV_H__
+#define __BLOCK_DEV_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct BLOCKDEV BLOCKDEV_t;
+
+/**
+ * @brief   Block device
+ * @note    The functions return 0 on success and a negative value on error
+ */
+struct BLOCKDEV
+{
+  const char *name;             /*!< Short name for reports */
+  uint32_t sectorSize;          /*!< Bytes per sector, power of two */
+  uint32_t sectorCount;         /*!< Sectors on the device */
+  int32_t (*read)(BLOCKDEV_t *dev, uint32_t lba, void *data, uint32_t count);
+  int32_t (*write)(BLOCKDEV_t *dev, uint32_t lba, const void *data, uint32_t count);
+  int32_t (*sync)(BLOCKDEV_t *dev);     /*!< Optional, NULL if writes are durable */
+  int32_t (*ready)(BLOCKDEV_t *dev);    /*!< 1 if the medium is present */
+  void *context;                /*!< Implementation data */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BLOCK_DEV_H__ */
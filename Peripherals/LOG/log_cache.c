@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file    log_cache.c
+  * @brief   Write-behind slot cache implementation
+  * @details This file provides the slot ring of the logging pipeline. The
+  *          producers own head, fill and the fill slot; the writer owns tail.
+  *          A slot length is written before head moves past it, so the
+  *          writer never sees a slot that is still being filled.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "log_cache.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t LOGCACHE_Copy(LOGCACHE_t *cache, const uint8_t *src, uint32_t len);
+
+/**
+  * @brief  Set up an empty cache
+  * @param  cache      Cache
+  * @param  storage    Slot memory
+  * @param  slotSize   Bytes per slot
+  * @param  slotCount  Number of slots
+  * @retval 0, or -1 on invalid geometry
+  */
+int32_t LOGCACHE_Init(LOGCACHE_t *cache, uint8_t *storage, uint32_t slotSize, uint32_t slotCount)
+{
+  if ((cache == NULL) || (storage == NULL) || (slotSize == 0U) ||
+      (slotCount < 2U) || (slotCount > LOGCACHE_MAX_SLOTS))
+  {
+    return -1;
+  }
+
+  cache->storage = storage;
+  cache->slotSize = slotSize;
+  cache->slotCount = slotCount;
+  LOGCACHE_Reset(cache);
+  return 0;
+}
+
+/**
+  * @brief  Empty the cache
+  * @param  cache  Cache
+  * @retval None
+  */
+void LOGCACHE_Reset(LOGCACHE_t *cache)
+{
+  cache->head = 0U;
+  cache->tail = 0U;
+  cache->fill = 0U;
+  cache->highWater = 0U;
+  cache->dropped = 0U;
+}
+
+/**
+  * @brief  Append a record
+  * @param  cache      Cache
+  * @param  header     First part
+  * @param  headerLen  Length of the first part
+  * @param  data       Second part
+  * @param  len        Length of the second part
+  * @retval Slots committed, or -1 if dropped
+  */
+int32_t LOGCACHE_Append(LOGCACHE_t *cache, const void *header, uint32_t headerLen,
+                        const void *data, uint32_t len)
+{
+  const uint32_t used = cache->head - cache->tail;
+  uint32_t room;
+  int32_t committed;
+
+  /* The fill slot belongs to the free slots until it is committed */
+  room = ((cache->slotCount - used) * cache->slotSize) - cache->fill;
+  if ((used >= cache->slotCount) || ((headerLen + len) > room))
+  {
+    cache->dropped++;
+    return -1;
+  }
+
+  committed = LOGCACHE_Copy(cache, (const uint8_t *)header, headerLen);
+  committed += LOGCACHE_Copy(cache, (const uint8_t *)data, len);
+  return committed;
+}
+
+/**
+  * @brief  Commit the partly filled slot
+  * @param  cache  Cache
+  * @retval 1 if a slot was committed
+  */
+int32_t LOGCACHE_Commit(LOGCACHE_t *cache)
+{
+  uint32_t used;
+
+  if (cache->fill == 0U)
+  {
+    return 0;
+  }
+
+  cache->length[cache->head % cache->slotCount] = cache->fill;
+  cache->fill = 0U;
+  cache->head++;
+  used = cache->head - cache->tail;
+  if (used > cache->highWater)
+  {
+    cache->highWater = used;
+  }
+  return 1;
+}
+
+/**
+  * @brief  Oldest committed slot
+  * @param  cache  Cache
+  * @param  len    Bytes in the slot
+  * @retval Slot data, or NULL
+  */
+const uint8_t *LOGCACHE_Peek(const LOGCACHE_t *cache, uint32_t *len)
+{
+  const uint32_t index = cache->tail % cache->slotCount;
+
+  if (cache->head == cache->tail)
+  {
+    return NULL;
+  }
+
+  *len = cache->length[index];
+  return &cache->storage[index * cache->slotSize];
+}
+
+/**
+  * @brief  Release the oldest committed slot
+  * @param  cache  Cache
+  * @retval None
+  */
+void LOGCACHE_Release(LOGCACHE_t *cache)
+{
+  if (cache->head != cache->tail)
+  {
+    cache->tail++;
+  }
+}
+
+/**
+  * @brief  Committed slots waiting for the writer
+  * @param  cache  Cache
+  * @retval Number of slots
+  */
+uint32_t LOGCACHE_Pending(const LOGCACHE_t *cache)
+{
+  return cache->head - cache->tail;
+}
+
+/**
+  * @brief  Copy bytes into the fill slot, committing the slots it fills
+  * @param  cache  Cache
+  * @param  src    Source
+  * @param  len    Length, known to fit
+  * @retval Slots committed
+  */
+static int32_t LOGCACHE_Copy(LOGCACHE_t *cache, const uint8_t *src, uint32_t len)
+{
+  int32_t committed = 0;
+  uint32_t chunk;
+
+  while (len > 0U)
+  {
+    chunk = cache->slotSize - cache->fill;
+    if (chunk > len)
+    {
+      chunk = len;
+    }
+    memcpy(&cache->storage[((cache->head % cache->slotCount) * cache->slotSize) + cache->fill],
+           src, chunk);
+    src += chunk;
+    len -= chunk;
+    cache->fill += chunk;
+    if (cache->fill == cache->slotSize)
+    {
+      committed += LOGCACHE_Commit(cache);
+    }
+  }
+  return committed;
+}
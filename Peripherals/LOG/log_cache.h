@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    log_cache.h
+  * @brief   Write-behind slot cache interface
+  * @details This file contains the types and function prototypes of the
+  *          cache between the log producers and the storage writer. The
+  *          cache is a ring of equal slots: producers append records into
+  *          the fill slot, a slot is committed to the writer once full, and
+  *          the writer stores each committed slot with a single write of
+  *          slotSize bytes before releasing it. With slots a multiple of the
+  *          sector size every write is sector-aligned, however the records
+  *          straddle them.
+  *
+  *          Appends are all-or-nothing: a record that does not fit into the
+  *          free slots is dropped and counted, the stored stream never holds
+  *          a partial record.
+  *
+  *          Appending and committing must be serialized by the caller;
+  *          peeking and releasing may run concurrently from a single
+  *          writer. The cache does not depend on the HAL or the RTOS.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __LOG_CACHE_H__
+#define __LOG_CACHE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define LOGCACHE_MAX_SLOTS        32U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Slot cache
+ */
+typedef struct
+{
+  uint8_t *storage;             /*!< slotSize * slotCount bytes */
+  uint32_t slotSize;            /*!< Bytes per slot */
+  uint32_t slotCount;           /*!< Slots in the ring */
+  volatile uint32_t head;       /*!< Slots committed, free running */
+  volatile uint32_t tail;       /*!< Slots released, free running */
+  uint32_t fill;                /*!< Bytes in the fill slot */
+  uint32_t length[LOGCACHE_MAX_SLOTS]; /*!< Bytes of each committed slot */
+  uint32_t highWater;           /*!< Most slots committed at once */
+  uint32_t dropped;             /*!< Records that did not fit */
+} LOGCACHE_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Sets up an empty cache
+ * @param   cache      Cache
+ * @param   storage    slotSize * slotCount bytes
+ * @param   slotSize   Bytes per slot
+ * @param   slotCount  Number of slots, 2 to LOGCACHE_MAX_SLOTS
+ * @retval  0, or -1 on invalid geometry
+ */
+int32_t LOGCACHE_Init(LOGCACHE_t *cache, uint8_t *storage, uint32_t slotSize, uint32_t slotCount);
+
+/**
+ * @brief   Empties the cache and clears its counters
+ * @param   cache  Cache
+ * @retval  None
+ */
+void LOGCACHE_Reset(LOGCACHE_t *cache);
+
+/**
+ * @brief   Appends a record
+ * @param   cache   Cache
+ * @param   header  First part of the record, may be NULL if headerLen is 0
+ * @param   headerLen  Length of the first part
+ * @param   data    Second part of the record
+ * @param   len     Length of the second part
+ * @retval  Slots committed by this append, or -1 if the record was dropped
+ */
+int32_t LOGCACHE_Append(LOGCACHE_t *cache, const void *header, uint32_t headerLen,
+                        const void *data, uint32_t len);
+
+/**
+ * @brief   Commits the partly filled slot
+ * @note    Used when logging stops; the slot is written with its length
+ * @param   cache  Cache
+ * @retval  1 if a slot was committed, 0 if the fill slot was empty
+ */
+int32_t LOGCACHE_Commit(LOGCACHE_t *cache);
+
+/**
+ * @brief   Oldest committed slot
+ * @param   cache  Cache
+ * @param   len    Bytes in the slot
+ * @retval  Slot data, or NULL if no slot is committed
+ */
+const uint8_t *LOGCACHE_Peek(const LOGCACHE_t *cache, uint32_t *len);
+
+/**
+ * @brief   Returns the oldest committed slot to the producers
+ * @param   cache  Cache
+ * @retval  None
+ */
+void LOGCACHE_Release(LOGCACHE_t *cache);
+
+/**
+ * @brief   Committed slots waiting for the writer
+ * @param   cache  Cache
+ * @retval  Number of slots
+ */
+uint32_t LOGCACHE_Pending(const LOGCACHE_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOG_CACHE_H__ */
@@ -0,0 +1,190 @@
+/**
+  ******************************************************************************
+  * @file    log_file.c
+  * @brief   Log file sink implementation
+  * @details This file provides the raw format on a block device.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "log_file.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Header and tail sector, only one log is open at a time
+ */
+static uint32_t sector[LOGFILE_SECTOR_MAX / sizeof(uint32_t)];
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t LOGFILE_RawOpen(LOGFILE_t *file);
+static int32_t LOGFILE_RawWrite(LOGFILE_t *file, const uint8_t *data, uint32_t len);
+static int32_t LOGFILE_RawHeader(LOGFILE_t *file);
+
+/**
+  * @brief  Open a log on a device
+  * @param  file  Log
+  * @param  dev   Device
+  * @retval 0, or -1 on error
+  */
+int32_t LOGFILE_Open(LOGFILE_t *file, BLOCKDEV_t *dev)
+{
+  if ((file == NULL) || (dev == NULL) || (dev->ready(dev) != 1) ||
+      (dev->sectorSize > LOGFILE_SECTOR_MAX))
+  {
+    return -1;
+  }
+
+  memset(file, 0, sizeof(*file));
+  file->dev = dev;
+
+  if (LOGFILE_RawOpen(file) != 0)
+  {
+    return -1;
+  }
+  file->open = 1U;
+  return 0;
+}
+
+/**
+  * @brief  Append data
+  * @param  file  Log
+  * @param  data  Data
+  * @param  len   Length
+  * @retval 0, or -1 on error
+  */
+int32_t LOGFILE_Write(LOGFILE_t *file, const void *data, uint32_t len)
+{
+  if (!file->open || file->ended)
+  {
+    return -1;
+  }
+  if ((len % file->dev->sectorSize) != 0U)
+  {
+    file->ended = 1U;
+  }
+
+  return LOGFILE_RawWrite(file, (const uint8_t *)data, len);
+}
+
+/**
+  * @brief  Make the written data durable
+  * @param  file  Log
+  * @retval 0, or -1 on error
+  */
+int32_t LOGFILE_Sync(LOGFILE_t *file)
+{
+  if (!file->open)
+  {
+    return -1;
+  }
+
+  if (LOGFILE_RawHeader(file) != 0)
+  {
+    return -1;
+  }
+  return (file->dev->sync != NULL) ? file->dev->sync(file->dev) : 0;
+}
+
+/**
+  * @brief  Close the log
+  * @param  file  Log
+  * @retval 0, or -1 on error
+  */
+int32_t LOGFILE_Close(LOGFILE_t *file)
+{
+  int32_t status;
+
+  if (!file->open)
+  {
+    return -1;
+  }
+
+  status = LOGFILE_Sync(file);
+  file->open = 0U;
+  return status;
+}
+
+/**
+  * @brief  Start a raw log
+  * @param  file  Log
+  * @retval 0, or -1 if the device is too small or has odd sectors
+  */
+static int32_t LOGFILE_RawOpen(LOGFILE_t *file)
+{
+  BLOCKDEV_t *dev = file->dev;
+
+  if (((LOGFILE_RAW_DATA_OFFSET % dev->sectorSize) != 0U) ||
+      (dev->sectorSize < sizeof(LOGFILE_RawHeader_t)) ||
+      (dev->sectorCount <= (LOGFILE_RAW_DATA_OFFSET / dev->sectorSize)))
+  {
+    return -1;
+  }
+
+  file->lba = LOGFILE_RAW_DATA_OFFSET / dev->sectorSize;
+  return LOGFILE_RawHeader(file);
+}
+
+/**
+  * @brief  Append to a raw log
+  * @param  file  Log
+  * @param  data  Data
+  * @param  len   Length
+  * @retval 0, or -1 on error or full device
+  */
+static int32_t LOGFILE_RawWrite(LOGFILE_t *file, const uint8_t *data, uint32_t len)
+{
+  BLOCKDEV_t *dev = file->dev;
+  const uint32_t whole = len / dev->sectorSize;
+  const uint32_t rest = len % dev->sectorSize;
+  const uint32_t needed = whole + ((rest != 0U) ? 1U : 0U);
+
+  if (needed > (dev->sectorCount - file->lba))
+  {
+    return -1;
+  }
+
+  if (whole > 0U)
+  {
+    if (dev->write(dev, file->lba, data, whole) != 0)
+    {
+      return -1;
+    }
+    file->lba += whole;
+  }
+
+  if (rest > 0U)
+  {
+    memset(sector, 0, dev->sectorSize);
+    memcpy(sector, &data[whole * dev->sectorSize], rest);
+    if (dev->write(dev, file->lba, sector, 1U) != 0)
+    {
+      return -1;
+    }
+    file->lba++;
+  }
+
+  file->bytes += len;
+  return 0;
+}
+
+/**
+  * @brief  Write the raw header with the current length
+  * @param  file  Log
+  * @retval 0, or -1 on error
+  */
+static int32_t LOGFILE_RawHeader(LOGFILE_t *file)
+{
+  LOGFILE_RawHeader_t *header = (LOGFILE_RawHeader_t *)sector;
+
+  memset(sector, 0, file->dev->sectorSize);
+  memcpy(header->magic, LOGFILE_RAW_MAGIC, sizeof(header->magic));
+  header->sectorSize = file->dev->sectorSize;
+  header->dataLba = LOGFILE_RAW_DATA_OFFSET / file->dev->sectorSize;
+  header->bytesLow = (uint32_t)file->bytes;
+  header->bytesHigh = (uint32_t)(file->bytes >> 32);
+  return file->dev->write(file->dev, LOGFILE_RAW_HEADER_LBA, sector, 1U);
+}
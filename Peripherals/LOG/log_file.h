@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    log_file.h
+  * @brief   Log file sink interface
+  * @details This file contains the types and function prototypes of the
+  *          sink the log writer stores its slots with, in raw format: the
+  *          header sector LOGFILE_RAW_HEADER_LBA, then the data from the
+  *          LOGFILE_RAW_DATA_OFFSET byte of the device. Raw mode overwrites
+  *          whatever the device holds and is meant for the RAM disk.
+  *
+  *          Writes are expected in whole sectors; a shorter write ends the
+  *          stream (the tail sector is padded with zeros).
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __LOG_FILE_H__
+#define __LOG_FILE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "block_dev.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define LOGFILE_SECTOR_MAX        512U      /* Largest supported sector */
+#define LOGFILE_RAW_HEADER_LBA    0U
+#define LOGFILE_RAW_DATA_OFFSET   32768U    /* Data start, aligned to the slots */
+#define LOGFILE_RAW_MAGIC         "LOGRAW01"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Raw format header, at the start of LOGFILE_RAW_HEADER_LBA
+ */
+typedef struct
+{
+  char magic[8];                /*!< LOGFILE_RAW_MAGIC, not terminated */
+  uint32_t sectorSize;          /*!< Bytes per sector */
+  uint32_t dataLba;             /*!< First data sector */
+  uint32_t bytesLow;            /*!< Logged bytes, low word */
+  uint32_t bytesHigh;           /*!< Logged bytes, high word */
+} LOGFILE_RawHeader_t;
+
+/**
+ * @brief   Open log
+ */
+typedef struct
+{
+  BLOCKDEV_t *dev;              /*!< Device */
+  uint64_t bytes;               /*!< Bytes written */
+  uint32_t lba;                 /*!< Next data sector */
+  uint8_t open;                 /*!< Writes accepted */
+  uint8_t ended;                /*!< A partial sector was written */
+} LOGFILE_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Opens a log on a device
+ * @param   file  Log
+ * @param   dev   Device
+ * @retval  0, or -1 on error
+ */
+int32_t LOGFILE_Open(LOGFILE_t *file, BLOCKDEV_t *dev);
+
+/**
+ * @brief   Appends data
+ * @param   file  Log
+ * @param   data  Data
+ * @param   len   Length, a multiple of the sector size except for the last
+ * @retval  0, or -1 on error or full device
+ */
+int32_t LOGFILE_Write(LOGFILE_t *file, const void *data, uint32_t len);
+
+/**
+ * @brief   Makes the data written so far durable
+ * @param   file  Log
+ * @retval  0, or -1 on error
+ */
+int32_t LOGFILE_Sync(LOGFILE_t *file);
+
+/**
+ * @brief   Closes the log
+ * @param   file  Log
+ * @retval  0, or -1 on error
+ */
+int32_t LOGFILE_Close(LOGFILE_t *file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOG_FILE_H__ */
@@ -0,0 +1,405 @@
+/**
+  ******************************************************************************
+  * @file    logger.c
+  * @brief   Sensor logging service implementation
+  * @details This file provides the logger task and the producer side. The
+  *          producers append under a short interrupt lock (a record copy into
+  *          SDRAM) and wake the task when a slot is complete; the task is the
+  *          only one touching the device, so the device writes stay out of
+  *          the producers' contexts.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "logger.h"
+#include "cmsis_os.h"
+#include "stack_monitor.h"
+#include "log_cache.h"
+#include "log_file.h"
+#include "ram_disk.h"
+#include "../BOOT/boot_init.h"
+#include "../L3GD20/l3gd20.h"
+#include "../SYS/mem_sections.h"
+#include "../TIM/timebase.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define LOGGER_FLAG_SLOT          0x01U
+#define LOGGER_FLAG_STOP          0x02U
+#define LOGGER_BENCH_RECORD       1024U     /* Header included */
+
+/* Private variables ---------------------------------------------------------*/
+static osThreadId_t loggerTaskHandle;
+static const osThreadAttr_t loggerTask_attributes = {
+  .name = "loggerTask",
+  .stack_size = LOGGER_TASK_STACK_SIZE,
+  .priority = (osPriority_t) osPriorityBelowNormal,
+};
+
+/**
+ * @brief   Write-behind cache and RAM disk, in SDRAM
+ */
+SDRAM_BSS static uint8_t cacheStorage[LOGGER_SLOT_COUNT * LOGGER_SLOT_SIZE];
+SDRAM_BSS static uint8_t ramDiskStorage[LOGGER_RAMDISK_SIZE];
+
+static LOGCACHE_t cache;
+static BLOCKDEV_t ramDisk;
+static LOGFILE_t logFile;
+
+static volatile uint8_t accepting;  /* Producers may append */
+static volatile uint8_t stopping;   /* Task drains and closes */
+static uint16_t sequence;
+static uint32_t slotsSinceSync;
+static uint64_t startUs;
+
+static LOGGER_Stats_t stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static void LOGGER_Task(void *argument);
+static void LOGGER_Drain(void);
+static void LOGGER_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context);
+
+/**
+  * @brief  Logger initialization
+  * @param  None
+  * @retval None
+  */
+void LOGGER_Init(void)
+{
+  if ((LOGCACHE_Init(&cache, cacheStorage, LOGGER_SLOT_SIZE, LOGGER_SLOT_COUNT) != 0) ||
+      (RAMDISK_Init(&ramDisk, ramDiskStorage, LOGGER_SECTOR_SIZE,
+                    LOGGER_RAMDISK_SIZE / LOGGER_SECTOR_SIZE) != 0))
+  {
+    Error_Handler();
+  }
+
+  loggerTaskHandle = osThreadNew(LOGGER_Task, NULL, &loggerTask_attributes);
+  if (loggerTaskHandle == NULL)
+  {
+    Error_Handler();
+  }
+  STACKMON_Watch(loggerTaskHandle, loggerTask_attributes.stack_size);
+
+  if (L3GD20_AddCallback(LOGGER_GyroCallback, NULL) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Start a session on the RAM disk
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LOGGER_Start(void)
+{
+  uint32_t primask;
+
+  if (stats.active || stopping)
+  {
+    return HAL_BUSY;
+  }
+  /* The cache and the RAM disk are in SDRAM */
+  if (BOOTINIT_Require(BOOTINIT_FMC) != HAL_OK)
+  {
+    return HAL_BUSY;
+  }
+
+  if (LOGFILE_Open(&logFile, &ramDisk) != 0)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  LOGCACHE_Reset(&cache);
+  memset(&stats, 0, sizeof(stats));
+  stats.active = 1U;
+  sequence = 0U;
+  slotsSinceSync = 0U;
+  startUs = TIMEBASE_GetUs();
+  accepting = 1U;
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the session
+  * @param  timeoutMs  Longest wait for the writes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LOGGER_Stop(uint32_t timeoutMs)
+{
+  uint32_t primask;
+  uint32_t waited = 0U;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (!stats.active || stopping)
+  {
+    __set_PRIMASK(primask);
+    return stopping ? HAL_BUSY : HAL_ERROR;
+  }
+  accepting = 0U;
+  stopping = 1U;
+  __set_PRIMASK(primask);
+
+  (void)osThreadFlagsSet(loggerTaskHandle, LOGGER_FLAG_STOP);
+  while (stopping)
+  {
+    if (waited >= timeoutMs)
+    {
+      return HAL_TIMEOUT;
+    }
+    osDelay(10U);
+    waited += 10U;
+  }
+  return (stats.errors == 0U) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Append a record
+  * @param  type  Record type
+  * @param  data  Payload
+  * @param  len   Payload length
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LOGGER_Write(uint8_t type, const void *data, uint32_t len)
+{
+  LOGGER_RecordHeader_t header;
+  uint32_t primask;
+  int32_t committed;
+
+  if (len > (LOGGER_SLOT_SIZE - sizeof(header)))
+  {
+    return HAL_ERROR;
+  }
+
+  header.sync = LOGGER_RECORD_SYNC;
+  header.type = type;
+  header.reserved = 0U;
+  header.length = (uint16_t)len;
+  header.timestampUs = TIMEBASE_GetUs();
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (!accepting)
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+  header.sequence = sequence++;
+  committed = LOGCACHE_Append(&cache, &header, sizeof(header), data, len);
+  if (committed >= 0)
+  {
+    stats.records++;
+    stats.bytesIn += sizeof(header) + len;
+  }
+  else
+  {
+    stats.dropped++;
+  }
+  __set_PRIMASK(primask);
+
+  if (committed > 0)
+  {
+    (void)osThreadFlagsSet(loggerTaskHandle, LOGGER_FLAG_SLOT);
+  }
+  return (committed >= 0) ? HAL_OK : HAL_BUSY;
+}
+
+/**
+  * @brief  Session statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void LOGGER_GetStats(LOGGER_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint64_t elapsedUs;
+
+  __disable_irq();
+  *dest = stats;
+  dest->pending = LOGCACHE_Pending(&cache);
+  dest->highWater = cache.highWater;
+  if (stats.active)
+  {
+    dest->elapsedMs = (uint32_t)TIMEBASE_UsToMs(TIMEBASE_GetUs() - startUs);
+  }
+  __set_PRIMASK(primask);
+
+  elapsedUs = (uint64_t)dest->elapsedMs * 1000U;
+  dest->writeKBps = (dest->busyUs != 0U)
+                  ? (uint32_t)(((uint64_t)dest->bytesWritten * 1000U) / dest->busyUs) : 0U;
+  dest->inKBps = (elapsedUs != 0U)
+               ? (uint32_t)(((uint64_t)dest->bytesIn * 1000U) / elapsedUs) : 0U;
+}
+
+/**
+  * @brief  Measure the sustained logging rate
+  * @param  bytes   Bytes to log
+  * @param  result  Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LOGGER_Benchmark(uint32_t bytes, LOGGER_Bench_t *result)
+{
+  static uint8_t pattern[LOGGER_BENCH_RECORD - sizeof(LOGGER_RecordHeader_t)];
+  LOGGER_Stats_t session;
+  HAL_StatusTypeDef status;
+  uint32_t logged = 0U;
+  uint64_t start;
+  uint64_t elapsed;
+  uint32_t i;
+
+  memset(result, 0, sizeof(*result));
+  for (i = 0; i < sizeof(pattern); i++)
+  {
+    pattern[i] = (uint8_t)i;
+  }
+
+  status = LOGGER_Start();
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  start = TIMEBASE_GetUs();
+  while ((logged < bytes) && (stats.errors == 0U))
+  {
+    if (LOGGER_Write(LOGGER_RECORD_BENCH, pattern, sizeof(pattern)) == HAL_OK)
+    {
+      logged += LOGGER_BENCH_RECORD;
+    }
+    else
+    {
+      /* Cache full: the device is the bottleneck, let the task write */
+      osDelay(1U);
+    }
+  }
+  status = LOGGER_Stop(10000U);
+  elapsed = TIMEBASE_GetUs() - start;
+
+  LOGGER_GetStats(&session);
+  result->bytes = session.bytesIn;
+  result->elapsedUs = (uint32_t)elapsed;
+  result->KBps = (elapsed != 0U) ? (uint32_t)(((uint64_t)session.bytesIn * 1000U) / elapsed) : 0U;
+  result->writeKBps = session.writeKBps;
+  result->writeUsMax = session.writeUsMax;
+  result->highWater = session.highWater;
+  return status;
+}
+
+/**
+  * @brief  Logger task
+  * @param  argument  Unused
+  * @retval None
+  */
+static void LOGGER_Task(void *argument)
+{
+  uint32_t flags;
+  uint32_t primask;
+
+  (void)argument;
+
+  for (;;)
+  {
+    flags = osThreadFlagsWait(LOGGER_FLAG_SLOT | LOGGER_FLAG_STOP, osFlagsWaitAny, osWaitForever);
+    if ((flags & osFlagsError) != 0U)
+    {
+      continue;
+    }
+
+    LOGGER_Drain();
+
+    if ((flags & LOGGER_FLAG_STOP) != 0U)
+    {
+      /* No producer appends any more, store the partial slot too */
+      primask = __get_PRIMASK();
+      __disable_irq();
+      (void)LOGCACHE_Commit(&cache);
+      __set_PRIMASK(primask);
+      LOGGER_Drain();
+
+      if ((LOGFILE_Close(&logFile) != 0) && (stats.errors == 0U))
+      {
+        stats.errors++;
+      }
+      primask = __get_PRIMASK();
+      __disable_irq();
+      stats.elapsedMs = (uint32_t)TIMEBASE_UsToMs(TIMEBASE_GetUs() - startUs);
+      stats.active = 0U;
+      stopping = 0U;
+      __set_PRIMASK(primask);
+    }
+  }
+}
+
+/**
+  * @brief  Store the committed slots
+  * @details After a failed write the session stops accepting records and
+  *          the remaining slots are discarded.
+  * @param  None
+  * @retval None
+  */
+static void LOGGER_Drain(void)
+{
+  const uint8_t *slot;
+  uint32_t len;
+  uint64_t start;
+  uint32_t duration;
+  int32_t status;
+
+  while ((slot = LOGCACHE_Peek(&cache, &len)) != NULL)
+  {
+    if (stats.errors != 0U)
+    {
+      LOGCACHE_Release(&cache);
+      continue;
+    }
+
+    start = TIMEBASE_GetUs();
+    status = LOGFILE_Write(&logFile, slot, len);
+    if ((status == 0) && (++slotsSinceSync >= LOGGER_SYNC_SLOTS))
+    {
+      slotsSinceSync = 0U;
+      status = LOGFILE_Sync(&logFile);
+    }
+    duration = (uint32_t)(TIMEBASE_GetUs() - start);
+    LOGCACHE_Release(&cache);
+
+    if (status != 0)
+    {
+      stats.errors++;
+      accepting = 0U;
+      continue;
+    }
+    stats.bytesWritten += len;
+    stats.slotsWritten++;
+    stats.busyUs += duration;
+    stats.writeUsLast = duration;
+    if (duration > stats.writeUsMax)
+    {
+      stats.writeUsMax = duration;
+    }
+  }
+}
+
+/**
+  * @brief  Gyro batch consumer
+  * @details Runs in the SPI DMA interrupt; one record per batch.
+  * @param  samples  Samples
+  * @param  count    Number of samples
+  * @param  context  Unused
+  * @retval None
+  */
+static void LOGGER_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context)
+{
+  (void)context;
+
+  if (accepting)
+  {
+    (void)LOGGER_Write(LOGGER_RECORD_GYRO, samples, count * sizeof(L3GD20_Sample_t));
+  }
+}
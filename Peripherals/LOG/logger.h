@@ -0,0 +1,166 @@
+/**
+  ******************************************************************************
+  * @file    logger.h
+  * @brief   Sensor logging service interface
+  * @details This file contains the types and function prototypes of the
+  *          logger, which stores sensor frames on the SDRAM RAM disk (raw
+  *          format of log_file.h).
+  *
+  *          Producers append records from any context into a write-behind
+  *          cache of LOGGER_SLOT_COUNT slots of LOGGER_SLOT_SIZE bytes in
+  *          SDRAM. The logger task stores every full slot with one aligned
+  *          write, so the device sees only 32 KB sequential writes and the
+  *          producers never wait for it; the cache absorbs the write latency
+  *          of the device. A record that finds the cache full is dropped and
+  *          counted.
+  *
+  *          The gyro stream is logged while a session runs; other producers
+  *          call LOGGER_Write() with their own record type.
+  *
+  *          Stream format: records of a LOGGER_RecordHeader_t followed by
+  *          length bytes of payload, back to back across slot boundaries.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __LOGGER_H__
+#define __LOGGER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define LOGGER_SLOT_SIZE          32768U    /* Bytes per device write */
+#define LOGGER_SLOT_COUNT         16U       /* 512 KB write-behind cache */
+#define LOGGER_RAMDISK_SIZE       (4U * 1024U * 1024U)
+#define LOGGER_SECTOR_SIZE        512U      /* RAM disk sectors */
+#define LOGGER_SYNC_SLOTS         32U       /* Sync every 1 MB */
+#define LOGGER_RECORD_SYNC        0x474CU   /* "LG" */
+#define LOGGER_TASK_STACK_SIZE    (384U * 4U)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Record types
+ */
+typedef enum
+{
+  LOGGER_RECORD_GYRO = 1,       /*!< L3GD20_Sample_t[] */
+  LOGGER_RECORD_BENCH = 2,      /*!< Counting pattern */
+  LOGGER_RECORD_USER = 0x80     /*!< First application type */
+} LOGGER_RecordType_t;
+
+/**
+ * @brief   Record header, little endian
+ */
+typedef struct
+{
+  uint16_t sync;                /*!< LOGGER_RECORD_SYNC */
+  uint8_t type;                 /*!< LOGGER_RecordType_t */
+  uint8_t reserved;
+  uint16_t length;              /*!< Payload bytes */
+  uint16_t sequence;            /*!< Per session, gaps show drops */
+  uint64_t timestampUs;         /*!< Time base when appended */
+} LOGGER_RecordHeader_t;
+
+/**
+ * @brief   Session statistics
+ */
+typedef struct
+{
+  uint8_t active;               /*!< Session running */
+  uint32_t records;             /*!< Records accepted */
+  uint32_t dropped;             /*!< Records dropped, cache full */
+  uint32_t bytesIn;             /*!< Bytes accepted */
+  uint32_t bytesWritten;        /*!< Bytes stored on the device */
+  uint32_t slotsWritten;        /*!< Device writes */
+  uint32_t pending;             /*!< Slots waiting for the device */
+  uint32_t highWater;           /*!< Most slots waiting at once */
+  uint32_t writeUsLast;         /*!< Duration of the last device write */
+  uint32_t writeUsMax;          /*!< Longest device write */
+  uint64_t busyUs;              /*!< Total device write time */
+  uint32_t elapsedMs;           /*!< Session duration */
+  uint32_t writeKBps;           /*!< Device throughput, KB/s (1000 B) */
+  uint32_t inKBps;              /*!< Logged data rate, KB/s (1000 B) */
+  uint32_t errors;              /*!< Failed writes, the session stops */
+} LOGGER_Stats_t;
+
+/**
+ * @brief   Benchmark result
+ */
+typedef struct
+{
+  uint32_t bytes;               /*!< Bytes logged */
+  uint32_t elapsedUs;           /*!< Until the last byte was stored */
+  uint32_t KBps;                /*!< Sustained rate, KB/s (1000 B) */
+  uint32_t writeKBps;           /*!< Device throughput, KB/s (1000 B) */
+  uint32_t writeUsMax;          /*!< Longest device write */
+  uint32_t highWater;           /*!< Most slots waiting at once */
+} LOGGER_Bench_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the logger
+ * @note    The session needs the SDRAM, call after FMC_Init()
+ * @param   None
+ * @retval  None
+ */
+void LOGGER_Init(void);
+
+/**
+ * @brief   Starts a session on the RAM disk
+ * @note    Task context
+ * @param   None
+ * @retval  HAL_OK, HAL_BUSY if a session runs or the SDRAM is not up yet,
+ *          HAL_ERROR if the log cannot be opened
+ */
+HAL_StatusTypeDef LOGGER_Start(void);
+
+/**
+ * @brief   Stops the session
+ * @details Stores the cached records, the partial slot included, and
+ *          closes the log
+ * @note    Task context, waits for the logger task
+ * @param   timeoutMs  Longest wait for the writes
+ * @retval  HAL_OK, HAL_TIMEOUT, or HAL_ERROR if no session runs
+ */
+HAL_StatusTypeDef LOGGER_Stop(uint32_t timeoutMs);
+
+/**
+ * @brief   Appends a record
+ * @note    Any context, never blocks
+ * @param   type  Record type
+ * @param   data  Payload
+ * @param   len   Payload length, up to a slot less the record header
+ * @retval  HAL_OK, HAL_BUSY if dropped, HAL_ERROR if no session runs
+ */
+HAL_StatusTypeDef LOGGER_Write(uint8_t type, const void *data, uint32_t len);
+
+/**
+ * @brief   Reads the session statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void LOGGER_GetStats(LOGGER_Stats_t *stats);
+
+/**
+ * @brief   Measures the sustained logging rate
+ * @details Runs a session of 1 KB records written as fast as the cache
+ *          accepts them, waiting instead of dropping when it is full, and
+ *          stops it
+ * @note    Task context, blocks until the bytes are stored
+ * @param   bytes   Bytes to log
+ * @param   result  Destination
+ * @retval  HAL status of the session
+ */
+HAL_StatusTypeDef LOGGER_Benchmark(uint32_t bytes, LOGGER_Bench_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOGGER_H__ */
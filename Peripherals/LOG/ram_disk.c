@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file    ram_disk.c
+  * @brief   RAM disk block device implementation
+  * @details This file provides the sector functions of the RAM disk. They
+  *          are plain copies and never fail inside the device.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ram_disk.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static int32_t RAMDISK_Read(BLOCKDEV_t *dev, uint32_t lba, void *data, uint32_t count);
+static int32_t RAMDISK_Write(BLOCKDEV_t *dev, uint32_t lba, const void *data, uint32_t count);
+static int32_t RAMDISK_Ready(BLOCKDEV_t *dev);
+
+/**
+  * @brief  Set up a RAM disk
+  * @param  dev          Device to fill in
+  * @param  storage      Disk memory
+  * @param  sectorSize   Bytes per sector
+  * @param  sectorCount  Number of sectors
+  * @retval 0, or -1 on invalid geometry
+  */
+int32_t RAMDISK_Init(BLOCKDEV_t *dev, uint8_t *storage, uint32_t sectorSize, uint32_t sectorCount)
+{
+  if ((dev == NULL) || (storage == NULL) || (sectorCount == 0U) ||
+      (sectorSize == 0U) || ((sectorSize & (sectorSize - 1U)) != 0U))
+  {
+    return -1;
+  }
+
+  dev->name = "ram";
+  dev->sectorSize = sectorSize;
+  dev->sectorCount = sectorCount;
+  dev->read = RAMDISK_Read;
+  dev->write = RAMDISK_Write;
+  dev->sync = NULL;
+  dev->ready = RAMDISK_Ready;
+  dev->context = storage;
+  return 0;
+}
+
+/**
+  * @brief  Read sectors
+  * @param  dev    Device
+  * @param  lba    First sector
+  * @param  data   Destination
+  * @param  count  Number of sectors
+  * @retval 0, or -1 past the end of the disk
+  */
+static int32_t RAMDISK_Read(BLOCKDEV_t *dev, uint32_t lba, void *data, uint32_t count)
+{
+  if ((lba > dev->sectorCount) || (count > (dev->sectorCount - lba)))
+  {
+    return -1;
+  }
+  memcpy(data, (const uint8_t *)dev->context + ((size_t)lba * dev->sectorSize),
+         (size_t)count * dev->sectorSize);
+  return 0;
+}
+
+/**
+  * @brief  Write sectors
+  * @param  dev    Device
+  * @param  lba    First sector
+  * @param  data   Source
+  * @param  count  Number of sectors
+  * @retval 0, or -1 past the end of the disk
+  */
+static int32_t RAMDISK_Write(BLOCKDEV_t *dev, uint32_t lba, const void *data, uint32_t count)
+{
+  if ((lba > dev->sectorCount) || (count > (dev->sectorCount - lba)))
+  {
+    return -1;
+  }
+  memcpy((uint8_t *)dev->context + ((size_t)lba * dev->sectorSize), data,
+         (size_t)count * dev->sectorSize);
+  return 0;
+}
+
+/**
+  * @brief  Medium presence
+  * @param  dev  Device
+  * @retval 1, the memory is always there
+  */
+static int32_t RAMDISK_Ready(BLOCKDEV_t *dev)
+{
+  (void)dev;
+  return 1;
+}
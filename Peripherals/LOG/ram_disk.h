@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    ram_disk.h
+  * @brief   RAM disk block device interface
+  * @details This file contains the prototype of the RAM disk, a block device
+  *          on caller-provided memory. On target it lives in SDRAM and holds
+  *          the logs; on a host it is the device the pipeline is checked
+  *          against.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __RAM_DISK_H__
+#define __RAM_DISK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "block_dev.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Sets up a RAM disk
+ * @param   dev          Device to fill in
+ * @param   storage      sectorSize * sectorCount bytes
+ * @param   sectorSize   Bytes per sector, power of two
+ * @param   sectorCount  Number of sectors
+ * @retval  0, or -1 on invalid geometry
+ */
+int32_t RAMDISK_Init(BLOCKDEV_t *dev, uint8_t *storage, uint32_t sectorSize, uint32_t sectorCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RAM_DISK_H__ */
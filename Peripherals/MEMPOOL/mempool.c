@@ -0,0 +1,388 @@
+/**
+  ******************************************************************************
+  * @file    mempool.c
+  * @brief   Fixed-size block pool module implementation
+  * @details This file provides the fixed-size block allocator used to pass
+  *          buffers between interrupt handlers and tasks without copying and
+  *          without touching the FreeRTOS heap. Free blocks are chained
+  *          through their first word, so the pools need no bookkeeping
+  *          memory beyond the control structure.
+  *
+  *          Critical sections save and restore PRIMASK, which makes every
+  *          entry point callable from any interrupt priority and before the
+  *          scheduler is started.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mempool.h"
+#include "../SYS/mem_sections.h"
+#include "../SYS/sys.h"
+#include <stdio.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define MEMPOOL_FREE_TAG   0x46524545UL  /* "FREE" */
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Size-class pool storage
+ * @details Small and medium blocks live in CCM RAM and must only be touched
+ *          by the CPU. Large blocks stay in internal SRAM so they can be used
+ *          as DMA targets.
+ */
+static uint8_t smallStorage[MEMPOOL_SMALL_BLOCK_SIZE * MEMPOOL_SMALL_BLOCK_COUNT] CCM_BSS;
+static uint8_t mediumStorage[MEMPOOL_MEDIUM_BLOCK_SIZE * MEMPOOL_MEDIUM_BLOCK_COUNT] CCM_BSS;
+static uint8_t largeStorage[MEMPOOL_LARGE_BLOCK_SIZE * MEMPOOL_LARGE_BLOCK_COUNT] __attribute__((aligned(4)));
+
+/**
+ * @brief   Size-class pools, ordered by increasing block size
+ */
+static MEMPOOL_Pool_t classPools[MEMPOOL_CLASS_COUNT];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t MEMPOOL_EnterCritical(void);
+static void MEMPOOL_ExitCritical(uint32_t primask);
+static uint8_t MEMPOOL_Owns(const MEMPOOL_Pool_t *pool, const void *block);
+static uint8_t MEMPOOL_IsFree(const MEMPOOL_Pool_t *pool, const MEMPOOL_Block_t *block);
+
+/**
+  * @brief  Size-class pool initialization
+  * @details Creates the three size-class pools. Must be called once after
+  *          SYS_Init() and before any MEMPOOL_Alloc().
+  * @param  None
+  * @retval None
+  */
+void MEMPOOL_Init(void)
+{
+  if (MEMPOOL_Create(&classPools[MEMPOOL_CLASS_SMALL], "small", smallStorage,
+                     MEMPOOL_SMALL_BLOCK_SIZE, MEMPOOL_SMALL_BLOCK_COUNT) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (MEMPOOL_Create(&classPools[MEMPOOL_CLASS_MEDIUM], "medium", mediumStorage,
+                     MEMPOOL_MEDIUM_BLOCK_SIZE, MEMPOOL_MEDIUM_BLOCK_COUNT) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  if (MEMPOOL_Create(&classPools[MEMPOOL_CLASS_LARGE], "large", largeStorage,
+                     MEMPOOL_LARGE_BLOCK_SIZE, MEMPOOL_LARGE_BLOCK_COUNT) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Create a pool over caller supplied storage
+  * @details Threads all blocks onto the free list in address order. The
+  *          storage may be placed anywhere, e.g. with CCM_BSS or SDRAM_BSS
+  *          from mem_sections.h.
+  * @param  pool       Pool control structure
+  * @param  name       Pool name
+  * @param  storage    Block storage
+  * @param  blockSize  Block size in bytes
+  * @param  blockCount Number of blocks
+  * @retval HAL_OK or HAL_ERROR
+  */
+HAL_StatusTypeDef MEMPOOL_Create(MEMPOOL_Pool_t *pool, const char *name, void *storage,
+                                 uint32_t blockSize, uint32_t blockCount)
+{
+  uint32_t i;
+
+  if ((pool == NULL) || (storage == NULL) || (blockCount == 0U) ||
+      (((uintptr_t)storage & 3U) != 0U) || (blockSize < sizeof(MEMPOOL_Block_t)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Keep every block word aligned so the free list link is always valid */
+  blockSize = (blockSize + 3U) & ~3U;
+
+  pool->name = name;
+  pool->storage = (uint8_t *)storage;
+  pool->blockSize = blockSize;
+  pool->blockCount = blockCount;
+  pool->allocFailures = 0U;
+  pool->invalidFrees = 0U;
+
+  pool->freeList = NULL;
+  for (i = blockCount; i > 0U; i--)
+  {
+    MEMPOOL_Block_t *block = (MEMPOOL_Block_t *)(pool->storage + ((i - 1U) * blockSize));
+    block->next = pool->freeList;
+    block->tag = MEMPOOL_FREE_TAG;
+    pool->freeList = block;
+  }
+
+  pool->freeCount = blockCount;
+  pool->minFree = blockCount;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take one block from a pool
+  * @param  pool  Pool to allocate from
+  * @retval Block pointer or NULL
+  */
+void *MEMPOOL_PoolAlloc(MEMPOOL_Pool_t *pool)
+{
+  MEMPOOL_Block_t *block;
+  uint32_t primask = MEMPOOL_EnterCritical();
+
+  block = pool->freeList;
+  if (block != NULL)
+  {
+    pool->freeList = block->next;
+    block->tag = 0U;
+    pool->freeCount--;
+    if (pool->freeCount < pool->minFree)
+    {
+      pool->minFree = pool->freeCount;
+    }
+  }
+  else
+  {
+    pool->allocFailures++;
+  }
+
+  MEMPOOL_ExitCritical(primask);
+
+  return block;
+}
+
+/**
+  * @brief  Return a block to a pool
+  * @param  pool   Owning pool
+  * @param  block  Block to release
+  * @retval HAL_OK or HAL_ERROR
+  */
+HAL_StatusTypeDef MEMPOOL_PoolFree(MEMPOOL_Pool_t *pool, void *block)
+{
+  uint32_t primask;
+
+  if (!MEMPOOL_Owns(pool, block))
+  {
+    primask = MEMPOOL_EnterCritical();
+    pool->invalidFrees++;
+    MEMPOOL_ExitCritical(primask);
+    return HAL_ERROR;
+  }
+
+  primask = MEMPOOL_EnterCritical();
+
+  /* Double free: a full pool, or a block still on the free list */
+  if ((pool->freeCount >= pool->blockCount) || MEMPOOL_IsFree(pool, (MEMPOOL_Block_t *)block))
+  {
+    pool->invalidFrees++;
+    MEMPOOL_ExitCritical(primask);
+    return HAL_ERROR;
+  }
+
+  ((MEMPOOL_Block_t *)block)->next = pool->freeList;
+  ((MEMPOOL_Block_t *)block)->tag = MEMPOOL_FREE_TAG;
+  pool->freeList = (MEMPOOL_Block_t *)block;
+  pool->freeCount++;
+
+  MEMPOOL_ExitCritical(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocate from the smallest fitting size class
+  * @param  size  Requested size in bytes
+  * @retval Block pointer or NULL
+  */
+void *MEMPOOL_Alloc(size_t size)
+{
+  uint32_t cls;
+
+  for (cls = 0U; cls < (uint32_t)MEMPOOL_CLASS_COUNT; cls++)
+  {
+    if (size <= classPools[cls].blockSize)
+    {
+      void *block = MEMPOOL_PoolAlloc(&classPools[cls]);
+      if (block != NULL)
+      {
+        return block;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Release a block to the size class that owns it
+  * @param  block  Block to release
+  * @retval None
+  */
+void MEMPOOL_Free(void *block)
+{
+  uint32_t cls;
+
+  if (block == NULL)
+  {
+    return;
+  }
+
+  for (cls = 0U; cls < (uint32_t)MEMPOOL_CLASS_COUNT; cls++)
+  {
+    if (MEMPOOL_Owns(&classPools[cls], block))
+    {
+      (void)MEMPOOL_PoolFree(&classPools[cls], block);
+      return;
+    }
+  }
+
+  /* Not ours at all: account it against the large class so it shows up */
+  (void)MEMPOOL_PoolFree(&classPools[MEMPOOL_CLASS_LARGE], block);
+}
+
+/**
+  * @brief  Usable size of a size-class block
+  * @param  block  Block pointer
+  * @retval Block size in bytes or 0
+  */
+uint32_t MEMPOOL_BlockSize(const void *block)
+{
+  uint32_t cls;
+
+  for (cls = 0U; cls < (uint32_t)MEMPOOL_CLASS_COUNT; cls++)
+  {
+    if (MEMPOOL_Owns(&classPools[cls], block))
+    {
+      return classPools[cls].blockSize;
+    }
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Snapshot of the statistics of one size class
+  * @param  cls    Size class
+  * @param  stats  Destination
+  * @retval None
+  */
+void MEMPOOL_GetStats(MEMPOOL_Class_t cls, MEMPOOL_Stats_t *stats)
+{
+  const MEMPOOL_Pool_t *pool;
+  uint32_t primask;
+
+  if ((cls >= MEMPOOL_CLASS_COUNT) || (stats == NULL))
+  {
+    return;
+  }
+
+  pool = &classPools[cls];
+
+  primask = MEMPOOL_EnterCritical();
+  stats->blockSize = pool->blockSize;
+  stats->blockCount = pool->blockCount;
+  stats->freeCount = pool->freeCount;
+  stats->peakUsed = pool->blockCount - pool->minFree;
+  stats->allocFailures = pool->allocFailures;
+  stats->invalidFrees = pool->invalidFrees;
+  MEMPOOL_ExitCritical(primask);
+}
+
+/**
+  * @brief  Print usage of all size classes
+  * @param  None
+  * @retval None
+  */
+void MEMPOOL_Report(void)
+{
+  uint32_t cls;
+  MEMPOOL_Stats_t stats;
+
+  printf("Pool     Size  Used/Total  Peak  Fail  BadFree\r\n");
+  for (cls = 0U; cls < (uint32_t)MEMPOOL_CLASS_COUNT; cls++)
+  {
+    MEMPOOL_GetStats((MEMPOOL_Class_t)cls, &stats);
+    printf("%-7s %5lu  %4lu/%-5lu  %4lu  %4lu  %7lu\r\n",
+           classPools[cls].name,
+           (unsigned long)stats.blockSize,
+           (unsigned long)(stats.blockCount - stats.freeCount),
+           (unsigned long)stats.blockCount,
+           (unsigned long)stats.peakUsed,
+           (unsigned long)stats.allocFailures,
+           (unsigned long)stats.invalidFrees);
+  }
+}
+
+/**
+  * @brief  Enter a critical section usable from any context
+  * @param  None
+  * @retval Previous PRIMASK value
+  */
+static uint32_t MEMPOOL_EnterCritical(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+}
+
+/**
+  * @brief  Leave a critical section entered with MEMPOOL_EnterCritical()
+  * @param  primask  Value returned by MEMPOOL_EnterCritical()
+  * @retval None
+  */
+static void MEMPOOL_ExitCritical(uint32_t primask)
+{
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Check that a pointer addresses the start of a block of a pool
+  * @param  pool   Pool to check against
+  * @param  block  Pointer to check
+  * @retval 1 if owned, 0 otherwise
+  */
+static uint8_t MEMPOOL_Owns(const MEMPOOL_Pool_t *pool, const void *block)
+{
+  uintptr_t start = (uintptr_t)pool->storage;
+  uintptr_t addr = (uintptr_t)block;
+
+  if ((pool->storage == NULL) || (addr < start) ||
+      (addr >= (start + (pool->blockSize * pool->blockCount))))
+  {
+    return 0U;
+  }
+
+  return (((addr - start) % pool->blockSize) == 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Check whether a block of a pool is on its free list
+  * @details The free tag settles it unless the data written into an
+  *          allocated block happens to match it; only then is the free
+  *          list walked. Must be called inside a critical section.
+  * @param  pool   Owning pool
+  * @param  block  Block of the pool
+  * @retval 1 if free, 0 if allocated
+  */
+static uint8_t MEMPOOL_IsFree(const MEMPOOL_Pool_t *pool, const MEMPOOL_Block_t *block)
+{
+  const MEMPOOL_Block_t *entry;
+
+  if (block->tag != MEMPOOL_FREE_TAG)
+  {
+    return 0U;
+  }
+
+  for (entry = pool->freeList; entry != NULL; entry = entry->next)
+  {
+    if (entry == block)
+    {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
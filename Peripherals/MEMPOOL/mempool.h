@@ -0,0 +1,179 @@
+/**
+  ******************************************************************************
+  * @file    mempool.h
+  * @brief   Fixed-size block pool module interface
+  * @details This file contains the types and function prototypes for the
+  *          fixed-size block allocator. Each pool hands out equally sized
+  *          blocks from a caller supplied storage area through an intrusive
+  *          free list, so allocation and release are O(1), never fragment
+  *          and may be called from both task and interrupt context.
+  *
+  *          A set of size-class pools is created by MEMPOOL_Init() and used
+  *          through MEMPOOL_Alloc()/MEMPOOL_Free(), which pick the smallest
+  *          class that fits the request.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __MEMPOOL_H__
+#define __MEMPOOL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include <stddef.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @brief   Size class configuration (block size in bytes x block count)
+ * @details Small blocks carry console lines and events, medium blocks carry
+ *          sensor sample batches and large blocks carry DMA receive chunks.
+ */
+#define MEMPOOL_SMALL_BLOCK_SIZE     32U
+#define MEMPOOL_SMALL_BLOCK_COUNT    64U
+#define MEMPOOL_MEDIUM_BLOCK_SIZE    128U
+#define MEMPOOL_MEDIUM_BLOCK_COUNT   32U
+#define MEMPOOL_LARGE_BLOCK_SIZE     512U
+#define MEMPOOL_LARGE_BLOCK_COUNT    16U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Size classes served by MEMPOOL_Alloc()
+ */
+typedef enum
+{
+  MEMPOOL_CLASS_SMALL = 0,
+  MEMPOOL_CLASS_MEDIUM,
+  MEMPOOL_CLASS_LARGE,
+  MEMPOOL_CLASS_COUNT
+} MEMPOOL_Class_t;
+
+/**
+ * @brief   Header stored at the start of every free block
+ * @details The tag marks the block as free, so a second free of the same
+ *          block is caught in O(1) in the common case. Allocation clears it.
+ */
+typedef struct MEMPOOL_Block
+{
+  struct MEMPOOL_Block *next;
+  uint32_t tag;
+} MEMPOOL_Block_t;
+
+/**
+ * @brief   Fixed-size block pool control structure
+ */
+typedef struct
+{
+  const char *name;           /*!< Pool name used in reports */
+  uint8_t *storage;           /*!< Start of the block storage area */
+  uint32_t blockSize;         /*!< Size of one block in bytes (multiple of 4) */
+  uint32_t blockCount;        /*!< Total number of blocks */
+  MEMPOOL_Block_t *freeList;  /*!< Head of the free list */
+  uint32_t freeCount;         /*!< Number of blocks currently free */
+  uint32_t minFree;           /*!< Lowest freeCount seen (high-water mark) */
+  uint32_t allocFailures;     /*!< Allocation attempts on an empty pool */
+  uint32_t invalidFrees;      /*!< Frees of pointers not owned by the pool */
+} MEMPOOL_Pool_t;
+
+/**
+ * @brief   Snapshot of the statistics of one pool
+ */
+typedef struct
+{
+  uint32_t blockSize;
+  uint32_t blockCount;
+  uint32_t freeCount;
+  uint32_t peakUsed;
+  uint32_t allocFailures;
+  uint32_t invalidFrees;
+} MEMPOOL_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the size-class pools
+ * @details Creates the small and medium pools in CCM RAM and the large pool
+ *          (DMA capable) in internal SRAM
+ * @param   None
+ * @retval  None
+ */
+void MEMPOOL_Init(void);
+
+/**
+ * @brief   Creates a pool over a caller supplied storage area
+ * @param   pool       Pool control structure to initialise
+ * @param   name       Name used in reports
+ * @param   storage    Storage area, 4-byte aligned, blockSize * blockCount bytes
+ * @param   blockSize  Block size in bytes, rounded up to a multiple of 4
+ * @param   blockCount Number of blocks
+ * @retval  HAL_OK on success, HAL_ERROR on invalid arguments
+ */
+HAL_StatusTypeDef MEMPOOL_Create(MEMPOOL_Pool_t *pool, const char *name, void *storage,
+                                 uint32_t blockSize, uint32_t blockCount);
+
+/**
+ * @brief   Takes one block from a pool
+ * @note    ISR safe. Returns NULL when the pool is exhausted.
+ * @param   pool  Pool to allocate from
+ * @retval  Pointer to the block or NULL
+ */
+void *MEMPOOL_PoolAlloc(MEMPOOL_Pool_t *pool);
+
+/**
+ * @brief   Returns a block to a pool
+ * @note    ISR safe. Pointers that do not address the start of a block of
+ *          this pool, and blocks that are already free, are rejected and
+ *          counted as invalid frees.
+ * @param   pool   Pool that owns the block
+ * @param   block  Block to release
+ * @retval  HAL_OK on success, HAL_ERROR on an invalid pointer
+ */
+HAL_StatusTypeDef MEMPOOL_PoolFree(MEMPOOL_Pool_t *pool, void *block);
+
+/**
+ * @brief   Allocates a block of at least size bytes from the size classes
+ * @note    ISR safe. Falls through to the next larger class if the best
+ *          fitting class is exhausted.
+ * @param   size  Requested size in bytes
+ * @retval  Pointer to the block or NULL
+ */
+void *MEMPOOL_Alloc(size_t size);
+
+/**
+ * @brief   Releases a block obtained from MEMPOOL_Alloc()
+ * @note    ISR safe. The owning class is found from the address.
+ * @param   block  Block to release, NULL is ignored
+ * @retval  None
+ */
+void MEMPOOL_Free(void *block);
+
+/**
+ * @brief   Returns the usable size of a block obtained from MEMPOOL_Alloc()
+ * @param   block  Block pointer
+ * @retval  Block size in bytes, 0 if the pointer is not owned by a pool
+ */
+uint32_t MEMPOOL_BlockSize(const void *block);
+
+/**
+ * @brief   Reads the statistics of one size class
+ * @param   cls    Size class
+ * @param   stats  Destination for the snapshot
+ * @retval  None
+ */
+void MEMPOOL_GetStats(MEMPOOL_Class_t cls, MEMPOOL_Stats_t *stats);
+
+/**
+ * @brief   Prints usage and high-water marks of all size classes
+ * @param   None
+ * @retval  None
+ */
+void MEMPOOL_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEMPOOL_H__ */
@@ -0,0 +1,306 @@
+/**
+  ******************************************************************************
+  * @file    motion.c
+  * @brief   Motion classifier service implementation
+  * @details This file provides the motion task. The gyro callback runs in
+  *          the SPI DMA interrupt; it only averages the samples into feature
+  *          steps, quantizes them into a ring and wakes the task every half
+  *          window. The task unrolls the ring into the input map and runs
+  *          the network, with input, arena and activations in CCM RAM.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "motion.h"
+#include "cmsis_os.h"
+#include "stack_monitor.h"
+#include "../L3GD20/l3gd20.h"
+#include "../SYS/dwt.h"
+#include "../SYS/mem_sections.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define MOTION_FLAG_WINDOW        0x01U
+
+/* Private variables ---------------------------------------------------------*/
+static osThreadId_t motionTaskHandle;
+static const osThreadAttr_t motionTask_attributes = {
+  .name = "motionTask",
+  .stack_size = MOTION_TASK_STACK_SIZE,
+  .priority = (osPriority_t) osPriorityBelowNormal,
+};
+
+/**
+ * @brief   Quantized feature steps, written by the gyro callback
+ */
+CCM_BSS static int8_t ring[MOTION_MAX_STEPS][MOTION_FEATURES];
+CCM_BSS static int8_t input[MOTION_MAX_STEPS][MOTION_FEATURES];
+CCM_BSS static uint32_t arena[MOTION_ARENA_SIZE / sizeof(uint32_t)];
+
+static uint32_t ringHead;
+static uint32_t ringFill;
+static uint32_t hopCount;
+static uint64_t windowEndUs;
+static volatile uint8_t windowPending;
+
+static float32_t stepSum[3];
+static uint32_t stepCount;
+
+static MOTION_Result_t latest;
+static uint8_t haveLatest;
+
+static MOTION_Callback_t resultCallback;
+static void *resultContext;
+
+static MOTION_Stats_t stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static void MOTION_Task(void *argument);
+static void MOTION_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context);
+static void MOTION_Classify(void);
+
+/**
+  * @brief  Motion classifier initialization
+  * @param  None
+  * @retval None
+  */
+void MOTION_Init(void)
+{
+  const MOTION_NN_Model_t *model = &motionModel;
+  const uint32_t flat = (uint32_t)model->convOutputLength * model->convFilters;
+
+  if ((MOTION_NN_Check(model) != 0) || (model->inputChannels != MOTION_FEATURES) ||
+      (model->inputLength > MOTION_MAX_STEPS) || (model->inputLength < 2U) ||
+      (model->decimation == 0U) || (MOTION_NN_ArenaSize(model) > sizeof(arena)))
+  {
+    Error_Handler();
+  }
+
+  stats.arenaBytes = MOTION_NN_ArenaSize(model);
+  stats.inputBytes = (uint32_t)model->inputLength * model->inputChannels;
+  stats.weightBytes = ((uint32_t)model->convFilters * model->convKernel * model->inputChannels) +
+                      (3U * model->convFilters * sizeof(int32_t)) +
+                      (flat * model->classCount) + (model->classCount * sizeof(int32_t));
+
+  motionTaskHandle = osThreadNew(MOTION_Task, NULL, &motionTask_attributes);
+  if (motionTaskHandle == NULL)
+  {
+    Error_Handler();
+  }
+  STACKMON_Watch(motionTaskHandle, motionTask_attributes.stack_size);
+
+  DWT_Init();
+  if (L3GD20_AddCallback(MOTION_GyroCallback, NULL) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Register the classification consumer
+  * @param  callback  Consumer
+  * @param  context   Consumer context
+  * @retval None
+  */
+void MOTION_SetCallback(MOTION_Callback_t callback, void *context)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  resultCallback = callback;
+  resultContext = context;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Most recent classification
+  * @param  result  Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MOTION_GetLatest(MOTION_Result_t *result)
+{
+  uint32_t primask;
+
+  if (!haveLatest)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *result = latest;
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Service statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void MOTION_GetStats(MOTION_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Motion task
+  * @param  argument  Unused
+  * @retval None
+  */
+static void MOTION_Task(void *argument)
+{
+  (void)argument;
+
+  for (;;)
+  {
+    if ((osThreadFlagsWait(MOTION_FLAG_WINDOW, osFlagsWaitAny, osWaitForever) & osFlagsError) == 0U)
+    {
+      MOTION_Classify();
+    }
+  }
+}
+
+/**
+  * @brief  Gyro batch consumer
+  * @details Runs in the SPI DMA interrupt; builds the feature steps.
+  * @param  samples  Samples
+  * @param  count    Number of samples
+  * @param  context  Unused
+  * @retval None
+  */
+static void MOTION_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context)
+{
+  const MOTION_NN_Model_t *model = &motionModel;
+  const float32_t inv = 1.0f / (float32_t)model->decimation;
+  int8_t *step;
+  float32_t x;
+  float32_t y;
+  float32_t z;
+  float32_t mag;
+  uint32_t i;
+
+  (void)context;
+
+  for (i = 0; i < count; i++)
+  {
+    stepSum[0] += samples[i].x;
+    stepSum[1] += samples[i].y;
+    stepSum[2] += samples[i].z;
+    if (++stepCount < model->decimation)
+    {
+      continue;
+    }
+
+    x = stepSum[0] * inv;
+    y = stepSum[1] * inv;
+    z = stepSum[2] * inv;
+    arm_sqrt_f32((x * x) + (y * y) + (z * z), &mag);
+    stepSum[0] = 0.0f;
+    stepSum[1] = 0.0f;
+    stepSum[2] = 0.0f;
+    stepCount = 0U;
+
+    step = ring[ringHead];
+    step[0] = MOTION_NN_Quantize(model, x);
+    step[1] = MOTION_NN_Quantize(model, y);
+    step[2] = MOTION_NN_Quantize(model, z);
+    step[3] = MOTION_NN_Quantize(model, mag);
+    ringHead = (ringHead + 1U) % model->inputLength;
+    if (ringFill < model->inputLength)
+    {
+      ringFill++;
+    }
+
+    /* Classify every half window once the first window is complete */
+    if ((ringFill == model->inputLength) && (++hopCount >= (model->inputLength / 2U)))
+    {
+      hopCount = 0U;
+      if (windowPending)
+      {
+        stats.skipped++;
+        continue;
+      }
+      windowEndUs = samples[i].timestampUs;
+      windowPending = 1U;
+      (void)osThreadFlagsSet(motionTaskHandle, MOTION_FLAG_WINDOW);
+    }
+  }
+}
+
+/**
+  * @brief  Classify the current window and publish the result
+  * @param  None
+  * @retval None
+  */
+static void MOTION_Classify(void)
+{
+  const MOTION_NN_Model_t *model = &motionModel;
+  const uint32_t length = model->inputLength;
+  MOTION_Result_t result;
+  MOTION_Callback_t callback;
+  arm_status status;
+  uint32_t head;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t primask;
+  uint32_t i;
+
+  /* Oldest step first; the callback does not write while the copy runs */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  head = ringHead;
+  memcpy(input[0], ring[head], (length - head) * MOTION_FEATURES);
+  memcpy(input[length - head], ring[0], head * MOTION_FEATURES);
+  result.timestampUs = windowEndUs;
+  windowPending = 0U;
+  __set_PRIMASK(primask);
+
+  start = DWT_GetCycles();
+  status = MOTION_NN_Run(model, input[0], arena, sizeof(arena), NULL, result.probs);
+  cycles = DWT_GetCycles() - start;
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    stats.errors++;
+    return;
+  }
+
+  result.classIndex = 0U;
+  for (i = 1; i < model->classCount; i++)
+  {
+    if (result.probs[i] > result.probs[result.classIndex])
+    {
+      result.classIndex = (uint8_t)i;
+    }
+  }
+  for (; i < MOTION_NN_MAX_CLASSES; i++)
+  {
+    result.probs[i] = 0.0f;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  latest = result;
+  haveLatest = 1U;
+  stats.inferences++;
+  stats.cyclesLast = cycles;
+  if (cycles > stats.cyclesMax)
+  {
+    stats.cyclesMax = cycles;
+  }
+  callback = resultCallback;
+  __set_PRIMASK(primask);
+
+  if (callback != NULL)
+  {
+    callback(&result, resultContext);
+  }
+}
@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    motion.h
+  * @brief   Motion classifier service interface
+  * @details This file contains the types and function prototypes of the
+  *          motion classifier. The gyro stream is reduced to feature steps
+  *          (mean x, y, z rate and its magnitude over decimation samples),
+  *          a window of inputLength steps is classified by the int8 network
+  *          of motion_nn.h every half window, and the class probabilities
+  *          are published like the AHRS attitude.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __MOTION_H__
+#define __MOTION_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "motion_nn.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define MOTION_FEATURES           4U        /* x, y, z, |w| per step */
+#define MOTION_MAX_STEPS          128U      /* Longest window a model may use */
+#define MOTION_ARENA_SIZE         1024U     /* Inference scratch, bytes */
+#define MOTION_TASK_STACK_SIZE    (256U * 4U)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Published classification
+ */
+typedef struct
+{
+  uint64_t timestampUs;                     /*!< Time of the last sample of the window */
+  uint8_t classIndex;                       /*!< Most probable class */
+  float32_t probs[MOTION_NN_MAX_CLASSES];   /*!< Per class probability */
+} MOTION_Result_t;
+
+/**
+ * @brief   Classification consumer
+ * @note    Runs in the motion task after every inference
+ * @param   result   New classification
+ * @param   context  Pointer given to MOTION_SetCallback()
+ */
+typedef void (*MOTION_Callback_t)(const MOTION_Result_t *result, void *context);
+
+/**
+ * @brief   Service statistics
+ */
+typedef struct
+{
+  uint32_t inferences;          /*!< Windows classified */
+  uint32_t skipped;             /*!< Windows not classified, task still busy */
+  uint32_t errors;              /*!< Kernel failures */
+  uint32_t cyclesLast;          /*!< CPU cycles of the last inference */
+  uint32_t cyclesMax;           /*!< CPU cycles of the slowest inference */
+  uint32_t arenaBytes;          /*!< Peak scratch of one inference */
+  uint32_t inputBytes;          /*!< Input feature map */
+  uint32_t weightBytes;         /*!< Weights and biases in flash */
+} MOTION_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Creates the motion task and subscribes to the gyro
+ * @note    Stops in Error_Handler() if motionModel does not fit the service
+ * @param   None
+ * @retval  None
+ */
+void MOTION_Init(void);
+
+/**
+ * @brief   Registers the classification consumer
+ * @param   callback  Consumer, NULL to remove
+ * @param   context   Passed back to the consumer
+ * @retval  None
+ */
+void MOTION_SetCallback(MOTION_Callback_t callback, void *context);
+
+/**
+ * @brief   Returns the most recent classification
+ * @param   result  Destination
+ * @retval  HAL_OK, or HAL_ERROR before the first inference
+ */
+HAL_StatusTypeDef MOTION_GetLatest(MOTION_Result_t *result);
+
+/**
+ * @brief   Reads the service statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void MOTION_GetStats(MOTION_Stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MOTION_H__ */
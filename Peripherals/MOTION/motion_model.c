@@ -0,0 +1,141 @@
+/**
+  ******************************************************************************
+  * @file    motion_model.c
+  * @brief   Motion classifier model
+  * @details Generated by tools/motion_model/export_model.py from
+  *          the synthetic demo model (--demo --seed 2025). Do not edit; export the trained model again instead.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "motion_nn.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const classNames[4] = { "idle", "rotate", "shake", "tilt" };
+
+static const int8_t convWeights[160] = {
+  127, 0, 0, 0, 127, 0, 0, 0, 127, 0, 0, 0, 127, 0, 0, 0,
+  127, 0, 0, 0, -127, 0, 0, 0, -127, 0, 0, 0, -127, 0, 0, 0,
+  -127, 0, 0, 0, -127, 0, 0, 0, 0, 127, 0, 0, 0, 127, 0, 0,
+  0, 127, 0, 0, 0, 127, 0, 0, 0, 127, 0, 0, 0, -127, 0, 0,
+  0, -127, 0, 0, 0, -127, 0, 0, 0, -127, 0, 0, 0, -127, 0, 0,
+  0, 0, 127, 0, 0, 0, 127, 0, 0, 0, 127, 0, 0, 0, 127, 0,
+  0, 0, 127, 0, 0, 0, -127, 0, 0, 0, -127, 0, 0, 0, -127, 0,
+  0, 0, -127, 0, 0, 0, -127, 0, 0, 0, 0, 127, 0, 0, 0, 127,
+  0, 0, 0, 127, 0, 0, 0, 127, 0, 0, 0, 127, 0, 0, 0, -32,
+  0, 0, 0, -32, 0, 0, 0, 127, 0, 0, 0, -32, 0, 0, 0, -32,
+};
+
+static const int32_t convBias[8] = {
+  0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const int32_t convMultiplier[8] = {
+  1747301911, 1747301911, 1747301911, 1747301911,
+  1747301911, 1747301911, 1747301911, 1747301911,
+};
+
+static const int32_t convShift[8] = {
+  -8, -8, -8, -8, -8, -8, -8, -6,
+};
+
+static const int8_t denseWeights[1024] = {
+  -5, 0, 0, -5, 0, -1, -11, -3, -17, -1, -1, -9, -1, -2, -29, 0,
+  -33, -2, -3, -10, -1, -1, -48, -1, -47, -5, -6, -11, -1, -1, -68, 0,
+  -59, -7, -8, -13, -1, -1, -86, -1, -67, -8, -11, -15, -1, -1, -100, -2,
+  -71, -10, -13, -16, -1, -1, -110, 0, -70, -11, -16, -19, 0, -1, -116, -1,
+  -66, -12, -19, -23, 0, -1, -119, -1, -58, -13, -20, -27, -2, -1, -116, -2,
+  -48, -13, -22, -28, -1, -1, -110, 0, -35, -13, -24, -29, -1, 0, -101, -1,
+  -27, -14, -27, -29, -2, 0, -98, -1, -25, -17, -29, -29, -1, 0, -98, -1,
+  -24, -18, -30, -26, -1, -1, -98, -1, -22, -19, -31, -23, 0, -2, -95, -2,
+  -20, -20, -32, -21, 0, -1, -92, -1, -16, -22, -32, -20, -1, -1, -88, -1,
+  -13, -22, -31, -19, -1, -1, -85, 0, -11, -23, -31, -18, -1, 0, -82, 0,
+  -10, -22, -29, -17, -2, 0, -79, -2, -9, -21, -25, -17, -2, -1, -73, 0,
+  -7, -20, -21, -16, -1, -1, -65, -1, -6, -18, -18, -14, -1, -1, -57, 0,
+  -4, -16, -14, -13, -1, -1, -48, -1, -3, -14, -10, -11, 0, -1, -39, 0,
+  -3, -11, -6, -10, -1, -1, -31, -1, -2, -8, -3, -9, -1, -1, -23, 0,
+  -2, -5, 0, -9, -1, 0, -16, 0, -2, -2, 0, -8, -2, 0, -13, 0,
+  -1, 0, 0, -7, -1, -1, -11, 0, -1, 0, 0, -6, -1, -1, -9, -2,
+  52, -30, 4, 5, 31, 4, 42, 41, 82, -17, 14, 20, 37, 10, 51, -106,
+  66, 33, 18, 30, 7, 12, 31, -103, 44, 58, 35, 44, -21, 7, 49, -91,
+  4, 32, 31, 29, 28, 68, 28, -100, 8, 32, 6, -7, 18, 60, 27, -103,
+  46, 63, 14, 0, 10, 41, 16, -89, 29, 42, 29, 26, -3, 5, 20, -97,
+  22, 27, 25, 38, 24, 2, 26, -101, 38, 25, 4, 30, 72, 29, 37, -87,
+  38, 4, -2, 26, 51, 6, 10, -90, 43, -4, 3, 25, 30, 0, -27, -111,
+  60, 21, 16, 27, 8, -5, 18, -101, 45, 29, 36, 38, 37, 31, 53, -84,
+  15, 22, 29, 26, 39, 30, 38, -91, 1, 20, 19, 12, 28, 15, -21, -96,
+  -11, 9, 21, 8, 21, 17, -41, -103, 8, 29, 41, 25, 4, 22, 4, -90,
+  43, 69, 45, 25, -10, 28, 40, -87, 2, 38, 34, 18, 7, 46, 24, -92,
+  -47, -9, 17, 12, 54, 73, -26, -103, -7, 24, 11, 18, 23, 11, -15, -101,
+  54, 67, 26, 42, 11, -27, 21, -89, 37, 26, 43, 61, 20, -28, 39, -99,
+  31, -3, 6, 19, 76, 30, 41, -83, 47, -5, 0, 2, 71, 32, 12, -93,
+  46, -10, 37, 31, 15, -17, 13, -108, 62, 17, 57, 47, 20, 3, 60, -93,
+  69, 57, 43, 28, 12, 22, 78, -88, 22, 53, 21, 3, 11, 55, 41, -104,
+  -12, 49, 26, 8, -10, 61, 28, -114, -6, 49, 34, 22, -24, 36, 47, -9,
+  -27, 45, 7, 11, -28, 3, 36, 14, -43, 42, 5, 2, -33, 0, 74, 114,
+  -32, -8, -2, -16, -2, -3, 79, 109, -11, -35, -25, -35, 29, 0, 48, 94,
+  32, -10, -29, -20, -18, -64, 62, 107, 26, -17, -7, 21, -7, -57, 51, 110,
+  -16, -58, -24, 10, 0, -36, 43, 93, 2, -38, -42, -21, 8, 3, 29, 100,
+  6, -21, -32, -34, -21, 10, 26, 107, -14, -17, -5, -27, -69, -16, 18, 94,
+  -17, 8, 0, -28, -46, 2, 42, 95, -28, 14, -3, -25, -21, 6, 73, 117,
+  -55, -17, -12, -21, 3, 9, 26, 105, -43, -25, -29, -30, -28, -28, -8, 90,
+  -12, -16, -22, -16, -32, -23, 5, 98, -3, -17, -14, -5, -23, -6, 57, 101,
+  3, -8, -14, 0, -17, -7, 70, 107, -23, -32, -30, -14, 3, -12, 23, 97,
+  -58, -72, -31, -18, 18, -20, -15, 93, -12, -36, -22, -17, 1, -41, 4, 94,
+  44, 13, 1, -7, -46, -67, 69, 109, 5, -21, 11, -8, -14, -3, 67, 110,
+  -58, -67, -9, -32, -4, 34, 25, 93, -36, -22, -34, -51, -13, 35, 14, 102,
+  -21, 16, 10, 2, -70, -22, 37, 90, -28, 22, 21, 22, -66, -23, 86, 102,
+  -21, 29, -18, -13, -9, 27, 90, 115, -32, -2, -40, -31, -14, 5, 45, 98,
+  -34, -42, -19, -5, -5, -18, 39, 93, 22, -33, 1, 25, 0, -50, 94, 112,
+  61, -26, -7, 21, 20, -54, 110, 123, 45, -31, -23, -1, 30, -31, 60, 33,
+  -20, -15, -11, -10, -2, -6, -67, -53, -22, -24, -18, -13, -2, -8, -96, -8,
+  -1, -22, -13, -4, -4, -8, -62, -5, 14, -19, -3, 3, -7, -6, -29, -3,
+  23, -15, 6, 4, -9, -3, -4, -6, 33, -6, 12, 1, -10, -2, 22, -5,
+  42, 5, 23, 6, -9, -4, 51, -4, 40, 7, 29, 15, -5, -6, 68, -1,
+  38, 7, 25, 19, -3, -10, 68, -5, 34, 5, 21, 23, -1, -11, 62, -5,
+  27, 1, 24, 29, -4, -8, 57, -5, 21, 2, 24, 29, -8, -5, 55, -4,
+  22, 9, 23, 24, -10, -4, 54, -3, 23, 13, 23, 20, -8, -4, 54, -5,
+  22, 12, 23, 17, -7, -6, 55, -5, 24, 15, 26, 16, -5, -8, 59, -4,
+  28, 19, 25, 13, -3, -9, 63, -4, 31, 25, 20, 9, -5, -9, 62, -6,
+  28, 25, 18, 12, -7, -7, 61, -5, 20, 21, 19, 17, -6, -5, 54, -2,
+  13, 18, 11, 13, -6, -6, 36, -4, 10, 18, 3, 7, -7, -7, 22, -9,
+  10, 21, 5, 6, -6, -6, 18, -3, 5, 13, 8, 4, -6, -6, 4, -2,
+  -6, 3, -2, -8, -5, -7, -30, -6, -15, -3, -11, -13, -5, -8, -59, -8,
+  -23, -8, -12, -9, -5, -9, -72, -6, -27, -8, -15, -7, -5, -7, -82, -5,
+  -33, -10, -23, -15, -6, -4, -101, -5, -42, -18, -22, -20, -9, -5, -123, -8,
+  -48, -23, -18, -21, -9, -6, -127, -8, -38, -18, -10, -14, -5, -4, -98, -22,
+};
+
+static const int32_t denseBias[4] = {
+  62329, -34523, -38094, 10288,
+};
+
+/* Exported variables --------------------------------------------------------*/
+const MOTION_NN_Model_t motionModel = {
+  .name = "motion_demo",
+  .classNames = classNames,
+  .classCount = 4U,
+  .inputLength = 64U,
+  .inputChannels = 4U,
+  .decimation = 8U,
+  .inputScale = 2.371019576e+00f,
+  .inputZeroPoint = 0,
+  .convFilters = 8U,
+  .convKernel = 5U,
+  .convStride = 2U,
+  .convPadding = 2U,
+  .convOutputLength = 32U,
+  .convWeights = convWeights,
+  .convBias = convBias,
+  .convMultiplier = convMultiplier,
+  .convShift = convShift,
+  .convOutputZeroPoint = -128,
+  .denseWeights = denseWeights,
+  .denseBias = denseBias,
+  .denseMultiplier = 2061188609,
+  .denseShift = -12,
+  .denseOutputZeroPoint = 36,
+  .denseOutputScale = 4.339240543e-01f,
+};
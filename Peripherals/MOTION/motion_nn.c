@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * @file    motion_nn.c
+  * @brief   Int8 motion classifier network implementation
+  * @details This file provides the inference of the motion classifier. The
+  *          arena holds the convolution output at offset 0, followed by a
+  *          region that is the im2col buffer of the convolution first and
+  *          the logits of the dense layer afterwards.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "motion_nn.h"
+#include "arm_nnfunctions.h"
+#include <math.h>
+#include <stddef.h>
+
+/* Private macros ------------------------------------------------------------*/
+#define MOTION_NN_ALIGN4(x)       (((x) + 3U) & ~3U)
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t MOTION_NN_ConvBufferSize(const MOTION_NN_Model_t *model);
+
+/**
+  * @brief  Check a model
+  * @param  model  Model
+  * @retval 0 or -1
+  */
+int32_t MOTION_NN_Check(const MOTION_NN_Model_t *model)
+{
+  uint32_t span;
+
+  if ((model == NULL) || (model->classCount == 0U) ||
+      (model->classCount > MOTION_NN_MAX_CLASSES) || (model->inputChannels == 0U) ||
+      (model->convKernel == 0U) || (model->convStride == 0U) || (model->convFilters == 0U))
+  {
+    return -1;
+  }
+
+  span = (uint32_t)model->inputLength + (2U * model->convPadding);
+  if ((span < model->convKernel) ||
+      (model->convOutputLength != (((span - model->convKernel) / model->convStride) + 1U)) ||
+      ((model->convOutputLength % 4U) != 0U))
+  {
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Inference scratch size
+  * @param  model  Model
+  * @retval Bytes
+  */
+uint32_t MOTION_NN_ArenaSize(const MOTION_NN_Model_t *model)
+{
+  const uint32_t convOut = MOTION_NN_ALIGN4((uint32_t)model->convOutputLength * model->convFilters);
+  const uint32_t convBuffer = MOTION_NN_ConvBufferSize(model);
+
+  return convOut + ((convBuffer > model->classCount) ? convBuffer : MOTION_NN_ALIGN4(model->classCount));
+}
+
+/**
+  * @brief  Quantize an input feature
+  * @param  model  Model
+  * @param  value  Feature value
+  * @retval Quantized value
+  */
+int8_t MOTION_NN_Quantize(const MOTION_NN_Model_t *model, float32_t value)
+{
+  int32_t q = (int32_t)lroundf(value / model->inputScale) + model->inputZeroPoint;
+
+  return (int8_t)((q > 127) ? 127 : ((q < -128) ? -128 : q));
+}
+
+/**
+  * @brief  Run one inference
+  * @param  model      Model
+  * @param  input      Input map
+  * @param  arena      Scratch
+  * @param  arenaSize  Scratch size
+  * @param  logits     Quantized logits or NULL
+  * @param  probs      Probabilities
+  * @retval CMSIS status
+  */
+arm_status MOTION_NN_Run(const MOTION_NN_Model_t *model, const int8_t *input, void *arena,
+                         uint32_t arenaSize, int8_t *logits, float32_t *probs)
+{
+  const uint32_t flat = (uint32_t)model->convOutputLength * model->convFilters;
+  int8_t *convOut = (int8_t *)arena;
+  int8_t *tail = (int8_t *)arena + MOTION_NN_ALIGN4(flat);
+  cmsis_nn_context ctx;
+  cmsis_nn_conv_params convParams;
+  cmsis_nn_per_channel_quant_params convQuant;
+  cmsis_nn_fc_params denseParams;
+  cmsis_nn_per_tensor_quant_params denseQuant;
+  cmsis_nn_dims inputDims;
+  cmsis_nn_dims filterDims;
+  cmsis_nn_dims biasDims;
+  cmsis_nn_dims outputDims;
+  arm_status status;
+  float32_t value[MOTION_NN_MAX_CLASSES];
+  float32_t peak;
+  float32_t sum = 0.0f;
+  uint32_t i;
+
+  if ((arena == NULL) || (arenaSize < MOTION_NN_ArenaSize(model)) || (MOTION_NN_Check(model) != 0))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Convolution with fused ReLU: real 0 is the output zero point */
+  inputDims = (cmsis_nn_dims){ .n = 1, .h = 1, .w = model->inputLength, .c = model->inputChannels };
+  filterDims = (cmsis_nn_dims){ .n = model->convFilters, .h = 1, .w = model->convKernel,
+                                .c = model->inputChannels };
+  biasDims = (cmsis_nn_dims){ .n = 1, .h = 1, .w = 1, .c = model->convFilters };
+  outputDims = (cmsis_nn_dims){ .n = 1, .h = 1, .w = model->convOutputLength, .c = model->convFilters };
+
+  convParams.input_offset = -model->inputZeroPoint;
+  convParams.output_offset = model->convOutputZeroPoint;
+  convParams.stride = (cmsis_nn_tile){ .w = model->convStride, .h = 1 };
+  convParams.padding = (cmsis_nn_tile){ .w = model->convPadding, .h = 0 };
+  convParams.dilation = (cmsis_nn_tile){ .w = 1, .h = 1 };
+  convParams.activation = (cmsis_nn_activation){ .min = model->convOutputZeroPoint, .max = 127 };
+
+  /* The kernels take non-const pointers but only read them */
+  convQuant.multiplier = (int32_t *)model->convMultiplier;
+  convQuant.shift = (int32_t *)model->convShift;
+
+  ctx.buf = tail;
+  ctx.size = (int32_t)MOTION_NN_ConvBufferSize(model);
+
+  status = arm_convolve_1_x_n_s8(&ctx, &convParams, &convQuant, &inputDims, input, &filterDims,
+                                 model->convWeights, &biasDims, model->convBias, &outputDims, convOut);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  /* Dense layer over the flattened [length][filters] map */
+  inputDims = (cmsis_nn_dims){ .n = 1, .h = 1, .w = 1, .c = (int32_t)flat };
+  filterDims = (cmsis_nn_dims){ .n = (int32_t)flat, .h = 1, .w = 1, .c = model->classCount };
+  biasDims = (cmsis_nn_dims){ .n = 1, .h = 1, .w = 1, .c = model->classCount };
+  outputDims = (cmsis_nn_dims){ .n = 1, .h = 1, .w = 1, .c = model->classCount };
+
+  denseParams.input_offset = -model->convOutputZeroPoint;
+  denseParams.filter_offset = 0;
+  denseParams.output_offset = model->denseOutputZeroPoint;
+  denseParams.activation = (cmsis_nn_activation){ .min = -128, .max = 127 };
+  denseQuant.multiplier = model->denseMultiplier;
+  denseQuant.shift = model->denseShift;
+
+  ctx.buf = NULL;
+  ctx.size = 0;
+
+  status = arm_fully_connected_s8(&ctx, &denseParams, &denseQuant, &inputDims, convOut, &filterDims,
+                                  model->denseWeights, &biasDims, model->denseBias, &outputDims, tail);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  /* Softmax on the dequantized logits */
+  for (i = 0; i < model->classCount; i++)
+  {
+    value[i] = model->denseOutputScale * (float32_t)((int32_t)tail[i] - model->denseOutputZeroPoint);
+    if (logits != NULL)
+    {
+      logits[i] = tail[i];
+    }
+  }
+
+  peak = value[0];
+  for (i = 1; i < model->classCount; i++)
+  {
+    peak = (value[i] > peak) ? value[i] : peak;
+  }
+  for (i = 0; i < model->classCount; i++)
+  {
+    probs[i] = expf(value[i] - peak);
+    sum += probs[i];
+  }
+  for (i = 0; i < model->classCount; i++)
+  {
+    probs[i] /= sum;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  * @brief  Convolution im2col buffer size
+  * @param  model  Model
+  * @retval Bytes
+  */
+static uint32_t MOTION_NN_ConvBufferSize(const MOTION_NN_Model_t *model)
+{
+  const cmsis_nn_dims inputDims = { .n = 1, .h = 1, .w = model->inputLength, .c = model->inputChannels };
+  const cmsis_nn_dims filterDims = { .n = model->convFilters, .h = 1, .w = model->convKernel,
+                                     .c = model->inputChannels };
+
+  return MOTION_NN_ALIGN4((uint32_t)arm_convolve_1_x_n_s8_get_buffer_size(&inputDims, &filterDims));
+}
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    motion_nn.h
+  * @brief   Int8 motion classifier network interface
+  * @details This file contains the model descriptor and the inference entry
+  *          points of the motion classifier. The network is fixed:
+  *          - input:  length x channels int8 feature map (NHWC, H = 1)
+  *          - conv:   1 x N convolution, per-channel quantized, fused ReLU
+  *                    (arm_convolve_1_x_n_s8)
+  *          - dense:  fully connected to one logit per class
+  *                    (arm_fully_connected_s8)
+  *          - softmax in float on the dequantized logits
+  *          Sizes and quantization parameters come from the descriptor that
+  *          tools/motion_model/export_model.py generates from a trained
+  *          float model, so a new model needs no code change.
+  *
+  *          Like the AHRS filters, this code only depends on CMSIS-DSP/NN,
+  *          so the same inference runs on target and in the host check.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __MOTION_NN_H__
+#define __MOTION_NN_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define MOTION_NN_MAX_CLASSES     8U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Quantized model descriptor
+ * @note    Scales follow the TFLite convention: real = scale * (q - zeroPoint).
+ *          Multipliers are Q31 with a left shift (negative shifts right).
+ */
+typedef struct
+{
+  const char *name;
+  const char *const *classNames;
+  uint8_t classCount;
+
+  /* Input feature map */
+  uint16_t inputLength;             /*!< Time steps */
+  uint8_t inputChannels;            /*!< Features per step */
+  uint8_t decimation;               /*!< Raw samples averaged per step */
+  float32_t inputScale;
+  int32_t inputZeroPoint;
+
+  /* Convolution, weights [filters][kernel][channels] */
+  uint8_t convFilters;
+  uint8_t convKernel;
+  uint8_t convStride;
+  uint8_t convPadding;
+  uint16_t convOutputLength;        /*!< Multiple of 4 (arm_convolve_1_x_n_s8) */
+  const int8_t *convWeights;
+  const int32_t *convBias;
+  const int32_t *convMultiplier;    /*!< Per filter */
+  const int32_t *convShift;         /*!< Per filter */
+  int32_t convOutputZeroPoint;
+
+  /* Dense, weights [classes][convOutputLength * convFilters] */
+  const int8_t *denseWeights;
+  const int32_t *denseBias;
+  int32_t denseMultiplier;
+  int32_t denseShift;
+  int32_t denseOutputZeroPoint;
+  float32_t denseOutputScale;
+} MOTION_NN_Model_t;
+
+/* Exported variables --------------------------------------------------------*/
+/**
+ * @brief   Model built into the firmware, generated into motion_model.c
+ */
+extern const MOTION_NN_Model_t motionModel;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Checks a model against the kernel constraints
+ * @param   model  Model
+ * @retval  0 if the model can run, -1 otherwise
+ */
+int32_t MOTION_NN_Check(const MOTION_NN_Model_t *model);
+
+/**
+ * @brief   Scratch memory one inference needs
+ * @details Convolution output plus the larger of the convolution im2col
+ *          buffer and the logits; this is the peak, both layers included
+ * @param   model  Model
+ * @retval  Bytes
+ */
+uint32_t MOTION_NN_ArenaSize(const MOTION_NN_Model_t *model);
+
+/**
+ * @brief   Quantizes one feature value for the input map
+ * @param   model  Model
+ * @param   value  Feature value
+ * @retval  Quantized value, saturated
+ */
+int8_t MOTION_NN_Quantize(const MOTION_NN_Model_t *model, float32_t value);
+
+/**
+ * @brief   Runs one inference
+ * @param   model      Model
+ * @param   input      Input map, inputLength x inputChannels
+ * @param   arena      Scratch, MOTION_NN_ArenaSize() bytes, 4-byte aligned
+ * @param   arenaSize  Size of arena
+ * @param   logits     Quantized logits, classCount values, or NULL
+ * @param   probs      Class probabilities, classCount values
+ * @retval  ARM_MATH_SUCCESS or the failing kernel status
+ */
+arm_status MOTION_NN_Run(const MOTION_NN_Model_t *model, const int8_t *input, void *arena,
+                         uint32_t arenaSize, int8_t *logits, float32_t *probs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MOTION_NN_H__ */
@@ -0,0 +1,359 @@
+/**
+  ******************************************************************************
+  * @file    newlib_lock.c
+  * @brief   Newlib lock integration implementation
+  * @details This file provides newlib's retargetable locking interface
+  *          (__retarget_lock_*) and the classic __malloc_lock/__malloc_unlock
+  *          pair on top of FreeRTOS recursive mutexes.
+  *
+  *          - Locks are no-ops until the scheduler starts, since only one
+  *            thread of execution exists before that. A release only gives
+  *            a mutex the calling task holds, so a section entered before
+  *            the start never gives a mutex it did not take.
+  *          - A mutex can be blocked on neither in handler mode nor with the
+  *            scheduler suspended. A C library call from there is a bug:
+  *            it is counted and stops at configASSERT(), instead of running
+  *            the section unlocked next to a task that holds the lock.
+  *          - Newlib's static locks and the first NEWLIB_LOCK_POOL_SIZE
+  *            dynamic locks use statically allocated mutexes; only further
+  *            dynamic locks (e.g. per FILE) come from the FreeRTOS heap.
+  *
+  *          Per-task errno and stdio state come from configUSE_NEWLIB_REENTRANT,
+  *          which makes the kernel switch _impure_ptr on every context switch.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "newlib_lock.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include <sys/lock.h>
+#include <reent.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define NEWLIB_LOCK_POOL_SIZE   8U   /* Dynamic locks served without the heap */
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Newlib lock object, layout owned by the application
+ */
+struct __lock
+{
+  SemaphoreHandle_t mutex;         /*!< Created on first use */
+  StaticSemaphore_t mutexBuffer;   /*!< Storage for the mutex */
+  uint8_t inUse;                   /*!< Pool slot allocated */
+  uint8_t fromHeap;                /*!< Object allocated with pvPortMalloc() */
+};
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Static locks referenced by newlib
+ */
+struct __lock __lock___sinit_recursive_mutex;
+struct __lock __lock___sfp_recursive_mutex;
+struct __lock __lock___atexit_recursive_mutex;
+struct __lock __lock___at_quick_exit_mutex;
+struct __lock __lock___malloc_recursive_mutex;
+struct __lock __lock___env_recursive_mutex;
+struct __lock __lock___tz_mutex;
+struct __lock __lock___dd_hash_mutex;
+struct __lock __lock___arc4random_mutex;
+
+/**
+ * @brief   Pool for locks created at run time
+ */
+static struct __lock lockPool[NEWLIB_LOCK_POOL_SIZE];
+
+/**
+ * @brief   Lock requests made from interrupt context
+ */
+static volatile uint32_t isrViolations;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t NEWLIB_LOCK_Bypass(void);
+static SemaphoreHandle_t NEWLIB_LOCK_Get(_LOCK_T lock);
+static _LOCK_T NEWLIB_LOCK_New(void);
+
+/**
+  * @brief  Number of lock requests made from interrupt context
+  * @param  None
+  * @retval Violation count
+  */
+uint32_t NEWLIB_LOCK_GetIsrViolations(void)
+{
+  return isrViolations;
+}
+
+/**
+  * @brief  Create a dynamic lock
+  * @param  lock  Destination for the lock
+  * @retval None
+  */
+void __retarget_lock_init(_LOCK_T *lock)
+{
+  *lock = NEWLIB_LOCK_New();
+}
+
+/**
+  * @brief  Create a dynamic recursive lock
+  * @param  lock  Destination for the lock
+  * @retval None
+  */
+void __retarget_lock_init_recursive(_LOCK_T *lock)
+{
+  *lock = NEWLIB_LOCK_New();
+}
+
+/**
+  * @brief  Destroy a dynamic lock
+  * @param  lock  Lock to destroy
+  * @retval None
+  */
+void __retarget_lock_close(_LOCK_T lock)
+{
+  if (lock == NULL)
+  {
+    return;
+  }
+
+  if (lock->mutex != NULL)
+  {
+    vSemaphoreDelete(lock->mutex);
+    lock->mutex = NULL;
+  }
+
+  if (lock->fromHeap != 0U)
+  {
+    vPortFree(lock);
+  }
+  else
+  {
+    lock->inUse = 0U;
+  }
+}
+
+/**
+  * @brief  Destroy a dynamic recursive lock
+  * @param  lock  Lock to destroy
+  * @retval None
+  */
+void __retarget_lock_close_recursive(_LOCK_T lock)
+{
+  __retarget_lock_close(lock);
+}
+
+/**
+  * @brief  Acquire a recursive lock
+  * @details Blocks until the lock is free
+  * @param  lock  Lock to acquire
+  * @retval None
+  */
+void __retarget_lock_acquire_recursive(_LOCK_T lock)
+{
+  SemaphoreHandle_t mutex;
+  BaseType_t taken;
+
+  if (NEWLIB_LOCK_Bypass())
+  {
+    return;
+  }
+
+  mutex = NEWLIB_LOCK_Get(lock);
+  if (mutex != NULL)
+  {
+    taken = xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+    configASSERT(taken == pdTRUE);
+    (void)taken;
+  }
+}
+
+/**
+  * @brief  Try to acquire a recursive lock
+  * @param  lock  Lock to acquire
+  * @retval 0 on success, non-zero if the lock is held by another task
+  */
+int __retarget_lock_try_acquire_recursive(_LOCK_T lock)
+{
+  SemaphoreHandle_t mutex;
+
+  if (NEWLIB_LOCK_Bypass())
+  {
+    return 0;
+  }
+
+  mutex = NEWLIB_LOCK_Get(lock);
+  if (mutex == NULL)
+  {
+    return 0;
+  }
+
+  return (xSemaphoreTakeRecursive(mutex, 0) == pdTRUE) ? 0 : 1;
+}
+
+/**
+  * @brief  Release a recursive lock
+  * @param  lock  Lock to release
+  * @retval None
+  */
+void __retarget_lock_release_recursive(_LOCK_T lock)
+{
+  if (NEWLIB_LOCK_Bypass() || (lock == NULL) || (lock->mutex == NULL))
+  {
+    return;
+  }
+
+  /* A lock entered before the scheduler started was never taken */
+  if (xSemaphoreGetMutexHolder(lock->mutex) == xTaskGetCurrentTaskHandle())
+  {
+    (void)xSemaphoreGiveRecursive(lock->mutex);
+  }
+}
+
+/**
+  * @brief  Acquire a lock
+  * @param  lock  Lock to acquire
+  * @retval None
+  */
+void __retarget_lock_acquire(_LOCK_T lock)
+{
+  __retarget_lock_acquire_recursive(lock);
+}
+
+/**
+  * @brief  Try to acquire a lock
+  * @param  lock  Lock to acquire
+  * @retval 0 on success, non-zero if the lock is held by another task
+  */
+int __retarget_lock_try_acquire(_LOCK_T lock)
+{
+  return __retarget_lock_try_acquire_recursive(lock);
+}
+
+/**
+  * @brief  Release a lock
+  * @param  lock  Lock to release
+  * @retval None
+  */
+void __retarget_lock_release(_LOCK_T lock)
+{
+  __retarget_lock_release_recursive(lock);
+}
+
+/**
+  * @brief  Newlib malloc lock
+  * @note   Also covers toolchains whose newlib is built without
+  *         retargetable locking
+  * @param  r  Reentrancy structure (unused)
+  * @retval None
+  */
+void __malloc_lock(struct _reent *r)
+{
+  (void)r;
+  __retarget_lock_acquire_recursive(&__lock___malloc_recursive_mutex);
+}
+
+/**
+  * @brief  Newlib malloc unlock
+  * @param  r  Reentrancy structure (unused)
+  * @retval None
+  */
+void __malloc_unlock(struct _reent *r)
+{
+  (void)r;
+  __retarget_lock_release_recursive(&__lock___malloc_recursive_mutex);
+}
+
+/**
+  * @brief  Decide whether a lock operation must be skipped
+  * @details Asserts in handler mode and with the scheduler suspended; if
+  *          configASSERT() returns, the operation is skipped on both the
+  *          acquire and the release side.
+  * @param  None
+  * @retval 1 before the scheduler starts, 0 otherwise
+  */
+static uint8_t NEWLIB_LOCK_Bypass(void)
+{
+  BaseType_t scheduler;
+
+  if (NEWLIB_IN_ISR())
+  {
+    isrViolations++;
+    configASSERT(0);
+    return 1U;
+  }
+
+  scheduler = xTaskGetSchedulerState();
+  if (scheduler == taskSCHEDULER_SUSPENDED)
+  {
+    configASSERT(0);
+    return 1U;
+  }
+
+  return (scheduler == taskSCHEDULER_NOT_STARTED) ? 1U : 0U;
+}
+
+/**
+  * @brief  Return the mutex of a lock, creating it on first use
+  * @param  lock  Lock object
+  * @retval Mutex handle or NULL
+  */
+static SemaphoreHandle_t NEWLIB_LOCK_Get(_LOCK_T lock)
+{
+  if (lock == NULL)
+  {
+    return NULL;
+  }
+
+  if (lock->mutex == NULL)
+  {
+    taskENTER_CRITICAL();
+    if (lock->mutex == NULL)
+    {
+      lock->mutex = xSemaphoreCreateRecursiveMutexStatic(&lock->mutexBuffer);
+    }
+    taskEXIT_CRITICAL();
+  }
+
+  return lock->mutex;
+}
+
+/**
+  * @brief  Allocate a lock object from the pool or the heap
+  * @param  None
+  * @retval Lock object or NULL
+  */
+static _LOCK_T NEWLIB_LOCK_New(void)
+{
+  _LOCK_T lock = NULL;
+  uint32_t i;
+
+  taskENTER_CRITICAL();
+  for (i = 0; i < NEWLIB_LOCK_POOL_SIZE; i++)
+  {
+    if (lockPool[i].inUse == 0U)
+    {
+      lockPool[i].inUse = 1U;
+      lockPool[i].fromHeap = 0U;
+      lockPool[i].mutex = NULL;
+      lock = &lockPool[i];
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+
+  if (lock == NULL)
+  {
+    lock = (_LOCK_T)pvPortMalloc(sizeof(struct __lock));
+    if (lock != NULL)
+    {
+      lock->mutex = NULL;
+      lock->inUse = 1U;
+      lock->fromHeap = 1U;
+    }
+  }
+
+  return lock;
+}
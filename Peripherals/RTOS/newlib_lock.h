@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    newlib_lock.h
+  * @brief   Newlib lock integration interface
+  * @details This file contains the helpers of the newlib lock layer. The
+  *          layer maps newlib's malloc, stdio and environment locks onto
+  *          FreeRTOS recursive mutexes so that printf() and malloc() are
+  *          safe to call from several tasks once the scheduler runs.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __NEWLIB_LOCK_H__
+#define __NEWLIB_LOCK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+ * @brief   Evaluates to non-zero when executing in handler mode
+ * @details Newlib locks cannot be taken from an interrupt; code that may run
+ *          in either context checks this before calling into the C library.
+ */
+#define NEWLIB_IN_ISR()   (__get_IPSR() != 0U)
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Number of lock requests made from interrupt context
+ * @details Each one fails configASSERT(), which records a crash with the
+ *          caller. A non-zero value means some interrupt handler calls
+ *          printf() or malloc() and must be fixed.
+ * @param   None
+ * @retval  Number of lock requests seen in handler mode
+ */
+uint32_t NEWLIB_LOCK_GetIsrViolations(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NEWLIB_LOCK_H__ */
@@ -12,7 +12,22 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "rtos.h"
+#include "stack_monitor.h"
 #include "usb_host.h"
+#include "usbh_core.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "../ACQ/acq.h"
+#include "../BOOT/boot_init.h"
+#include "../BRIDGE/bridge.h"
+#include "../AHRS/ahrs.h"
+#include "../CDC/cdc_stream.h"
+#include "../LOG/logger.h"
+#include "../MOTION/motion.h"
+#include "../SPECTRUM/spectrum.h"
+#include "../SYS/crash.h"
+#include "../SYS/dwt.h"
+#include "../UART/uart_example.h"
 
 /* Private variables ---------------------------------------------------------*/
 /**
@@ -24,21 +39,62 @@ osThreadId_t defaultTaskHandle;
 /**
  * @brief   Default task configuration attributes
  * @details Defines the task name, stack size, and priority
- * @note    Stack size is set to 16 KB (4096 * 4 bytes) which is
- *          adequate for most general-purpose tasks
+ * @note    Stack size is 2 KB (512 * 4 bytes), down from 16 KB. Static
+ *          worst case, not a board measurement: the deepest path is
+ *          CRASH_Report() (128-byte fault text) into printf(), about 200
+ *          bytes of frames plus 512 bytes allowed for newlib-nano's printf
+ *          and 200 for the FPU exception and context frames, under 1 KB.
+ *          The USB host bring-up is not analysed, hence 2 KB. Check it
+ *          against the stack monitor report on the board.
  */
 const osThreadAttr_t defaultTask_attributes = {
   .name = "defaultTask",         /* Task name for debugging and analysis */
-  .stack_size = 4096 * 4,        /* 16 KB stack allocation */
+  .stack_size = 512 * 4,         /* 2 KB stack allocation */
   .priority = (osPriority_t) osPriorityNormal, /* Normal priority level */
 };
 
+/**
+ * @brief   Handle for the console task
+ */
+osThreadId_t consoleTaskHandle;
+
+/**
+ * @brief   Console task configuration attributes
+ * @note    Stack size is 4 KB (1024 * 4 bytes), from gcc -fstack-usage on
+ *          the Debug (-O0) build: UART_Example_ProcessCommand() alone takes
+ *          2496 bytes for its line copy and report buffers (1504 at -Os),
+ *          2848 with the command line drain above it and HEAPTRACE_Report()
+ *          below. Measured on a host build of uart_example.c, there being
+ *          no target compiler here; the buffers dominate, so the Cortex-M4
+ *          frames are close. Plus 512 bytes for newlib-nano's printf and
+ *          200 for the FPU exception and context frames: 3.5 KB. The 2 KB
+ *          it had overflowed on the first command.
+ *          Below normal priority: it polls every PROCESS_INTERVAL_MS and
+ *          must not delay the sensor tasks.
+ */
+const osThreadAttr_t consoleTask_attributes = {
+  .name = "console",
+  .stack_size = 1024 * 4,
+  .priority = (osPriority_t) osPriorityBelowNormal,
+};
+
+/**
+ * @brief   CPU load published by the default task
+ */
+static RTOS_CpuLoad_t cpuLoad;
+
+/* External variables --------------------------------------------------------*/
+extern USBH_HandleTypeDef hUsbHostHS;
+
+/* Private function prototypes -----------------------------------------------*/
+static void StartConsoleTask(void *argument);
+
 /**
   * @brief  RTOS Initialization Function
   * @details Performs initialization of the RTOS kernel and creates
   *          the default system tasks. The sequence is:
   *          1. Initialize the OS kernel
-  *          2. Create the default task
+  *          2. Create the default task and the console task
   *          3. Set up any additional RTOS resources
   *
   * @note   This should be called before any peripheral initialization
@@ -55,6 +111,35 @@ void RTOS_Init(void)
   /* Creation of defaultTask - the main application task */
   defaultTaskHandle = osThreadNew(StartDefaultTask, NULL, &defaultTask_attributes);
 
+  /* Console command loop, run by main() itself before the kernel started */
+  consoleTaskHandle = osThreadNew(StartConsoleTask, NULL, &consoleTask_attributes);
+
+  /* Stack high-water monitoring and right-sizing report */
+  STACKMON_Init();
+  STACKMON_Watch(defaultTaskHandle, defaultTask_attributes.stack_size);
+  STACKMON_Watch(consoleTaskHandle, consoleTask_attributes.stack_size);
+
+  /* Attitude estimation from the gyro stream */
+  AHRS_Init(AHRS_FILTER_MADGWICK);
+
+  /* Vibration spectrum of the gyro stream and its spectrogram */
+  SPECTRUM_Init();
+
+  /* Int8 motion classifier on the gyro stream */
+  MOTION_Init();
+
+  /* CDC byte stream, fed once the USB host sees a device */
+  CDCSTREAM_Init();
+
+  /* Gyro logging to the SDRAM RAM disk */
+  LOGGER_Init();
+
+  /* USART1 to USB CDC bridge, idle until requested from the console */
+  BRIDGE_Init();
+
+  /* Peripherals main() left down, brought up once the kernel runs */
+  BOOTINIT_StartTask();
+
   /* Add additional RTOS resources here (mutexes, semaphores, queues, etc.) */
 }
 
@@ -81,31 +166,102 @@ void RTOS_Start(void)
 /**
   * @brief  Function implementing the defaultTask thread
   * @details This is the entry function for the default task. It:
-  *          1. Initializes the USB Host interface
-  *          2. Enters an infinite loop for continuous operation
-  *          3. Includes a delay to prevent CPU hogging
+  *          1. Initializes the USB Host interface, which then runs in its
+  *             own thread, woken by the HCD interrupt through the host
+  *             event queue (USBH_USE_OS)
+  *          2. Measures the CPU load once per RTOS_LOAD_WINDOW_MS from
+  *             the run time of the idle task
   *
-  * @note   The default task is typically used for:
-  *         - Non-time-critical operations
-  *         - Background processing
-  *         - System maintenance functions
+  * @note   The task sleeps between windows; it used to wake up every tick
+  *         for nothing.
   *
   * @param  argument: Task input argument pointer (unused in this implementation)
   * @retval None
   */
 void StartDefaultTask(void *argument)
 {
+  uint32_t lastIdle;
+  uint32_t lastCycles;
+  uint32_t idle;
+  uint32_t cycles;
+  uint32_t share;
+  uint32_t primask;
+
+  (void)argument;
+
+  /* Post-mortem of the previous run, if it ended in a crash */
+  CRASH_Report();
+
   /* Initialize code for USB Host */
   MX_USB_HOST_Init();
+  STACKMON_Watch(hUsbHostHS.thread, USBH_PROCESS_STACK_SIZE);
+
+  lastIdle = ulTaskGetIdleRunTimeCounter();
+  lastCycles = DWT_GetCycles();
 
-  /* Infinite loop - the task body that runs repeatedly */
   for(;;)
   {
-    /* Small delay to prevent task from consuming all CPU time */
-    osDelay(1);  /* Yield for 1 tick (typically 1ms) */
+    osDelay(RTOS_LOAD_WINDOW_MS);
+
+    /* Both counters wrap every 2^32 cycles (23 s), far longer than a window */
+    idle = ulTaskGetIdleRunTimeCounter();
+    cycles = DWT_GetCycles();
+    share = (cycles == lastCycles) ? 0U
+          : (uint32_t)(((uint64_t)(idle - lastIdle) * 10000U) / (cycles - lastCycles));
+    lastIdle = idle;
+    lastCycles = cycles;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    cpuLoad.idle = (share > 10000U) ? 10000U : share;
+    cpuLoad.load = 10000U - cpuLoad.idle;
+    if (cpuLoad.load > cpuLoad.peakLoad)
+    {
+      cpuLoad.peakLoad = cpuLoad.load;
+    }
+    cpuLoad.windows++;
+    __set_PRIMASK(primask);
   }
 }
 
+/**
+  * @brief  Function implementing the console task
+  * @details Runs the UART command loop, which sleeps between passes once
+  *          the kernel runs
+  * @param  argument: Task input argument pointer (unused)
+  * @retval None
+  */
+static void StartConsoleTask(void *argument)
+{
+  (void)argument;
+
+  UART_Example_MainLoop();
+}
+
+/**
+  * @brief  CPU load of the last window
+  * @param  load  Destination
+  * @retval None
+  */
+void RTOS_GetCpuLoad(RTOS_CpuLoad_t *load)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *load = cpuLoad;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  FreeRTOS run time counter
+  * @param  None
+  * @retval DWT cycle counter
+  */
+uint32_t RTOS_GetRunTimeCounter(void)
+{
+  return DWT_GetCycles();
+}
+
 /**
   * @brief  Period elapsed callback in non-blocking mode
   * @details This function is automatically called by the HAL when
@@ -113,7 +269,8 @@ void StartDefaultTask(void *argument)
   *          counter used by the RTOS for timing and task switching.
   *
   * @note   This function is critical for RTOS timing. TIM6 is configured
-  *         as the time base source for the RTOS kernel.
+  *         as the time base source for the RTOS kernel. TIM1 updates are
+  *         the sample ticks of the acquisition scheduler.
   * @param  htim : TIM handle pointer to identify which timer triggered the callback
   * @retval None
   */
@@ -123,4 +280,8 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
   {
     HAL_IncTick();  /* Increment the HAL tick counter used by the RTOS */
   }
+  else if (htim->Instance == TIM1)
+  {
+    ACQ_TimerTick();
+  }
 }
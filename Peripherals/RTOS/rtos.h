@@ -22,6 +22,24 @@ extern "C" {
 #include "main.h"
 #include "cmsis_os.h"
 
+/* Exported constants --------------------------------------------------------*/
+#define RTOS_LOAD_WINDOW_MS       1000U     /* CPU load measurement window */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   CPU load over the last measurement window
+ * @details Idle is the run time of the FreeRTOS idle task (including the idle
+ *          hook, which only drains stdout), counted in DWT cycles at every
+ *          context switch
+ */
+typedef struct
+{
+  uint32_t idle;                /*!< Idle time, 0.01 % */
+  uint32_t load;                /*!< 10000 - idle */
+  uint32_t peakLoad;            /*!< Highest load of any window, 0.01 % */
+  uint32_t windows;             /*!< Windows measured */
+} RTOS_CpuLoad_t;
+
 /* Exported functions prototypes ---------------------------------------------*/
 /**
  * @brief   Initializes RTOS components before kernel start
@@ -48,6 +66,21 @@ void RTOS_Start(void);
  */
 void StartDefaultTask(void *argument);
 
+/**
+ * @brief   Reads the CPU load measured by the default task
+ * @param   load  Destination, zero until the first window ended
+ * @retval  None
+ */
+void RTOS_GetCpuLoad(RTOS_CpuLoad_t *load);
+
+/**
+ * @brief   FreeRTOS run time counter
+ * @note    portGET_RUN_TIME_COUNTER_VALUE(), wraps every 2^32 cycles
+ * @param   None
+ * @retval  DWT cycle counter
+ */
+uint32_t RTOS_GetRunTimeCounter(void);
+
 /* Exported variables ---------------------------------------------------------*/
 /**
  * @brief   Handle for the default task
@@ -62,6 +95,12 @@ extern osThreadId_t defaultTaskHandle;
  */
 extern const osThreadAttr_t defaultTask_attributes;
 
+/**
+ * @brief   Handle for the console task
+ * @details Runs the UART command loop once the kernel is started
+ */
+extern osThreadId_t consoleTaskHandle;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,343 @@
+/**
+  ******************************************************************************
+  * @file    stack_monitor.c
+  * @brief   Task stack monitor implementation
+  * @details This file provides the stack monitor task. Every
+  *          STACKMON_PERIOD_MS it walks the task list with
+  *          uxTaskGetSystemState() and keeps the lowest high-water mark seen
+  *          per task. The report lists the allocated size, the peak usage
+  *          and a recommended size of peak + STACKMON_MARGIN_PERCENT, so
+  *          oversized stacks can be trimmed with data rather than guesses.
+  *
+  *          When the kernel detects an overflow the snapshot of the task is
+  *          stored in no-init RAM and the MCU is reset; the snapshot is
+  *          printed on the next boot.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stack_monitor.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "../SYS/mem_sections.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define STACKMON_SNAPSHOT_MAGIC   0x5354434BU   /* "STCK" */
+
+#ifndef configIDLE_TASK_NAME
+#define configIDLE_TASK_NAME "IDLE"
+#endif
+
+#ifndef configTIMER_SERVICE_TASK_NAME
+#define configTIMER_SERVICE_TASK_NAME "Tmr Svc"
+#endif
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Per-task tracking entry
+ */
+typedef struct
+{
+  TaskHandle_t handle;        /*!< Task handle, NULL for a free slot */
+  const char *name;           /*!< Task name (owned by the kernel) */
+  uint32_t stackBytes;        /*!< Allocated stack in bytes, 0 if unknown */
+  uint32_t minFreeBytes;      /*!< Lowest free stack seen in bytes */
+} STACKMON_Entry_t;
+
+/**
+ * @brief   Overflow snapshot kept across the reset
+ */
+typedef struct
+{
+  uint32_t magic;                        /*!< STACKMON_SNAPSHOT_MAGIC when valid */
+  uint32_t tick;                         /*!< Kernel tick at detection */
+  uint32_t task;                         /*!< Task handle */
+  uint32_t psp;                          /*!< Process stack pointer at detection */
+  uint32_t stackBytes;                   /*!< Registered stack size, 0 if unknown */
+  char name[configMAX_TASK_NAME_LEN];    /*!< Task name */
+} STACKMON_Snapshot_t;
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Overflow snapshot, survives the reset issued by the hook
+ */
+static STACKMON_Snapshot_t overflowSnapshot NOINIT;
+
+/**
+ * @brief   Tracking table and scratch buffer for uxTaskGetSystemState()
+ */
+static STACKMON_Entry_t entries[STACKMON_MAX_TASKS];
+static TaskStatus_t taskStatus[STACKMON_MAX_TASKS];
+
+/**
+ * @brief   Monitor task handle and attributes
+ */
+static osThreadId_t stackMonTaskHandle;
+static const osThreadAttr_t stackMonTask_attributes = {
+  .name = "stackMon",
+  .stack_size = 384 * 4,
+  .priority = (osPriority_t) osPriorityLow,
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void STACKMON_Task(void *argument);
+static STACKMON_Entry_t *STACKMON_Find(TaskHandle_t handle, uint8_t create);
+static uint32_t STACKMON_Recommend(uint32_t usedBytes);
+
+/**
+  * @brief  Stack monitor initialization
+  * @details Prints and clears any overflow snapshot left by the previous
+  *          run, then creates the monitor task.
+  * @param  None
+  * @retval None
+  */
+void STACKMON_Init(void)
+{
+  if (overflowSnapshot.magic == STACKMON_SNAPSHOT_MAGIC)
+  {
+    overflowSnapshot.name[configMAX_TASK_NAME_LEN - 1] = '\0';
+    printf("\r\n*** Stack overflow before reset ***\r\n");
+    printf("task '%s' handle 0x%08lX psp 0x%08lX size %lu tick %lu\r\n",
+           overflowSnapshot.name,
+           (unsigned long)overflowSnapshot.task,
+           (unsigned long)overflowSnapshot.psp,
+           (unsigned long)overflowSnapshot.stackBytes,
+           (unsigned long)overflowSnapshot.tick);
+  }
+  overflowSnapshot.magic = 0U;
+
+  memset(entries, 0, sizeof(entries));
+
+  stackMonTaskHandle = osThreadNew(STACKMON_Task, NULL, &stackMonTask_attributes);
+  STACKMON_Watch(stackMonTaskHandle, stackMonTask_attributes.stack_size);
+}
+
+/**
+  * @brief  Register the allocated stack size of a task
+  * @param  thread      Thread handle
+  * @param  stackBytes  Stack size in bytes
+  * @retval None
+  */
+void STACKMON_Watch(osThreadId_t thread, uint32_t stackBytes)
+{
+  STACKMON_Entry_t *entry;
+
+  if (thread == NULL)
+  {
+    return;
+  }
+
+  vTaskSuspendAll();
+  entry = STACKMON_Find((TaskHandle_t)thread, 1U);
+  if (entry != NULL)
+  {
+    entry->stackBytes = stackBytes;
+  }
+  (void)xTaskResumeAll();
+}
+
+/**
+  * @brief  Sample the high-water mark of every task
+  * @param  None
+  * @retval None
+  */
+void STACKMON_Sample(void)
+{
+  UBaseType_t count;
+  UBaseType_t i;
+
+  count = uxTaskGetSystemState(taskStatus, STACKMON_MAX_TASKS, NULL);
+
+  vTaskSuspendAll();
+  for (i = 0; i < count; i++)
+  {
+    STACKMON_Entry_t *entry = STACKMON_Find(taskStatus[i].xHandle, 1U);
+    uint32_t freeBytes = (uint32_t)taskStatus[i].usStackHighWaterMark * sizeof(StackType_t);
+
+    if (entry == NULL)
+    {
+      continue;
+    }
+
+    entry->name = taskStatus[i].pcTaskName;
+
+    /* Kernel tasks are never registered, their sizes come from the config */
+    if (entry->stackBytes == 0U)
+    {
+      if (strcmp(entry->name, configIDLE_TASK_NAME) == 0)
+      {
+        entry->stackBytes = configMINIMAL_STACK_SIZE * sizeof(StackType_t);
+      }
+      else if (strcmp(entry->name, configTIMER_SERVICE_TASK_NAME) == 0)
+      {
+        entry->stackBytes = configTIMER_TASK_STACK_DEPTH * sizeof(StackType_t);
+      }
+    }
+
+    if (freeBytes < entry->minFreeBytes)
+    {
+      entry->minFreeBytes = freeBytes;
+    }
+  }
+  (void)xTaskResumeAll();
+}
+
+/**
+  * @brief  Print per-task stack usage and recommended sizes
+  * @param  None
+  * @retval None
+  */
+void STACKMON_Report(void)
+{
+  uint32_t i;
+  uint32_t reclaim = 0U;
+
+  printf("\r\nTask             Size   Peak   Free   Recommend\r\n");
+  for (i = 0; i < STACKMON_MAX_TASKS; i++)
+  {
+    const STACKMON_Entry_t *entry = &entries[i];
+    uint32_t used;
+    uint32_t recommend;
+
+    if ((entry->handle == NULL) || (entry->name == NULL))
+    {
+      continue;
+    }
+
+    if (entry->stackBytes == 0U)
+    {
+      printf("%-16s     ?      ?  %5lu           ?\r\n",
+             entry->name, (unsigned long)entry->minFreeBytes);
+      continue;
+    }
+
+    used = entry->stackBytes - entry->minFreeBytes;
+    recommend = STACKMON_Recommend(used);
+    if (recommend < entry->stackBytes)
+    {
+      reclaim += entry->stackBytes - recommend;
+    }
+
+    printf("%-16s %5lu  %5lu  %5lu  %10lu\r\n",
+           entry->name,
+           (unsigned long)entry->stackBytes,
+           (unsigned long)used,
+           (unsigned long)entry->minFreeBytes,
+           (unsigned long)recommend);
+  }
+  printf("Reclaimable with recommended sizes: %lu bytes\r\n", (unsigned long)reclaim);
+}
+
+/**
+  * @brief  Record an overflow snapshot and reset
+  * @details Runs inside the context switch with interrupts masked, so it
+  *          only copies data and never calls blocking or printing code.
+  * @param  task      Overflowing task handle
+  * @param  taskName  Overflowing task name
+  * @retval None
+  */
+void STACKMON_OverflowCapture(void *task, const char *taskName)
+{
+  const STACKMON_Entry_t *entry = STACKMON_Find((TaskHandle_t)task, 0U);
+
+  overflowSnapshot.tick = (uint32_t)xTaskGetTickCountFromISR();
+  overflowSnapshot.task = (uint32_t)task;
+  overflowSnapshot.psp = __get_PSP();
+  overflowSnapshot.stackBytes = (entry != NULL) ? entry->stackBytes : 0U;
+  strncpy(overflowSnapshot.name, (taskName != NULL) ? taskName : "?",
+          sizeof(overflowSnapshot.name) - 1U);
+  overflowSnapshot.name[sizeof(overflowSnapshot.name) - 1U] = '\0';
+  overflowSnapshot.magic = STACKMON_SNAPSHOT_MAGIC;
+
+  /* The corrupted task cannot be trusted to continue */
+  NVIC_SystemReset();
+}
+
+/**
+  * @brief  Function implementing the stack monitor thread
+  * @param  argument: Not used
+  * @retval None
+  */
+static void STACKMON_Task(void *argument)
+{
+  uint32_t samples = 0U;
+
+  (void)argument;
+
+  /* First report once the other tasks had a chance to run */
+  osDelay(STACKMON_PERIOD_MS);
+  STACKMON_Sample();
+  STACKMON_Report();
+
+  for(;;)
+  {
+    osDelay(STACKMON_PERIOD_MS);
+    STACKMON_Sample();
+
+    if (++samples >= STACKMON_REPORT_EVERY)
+    {
+      samples = 0U;
+      STACKMON_Report();
+    }
+  }
+}
+
+/**
+  * @brief  Look up the tracking entry of a task
+  * @param  handle  Task handle
+  * @param  create  Allocate a free slot if the task is not tracked yet
+  * @retval Entry pointer or NULL if not found / table full
+  */
+static STACKMON_Entry_t *STACKMON_Find(TaskHandle_t handle, uint8_t create)
+{
+  STACKMON_Entry_t *freeSlot = NULL;
+  uint32_t i;
+
+  for (i = 0; i < STACKMON_MAX_TASKS; i++)
+  {
+    if (entries[i].handle == handle)
+    {
+      return &entries[i];
+    }
+    if ((entries[i].handle == NULL) && (freeSlot == NULL))
+    {
+      freeSlot = &entries[i];
+    }
+  }
+
+  if ((create != 0U) && (freeSlot != NULL))
+  {
+    freeSlot->handle = handle;
+    freeSlot->name = NULL;
+    freeSlot->stackBytes = 0U;
+    freeSlot->minFreeBytes = UINT32_MAX;
+  }
+  else
+  {
+    freeSlot = NULL;
+  }
+
+  return freeSlot;
+}
+
+/**
+  * @brief  Compute a recommended stack size from the peak usage
+  * @param  usedBytes  Peak usage in bytes
+  * @retval Recommended size in bytes
+  */
+static uint32_t STACKMON_Recommend(uint32_t usedBytes)
+{
+  uint32_t size = (usedBytes * (100U + STACKMON_MARGIN_PERCENT)) / 100U;
+
+  size = (size + STACKMON_ROUND_BYTES - 1U) & ~(STACKMON_ROUND_BYTES - 1U);
+  if (size < (configMINIMAL_STACK_SIZE * sizeof(StackType_t)))
+  {
+    size = configMINIMAL_STACK_SIZE * sizeof(StackType_t);
+  }
+
+  return size;
+}
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    stack_monitor.h
+  * @brief   Task stack monitor interface
+  * @details This file contains the function prototypes for the task stack
+  *          monitor. The monitor periodically samples the stack high-water
+  *          mark of every task, prints a right-sizing report with a safety
+  *          margin and records a snapshot of the offending task when the
+  *          kernel detects a stack overflow.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STACK_MONITOR_H__
+#define __STACK_MONITOR_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "cmsis_os.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define STACKMON_MAX_TASKS        16U      /* Tasks tracked by the monitor */
+#define STACKMON_PERIOD_MS        5000U    /* Sampling period */
+#define STACKMON_REPORT_EVERY     12U      /* Print a report every N samples */
+#define STACKMON_MARGIN_PERCENT   25U      /* Margin added to the peak usage */
+#define STACKMON_ROUND_BYTES      64U      /* Recommended sizes are rounded up to this */
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the stack monitor
+ * @details Reports an overflow captured before the last reset, registers
+ *          the kernel tasks and creates the monitor task
+ * @note    Call from RTOS_Init() after osKernelInitialize()
+ * @param   None
+ * @retval  None
+ */
+void STACKMON_Init(void);
+
+/**
+ * @brief   Registers the allocated stack size of a task
+ * @details The kernel does not expose a task's stack size, so tasks whose
+ *          size should appear in the report register it here
+ * @param   thread      Thread handle returned by osThreadNew()
+ * @param   stackBytes  Stack size in bytes as passed in osThreadAttr_t
+ * @retval  None
+ */
+void STACKMON_Watch(osThreadId_t thread, uint32_t stackBytes);
+
+/**
+ * @brief   Samples the high-water mark of every task
+ * @param   None
+ * @retval  None
+ */
+void STACKMON_Sample(void);
+
+/**
+ * @brief   Prints the per-task stack usage and recommended sizes
+ * @param   None
+ * @retval  None
+ */
+void STACKMON_Report(void);
+
+/**
+ * @brief   Records an overflow snapshot and resets the system
+ * @details Called from vApplicationStackOverflowHook(). The snapshot lives
+ *          in no-init RAM and is printed by STACKMON_Init() after reboot.
+ * @param   task      Handle of the overflowing task
+ * @param   taskName  Name of the overflowing task
+ * @retval  None
+ */
+void STACKMON_OverflowCapture(void *task, const char *taskName);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STACK_MONITOR_H__ */
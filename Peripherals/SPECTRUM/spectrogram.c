@@ -0,0 +1,241 @@
+/**
+  ******************************************************************************
+  * @file    spectrogram.c
+  * @brief   LTDC waterfall display implementation
+  * @details This file provides the spectrogram renderer. The DMA2D scroll
+  *          copy (about 300 KB SDRAM to SDRAM) runs while the CPU draws the
+  *          new top row, which the copy does not touch. The swap is latched
+  *          at vertical blanking, so the panel never shows a half scrolled
+  *          image; the LTDC reload interrupt reports when the old front
+  *          buffer is free to be drawn again.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "spectrogram.h"
+#include "cmsis_os.h"
+#include "../BOOT/boot_init.h"
+#include "../DMA2D/dma2d.h"
+#include "../LTDC/ltdc.h"
+#include "../SYS/mem_sections.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define SPECTROGRAM_PIXELS        (SPECTROGRAM_WIDTH * SPECTROGRAM_HEIGHT)
+#define SPECTROGRAM_BLACK         0xFF000000U
+#define SPECTROGRAM_DMA2D_TIMEOUT 50U       /* ms */
+#define SPECTROGRAM_SWAP_TIMEOUT  50U       /* ms, three frames at 60 Hz */
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Front and back framebuffers, ARGB8888
+ */
+SDRAM_BSS static uint32_t framebuffer[2][SPECTROGRAM_PIXELS];
+
+/**
+ * @brief   Level to colour: black, blue, magenta, red, yellow, white
+ */
+static uint32_t colorMap[256];
+
+static uint8_t front;
+static volatile uint8_t swapPending;
+static uint8_t ready;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SPECTROGRAM_BuildColorMap(void);
+static HAL_StatusTypeDef SPECTROGRAM_WaitSwap(void);
+
+/**
+  * @brief  Spectrogram initialization
+  * @param  None
+  * @retval None
+  */
+void SPECTROGRAM_Init(void)
+{
+  uint32_t i;
+
+  /* The display is brought up on first use, with the SDRAM behind it */
+  if ((BOOTINIT_Require(BOOTINIT_LTDC) != HAL_OK) || (BOOTINIT_Require(BOOTINIT_DMA2D) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  SPECTROGRAM_BuildColorMap();
+
+  /* Clear both buffers with the register-to-memory mode set by DMA2D_Init() */
+  for (i = 0; i < 2U; i++)
+  {
+    if ((HAL_DMA2D_Start(&hdma2d, SPECTROGRAM_BLACK, (uint32_t)framebuffer[i],
+                         SPECTROGRAM_WIDTH, SPECTROGRAM_HEIGHT) != HAL_OK) ||
+        (HAL_DMA2D_PollForTransfer(&hdma2d, SPECTROGRAM_DMA2D_TIMEOUT) != HAL_OK))
+    {
+      Error_Handler();
+    }
+  }
+
+  /* Scrolling is a plain ARGB8888 memory-to-memory copy */
+  hdma2d.Init.Mode = DMA2D_M2M;
+  hdma2d.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+  hdma2d.Init.OutputOffset = 0U;
+  hdma2d.LayerCfg[1].InputOffset = 0U;
+  hdma2d.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
+  hdma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  hdma2d.LayerCfg[1].InputAlpha = 0xFFU;
+  if ((HAL_DMA2D_Init(&hdma2d) != HAL_OK) || (HAL_DMA2D_ConfigLayer(&hdma2d, 1U) != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  /* Layer 0 shows the spectrogram, layer 1 has no framebuffer */
+  front = 0U;
+  __HAL_LTDC_LAYER_DISABLE(&hltdc, 1U);
+  if (HAL_LTDC_SetAddress(&hltdc, (uint32_t)framebuffer[front], 0U) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  ready = 1U;
+}
+
+/**
+  * @brief  Scroll and draw a new row
+  * @param  db    Power per bin in dB
+  * @param  bins  Number of bins
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPECTROGRAM_PushRow(const float32_t *db, uint32_t bins)
+{
+  const float32_t levelScale = 255.0f / (SPECTROGRAM_DB_MAX - SPECTROGRAM_DB_MIN);
+  uint32_t *back;
+  float32_t peak;
+  float32_t level;
+  uint32_t lo;
+  uint32_t hi;
+  uint32_t x;
+  uint32_t k;
+  HAL_StatusTypeDef status;
+
+  if (!ready || (bins == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The back buffer is the one the LTDC scanned until the last swap */
+  if (SPECTROGRAM_WaitSwap() != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+  back = framebuffer[front ^ 1U];
+
+  status = HAL_DMA2D_Start(&hdma2d, (uint32_t)framebuffer[front], (uint32_t)&back[SPECTROGRAM_WIDTH],
+                           SPECTROGRAM_WIDTH, SPECTROGRAM_HEIGHT - 1U);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  for (x = 0; x < SPECTROGRAM_WIDTH; x++)
+  {
+    lo = (x * bins) / SPECTROGRAM_WIDTH;
+    hi = ((x + 1U) * bins) / SPECTROGRAM_WIDTH;
+    if (hi <= lo)
+    {
+      hi = lo + 1U;
+    }
+
+    peak = db[lo];
+    for (k = lo + 1U; k < hi; k++)
+    {
+      if (db[k] > peak)
+      {
+        peak = db[k];
+      }
+    }
+
+    level = (peak - SPECTROGRAM_DB_MIN) * levelScale;
+    level = (level < 0.0f) ? 0.0f : ((level > 255.0f) ? 255.0f : level);
+    back[x] = colorMap[(uint32_t)level];
+  }
+
+  status = HAL_DMA2D_PollForTransfer(&hdma2d, SPECTROGRAM_DMA2D_TIMEOUT);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  swapPending = 1U;
+  front ^= 1U;
+  if ((HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)back, 0U) != HAL_OK) ||
+      (HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING) != HAL_OK))
+  {
+    swapPending = 0U;
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  LTDC shadow reload done
+  * @note   Called from LTDC_IRQHandler() after HAL_LTDC_Reload()
+  * @param  hltdc  LTDC handle
+  * @retval None
+  */
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  (void)hltdc;
+
+  swapPending = 0U;
+}
+
+/**
+  * @brief  Build the colour map
+  * @param  None
+  * @retval None
+  */
+static void SPECTROGRAM_BuildColorMap(void)
+{
+  static const uint8_t anchors[6][3] = {
+    {   0U,   0U,   0U },
+    {   0U,   0U, 255U },
+    { 255U,   0U, 255U },
+    { 255U,   0U,   0U },
+    { 255U, 255U,   0U },
+    { 255U, 255U, 255U },
+  };
+  uint32_t level;
+  uint32_t segment;
+  uint32_t t;
+  uint32_t c;
+  uint32_t rgb[3];
+
+  for (level = 0; level < 256U; level++)
+  {
+    segment = (level * 5U) / 256U;
+    t = (level * 5U) % 256U;
+    for (c = 0; c < 3U; c++)
+    {
+      rgb[c] = ((anchors[segment][c] * (255U - t)) + (anchors[segment + 1U][c] * t)) / 255U;
+    }
+    colorMap[level] = SPECTROGRAM_BLACK | (rgb[0] << 16) | (rgb[1] << 8) | rgb[2];
+  }
+}
+
+/**
+  * @brief  Wait until the last swap has been latched
+  * @param  None
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPECTROGRAM_WaitSwap(void)
+{
+  uint32_t start = HAL_GetTick();
+
+  while (swapPending)
+  {
+    if ((HAL_GetTick() - start) > SPECTROGRAM_SWAP_TIMEOUT)
+    {
+      return HAL_TIMEOUT;
+    }
+    osDelay(1);
+  }
+  return HAL_OK;
+}
@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    spectrogram.h
+  * @brief   LTDC waterfall display interface
+  * @details This file contains the function prototypes of the spectrogram
+  *          renderer. It owns LTDC layer 0 and two full screen ARGB8888
+  *          framebuffers in SDRAM. Each new spectrum becomes the top row:
+  *          DMA2D copies the visible image one row down into the back
+  *          buffer, the CPU draws the new row through a colour map, and the
+  *          buffers are swapped at the next vertical blanking.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SPECTROGRAM_H__
+#define __SPECTROGRAM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "arm_math.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SPECTROGRAM_WIDTH         240U
+#define SPECTROGRAM_HEIGHT        320U
+#define SPECTROGRAM_DB_MIN        (-60.0f)  /* Black */
+#define SPECTROGRAM_DB_MAX        (40.0f)   /* White */
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Clears the framebuffers and shows the first one on layer 0
+ * @note    LTDC_Init(), DMA2D_Init() and FMC_Init() must have run. The
+ *          DMA2D is switched to memory-to-memory mode.
+ * @param   None
+ * @retval  None
+ */
+void SPECTROGRAM_Init(void);
+
+/**
+ * @brief   Scrolls the display and draws a spectrum as the new top row
+ * @details Bins are spread over the width; where several bins share a
+ *          column the strongest one is shown
+ * @note    Task context; waits for the previous swap and the DMA2D copy
+ * @param   db    Power per bin, dB
+ * @param   bins  Number of bins
+ * @retval  HAL status of the DMA2D copy
+ */
+HAL_StatusTypeDef SPECTROGRAM_PushRow(const float32_t *db, uint32_t bins);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPECTROGRAM_H__ */
@@ -0,0 +1,560 @@
+/**
+  ******************************************************************************
+  * @file    spectrum.c
+  * @brief   Gyro vibration spectrum analyzer implementation
+  * @details This file provides the analyzer task. The gyro callback runs in
+  *          the SPI DMA interrupt and only appends the selected signal to
+  *          the sample ring; once hop new samples are in, it wakes the task,
+  *          which copies the newest fftSize samples out of the ring and
+  *          transforms them. The ring holds twice the largest frame, so the
+  *          task may lag by several frames before one is lost.
+  *
+  *          The transform buffers live in CCM RAM: only the CPU touches
+  *          them and CCM is zero wait state, without contention from the
+  *          LTDC and DMA2D traffic on the main bus matrix. The Hann window
+  *          is symmetric, so only its first half is tabulated.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "spectrum.h"
+#include "spectrogram.h"
+#include "cmsis_os.h"
+#include "stack_monitor.h"
+#include "../CRC/crc.h"
+#include "../L3GD20/l3gd20.h"
+#include "../SYS/dwt.h"
+#include "../SYS/mem_sections.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SPECTRUM_FLAG_FRAME       0x0001U
+#define SPECTRUM_RING_MASK        (SPECTRUM_RING_SAMPLES - 1U)
+#define SPECTRUM_BENCH_RUNS       4U
+#define SPECTRUM_POWER_FLOOR      1.0e-12f  /* -120 dB, keeps log10f finite */
+
+/** Frame words: header, int16 payload, CRC */
+#define SPECTRUM_TX_WORDS         ((sizeof(SPECTRUM_FrameHeader_t) + (2U * SPECTRUM_MAX_BINS)) / 4U + 1U)
+
+/* Private variables ---------------------------------------------------------*/
+static osThreadId_t spectrumTaskHandle;
+static const osThreadAttr_t spectrumTask_attributes = {
+  .name = "spectrumTask",
+  .stack_size = SPECTRUM_TASK_STACK_SIZE,
+  .priority = (osPriority_t) osPriorityBelowNormal,
+};
+
+static osMutexId_t spectrumMutex;
+static const osMutexAttr_t spectrumMutex_attributes = {
+  .name = "spectrumMutex",
+};
+
+/**
+ * @brief   Sample ring, written by the gyro callback
+ */
+static float32_t ring[SPECTRUM_RING_SAMPLES];
+static volatile uint32_t writeCount;
+static volatile uint64_t lastSampleUs;
+
+/**
+ * @brief   Transform buffers, CPU only
+ */
+CCM_BSS static float32_t frame[SPECTRUM_MAX_FFT];
+CCM_BSS static float32_t fftOut[SPECTRUM_MAX_FFT];
+CCM_BSS static float32_t window[SPECTRUM_MAX_FFT / 2U + 1U];
+CCM_BSS static float32_t accum[SPECTRUM_MAX_BINS];
+
+/**
+ * @brief   Outgoing binary frame, word aligned for the CRC unit
+ */
+static uint32_t txFrame[SPECTRUM_TX_WORDS];
+
+static arm_rfft_fast_instance_f32 rfft;
+static SPECTRUM_Config_t config;
+static volatile SPECTRUM_Axis_t activeAxis;
+static uint32_t hop;
+static volatile uint32_t nextEnd;
+static uint32_t framesAveraged;
+static uint32_t sequence;
+static volatile uint8_t streaming;
+
+static SPECTRUM_Stats_t stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SPECTRUM_Task(void *argument);
+static void SPECTRUM_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context);
+static HAL_StatusTypeDef SPECTRUM_Apply(const SPECTRUM_Config_t *newConfig);
+static uint8_t SPECTRUM_IsValid(const SPECTRUM_Config_t *candidate);
+static uint32_t SPECTRUM_Hop(uint32_t fftSize, uint32_t overlapPercent);
+static void SPECTRUM_Transform(uint32_t end, uint32_t *cyclesFft, uint32_t *cyclesFrame);
+static void SPECTRUM_Publish(uint64_t timestampUs);
+static void SPECTRUM_Stream(uint32_t bins, uint64_t timestampUs);
+
+/**
+  * @brief  Spectrum analyzer initialization
+  * @param  None
+  * @retval None
+  */
+void SPECTRUM_Init(void)
+{
+  const SPECTRUM_Config_t defaults = {
+    .fftSize = 1024U,
+    .overlapPercent = 50U,
+    .averages = 4U,
+    .axis = SPECTRUM_AXIS_MAG,
+  };
+
+  DWT_Init();
+  SPECTROGRAM_Init();
+
+  if (SPECTRUM_Apply(&defaults) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  spectrumMutex = osMutexNew(&spectrumMutex_attributes);
+  spectrumTaskHandle = osThreadNew(SPECTRUM_Task, NULL, &spectrumTask_attributes);
+  if ((spectrumMutex == NULL) || (spectrumTaskHandle == NULL))
+  {
+    Error_Handler();
+  }
+  STACKMON_Watch(spectrumTaskHandle, spectrumTask_attributes.stack_size);
+
+  if (L3GD20_AddCallback(SPECTRUM_GyroCallback, NULL) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Change the configuration
+  * @param  newConfig  Configuration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPECTRUM_Configure(const SPECTRUM_Config_t *newConfig)
+{
+  HAL_StatusTypeDef status;
+
+  if ((newConfig == NULL) || !SPECTRUM_IsValid(newConfig))
+  {
+    return HAL_ERROR;
+  }
+
+  (void)osMutexAcquire(spectrumMutex, osWaitForever);
+  status = SPECTRUM_Apply(newConfig);
+  (void)osMutexRelease(spectrumMutex);
+  return status;
+}
+
+/**
+  * @brief  Current configuration
+  * @param  dest  Destination
+  * @retval None
+  */
+void SPECTRUM_GetConfig(SPECTRUM_Config_t *dest)
+{
+  (void)osMutexAcquire(spectrumMutex, osWaitForever);
+  *dest = config;
+  (void)osMutexRelease(spectrumMutex);
+}
+
+/**
+  * @brief  Enable or disable streaming
+  * @param  enable  1 to stream
+  * @retval None
+  */
+void SPECTRUM_SetStream(uint8_t enable)
+{
+  streaming = enable ? 1U : 0U;
+}
+
+/**
+  * @brief  Analyzer statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void SPECTRUM_GetStats(SPECTRUM_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Time every transform size
+  * @param  results     Destination
+  * @param  maxResults  Capacity
+  * @retval Entries written
+  */
+uint32_t SPECTRUM_Benchmark(SPECTRUM_Bench_t *results, uint32_t maxResults)
+{
+  SPECTRUM_Config_t saved;
+  SPECTRUM_Bench_t *result;
+  uint32_t cyclesFft;
+  uint32_t cyclesFrame;
+  uint32_t written = 0U;
+  uint32_t size;
+  uint32_t run;
+
+  (void)osMutexAcquire(spectrumMutex, osWaitForever);
+  saved = config;
+
+  for (size = SPECTRUM_MIN_FFT; (size <= SPECTRUM_MAX_FFT) && (written < maxResults); size *= 2U)
+  {
+    SPECTRUM_Config_t trial = saved;
+
+    trial.fftSize = (uint16_t)size;
+    if (SPECTRUM_Apply(&trial) != HAL_OK)
+    {
+      break;
+    }
+
+    result = &results[written++];
+    result->fftSize = (uint16_t)size;
+    result->cycles = UINT32_MAX;
+    result->cyclesFrame = UINT32_MAX;
+
+    for (run = 0; run < SPECTRUM_BENCH_RUNS; run++)
+    {
+      SPECTRUM_Transform(writeCount, &cyclesFft, &cyclesFrame);
+      if (cyclesFft < result->cycles)
+      {
+        result->cycles = cyclesFft;
+      }
+      if (cyclesFrame < result->cyclesFrame)
+      {
+        result->cyclesFrame = cyclesFrame;
+      }
+    }
+
+    result->usFrame = DWT_CyclesToUs(result->cyclesFrame);
+    result->maxSampleRate = (uint32_t)(((uint64_t)SystemCoreClock *
+                                        SPECTRUM_Hop(size, saved.overlapPercent)) /
+                                       result->cyclesFrame);
+  }
+
+  (void)SPECTRUM_Apply(&saved);
+  (void)osMutexRelease(spectrumMutex);
+  return written;
+}
+
+/**
+  * @brief  Axis name
+  * @param  axis  Axis
+  * @retval Name
+  */
+const char *SPECTRUM_AxisName(SPECTRUM_Axis_t axis)
+{
+  static const char *const names[SPECTRUM_AXIS_COUNT] = { "x", "y", "z", "mag" };
+
+  return (axis < SPECTRUM_AXIS_COUNT) ? names[axis] : "?";
+}
+
+/**
+  * @brief  Spectrum analyzer task
+  * @param  argument  Unused
+  * @retval None
+  */
+static void SPECTRUM_Task(void *argument)
+{
+  uint32_t cyclesFft;
+  uint32_t cyclesFrame;
+  uint32_t lag;
+  uint32_t primask;
+
+  (void)argument;
+
+  for (;;)
+  {
+    (void)osThreadFlagsWait(SPECTRUM_FLAG_FRAME, osFlagsWaitAny, osWaitForever);
+    (void)osMutexAcquire(spectrumMutex, osWaitForever);
+
+    while ((int32_t)(writeCount - nextEnd) >= 0)
+    {
+      /* Frames older than the ring are gone: restart from the newest one */
+      lag = writeCount - nextEnd;
+      if (lag > (SPECTRUM_RING_SAMPLES - config.fftSize))
+      {
+        nextEnd = writeCount;
+        lag = 0U;
+        stats.overruns++;
+      }
+
+      SPECTRUM_Transform(nextEnd, &cyclesFft, &cyclesFrame);
+      arm_add_f32(accum, frame, accum, config.fftSize / 2U);
+
+      primask = __get_PRIMASK();
+      __disable_irq();
+      stats.transforms++;
+      stats.cyclesFft = cyclesFft;
+      stats.cyclesFrame = cyclesFrame;
+      __set_PRIMASK(primask);
+
+      if (++framesAveraged >= config.averages)
+      {
+        SPECTRUM_Publish(lastSampleUs - (((uint64_t)lag * 1000000U) / L3GD20_GetOdrHz()));
+      }
+      nextEnd += hop;
+    }
+
+    (void)osMutexRelease(spectrumMutex);
+  }
+}
+
+/**
+  * @brief  Gyro batch consumer
+  * @details Runs in the SPI DMA interrupt; only fills the ring.
+  * @param  samples  Samples
+  * @param  count    Number of samples
+  * @param  context  Unused
+  * @retval None
+  */
+static void SPECTRUM_GyroCallback(const L3GD20_Sample_t *samples, uint32_t count, void *context)
+{
+  const SPECTRUM_Axis_t axis = activeAxis;
+  uint32_t index = writeCount;
+  float32_t value;
+  uint32_t i;
+
+  (void)context;
+
+  if (count == 0U)
+  {
+    return;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    switch (axis)
+    {
+      case SPECTRUM_AXIS_X:
+        value = samples[i].x;
+        break;
+
+      case SPECTRUM_AXIS_Y:
+        value = samples[i].y;
+        break;
+
+      case SPECTRUM_AXIS_Z:
+        value = samples[i].z;
+        break;
+
+      default:
+        value = sqrtf((samples[i].x * samples[i].x) + (samples[i].y * samples[i].y) +
+                      (samples[i].z * samples[i].z));
+        break;
+    }
+    ring[index & SPECTRUM_RING_MASK] = value;
+    index++;
+  }
+
+  lastSampleUs = samples[count - 1U].timestampUs;
+  writeCount = index;
+  stats.samples += count;
+
+  if ((spectrumTaskHandle != NULL) && ((int32_t)(index - nextEnd) >= 0))
+  {
+    (void)osThreadFlagsSet(spectrumTaskHandle, SPECTRUM_FLAG_FRAME);
+  }
+}
+
+/**
+  * @brief  Apply a configuration
+  * @details Caller holds the mutex, or the task does not exist yet.
+  * @param  newConfig  Configuration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPECTRUM_Apply(const SPECTRUM_Config_t *newConfig)
+{
+  const uint32_t n = newConfig->fftSize;
+  uint32_t available = writeCount;
+  uint32_t i;
+
+  if (!SPECTRUM_IsValid(newConfig) ||
+      (arm_rfft_fast_init_f32(&rfft, (uint16_t)n) != ARM_MATH_SUCCESS))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Periodic Hann: w[n - i] == w[i] */
+  for (i = 0; i <= (n / 2U); i++)
+  {
+    window[i] = 0.5f - (0.5f * cosf((2.0f * PI * (float32_t)i) / (float32_t)n));
+  }
+
+  config = *newConfig;
+  activeAxis = config.axis;
+  hop = SPECTRUM_Hop(n, config.overlapPercent);
+  arm_fill_f32(0.0f, accum, n / 2U);
+  framesAveraged = 0U;
+  nextEnd = (available >= n) ? available : n;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check a configuration
+  * @param  candidate  Configuration
+  * @retval 1 if valid
+  */
+static uint8_t SPECTRUM_IsValid(const SPECTRUM_Config_t *candidate)
+{
+  const uint32_t n = candidate->fftSize;
+
+  return ((n >= SPECTRUM_MIN_FFT) && (n <= SPECTRUM_MAX_FFT) && ((n & (n - 1U)) == 0U) &&
+          (candidate->overlapPercent <= SPECTRUM_MAX_OVERLAP) &&
+          (candidate->averages >= 1U) && (candidate->averages <= SPECTRUM_MAX_AVERAGES) &&
+          (candidate->axis < SPECTRUM_AXIS_COUNT)) ? 1U : 0U;
+}
+
+/**
+  * @brief  New samples between frames
+  * @param  fftSize         Frame length
+  * @param  overlapPercent  Overlap
+  * @retval Hop length, at least 1
+  */
+static uint32_t SPECTRUM_Hop(uint32_t fftSize, uint32_t overlapPercent)
+{
+  uint32_t step = (fftSize * (100U - overlapPercent)) / 100U;
+
+  return (step == 0U) ? 1U : step;
+}
+
+/**
+  * @brief  Power spectrum of the frame ending at a sample count
+  * @details Leaves fftSize / 2 bin powers, unscaled, in frame[].
+  * @param  end          Free-running index one past the newest sample
+  * @param  cyclesFft    CPU cycles of the FFT alone
+  * @param  cyclesFrame  CPU cycles of the whole frame
+  * @retval None
+  */
+static void SPECTRUM_Transform(uint32_t end, uint32_t *cyclesFft, uint32_t *cyclesFrame)
+{
+  const uint32_t n = config.fftSize;
+  const uint32_t first = (end - n) & SPECTRUM_RING_MASK;
+  const uint32_t run = (SPECTRUM_RING_SAMPLES - first < n) ? (SPECTRUM_RING_SAMPLES - first) : n;
+  const uint32_t start = DWT_GetCycles();
+  uint32_t fftStart;
+  float32_t mean;
+  uint32_t i;
+
+  arm_copy_f32(&ring[first], frame, run);
+  if (run < n)
+  {
+    arm_copy_f32(ring, &frame[run], n - run);
+  }
+
+  arm_mean_f32(frame, n, &mean);
+  arm_offset_f32(frame, -mean, frame, n);
+  arm_mult_f32(frame, window, frame, n / 2U);
+  for (i = n / 2U; i < n; i++)
+  {
+    frame[i] *= window[n - i];
+  }
+
+  fftStart = DWT_GetCycles();
+  arm_rfft_fast_f32(&rfft, frame, fftOut, 0U);
+  *cyclesFft = DWT_GetCycles() - fftStart;
+
+  /* fftOut[0] is the real DC bin, fftOut[1] the real Nyquist bin */
+  frame[0] = fftOut[0] * fftOut[0];
+  arm_cmplx_mag_squared_f32(&fftOut[2], &frame[1], (n / 2U) - 1U);
+
+  *cyclesFrame = DWT_GetCycles() - start;
+}
+
+/**
+  * @brief  Finish an averaged spectrum and hand it out
+  * @param  timestampUs  Time of the newest sample
+  * @retval None
+  */
+static void SPECTRUM_Publish(uint64_t timestampUs)
+{
+  const uint32_t bins = config.fftSize / 2U;
+  /* Hann sum is n / 2; one-sided bins carry twice the power of DC */
+  const float32_t windowSum = (float32_t)bins;
+  const float32_t scale = 2.0f / (windowSum * windowSum * (float32_t)framesAveraged);
+  float32_t peak;
+  uint32_t peakBin;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t primask;
+  uint32_t k;
+
+  arm_scale_f32(accum, scale, accum, bins);
+  accum[0] *= 0.5f;
+  for (k = 0; k < bins; k++)
+  {
+    accum[k] = 10.0f * log10f(accum[k] + SPECTRUM_POWER_FLOOR);
+  }
+
+  /* Skip DC, the mean is removed anyway */
+  arm_max_f32(&accum[1], bins - 1U, &peak, &peakBin);
+  peakBin++;
+
+  start = DWT_GetCycles();
+  (void)SPECTROGRAM_PushRow(accum, bins);
+  cycles = DWT_GetCycles() - start;
+
+  if (streaming)
+  {
+    SPECTRUM_Stream(bins, timestampUs);
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  stats.spectra++;
+  stats.cyclesSpectrogram = cycles;
+  stats.peakCentiHz = (peakBin * L3GD20_GetOdrHz() * 100U) / config.fftSize;
+  stats.peakCentiDb = (int32_t)(peak * 100.0f);
+  __set_PRIMASK(primask);
+
+  sequence++;
+  framesAveraged = 0U;
+  arm_fill_f32(0.0f, accum, bins);
+}
+
+/**
+  * @brief  Write the spectrum as a binary frame to stdout
+  * @param  bins         Number of bins, even
+  * @param  timestampUs  Time of the newest sample
+  * @retval None
+  */
+static void SPECTRUM_Stream(uint32_t bins, uint64_t timestampUs)
+{
+  const SPECTRUM_FrameHeader_t header = {
+    .sync = SPECTRUM_FRAME_SYNC,
+    .type = SPECTRUM_FRAME_POWER_DB,
+    .axis = (uint8_t)config.axis,
+    .sequence = sequence,
+    .fftSize = config.fftSize,
+    .bins = (uint16_t)bins,
+    .sampleRateHz = (uint16_t)L3GD20_GetOdrHz(),
+    .averages = config.averages,
+    .timestampUs = timestampUs,
+  };
+  int16_t *payload = (int16_t *)&txFrame[sizeof(header) / 4U];
+  const uint32_t words = (sizeof(header) + (2U * bins)) / 4U;
+  float32_t centi;
+  uint32_t k;
+
+  memcpy(txFrame, &header, sizeof(header));
+  for (k = 0; k < bins; k++)
+  {
+    centi = accum[k] * 100.0f;
+    centi = (centi > 32767.0f) ? 32767.0f : ((centi < -32768.0f) ? -32768.0f : centi);
+    payload[k] = (int16_t)centi;
+  }
+  txFrame[words] = HAL_CRC_Calculate(&hcrc, txFrame, words);
+
+  if (fwrite(txFrame, sizeof(uint32_t), words + 1U, stdout) == (words + 1U))
+  {
+    stats.streamed++;
+  }
+  fflush(stdout);
+}
@@ -0,0 +1,184 @@
+/**
+  ******************************************************************************
+  * @file    spectrum.h
+  * @brief   Gyro vibration spectrum analyzer interface
+  * @details This file contains the types and function prototypes of the
+  *          spectrum analyzer. It subscribes to the L3GD20 sample batches,
+  *          keeps one axis (or the rate magnitude) in a sample ring and, every
+  *          hop samples, computes the power spectrum of the last fftSize
+  *          samples:
+  *          - mean removal and Hann window
+  *          - arm_rfft_fast_f32, 256 to 4096 points
+  *          - |X|^2 per bin, averaged over a number of frames
+  *          Each averaged spectrum goes to the LTDC spectrogram and, when
+  *          streaming is enabled, out of stdout as a binary frame.
+  *
+  *          Bin power is the mean square of the component in (deg/s)^2, so
+  *          a sine of amplitude A reads A^2 / 2. Bins cover DC up to one bin
+  *          below Nyquist, L3GD20_GetOdrHz() / fftSize apart.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SPECTRUM_H__
+#define __SPECTRUM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "arm_math.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SPECTRUM_MIN_FFT          256U
+#define SPECTRUM_MAX_FFT          4096U
+#define SPECTRUM_MAX_BINS         (SPECTRUM_MAX_FFT / 2U)
+#define SPECTRUM_RING_SAMPLES     8192U     /* Power of two, >= 2 x SPECTRUM_MAX_FFT */
+#define SPECTRUM_MAX_AVERAGES     64U
+#define SPECTRUM_MAX_OVERLAP      87U       /* Percent */
+#define SPECTRUM_TASK_STACK_SIZE  (256U * 4U)
+
+#define SPECTRUM_FRAME_SYNC       0x5AA5U   /* Sent as A5 5A */
+#define SPECTRUM_FRAME_POWER_DB   0x01U     /* Payload: int16 centi-dB per bin */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Analyzed signal
+ */
+typedef enum
+{
+  SPECTRUM_AXIS_X = 0,
+  SPECTRUM_AXIS_Y,
+  SPECTRUM_AXIS_Z,
+  SPECTRUM_AXIS_MAG,              /*!< sqrt(x^2 + y^2 + z^2) */
+  SPECTRUM_AXIS_COUNT
+} SPECTRUM_Axis_t;
+
+/**
+ * @brief   Analyzer configuration
+ */
+typedef struct
+{
+  uint16_t fftSize;               /*!< Power of two, SPECTRUM_MIN_FFT..SPECTRUM_MAX_FFT */
+  uint8_t overlapPercent;         /*!< Frame overlap, 0..SPECTRUM_MAX_OVERLAP */
+  uint8_t averages;               /*!< Frames per output spectrum, 1..SPECTRUM_MAX_AVERAGES */
+  SPECTRUM_Axis_t axis;
+} SPECTRUM_Config_t;
+
+/**
+ * @brief   Binary frame header
+ * @details Little endian, naturally aligned, 24 bytes. The header is
+ *          followed by bins int16 values (power in 0.01 dB re 1 (deg/s)^2)
+ *          and a uint32 CRC of header and payload. The CRC is the STM32
+ *          hardware CRC-32: polynomial 0x04C11DB7, initial value
+ *          0xFFFFFFFF, no reflection, no final XOR, fed 32-bit words.
+ */
+typedef struct
+{
+  uint16_t sync;                  /*!< SPECTRUM_FRAME_SYNC */
+  uint8_t type;                   /*!< SPECTRUM_FRAME_POWER_DB */
+  uint8_t axis;                   /*!< SPECTRUM_Axis_t */
+  uint32_t sequence;              /*!< Output spectrum counter */
+  uint16_t fftSize;
+  uint16_t bins;                  /*!< fftSize / 2 */
+  uint16_t sampleRateHz;
+  uint16_t averages;
+  uint64_t timestampUs;           /*!< Time of the newest sample, TIMEBASE clock */
+} SPECTRUM_FrameHeader_t;
+
+/**
+ * @brief   Analyzer statistics
+ */
+typedef struct
+{
+  uint32_t samples;               /*!< Samples taken from the gyro */
+  uint32_t transforms;            /*!< FFT frames computed */
+  uint32_t spectra;               /*!< Averaged spectra produced */
+  uint32_t streamed;              /*!< Binary frames written */
+  uint32_t overruns;              /*!< Frames skipped because the task fell behind */
+  uint32_t cyclesFft;             /*!< CPU cycles of the last arm_rfft_fast_f32 */
+  uint32_t cyclesFrame;           /*!< CPU cycles of the last whole frame */
+  uint32_t cyclesSpectrogram;     /*!< CPU cycles of the last spectrogram row */
+  uint32_t peakCentiHz;           /*!< Strongest bin of the last spectrum, 0.01 Hz */
+  int32_t peakCentiDb;            /*!< Its power, 0.01 dB */
+} SPECTRUM_Stats_t;
+
+/**
+ * @brief   Benchmark result for one transform size
+ */
+typedef struct
+{
+  uint16_t fftSize;
+  uint32_t cycles;                /*!< Best of the runs, arm_rfft_fast_f32 only */
+  uint32_t cyclesFrame;           /*!< Best of the runs, window + FFT + power */
+  uint32_t usFrame;               /*!< cyclesFrame in microseconds */
+  uint32_t maxSampleRate;         /*!< Input rate one core keeps up with at the
+                                       current overlap, samples/s */
+} SPECTRUM_Bench_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Creates the analyzer task, subscribes to the gyro and starts
+ *          the spectrogram
+ * @note    Brings up the display through BOOTINIT_Require(); the gyro
+ *          may come up later
+ * @param   None
+ * @retval  None
+ */
+void SPECTRUM_Init(void);
+
+/**
+ * @brief   Changes the analyzer configuration
+ * @details Restarts the averaging; samples already in the ring are reused
+ * @param   config  New configuration
+ * @retval  HAL_OK, or HAL_ERROR for an invalid configuration
+ */
+HAL_StatusTypeDef SPECTRUM_Configure(const SPECTRUM_Config_t *config);
+
+/**
+ * @brief   Reads the current configuration
+ * @param   config  Destination
+ * @retval  None
+ */
+void SPECTRUM_GetConfig(SPECTRUM_Config_t *config);
+
+/**
+ * @brief   Enables or disables the binary frame stream on stdout
+ * @param   enable  1 to stream
+ * @retval  None
+ */
+void SPECTRUM_SetStream(uint8_t enable);
+
+/**
+ * @brief   Reads the analyzer statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void SPECTRUM_GetStats(SPECTRUM_Stats_t *stats);
+
+/**
+ * @brief   Times the frame processing for every supported size
+ * @details Runs on the analyzer buffers, so the analysis pauses meanwhile;
+ *          the averaging restarts afterwards
+ * @note    Task context only
+ * @param   results     Destination, one entry per size
+ * @param   maxResults  Capacity of results
+ * @retval  Number of entries written
+ */
+uint32_t SPECTRUM_Benchmark(SPECTRUM_Bench_t *results, uint32_t maxResults);
+
+/**
+ * @brief   Name of an axis
+ * @param   axis  Axis
+ * @retval  "x", "y", "z", "mag" or "?"
+ */
+const char *SPECTRUM_AxisName(SPECTRUM_Axis_t axis);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPECTRUM_H__ */
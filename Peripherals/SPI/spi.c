@@ -20,6 +20,16 @@
  */
 SPI_HandleTypeDef hspi5;
 
+/**
+ * @brief   SPI5 DMA handles
+ * @details RX on DMA2 Stream3 channel 2, TX on DMA2 Stream6 channel 7
+ */
+DMA_HandleTypeDef hdma_spi5_rx;
+DMA_HandleTypeDef hdma_spi5_tx;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SPI_DMA_Init(void);
+
 /**
   * @brief  SPI Initialization Function
   * @details Configures the SPI5 peripheral with the following settings:
@@ -33,6 +43,7 @@ SPI_HandleTypeDef hspi5;
   *          - MSB transmitted/received first
   *          - TI mode disabled
   *          - CRC calculation disabled
+  *          - DMA2 Stream3/Stream6 attached for RX/TX
   *
   * @note   SPI5 is commonly used for display or external sensor communication
   * @param  None
@@ -59,4 +70,60 @@ void SPI_Init(void)
   {
     Error_Handler();  /* Call error handler if initialization fails */
   }
+
+  /* Attach DMA streams for burst transfers */
+  SPI_DMA_Init();
+}
+
+/**
+  * @brief  SPI5 DMA Initialization Function
+  * @details Configures DMA2 Stream3 (RX) and Stream6 (TX) for SPI5 in
+  *          normal byte mode and links them to hspi5. The interrupts use a
+  *          priority at or below configMAX_SYSCALL_INTERRUPT_PRIORITY so the
+  *          completion callbacks may use FreeRTOS FromISR services.
+  * @param  None
+  * @retval None
+  */
+static void SPI_DMA_Init(void)
+{
+  __HAL_RCC_DMA2_CLK_ENABLE();
+
+  /* SPI5 RX: peripheral to memory */
+  hdma_spi5_rx.Instance = DMA2_Stream3;
+  hdma_spi5_rx.Init.Channel = DMA_CHANNEL_2;
+  hdma_spi5_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_spi5_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_spi5_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_spi5_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_spi5_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_spi5_rx.Init.Mode = DMA_NORMAL;
+  hdma_spi5_rx.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_spi5_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_spi5_rx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(&hspi5, hdmarx, hdma_spi5_rx);
+
+  /* SPI5 TX: memory to peripheral */
+  hdma_spi5_tx.Instance = DMA2_Stream6;
+  hdma_spi5_tx.Init.Channel = DMA_CHANNEL_7;
+  hdma_spi5_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_spi5_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_spi5_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_spi5_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_spi5_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_spi5_tx.Init.Mode = DMA_NORMAL;
+  hdma_spi5_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+  hdma_spi5_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_spi5_tx) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  __HAL_LINKDMA(&hspi5, hdmatx, hdma_spi5_tx);
+
+  HAL_NVIC_SetPriority(DMA2_Stream3_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream3_IRQn);
+  HAL_NVIC_SetPriority(DMA2_Stream6_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream6_IRQn);
 }
@@ -38,6 +38,13 @@ void SPI_Init(void);
  */
 extern SPI_HandleTypeDef hspi5;
 
+/**
+ * @brief   SPI5 DMA handles
+ * @details Serviced from DMA2_Stream3_IRQHandler and DMA2_Stream6_IRQHandler
+ */
+extern DMA_HandleTypeDef hdma_spi5_rx;
+extern DMA_HandleTypeDef hdma_spi5_tx;
+
 #ifdef __cplusplus
 }
 #endif
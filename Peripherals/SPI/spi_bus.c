@@ -0,0 +1,425 @@
+/**
+  ******************************************************************************
+  * @file    spi_bus.c
+  * @brief   Shared SPI5 bus transaction engine implementation
+  * @details This file provides the transaction queue for SPI5. Transactions
+  *          form a singly linked FIFO; the head runs on DMA while the rest
+  *          wait. The DMA completion releases the chip select, reports the
+  *          result and starts the next transaction from interrupt context,
+  *          so consecutive transfers follow each other without a task switch.
+  *
+  *          Between transactions of different devices only the BR, CPOL and
+  *          CPHA bits of CR1 are rewritten (with SPE cleared), which is much
+  *          cheaper than a full HAL_SPI_Init().
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "spi_bus.h"
+#include "spi.h"
+#include "../SYS/dwt.h"
+#include "cmsis_os.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SPIBUS_CR1_CONFIG_MASK   (SPI_CR1_BR | SPI_CR1_CPOL | SPI_CR1_CPHA)
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Bus ownership
+ */
+typedef enum
+{
+  SPIBUS_OWNER_IDLE = 0,
+  SPIBUS_OWNER_DMA,       /* Queue head is running */
+  SPIBUS_OWNER_POLLED     /* SPIBUS_TransferBlocking() holds the bus */
+} SPIBUS_Owner_t;
+
+/* Private variables ---------------------------------------------------------*/
+static SPIBUS_Transaction_t *queueHead;
+static SPIBUS_Transaction_t *queueTail;
+static volatile SPIBUS_Owner_t owner = SPIBUS_OWNER_IDLE;
+static uint32_t startCycles;
+static volatile uint32_t pclkHz;
+
+static SPIBUS_Stats_t stats;
+static uint32_t utilLastCycles;
+static uint32_t utilLastBusy;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SPIBUS_Configure(const SPIBUS_Device_t *device);
+static uint32_t SPIBUS_Prescaler(uint32_t maxClockHz);
+static void SPIBUS_StartNext(void);
+static void SPIBUS_Complete(HAL_StatusTypeDef status);
+
+/**
+  * @brief  Transaction engine initialization
+  * @param  None
+  * @retval None
+  */
+void SPIBUS_Init(void)
+{
+  DWT_Init();
+
+  queueHead = NULL;
+  queueTail = NULL;
+  owner = SPIBUS_OWNER_IDLE;
+  memset(&stats, 0, sizeof(stats));
+  SPIBUS_UpdateClock();
+
+  utilLastCycles = DWT_GetCycles();
+  utilLastBusy = 0U;
+}
+
+/**
+  * @brief  Queue a transaction
+  * @param  transaction  Descriptor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPIBUS_Submit(SPIBUS_Transaction_t *transaction)
+{
+  uint32_t primask;
+
+  if ((transaction == NULL) || (transaction->device == NULL) ||
+      (transaction->length == 0U) ||
+      ((transaction->txData == NULL) && (transaction->rxData == NULL)))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (transaction->status == HAL_BUSY)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  transaction->status = HAL_BUSY;
+  transaction->next = NULL;
+  if (queueTail == NULL)
+  {
+    queueHead = transaction;
+  }
+  else
+  {
+    queueTail->next = transaction;
+  }
+  queueTail = transaction;
+
+  stats.queueDepth++;
+  if (stats.queueDepth > stats.queuePeak)
+  {
+    stats.queuePeak = stats.queueDepth;
+  }
+
+  if (owner == SPIBUS_OWNER_IDLE)
+  {
+    SPIBUS_StartNext();
+  }
+
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Polled transfer once the bus is free
+  * @param  device     Target device
+  * @param  txData     Bytes to send, or NULL
+  * @param  rxData     Receive buffer, or NULL
+  * @param  length     Length in bytes
+  * @param  timeoutMs  Timeout
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPIBUS_TransferBlocking(const SPIBUS_Device_t *device,
+                                          const uint8_t *txData, uint8_t *rxData,
+                                          uint16_t length, uint32_t timeoutMs)
+{
+  uint32_t tickStart = HAL_GetTick();
+  uint32_t primask;
+  uint32_t t0;
+  HAL_StatusTypeDef status;
+
+  if ((device == NULL) || (length == 0U) || ((txData == NULL) && (rxData == NULL)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Claim the bus between two queued transactions */
+  for (;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if ((owner == SPIBUS_OWNER_IDLE) && (queueHead == NULL))
+    {
+      owner = SPIBUS_OWNER_POLLED;
+      __set_PRIMASK(primask);
+      break;
+    }
+    __set_PRIMASK(primask);
+
+    if ((HAL_GetTick() - tickStart) >= timeoutMs)
+    {
+      return HAL_TIMEOUT;
+    }
+    if (osKernelGetState() == osKernelRunning)
+    {
+      osThreadYield();
+    }
+  }
+
+  SPIBUS_Configure(device);
+  t0 = DWT_GetCycles();
+
+  HAL_GPIO_WritePin(device->csPort, device->csPin, GPIO_PIN_RESET);
+  if (rxData == NULL)
+  {
+    status = HAL_SPI_Transmit(&hspi5, (uint8_t *)txData, length, timeoutMs);
+  }
+  else
+  {
+    if (txData == NULL)
+    {
+      memset(rxData, 0, length);
+      txData = rxData;
+    }
+    status = HAL_SPI_TransmitReceive(&hspi5, (uint8_t *)txData, rxData, length, timeoutMs);
+  }
+  HAL_GPIO_WritePin(device->csPort, device->csPin, GPIO_PIN_SET);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  stats.busyCycles += DWT_GetCycles() - t0;
+  if (status == HAL_OK)
+  {
+    stats.blocking++;
+    stats.bytes += length;
+  }
+  else
+  {
+    stats.errors++;
+  }
+
+  /* Hand the bus back and start whatever queued up meanwhile */
+  owner = SPIBUS_OWNER_IDLE;
+  SPIBUS_StartNext();
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Read the bus statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void SPIBUS_GetStats(SPIBUS_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Bus utilization since the previous call
+  * @param  None
+  * @retval Utilization in 0.01 %
+  */
+uint32_t SPIBUS_GetUtilization(void)
+{
+  uint32_t now = DWT_GetCycles();
+  uint32_t busyTotal = stats.busyCycles;
+  uint32_t elapsed = now - utilLastCycles;
+  uint32_t busy = busyTotal - utilLastBusy;
+
+  utilLastCycles = now;
+  utilLastBusy = busyTotal;
+
+  return (elapsed == 0U) ? 0U : (uint32_t)(((uint64_t)busy * 10000U) / elapsed);
+}
+
+/**
+  * @brief  SPI transmit-receive DMA complete callback
+  * @param  hspi  SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  if (hspi == &hspi5)
+  {
+    SPIBUS_Complete(HAL_OK);
+  }
+}
+
+/**
+  * @brief  SPI transmit DMA complete callback
+  * @param  hspi  SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  if (hspi == &hspi5)
+  {
+    SPIBUS_Complete(HAL_OK);
+  }
+}
+
+/**
+  * @brief  SPI error callback
+  * @param  hspi  SPI handle
+  * @retval None
+  */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+  if (hspi == &hspi5)
+  {
+    SPIBUS_Complete(HAL_ERROR);
+  }
+}
+
+/**
+  * @brief  Pick up a new APB2 clock
+  * @param  None
+  * @retval None
+  */
+void SPIBUS_UpdateClock(void)
+{
+  pclkHz = HAL_RCC_GetPCLK2Freq();
+}
+
+/**
+  * @brief  Apply the clock settings of a device
+  * @details Only touches CR1 when the settings differ from the current ones
+  * @param  device  Target device
+  * @retval None
+  */
+static void SPIBUS_Configure(const SPIBUS_Device_t *device)
+{
+  uint32_t cr1 = hspi5.Instance->CR1;
+  uint32_t prescaler = SPIBUS_Prescaler(device->maxClockHz);
+  uint32_t wanted = (cr1 & ~SPIBUS_CR1_CONFIG_MASK) |
+                    prescaler | device->polarity | device->phase;
+
+  if (wanted != cr1)
+  {
+    __HAL_SPI_DISABLE(&hspi5);
+    hspi5.Instance->CR1 = wanted & ~SPI_CR1_SPE;
+    hspi5.Init.BaudRatePrescaler = prescaler;
+    hspi5.Init.CLKPolarity = device->polarity;
+    hspi5.Init.CLKPhase = device->phase;
+    stats.reconfigs++;
+  }
+}
+
+/**
+  * @brief  Smallest prescaler that keeps SCK at or under a limit
+  * @param  maxClockHz  Device limit
+  * @retval SPI_BAUDRATEPRESCALER_x, /256 if even that is too fast
+  */
+static uint32_t SPIBUS_Prescaler(uint32_t maxClockHz)
+{
+  uint32_t br = 0U;
+
+  /* BR = n divides by 2^(n+1) */
+  while ((br < 7U) && ((pclkHz >> (br + 1U)) > maxClockHz))
+  {
+    br++;
+  }
+  return br << SPI_CR1_BR_Pos;
+}
+
+/**
+  * @brief  Start the queue head on DMA
+  * @note   Called with interrupts disabled or from the DMA interrupt, while
+  *         the bus is idle. A head that fails to start is completed with an
+  *         error, which moves on to the next one.
+  * @param  None
+  * @retval None
+  */
+static void SPIBUS_StartNext(void)
+{
+  SPIBUS_Transaction_t *t = queueHead;
+  HAL_StatusTypeDef status;
+
+  if (t == NULL)
+  {
+    return;
+  }
+
+  SPIBUS_Configure(t->device);
+  owner = SPIBUS_OWNER_DMA;
+  startCycles = DWT_GetCycles();
+
+  HAL_GPIO_WritePin(t->device->csPort, t->device->csPin, GPIO_PIN_RESET);
+  if (t->rxData == NULL)
+  {
+    status = HAL_SPI_Transmit_DMA(&hspi5, (uint8_t *)t->txData, t->length);
+  }
+  else if (t->txData == NULL)
+  {
+    memset(t->rxData, 0, t->length);
+    status = HAL_SPI_TransmitReceive_DMA(&hspi5, t->rxData, t->rxData, t->length);
+  }
+  else
+  {
+    status = HAL_SPI_TransmitReceive_DMA(&hspi5, (uint8_t *)t->txData, t->rxData, t->length);
+  }
+
+  if (status != HAL_OK)
+  {
+    SPIBUS_Complete(HAL_ERROR);
+  }
+}
+
+/**
+  * @brief  Finish the running transaction and start the next one
+  * @param  status  Transfer result
+  * @retval None
+  */
+static void SPIBUS_Complete(HAL_StatusTypeDef status)
+{
+  SPIBUS_Transaction_t *t = queueHead;
+
+  if ((owner != SPIBUS_OWNER_DMA) || (t == NULL))
+  {
+    return;
+  }
+
+  HAL_GPIO_WritePin(t->device->csPort, t->device->csPin, GPIO_PIN_SET);
+  stats.busyCycles += DWT_GetCycles() - startCycles;
+
+  queueHead = t->next;
+  if (queueHead == NULL)
+  {
+    queueTail = NULL;
+  }
+  stats.queueDepth--;
+
+  if (status == HAL_OK)
+  {
+    stats.transactions++;
+    stats.bytes += t->length;
+  }
+  else
+  {
+    stats.errors++;
+  }
+
+  owner = SPIBUS_OWNER_IDLE;
+  t->status = status;
+  if (t->callback != NULL)
+  {
+    t->callback(t);
+  }
+
+  /* A submit from the callback may already have started the next one */
+  if (owner == SPIBUS_OWNER_IDLE)
+  {
+    SPIBUS_StartNext();
+  }
+}
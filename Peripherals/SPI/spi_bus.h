@@ -0,0 +1,158 @@
+/**
+  ******************************************************************************
+  * @file    spi_bus.h
+  * @brief   Shared SPI5 bus transaction engine interface
+  * @details This file contains the types and function prototypes of the
+  *          asynchronous transaction queue for SPI5, which is shared by the
+  *          gyroscope and the ILI9341 LCD controller.
+  *
+  *          A transaction describes one chip-select cycle: the device (chip
+  *          select pin, clock limit and SPI mode), the TX/RX buffers and a
+  *          completion callback. Submitted transactions are linked into a
+  *          FIFO and executed back-to-back with DMA; the bus is reconfigured
+  *          only when the next device needs different settings. Drivers that
+  *          need a short synchronous exchange (register setup at init) use
+  *          SPIBUS_TransferBlocking(), which waits for the queue to drain and
+  *          then owns the bus for a polled transfer.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SPI_BUS_H__
+#define __SPI_BUS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Device attached to the bus
+ * @details polarity and phase take the HAL SPI_POLARITY_x and SPI_PHASE_x
+ *          values. The prescaler is derived from maxClockHz and the current
+ *          APB2 clock, so a device keeps within its limit at any CPU clock.
+ */
+typedef struct
+{
+  const char *name;           /*!< Name used in reports */
+  GPIO_TypeDef *csPort;       /*!< Chip select port, active low */
+  uint16_t csPin;             /*!< Chip select pin */
+  uint32_t maxClockHz;        /*!< Fastest SCK the device takes */
+  uint32_t polarity;          /*!< Clock polarity of this device */
+  uint32_t phase;             /*!< Clock phase of this device */
+} SPIBUS_Device_t;
+
+struct SPIBUS_Transaction;
+
+/**
+ * @brief   Completion callback
+ * @note    Runs in DMA interrupt context. The transaction may be submitted
+ *          again from inside the callback.
+ * @param   transaction  Finished transaction, status holds the result
+ */
+typedef void (*SPIBUS_Callback_t)(struct SPIBUS_Transaction *transaction);
+
+/**
+ * @brief   Transaction descriptor
+ * @details Owned by the caller and must stay valid until the callback ran.
+ *          Buffers must be DMA reachable (SRAM or SDRAM, not CCM RAM).
+ *          With txData NULL zeros are clocked out and rxData is used as the
+ *          transmit buffer; with rxData NULL the received bytes are dropped.
+ */
+typedef struct SPIBUS_Transaction
+{
+  const SPIBUS_Device_t *device;      /*!< Target device */
+  const uint8_t *txData;              /*!< Bytes to send, or NULL */
+  uint8_t *rxData;                    /*!< Receive buffer, or NULL */
+  uint16_t length;                    /*!< Transfer length in bytes */
+  SPIBUS_Callback_t callback;         /*!< Completion callback, or NULL */
+  void *context;                      /*!< Free for the submitter */
+  volatile HAL_StatusTypeDef status;  /*!< HAL_BUSY while queued or running */
+  struct SPIBUS_Transaction *next;    /*!< Queue link, internal */
+} SPIBUS_Transaction_t;
+
+/**
+ * @brief   Bus statistics
+ */
+typedef struct
+{
+  uint32_t transactions;      /*!< DMA transactions completed */
+  uint32_t blocking;          /*!< Polled transfers completed */
+  uint32_t bytes;             /*!< Bytes exchanged */
+  uint32_t errors;            /*!< Failed transfers */
+  uint32_t reconfigs;         /*!< Prescaler or mode changes between devices */
+  uint32_t queueDepth;        /*!< Transactions waiting now */
+  uint32_t queuePeak;         /*!< Highest number of waiting transactions */
+  uint32_t busyCycles;        /*!< CPU cycles the bus spent transferring */
+} SPIBUS_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the transaction engine
+ * @note    SPI_Init() must have run
+ * @param   None
+ * @retval  None
+ */
+void SPIBUS_Init(void);
+
+/**
+ * @brief   Queues a transaction
+ * @details Starts it at once when the bus is idle. Safe from tasks and from
+ *          interrupts at or below configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ * @param   transaction  Descriptor to queue
+ * @retval  HAL_OK, HAL_BUSY if the descriptor is still pending, or HAL_ERROR
+ *          for an invalid descriptor
+ */
+HAL_StatusTypeDef SPIBUS_Submit(SPIBUS_Transaction_t *transaction);
+
+/**
+ * @brief   Picks up a new APB2 clock
+ * @details The prescalers are recomputed from the next transaction on; the
+ *          one running finishes at its old prescaler.
+ * @note    Called by the clock governor after a clock change
+ * @param   None
+ * @retval  None
+ */
+void SPIBUS_UpdateClock(void);
+
+/**
+ * @brief   Performs a polled transfer once the bus is free
+ * @details Waits for the queue to drain, reconfigures the bus for the device
+ *          and exchanges the bytes with interrupts enabled. Transactions
+ *          submitted meanwhile start when the transfer is done. Works before
+ *          the scheduler starts; must not be called from an interrupt.
+ * @param   device     Target device
+ * @param   txData     Bytes to send, or NULL to clock out zeros into rxData
+ * @param   rxData     Receive buffer, or NULL
+ * @param   length     Transfer length in bytes
+ * @param   timeoutMs  Maximum wait for the bus plus the transfer
+ * @retval  HAL status
+ */
+HAL_StatusTypeDef SPIBUS_TransferBlocking(const SPIBUS_Device_t *device,
+                                          const uint8_t *txData, uint8_t *rxData,
+                                          uint16_t length, uint32_t timeoutMs);
+
+/**
+ * @brief   Reads the bus statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void SPIBUS_GetStats(SPIBUS_Stats_t *stats);
+
+/**
+ * @brief   Bus utilization in 0.01 % since the previous call
+ * @note    Call at least every 25 s so the cycle counter does not wrap
+ * @param   None
+ * @retval  Utilization in hundredths of a percent
+ */
+uint32_t SPIBUS_GetUtilization(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPI_BUS_H__ */
@@ -0,0 +1,562 @@
+/**
+  ******************************************************************************
+  * @file    stdio_retarget.c
+  * @brief   Buffered stdout retarget implementation
+  * @details This file provides the strong _write() that replaces the weak
+  *          byte-by-byte ITM version in syscalls.c. _write() only copies
+  *          into the ring of the active sink and starts the drain; it never
+  *          waits for the hardware unless the ring is full.
+  *
+  *          Each ring has producers (_write, from any task or interrupt)
+  *          and one consumer (the sink drain). A producer reserves its
+  *          space in a short critical section and copies with interrupts
+  *          enabled; the last writer to finish publishes every reserved
+  *          byte to the drain at once, so the drain never sees a
+  *          half-copied range. A drain
+  *          is claimed inside a critical section by setting inFlight, then
+  *          started outside it, so a transfer is never started twice and
+  *          driver calls never run with interrupts masked.
+  *
+  *          USART1 is shared with the console and the bridge, so a claim on
+  *          the UART ring does not mean the UART is sending it: a start that
+  *          found the UART busy keeps its claim and is retried, and a
+  *          transmit completion is only taken as ours when the transfer
+  *          that finished came from the claimed chunk.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stdio_retarget.h"
+#include "cmsis_os.h"
+#include "../CDC/cdc_stream.h"
+#include "../SYS/dwt.h"
+#include "../SYS/mem_sections.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Sink ring buffer
+ */
+typedef struct
+{
+  uint8_t *buffer;            /*!< Storage, STDIO_RING_SIZE bytes */
+  volatile uint32_t head;     /*!< Free-running write index, published data */
+  volatile uint32_t reserved; /*!< Free-running end of the reserved space */
+  volatile uint32_t writers;  /*!< Producers copying into reserved space */
+  volatile uint32_t tail;     /*!< Free-running read index */
+  volatile uint32_t inFlight; /*!< Bytes claimed by a drain, started or not */
+  uint32_t dropped;           /*!< Bytes dropped on overflow */
+} STDIO_Ring_t;
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Ring storage
+ * @details SWO is fed by the CPU so its ring lives in CCM RAM; the UART
+ *          ring is read by DMA and must stay in SRAM.
+ */
+static uint8_t swoBuffer[STDIO_RING_SIZE] CCM_BSS;
+static uint8_t uartBuffer[STDIO_RING_SIZE] __attribute__((aligned(4)));
+static uint8_t usbBuffer[STDIO_RING_SIZE] __attribute__((aligned(4)));
+
+static STDIO_Ring_t rings[STDIO_SINK_COUNT] = {
+  { .buffer = swoBuffer },
+  { .buffer = uartBuffer },
+  { .buffer = usbBuffer },
+};
+
+static volatile STDIO_Sink_t activeSink = STDIO_SINK_SWO;
+
+/* Claimed UART chunk whose start found USART1 busy with another user */
+static volatile uint8_t uartRetry;
+
+static const char *const sinkNames[STDIO_SINK_COUNT] = { "swo", "uart", "usb" };
+
+/* External variables --------------------------------------------------------*/
+extern UART_HandleTypeDef huart1;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t STDIO_Put(STDIO_Ring_t *ring, const uint8_t *data, uint32_t len);
+static void STDIO_Kick(STDIO_Sink_t sink);
+static void STDIO_StartUart(STDIO_Ring_t *ring, uint32_t count);
+static uint8_t STDIO_TakeUartRetry(void);
+static uint8_t STDIO_UartOwnsTransfer(const UART_HandleTypeDef *huart, const STDIO_Ring_t *ring);
+static void STDIO_DrainSwo(void);
+static uint32_t STDIO_Claim(STDIO_Ring_t *ring);
+static void STDIO_Complete(STDIO_Ring_t *ring, uint32_t count);
+static uint8_t STDIO_WaitForSpace(STDIO_Sink_t sink, uint32_t start);
+
+/**
+  * @brief  Newlib write hook for stdout and stderr
+  * @param  file  File descriptor (unused, all output goes to the sink)
+  * @param  ptr   Data
+  * @param  len   Length
+  * @retval Number of bytes consumed
+  */
+int _write(int file, char *ptr, int len)
+{
+  STDIO_Sink_t sink = activeSink;
+  STDIO_Ring_t *ring = &rings[sink];
+  const uint8_t *data = (const uint8_t *)ptr;
+  uint32_t remaining = (uint32_t)len;
+  uint32_t start = HAL_GetTick();
+
+  (void)file;
+
+  while (remaining > 0U)
+  {
+    uint32_t copied = STDIO_Put(ring, data, remaining);
+
+    data += copied;
+    remaining -= copied;
+    STDIO_Kick(sink);
+
+    if ((remaining > 0U) && !STDIO_WaitForSpace(sink, start))
+    {
+      ring->dropped += remaining;
+      break;
+    }
+  }
+
+  return len;
+}
+
+/**
+  * @brief  Select the active sink
+  * @param  sink  New sink
+  * @retval None
+  */
+void STDIO_SetSink(STDIO_Sink_t sink)
+{
+  if (sink < STDIO_SINK_COUNT)
+  {
+    fflush(stdout);
+    activeSink = sink;
+  }
+}
+
+/**
+  * @brief  Active sink
+  * @param  None
+  * @retval Sink
+  */
+STDIO_Sink_t STDIO_GetSink(void)
+{
+  return activeSink;
+}
+
+/**
+  * @brief  Sink name
+  * @param  sink  Sink
+  * @retval Name
+  */
+const char *STDIO_SinkName(STDIO_Sink_t sink)
+{
+  return (sink < STDIO_SINK_COUNT) ? sinkNames[sink] : "?";
+}
+
+/**
+  * @brief  Drain all sinks without blocking
+  * @param  None
+  * @retval None
+  */
+void STDIO_Poll(void)
+{
+  STDIO_DrainSwo();
+  STDIO_Kick(STDIO_SINK_UART);
+  STDIO_Kick(STDIO_SINK_USB);
+  CDCSTREAM_Poll();
+}
+
+/**
+  * @brief  Wait until a sink ring is empty
+  * @param  sink       Sink
+  * @param  timeoutMs  Timeout
+  * @retval HAL_OK or HAL_TIMEOUT
+  */
+HAL_StatusTypeDef STDIO_Flush(STDIO_Sink_t sink, uint32_t timeoutMs)
+{
+  STDIO_Ring_t *ring = &rings[sink];
+  uint32_t start = HAL_GetTick();
+
+  fflush(stdout);
+
+  while (ring->head != ring->tail)
+  {
+    if ((HAL_GetTick() - start) >= timeoutMs)
+    {
+      return HAL_TIMEOUT;
+    }
+
+    STDIO_Poll();
+    if (osKernelGetState() == osKernelRunning)
+    {
+      osDelay(1);
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read sink counters
+  * @param  sink   Sink
+  * @param  stats  Destination
+  * @retval None
+  */
+void STDIO_GetStats(STDIO_Sink_t sink, STDIO_Stats_t *stats)
+{
+  const STDIO_Ring_t *ring = &rings[sink];
+
+  stats->written = ring->head;
+  stats->drained = ring->tail;
+  stats->pending = ring->head - ring->tail;
+  stats->dropped = ring->dropped;
+}
+
+/**
+  * @brief  printf throughput benchmark
+  * @param  lines  Number of lines
+  * @retval None
+  */
+void STDIO_Benchmark(uint32_t lines)
+{
+  STDIO_Sink_t sink = activeSink;
+  uint32_t droppedBefore = rings[sink].dropped;
+  uint32_t bytesBefore = rings[sink].head;
+  uint32_t cycles = 0U;
+  uint32_t drainStart;
+  uint32_t drainMs;
+  uint32_t bytes;
+  uint32_t i;
+
+  DWT_Init();
+  (void)STDIO_Flush(sink, 1000U);
+  drainStart = HAL_GetTick();
+
+  for (i = 0; i < lines; i++)
+  {
+    uint32_t t0 = DWT_GetCycles();
+    printf("bench %4lu: tick=%8lu value=%6ld ratio=%3lu.%02lu\r\n",
+           (unsigned long)i, (unsigned long)HAL_GetTick(),
+           (long)(i * 37U) - 1000L, (unsigned long)(i % 100U), (unsigned long)(i % 97U));
+    cycles += DWT_GetCycles() - t0;
+  }
+
+  (void)STDIO_Flush(sink, 5000U);
+  drainMs = HAL_GetTick() - drainStart;
+  bytes = rings[sink].head - bytesBefore;
+
+  printf("\r\nstdio benchmark on %s: %lu lines, %lu bytes\r\n",
+         STDIO_SinkName(sink), (unsigned long)lines, (unsigned long)bytes);
+  printf("  printf: %lu cycles/line (%lu us total)\r\n",
+         (unsigned long)((lines != 0U) ? (cycles / lines) : 0U),
+         (unsigned long)DWT_CyclesToUs(cycles));
+  printf("  drained in %lu ms (%lu B/s), dropped %lu\r\n",
+         (unsigned long)drainMs,
+         (unsigned long)((drainMs != 0U) ? ((bytes * 1000U) / drainMs) : 0U),
+         (unsigned long)(rings[sink].dropped - droppedBefore));
+}
+
+/**
+  * @brief  UART transmit complete hook
+  * @param  huart  UART handle
+  * @retval None
+  */
+void STDIO_UartTxCpltCallback(UART_HandleTypeDef *huart)
+{
+  STDIO_Ring_t *ring = &rings[STDIO_SINK_UART];
+
+  if (huart != &huart1)
+  {
+    return;
+  }
+
+  if (STDIO_UartOwnsTransfer(huart, ring))
+  {
+    STDIO_Complete(ring, ring->inFlight);
+  }
+
+  /* Next chunk, or the start another user's transfer held up */
+  STDIO_Kick(STDIO_SINK_UART);
+}
+
+/**
+  * @brief  USB CDC stream space hook
+  * @param  None
+  * @retval None
+  */
+void STDIO_UsbTxCpltCallback(void)
+{
+  STDIO_Kick(STDIO_SINK_USB);
+}
+
+/**
+  * @brief  Copy data into a ring
+  * @param  ring  Ring
+  * @param  data  Data
+  * @param  len   Length
+  * @retval Bytes copied
+  */
+static uint32_t STDIO_Put(STDIO_Ring_t *ring, const uint8_t *data, uint32_t len)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t space;
+  uint32_t first;
+  uint32_t offset;
+
+  /* Reserve: the copy itself runs with interrupts enabled */
+  __disable_irq();
+  space = STDIO_RING_SIZE - (ring->reserved - ring->tail);
+  if (len > space)
+  {
+    len = space;
+  }
+  offset = ring->reserved & (STDIO_RING_SIZE - 1U);
+  ring->reserved += len;
+  ring->writers++;
+  __set_PRIMASK(primask);
+
+  first = STDIO_RING_SIZE - offset;
+  if (first > len)
+  {
+    first = len;
+  }
+  memcpy(&ring->buffer[offset], data, first);
+  memcpy(ring->buffer, data + first, len - first);
+
+  /* Publish once no writer that reserved earlier or later is still copying */
+  __disable_irq();
+  ring->writers--;
+  if (ring->writers == 0U)
+  {
+    ring->head = ring->reserved;
+  }
+  __set_PRIMASK(primask);
+
+  return len;
+}
+
+/**
+  * @brief  Start draining a sink if it is idle
+  * @param  sink  Sink
+  * @retval None
+  */
+static void STDIO_Kick(STDIO_Sink_t sink)
+{
+  STDIO_Ring_t *ring = &rings[sink];
+  uint8_t *chunk;
+  uint32_t count;
+
+  if (sink == STDIO_SINK_SWO)
+  {
+    STDIO_DrainSwo();
+    return;
+  }
+
+  if ((sink == STDIO_SINK_USB) && !CDCSTREAM_IsConnected())
+  {
+    return;
+  }
+
+  count = STDIO_Claim(ring);
+  if ((count == 0U) && (sink == STDIO_SINK_UART) && STDIO_TakeUartRetry())
+  {
+    count = ring->inFlight;
+  }
+  if (count == 0U)
+  {
+    return;
+  }
+
+  if (sink == STDIO_SINK_UART)
+  {
+    STDIO_StartUart(ring, count);
+    return;
+  }
+
+  /* The CDC stream copies and sends from its own ring */
+  chunk = &ring->buffer[ring->tail & (STDIO_RING_SIZE - 1U)];
+  STDIO_Complete(ring, CDCSTREAM_Write(chunk, count, 0U));
+}
+
+/**
+  * @brief  Send the claimed UART chunk
+  * @param  ring   UART ring, claimed
+  * @param  count  Claimed bytes
+  * @retval None
+  */
+static void STDIO_StartUart(STDIO_Ring_t *ring, uint32_t count)
+{
+  uint8_t *chunk = &ring->buffer[ring->tail & (STDIO_RING_SIZE - 1U)];
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  if (huart1.hdmatx != NULL)
+  {
+    status = HAL_UART_Transmit_DMA(&huart1, chunk, (uint16_t)count);
+  }
+  else if (huart1.Instance != NULL)
+  {
+    status = HAL_UART_Transmit_IT(&huart1, chunk, (uint16_t)count);
+  }
+
+  if (status == HAL_BUSY)
+  {
+    /* Another user is sending: keep the claim, retry from the next kick */
+    uartRetry = 1U;
+  }
+  else if (status != HAL_OK)
+  {
+    /* No UART to drain to */
+    ring->inFlight = 0U;
+  }
+}
+
+/**
+  * @brief  Take over a claimed UART chunk that is waiting for a start
+  * @param  None
+  * @retval 1 if the caller now has to start it
+  */
+static uint8_t STDIO_TakeUartRetry(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t take;
+
+  __disable_irq();
+  take = uartRetry;
+  uartRetry = 0U;
+  __set_PRIMASK(primask);
+
+  return take;
+}
+
+/**
+  * @brief  Whether the transfer that just finished sent the claimed chunk
+  * @details HAL_UART_Transmit_DMA() leaves pTxBuffPtr at the start of the
+  *          data, HAL_UART_Transmit_IT() advances it to the end.
+  * @param  huart  UART handle
+  * @param  ring   UART ring
+  * @retval 1 if it was ours
+  */
+static uint8_t STDIO_UartOwnsTransfer(const UART_HandleTypeDef *huart, const STDIO_Ring_t *ring)
+{
+  const uint8_t *chunk = &ring->buffer[ring->tail & (STDIO_RING_SIZE - 1U)];
+  const uint8_t *start = huart->pTxBuffPtr;
+
+  if ((ring->inFlight == 0U) || uartRetry || (huart->TxXferSize != ring->inFlight))
+  {
+    return 0U;
+  }
+  if (huart->hdmatx == NULL)
+  {
+    start -= huart->TxXferSize;
+  }
+
+  return (start == chunk) ? 1U : 0U;
+}
+
+/**
+  * @brief  Feed the ITM stimulus port while it accepts data
+  * @details Never waits on the ITM FIFO. Without an attached debugger the
+  *          port is disabled and the data is discarded.
+  * @param  None
+  * @retval None
+  */
+static void STDIO_DrainSwo(void)
+{
+  STDIO_Ring_t *ring = &rings[STDIO_SINK_SWO];
+  uint32_t count = STDIO_Claim(ring);
+  uint32_t sent = 0U;
+
+  if (count == 0U)
+  {
+    return;
+  }
+
+  if (((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0U) || ((ITM->TER & 1U) == 0U))
+  {
+    sent = count;
+  }
+  else
+  {
+    while ((sent < count) && (ITM->PORT[0U].u32 != 0U))
+    {
+      ITM->PORT[0U].u8 = ring->buffer[(ring->tail + sent) & (STDIO_RING_SIZE - 1U)];
+      sent++;
+    }
+  }
+
+  STDIO_Complete(ring, sent);
+}
+
+/**
+  * @brief  Claim the contiguous pending data of an idle ring
+  * @param  ring  Ring
+  * @retval Claimed bytes, 0 if busy or empty
+  */
+static uint32_t STDIO_Claim(STDIO_Ring_t *ring)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t count = 0U;
+
+  __disable_irq();
+
+  if (ring->inFlight == 0U)
+  {
+    uint32_t offset = ring->tail & (STDIO_RING_SIZE - 1U);
+
+    count = ring->head - ring->tail;
+    if (count > (STDIO_RING_SIZE - offset))
+    {
+      count = STDIO_RING_SIZE - offset;
+    }
+    ring->inFlight = count;
+  }
+
+  __set_PRIMASK(primask);
+
+  return count;
+}
+
+/**
+  * @brief  Release drained bytes and the claim
+  * @param  ring   Ring
+  * @param  count  Bytes drained
+  * @retval None
+  */
+static void STDIO_Complete(STDIO_Ring_t *ring, uint32_t count)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  ring->tail += count;
+  ring->inFlight = 0U;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Wait for ring space after an overflow
+  * @param  sink   Sink
+  * @param  start  Tick when the write started
+  * @retval 1 to retry, 0 to drop the rest of the write
+  */
+static uint8_t STDIO_WaitForSpace(STDIO_Sink_t sink, uint32_t start)
+{
+  if ((__get_IPSR() != 0U) || ((HAL_GetTick() - start) >= STDIO_FULL_TIMEOUT_MS))
+  {
+    return 0U;
+  }
+
+  if (osKernelGetState() == osKernelRunning)
+  {
+    osDelay(1);
+  }
+  else
+  {
+    STDIO_Kick(sink);
+  }
+
+  return 1U;
+}
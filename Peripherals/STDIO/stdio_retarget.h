@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file    stdio_retarget.h
+  * @brief   Buffered stdout retarget interface
+  * @details This file contains the function prototypes for the buffered
+  *          stdout backend. printf() output is copied into a ring buffer of
+  *          the selected sink and drained in the background:
+  *          - SWO:  ITM stimulus port 0, drained from the idle hook without
+  *                  ever waiting on the ITM FIFO
+  *          - UART: USART1, drained by DMA (or interrupts when the console
+  *                  is not in DMA mode)
+  *          - USB:  USB host CDC link, handed to the CDC stream (cdc_stream.h)
+  *          The sink can be changed at run time with STDIO_SetSink().
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STDIO_RETARGET_H__
+#define __STDIO_RETARGET_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define STDIO_RING_SIZE           1024U  /* Per-sink ring size, power of two */
+#define STDIO_FULL_TIMEOUT_MS     20U    /* Wait for space before dropping */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   stdout sinks
+ */
+typedef enum
+{
+  STDIO_SINK_SWO = 0,
+  STDIO_SINK_UART,
+  STDIO_SINK_USB,
+  STDIO_SINK_COUNT
+} STDIO_Sink_t;
+
+/**
+ * @brief   Per-sink counters
+ */
+typedef struct
+{
+  uint32_t written;     /*!< Bytes accepted into the ring */
+  uint32_t drained;     /*!< Bytes handed to the sink */
+  uint32_t dropped;     /*!< Bytes lost because the ring stayed full */
+  uint32_t pending;     /*!< Bytes currently buffered */
+} STDIO_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Selects the active stdout sink
+ * @details Output already buffered for the previous sink keeps draining
+ *          to it
+ * @param   sink  New sink
+ * @retval  None
+ */
+void STDIO_SetSink(STDIO_Sink_t sink);
+
+/**
+ * @brief   Returns the active stdout sink
+ * @param   None
+ * @retval  Active sink
+ */
+STDIO_Sink_t STDIO_GetSink(void);
+
+/**
+ * @brief   Returns the name of a sink
+ * @param   sink  Sink
+ * @retval  Constant string
+ */
+const char *STDIO_SinkName(STDIO_Sink_t sink);
+
+/**
+ * @brief   Drains all rings as far as possible without blocking
+ * @note    Called from the idle hook; also safe from any task
+ * @param   None
+ * @retval  None
+ */
+void STDIO_Poll(void);
+
+/**
+ * @brief   Waits until the ring of a sink is empty
+ * @param   sink       Sink to flush
+ * @param   timeoutMs  Maximum wait in milliseconds
+ * @retval  HAL_OK when empty, HAL_TIMEOUT otherwise
+ */
+HAL_StatusTypeDef STDIO_Flush(STDIO_Sink_t sink, uint32_t timeoutMs);
+
+/**
+ * @brief   Reads the counters of a sink
+ * @param   sink   Sink
+ * @param   stats  Destination
+ * @retval  None
+ */
+void STDIO_GetStats(STDIO_Sink_t sink, STDIO_Stats_t *stats);
+
+/**
+ * @brief   Measures printf throughput on the active sink
+ * @details Prints a number of formatted lines, then reports the CPU cycles
+ *          spent inside printf(), the time until the sink drained and the
+ *          bytes dropped
+ * @param   lines  Number of lines to print
+ * @retval  None
+ */
+void STDIO_Benchmark(uint32_t lines);
+
+/**
+ * @brief   UART transmit complete hook
+ * @note    Called from HAL_UART_TxCpltCallback()
+ * @param   huart  UART handle that completed
+ * @retval  None
+ */
+void STDIO_UartTxCpltCallback(UART_HandleTypeDef *huart);
+
+/**
+ * @brief   USB CDC stream space hook
+ * @note    Called by the CDC stream after each completed transfer
+ * @param   None
+ * @retval  None
+ */
+void STDIO_UsbTxCpltCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STDIO_RETARGET_H__ */
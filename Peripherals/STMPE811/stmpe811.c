@@ -0,0 +1,514 @@
+/**
+  ******************************************************************************
+  * @file    stmpe811.c
+  * @brief   STMPE811 touch screen controller driver implementation
+  * @details This file provides the interrupt driven driver for the touch
+  *          controller. An interrupt runs a chain of queued I2C transactions
+  *          without blocking:
+  *          1. INT_STA is read to learn the cause
+  *          2. TSC_CTRL .. FIFO_SIZE (13 bytes) give the touch state and the
+  *             number of stored samples
+  *          3. The samples are read in one burst from the non-incrementing
+  *             data register, 4 bytes each
+  *          4. The handled INT_STA bits are written back to clear them
+  *          The interrupt output is level sensitive, so the chain restarts if
+  *          the line is still low when it finishes.
+  *
+  *          A batch holds up to STMPE811_FIFO_THRESHOLD samples taken one
+  *          sample period apart, so each one is stamped back from the time
+  *          the FIFO level was read by the samples taken after it. The first
+  *          sample of a touch is dated from the detection instead, since a
+  *          resting finger can leave it alone in the FIFO for a long time.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stmpe811.h"
+#include "../I2C/i2c_bus.h"
+#include "../TIM/timebase.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define STMPE811_I2C_TIMEOUT_MS   10U
+#define STMPE811_TSC_BLOCK_SIZE   (STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL + 1U)
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Transaction chain state
+ */
+typedef enum
+{
+  STMPE811_STATE_IDLE = 0,
+  STMPE811_STATE_STATUS,
+  STMPE811_STATE_TSC,
+  STMPE811_STATE_FIFO,
+  STMPE811_STATE_CLEAR
+} STMPE811_State_t;
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Transaction buffers (SRAM, reachable by DMA1)
+ */
+static uint8_t intStatus;
+static uint8_t tscBlock[STMPE811_TSC_BLOCK_SIZE];
+static uint8_t fifoData[STMPE811_MAX_BATCH * STMPE811_SAMPLE_BYTES] __attribute__((aligned(4)));
+
+static I2CBUS_Transaction_t statusTransaction;
+static I2CBUS_Transaction_t tscTransaction;
+static I2CBUS_Transaction_t fifoTransaction;
+static I2CBUS_Transaction_t clearTransaction;
+
+static volatile STMPE811_State_t state = STMPE811_STATE_IDLE;
+static uint8_t released;          /* Touch ended and the FIFO is empty */
+static uint8_t drained;           /* Last batch emptied the FIFO during a touch */
+static uint8_t touchSeen;         /* A read found the panel touched */
+static uint8_t firstPending;      /* Next sample is the first of the touch */
+static uint64_t firstSampleUs;
+static uint64_t batchUs;          /* FIFO level read time */
+static uint64_t lastBatchUs;
+static uint32_t batchLevel;       /* Samples in the FIFO at batchUs */
+static uint32_t spacingUs;        /* Between the samples of the batch */
+
+static TOUCH_Gesture_t gesture;
+static osMessageQueueId_t eventQueue;
+static STMPE811_Stats_t stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef STMPE811_WriteReg(uint8_t reg, uint8_t value);
+static void STMPE811_StartChain(void);
+static void STMPE811_StatusDone(I2CBUS_Transaction_t *transaction);
+static void STMPE811_TscDone(I2CBUS_Transaction_t *transaction);
+static void STMPE811_FifoDone(I2CBUS_Transaction_t *transaction);
+static void STMPE811_ClearDone(I2CBUS_Transaction_t *transaction);
+static void STMPE811_StartClear(void);
+static void STMPE811_Abort(void);
+static void STMPE811_Emit(const TOUCH_Event_t *event, void *context);
+static int16_t STMPE811_Scale(int32_t raw, int32_t rawMin, int32_t rawMax, int32_t size);
+
+/**
+  * @brief  Touch controller initialization
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef STMPE811_Init(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  uint8_t id[2] = { 0U, 0U };
+  uint8_t ctrl2 = 0U;
+  uint8_t af = 0U;
+
+  if ((I2CBUS_MemRead(STMPE811_I2C_ADDRESS, STMPE811_REG_CHIP_ID, id, 2,
+                      STMPE811_I2C_TIMEOUT_MS) != HAL_OK) ||
+      ((((uint16_t)id[0] << 8) | id[1]) != STMPE811_CHIP_ID))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Soft reset */
+  if (STMPE811_WriteReg(STMPE811_REG_SYS_CTRL1, STMPE811_SYS_CTRL1_SOFT_RESET) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  HAL_Delay(10);
+  if (STMPE811_WriteReg(STMPE811_REG_SYS_CTRL1, 0x00U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  HAL_Delay(2);
+
+  /* Clock the ADC and touch blocks, hand the touch pins to the TSC */
+  if ((I2CBUS_MemRead(STMPE811_I2C_ADDRESS, STMPE811_REG_SYS_CTRL2, &ctrl2, 1,
+                      STMPE811_I2C_TIMEOUT_MS) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_SYS_CTRL2,
+                         ctrl2 & ~(STMPE811_SYS_CTRL2_ADC_OFF | STMPE811_SYS_CTRL2_TSC_OFF)) != HAL_OK) ||
+      (I2CBUS_MemRead(STMPE811_I2C_ADDRESS, STMPE811_REG_GPIO_AF, &af, 1,
+                      STMPE811_I2C_TIMEOUT_MS) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_GPIO_AF, af & ~STMPE811_GPIO_AF_TSC_PINS) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  /* 80 clock sample time, 12-bit, 3.25 MHz ADC clock */
+  if (STMPE811_WriteReg(STMPE811_REG_ADC_CTRL1, 0x49U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  HAL_Delay(2);
+
+  /* 4 sample average, 500 us touch detect delay, 500 us settling;
+     FIFO threshold batching; tracking index against resting jitter */
+  if ((STMPE811_WriteReg(STMPE811_REG_ADC_CTRL2, 0x01U) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_TSC_CFG, 0x9AU) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_FIFO_TH, STMPE811_FIFO_THRESHOLD) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_FIFO_STA, STMPE811_FIFO_STA_RESET) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_FIFO_STA, 0x00U) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_TSC_FRACT_Z, 0x01U) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_TSC_I_DRIVE, 0x01U) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_TSC_CTRL,
+                         STMPE811_TSC_CTRL_EN | STMPE811_TSC_CTRL_TRACK_4) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_INT_STA, 0xFFU) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_INT_EN,
+                         STMPE811_INT_TOUCH_DET | STMPE811_INT_FIFO_TH | STMPE811_INT_FIFO_OFLOW) != HAL_OK) ||
+      (STMPE811_WriteReg(STMPE811_REG_INT_CTRL, STMPE811_INT_CTRL_GLOBAL) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Chain descriptors */
+  statusTransaction.address = STMPE811_I2C_ADDRESS;
+  statusTransaction.regSize = 1U;
+  statusTransaction.reg = STMPE811_REG_INT_STA;
+  statusTransaction.direction = I2CBUS_READ;
+  statusTransaction.data = &intStatus;
+  statusTransaction.length = 1U;
+  statusTransaction.callback = STMPE811_StatusDone;
+
+  tscTransaction = statusTransaction;
+  tscTransaction.reg = STMPE811_REG_TSC_CTRL;
+  tscTransaction.data = tscBlock;
+  tscTransaction.length = STMPE811_TSC_BLOCK_SIZE;
+  tscTransaction.callback = STMPE811_TscDone;
+
+  fifoTransaction = statusTransaction;
+  fifoTransaction.reg = STMPE811_REG_TSC_DATA;
+  fifoTransaction.data = fifoData;
+  fifoTransaction.callback = STMPE811_FifoDone;
+
+  clearTransaction = statusTransaction;
+  clearTransaction.direction = I2CBUS_WRITE;
+  clearTransaction.callback = STMPE811_ClearDone;
+
+  TOUCH_Gesture_Init(&gesture, STMPE811_Emit, NULL);
+  eventQueue = osMessageQueueNew(STMPE811_EVENT_QUEUE_DEPTH, sizeof(TOUCH_Event_t), NULL);
+
+  /* Interrupt output is active low */
+  GPIO_InitStruct.Pin = TP_INT1_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  HAL_GPIO_Init(TP_INT1_GPIO_Port, &GPIO_InitStruct);
+
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, STMPE811_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Controller interrupt entry
+  * @param  None
+  * @retval None
+  */
+void STMPE811_IrqHandler(void)
+{
+  stats.interrupts++;
+
+  /* A running chain re-checks the line when it finishes */
+  if (state == STMPE811_STATE_IDLE)
+  {
+    STMPE811_StartChain();
+  }
+}
+
+/**
+  * @brief  Gesture event queue
+  * @param  None
+  * @retval Queue handle
+  */
+osMessageQueueId_t STMPE811_GetEventQueue(void)
+{
+  return eventQueue;
+}
+
+/**
+  * @brief  Read the driver statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void STMPE811_GetStats(STMPE811_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Event type name
+  * @param  type  Event type
+  * @retval Constant string
+  */
+const char *STMPE811_EventName(TOUCH_EventType_t type)
+{
+  static const char *const names[] =
+  {
+    "down", "up", "tap", "drag", "drag-end",
+    "swipe-left", "swipe-right", "swipe-up", "swipe-down"
+  };
+
+  return ((uint32_t)type < (sizeof(names) / sizeof(names[0]))) ? names[type] : "?";
+}
+
+/**
+  * @brief  Blocking register write
+  * @param  reg    Register
+  * @param  value  Value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef STMPE811_WriteReg(uint8_t reg, uint8_t value)
+{
+  return I2CBUS_MemWrite(STMPE811_I2C_ADDRESS, reg, &value, 1, STMPE811_I2C_TIMEOUT_MS);
+}
+
+/**
+  * @brief  Start the chain with the INT_STA read
+  * @param  None
+  * @retval None
+  */
+static void STMPE811_StartChain(void)
+{
+  state = STMPE811_STATE_STATUS;
+  if (I2CBUS_Submit(&statusTransaction) != HAL_OK)
+  {
+    STMPE811_Abort();
+  }
+}
+
+/**
+  * @brief  INT_STA read finished
+  * @param  transaction  Bus transaction
+  * @retval None
+  */
+static void STMPE811_StatusDone(I2CBUS_Transaction_t *transaction)
+{
+  if (transaction->status != HAL_OK)
+  {
+    STMPE811_Abort();
+    return;
+  }
+
+  if ((intStatus & STMPE811_INT_FIFO_OFLOW) != 0U)
+  {
+    stats.overflows++;
+  }
+
+  state = STMPE811_STATE_TSC;
+  if (I2CBUS_Submit(&tscTransaction) != HAL_OK)
+  {
+    STMPE811_Abort();
+  }
+}
+
+/**
+  * @brief  Touch state and FIFO level read finished
+  * @param  transaction  Bus transaction
+  * @retval None
+  */
+static void STMPE811_TscDone(I2CBUS_Transaction_t *transaction)
+{
+  uint32_t count;
+
+  if (transaction->status != HAL_OK)
+  {
+    STMPE811_Abort();
+    return;
+  }
+
+  lastBatchUs = batchUs;
+  batchUs = TIMEBASE_GetUs();
+  batchLevel = tscBlock[STMPE811_REG_FIFO_SIZE - STMPE811_REG_TSC_CTRL];
+  count = (batchLevel > STMPE811_MAX_BATCH) ? STMPE811_MAX_BATCH : batchLevel;
+
+  /* The newest sample is about as old as the read, the others one sample
+     period apart; after a batch that emptied the FIFO they all came since
+     then, which bounds the spacing when the period is shorter than assumed */
+  spacingUs = STMPE811_SAMPLE_PERIOD_US;
+  if (drained && (batchLevel != 0U) &&
+      ((batchUs - lastBatchUs) < ((uint64_t)batchLevel * STMPE811_SAMPLE_PERIOD_US)))
+  {
+    spacingUs = (uint32_t)((batchUs - lastBatchUs) / batchLevel);
+  }
+
+  /* Release is reported only once every stored sample has been used */
+  released = (((tscBlock[0] & STMPE811_TSC_CTRL_TOUCHED) == 0U) &&
+              (count == batchLevel)) ? 1U : 0U;
+  drained = ((count == batchLevel) && !released) ? 1U : 0U;
+
+  /* A touch found with the FIFO still empty dates its first sample: one
+     sample period after the detection, however long it waits in the FIFO */
+  if (((tscBlock[0] & STMPE811_TSC_CTRL_TOUCHED) != 0U) && !touchSeen)
+  {
+    firstPending = (batchLevel == 0U) ? 1U : 0U;
+    firstSampleUs = batchUs + STMPE811_SAMPLE_PERIOD_US;
+  }
+  touchSeen = ((tscBlock[0] & STMPE811_TSC_CTRL_TOUCHED) != 0U) ? 1U : 0U;
+
+  if (count == 0U)
+  {
+    STMPE811_StartClear();
+    return;
+  }
+
+  state = STMPE811_STATE_FIFO;
+  fifoTransaction.length = (uint16_t)(count * STMPE811_SAMPLE_BYTES);
+  if (I2CBUS_Submit(&fifoTransaction) != HAL_OK)
+  {
+    STMPE811_Abort();
+  }
+}
+
+/**
+  * @brief  Sample burst finished
+  * @details Converts the samples to pixels and feeds the recognizer with
+  *          the time each was taken, counted back from the FIFO level read
+  * @param  transaction  Bus transaction
+  * @retval None
+  */
+static void STMPE811_FifoDone(I2CBUS_Transaction_t *transaction)
+{
+  const uint8_t *raw = fifoData;
+  uint32_t count = transaction->length / STMPE811_SAMPLE_BYTES;
+  uint64_t sampleUs;
+  uint64_t ageUs;
+  uint32_t i;
+
+  if (transaction->status != HAL_OK)
+  {
+    STMPE811_Abort();
+    return;
+  }
+
+  for (i = 0; i < count; i++, raw += STMPE811_SAMPLE_BYTES)
+  {
+    int32_t x = ((int32_t)raw[0] << 4) | (raw[1] >> 4);
+    int32_t y = (((int32_t)raw[1] & 0x0F) << 8) | raw[2];
+
+    /* Oldest first: batchLevel - 1 - i samples were taken after this one */
+    ageUs = (uint64_t)(batchLevel - 1U - i) * spacingUs;
+    sampleUs = (ageUs < batchUs) ? (batchUs - ageUs) : 0U;
+    if (firstPending)
+    {
+      sampleUs = (firstSampleUs < sampleUs) ? firstSampleUs : sampleUs;
+      firstPending = 0U;
+    }
+    TOUCH_Gesture_Sample(&gesture,
+                         STMPE811_Scale(x, STMPE811_RAW_X_MIN, STMPE811_RAW_X_MAX, STMPE811_SCREEN_WIDTH),
+                         STMPE811_Scale(y, STMPE811_RAW_Y_MIN, STMPE811_RAW_Y_MAX, STMPE811_SCREEN_HEIGHT),
+                         (uint32_t)TIMEBASE_UsToMs(sampleUs));
+  }
+
+  stats.batches++;
+  stats.samples += count;
+  STMPE811_StartClear();
+}
+
+/**
+  * @brief  Start the INT_STA clear
+  * @param  None
+  * @retval None
+  */
+static void STMPE811_StartClear(void)
+{
+  state = STMPE811_STATE_CLEAR;
+  if (I2CBUS_Submit(&clearTransaction) != HAL_OK)
+  {
+    STMPE811_Abort();
+  }
+}
+
+/**
+  * @brief  INT_STA clear finished
+  * @param  transaction  Bus transaction
+  * @retval None
+  */
+static void STMPE811_ClearDone(I2CBUS_Transaction_t *transaction)
+{
+  if (transaction->status != HAL_OK)
+  {
+    STMPE811_Abort();
+    return;
+  }
+
+  if (released)
+  {
+    TOUCH_Gesture_Release(&gesture, (uint32_t)TIMEBASE_UsToMs(batchUs));
+  }
+
+  state = STMPE811_STATE_IDLE;
+
+  /* Level interrupt still asserted: more samples or a new touch arrived */
+  if (HAL_GPIO_ReadPin(TP_INT1_GPIO_Port, TP_INT1_Pin) == GPIO_PIN_RESET)
+  {
+    STMPE811_StartChain();
+  }
+}
+
+/**
+  * @brief  Handle an I2C error in the chain
+  * @details Tries to clear every interrupt flag so the line goes high again
+  *          and the next falling edge starts over; a failing clear ends the
+  *          chain.
+  * @param  None
+  * @retval None
+  */
+static void STMPE811_Abort(void)
+{
+  stats.errors++;
+
+  if (state == STMPE811_STATE_CLEAR)
+  {
+    state = STMPE811_STATE_IDLE;
+    return;
+  }
+
+  intStatus = 0xFFU;
+  released = 0U;
+  drained = 0U;
+  firstPending = 0U;
+  STMPE811_StartClear();
+}
+
+/**
+  * @brief  Post a gesture event
+  * @param  event    Event
+  * @param  context  Unused
+  * @retval None
+  */
+static void STMPE811_Emit(const TOUCH_Event_t *event, void *context)
+{
+  (void)context;
+
+  if ((eventQueue != NULL) && (osMessageQueuePut(eventQueue, event, 0U, 0U) == osOK))
+  {
+    stats.events++;
+  }
+  else
+  {
+    stats.dropped++;
+  }
+}
+
+/**
+  * @brief  Map a raw coordinate to pixels
+  * @param  raw     ADC value
+  * @param  rawMin  ADC value at pixel 0
+  * @param  rawMax  ADC value at the last pixel
+  * @param  size    Axis length in pixels
+  * @retval Pixel, clamped to the screen
+  */
+static int16_t STMPE811_Scale(int32_t raw, int32_t rawMin, int32_t rawMax, int32_t size)
+{
+  int32_t pixel = ((raw - rawMin) * size) / (rawMax - rawMin);
+
+  if (pixel < 0)
+  {
+    pixel = 0;
+  }
+  else if (pixel >= size)
+  {
+    pixel = size - 1;
+  }
+
+  return (int16_t)pixel;
+}
@@ -0,0 +1,165 @@
+/**
+  ******************************************************************************
+  * @file    stmpe811.h
+  * @brief   STMPE811 touch screen controller driver interface
+  * @details This file contains the register map, types and function
+  *          prototypes of the driver for the STMPE811 resistive touch
+  *          controller on I2C3 (address 0x41, interrupt on PA15 / EXTI15).
+  *
+  *          The controller only converts while the panel is touched. Its
+  *          FIFO collects STMPE811_FIFO_THRESHOLD samples before it raises
+  *          the interrupt, and the driver drains the whole batch with one
+  *          queued I2C read. Samples go through the jitter filter and the
+  *          gesture recognizer of touch_gesture.c, which post TOUCH_Event_t
+  *          events to an RTOS message queue.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STMPE811_H__
+#define __STMPE811_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "cmsis_os.h"
+#include "touch_gesture.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+ * @brief   Bus address and identification
+ */
+#define STMPE811_I2C_ADDRESS        0x41U   /* 7-bit, ADDR0 low */
+#define STMPE811_CHIP_ID            0x0811U
+
+/**
+ * @brief   Register map
+ */
+#define STMPE811_REG_CHIP_ID        0x00U
+#define STMPE811_REG_SYS_CTRL1      0x03U
+#define STMPE811_REG_SYS_CTRL2      0x04U
+#define STMPE811_REG_INT_CTRL       0x09U
+#define STMPE811_REG_INT_EN         0x0AU
+#define STMPE811_REG_INT_STA        0x0BU
+#define STMPE811_REG_GPIO_AF        0x17U
+#define STMPE811_REG_ADC_CTRL1      0x20U
+#define STMPE811_REG_ADC_CTRL2      0x21U
+#define STMPE811_REG_TSC_CTRL       0x40U
+#define STMPE811_REG_TSC_CFG        0x41U
+#define STMPE811_REG_FIFO_TH        0x4AU
+#define STMPE811_REG_FIFO_STA       0x4BU
+#define STMPE811_REG_FIFO_SIZE      0x4CU
+#define STMPE811_REG_TSC_FRACT_Z    0x56U
+#define STMPE811_REG_TSC_I_DRIVE    0x58U
+#define STMPE811_REG_TSC_DATA       0xD7U   /* Non auto-incrementing XYZ data */
+
+/**
+ * @brief   Register bit fields
+ */
+#define STMPE811_SYS_CTRL1_SOFT_RESET  0x02U
+#define STMPE811_SYS_CTRL2_ADC_OFF     0x01U
+#define STMPE811_SYS_CTRL2_TSC_OFF     0x02U
+#define STMPE811_INT_CTRL_GLOBAL       0x01U   /* Level, active low */
+#define STMPE811_INT_TOUCH_DET         0x01U
+#define STMPE811_INT_FIFO_TH           0x02U
+#define STMPE811_INT_FIFO_OFLOW        0x04U
+#define STMPE811_GPIO_AF_TSC_PINS      0xF0U
+#define STMPE811_TSC_CTRL_EN           0x01U
+#define STMPE811_TSC_CTRL_TRACK_4      0x10U   /* Skip samples that moved < 4 LSB */
+#define STMPE811_TSC_CTRL_TOUCHED      0x80U
+#define STMPE811_FIFO_STA_RESET        0x01U
+
+/**
+ * @brief   Driver configuration
+ */
+#define STMPE811_FIFO_THRESHOLD     8U      /* Samples per interrupt */
+#define STMPE811_MAX_BATCH          32U     /* Samples drained per read */
+#define STMPE811_SAMPLE_BYTES       4U      /* 12-bit X, 12-bit Y, 8-bit Z */
+#define STMPE811_EVENT_QUEUE_DEPTH  16U
+#define STMPE811_IRQ_PRIORITY       6U      /* EXTI15_10 priority, FreeRTOS safe */
+
+/**
+ * @brief   Time between two touch samples, from the ADC and TSC configuration
+ * @details 500 us touch detect delay, then X, Y and Z each settle for 500 us
+ *          and convert 4 times at 80 clocks of 3.25 MHz. The tracking index
+ *          drops samples of a resting finger, so this is the shortest
+ *          spacing of the samples in the FIFO, not a fixed one.
+ */
+#define STMPE811_SAMPLE_PERIOD_US   2300U
+
+/**
+ * @brief   Raw to pixel calibration of the 240x320 panel
+ */
+#define STMPE811_SCREEN_WIDTH       240
+#define STMPE811_SCREEN_HEIGHT      320
+#define STMPE811_RAW_X_MIN          280
+#define STMPE811_RAW_X_MAX          3850
+#define STMPE811_RAW_Y_MIN          230
+#define STMPE811_RAW_Y_MAX          3850
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Driver statistics
+ */
+typedef struct
+{
+  uint32_t interrupts;      /*!< Controller interrupts serviced */
+  uint32_t batches;         /*!< FIFO batches drained */
+  uint32_t samples;         /*!< Samples fed to the recognizer */
+  uint32_t overflows;       /*!< FIFO overflow flags seen */
+  uint32_t events;          /*!< Events posted */
+  uint32_t dropped;         /*!< Events lost because the queue was full */
+  uint32_t errors;          /*!< I2C errors */
+} STMPE811_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes the touch controller
+ * @details Checks the chip ID, enables the touch screen block with FIFO
+ *          threshold and touch detect interrupts, creates the event queue
+ *          and enables EXTI15_10
+ * @note    I2C_Init(), I2CBUS_Init() and GPIO_Init() must have run
+ * @param   None
+ * @retval  HAL_OK, or HAL_ERROR if the controller does not answer
+ */
+HAL_StatusTypeDef STMPE811_Init(void);
+
+/**
+ * @brief   Controller interrupt entry
+ * @note    Called from HAL_GPIO_EXTI_Callback() for TP_INT1_Pin
+ * @param   None
+ * @retval  None
+ */
+void STMPE811_IrqHandler(void);
+
+/**
+ * @brief   Returns the gesture event queue
+ * @details Messages are TOUCH_Event_t
+ * @param   None
+ * @retval  Queue handle, NULL before STMPE811_Init()
+ */
+osMessageQueueId_t STMPE811_GetEventQueue(void);
+
+/**
+ * @brief   Reads the driver statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void STMPE811_GetStats(STMPE811_Stats_t *stats);
+
+/**
+ * @brief   Returns the name of an event type
+ * @param   type  Event type
+ * @retval  Constant string
+ */
+const char *STMPE811_EventName(TOUCH_EventType_t type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STMPE811_H__ */
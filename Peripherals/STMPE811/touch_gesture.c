@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    touch_gesture.c
+  * @brief   Touch jitter filter and gesture recognizer implementation
+  * @details This file provides the filter and the gesture state machine.
+  *          Resistive panels jitter by a few pixels even under a resting
+  *          finger; a first order low pass removes the noise and the dead band
+  *          suppresses the remaining one pixel wobble, so a still finger
+  *          produces no DRAG events at all.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "touch_gesture.h"
+#include <stddef.h>
+
+/* Private function prototypes -----------------------------------------------*/
+static void TOUCH_Emit(TOUCH_Gesture_t *gesture, TOUCH_EventType_t type, uint32_t timestampMs);
+static int32_t TOUCH_Abs(int32_t value);
+
+/**
+  * @brief  Recognizer initialization
+  * @param  gesture  State
+  * @param  emit     Consumer
+  * @param  context  Consumer context
+  * @retval None
+  */
+void TOUCH_Gesture_Init(TOUCH_Gesture_t *gesture, TOUCH_EmitFn_t emit, void *context)
+{
+  gesture->touched = 0U;
+  gesture->dragging = 0U;
+  gesture->smoothX = 0;
+  gesture->smoothY = 0;
+  gesture->outX = 0;
+  gesture->outY = 0;
+  gesture->downX = 0;
+  gesture->downY = 0;
+  gesture->downMs = 0U;
+  gesture->lastMs = 0U;
+  gesture->emit = emit;
+  gesture->context = context;
+}
+
+/**
+  * @brief  Feed one position sample
+  * @param  gesture      Recognizer
+  * @param  x            Position
+  * @param  y            Position
+  * @param  timestampMs  Sample time
+  * @retval None
+  */
+void TOUCH_Gesture_Sample(TOUCH_Gesture_t *gesture, int16_t x, int16_t y, uint32_t timestampMs)
+{
+  int16_t fx;
+  int16_t fy;
+
+  gesture->lastMs = timestampMs;
+
+  if (!gesture->touched)
+  {
+    gesture->touched = 1U;
+    gesture->dragging = 0U;
+    gesture->smoothX = (int32_t)x * 256;
+    gesture->smoothY = (int32_t)y * 256;
+    gesture->outX = x;
+    gesture->outY = y;
+    gesture->downX = x;
+    gesture->downY = y;
+    gesture->downMs = timestampMs;
+    TOUCH_Emit(gesture, TOUCH_EVENT_DOWN, timestampMs);
+    return;
+  }
+
+  /* Low pass: s += (x - s) / 2^TOUCH_FILTER_SHIFT */
+  gesture->smoothX += (((int32_t)x * 256) - gesture->smoothX) / (1 << TOUCH_FILTER_SHIFT);
+  gesture->smoothY += (((int32_t)y * 256) - gesture->smoothY) / (1 << TOUCH_FILTER_SHIFT);
+  fx = (int16_t)((gesture->smoothX + 128) / 256);
+  fy = (int16_t)((gesture->smoothY + 128) / 256);
+
+  if ((TOUCH_Abs(fx - gesture->outX) < TOUCH_DEADBAND_PX) &&
+      (TOUCH_Abs(fy - gesture->outY) < TOUCH_DEADBAND_PX))
+  {
+    return;
+  }
+  gesture->outX = fx;
+  gesture->outY = fy;
+
+  if (!gesture->dragging &&
+      ((TOUCH_Abs(fx - gesture->downX) >= TOUCH_DRAG_START_PX) ||
+       (TOUCH_Abs(fy - gesture->downY) >= TOUCH_DRAG_START_PX)))
+  {
+    gesture->dragging = 1U;
+  }
+
+  if (gesture->dragging)
+  {
+    TOUCH_Emit(gesture, TOUCH_EVENT_DRAG, timestampMs);
+  }
+}
+
+/**
+  * @brief  Finger lifted
+  * @param  gesture      Recognizer
+  * @param  timestampMs  Release time
+  * @retval None
+  */
+void TOUCH_Gesture_Release(TOUCH_Gesture_t *gesture, uint32_t timestampMs)
+{
+  uint32_t duration;
+  int32_t dx;
+  int32_t dy;
+
+  if (!gesture->touched)
+  {
+    return;
+  }
+
+  duration = timestampMs - gesture->downMs;
+  dx = gesture->outX - gesture->downX;
+  dy = gesture->outY - gesture->downY;
+
+  if (!gesture->dragging)
+  {
+    if (duration <= TOUCH_TAP_MAX_MS)
+    {
+      TOUCH_Emit(gesture, TOUCH_EVENT_TAP, timestampMs);
+    }
+  }
+  else if ((duration <= TOUCH_SWIPE_MAX_MS) &&
+           ((TOUCH_Abs(dx) >= TOUCH_SWIPE_MIN_PX) || (TOUCH_Abs(dy) >= TOUCH_SWIPE_MIN_PX)))
+  {
+    if (TOUCH_Abs(dx) >= TOUCH_Abs(dy))
+    {
+      TOUCH_Emit(gesture, (dx < 0) ? TOUCH_EVENT_SWIPE_LEFT : TOUCH_EVENT_SWIPE_RIGHT, timestampMs);
+    }
+    else
+    {
+      TOUCH_Emit(gesture, (dy < 0) ? TOUCH_EVENT_SWIPE_UP : TOUCH_EVENT_SWIPE_DOWN, timestampMs);
+    }
+  }
+  else
+  {
+    TOUCH_Emit(gesture, TOUCH_EVENT_DRAG_END, timestampMs);
+  }
+
+  TOUCH_Emit(gesture, TOUCH_EVENT_UP, timestampMs);
+  gesture->touched = 0U;
+  gesture->dragging = 0U;
+}
+
+/**
+  * @brief  Build and emit an event at the current output position
+  * @param  gesture      Recognizer
+  * @param  type         Event type
+  * @param  timestampMs  Event time
+  * @retval None
+  */
+static void TOUCH_Emit(TOUCH_Gesture_t *gesture, TOUCH_EventType_t type, uint32_t timestampMs)
+{
+  TOUCH_Event_t event;
+
+  if (gesture->emit == NULL)
+  {
+    return;
+  }
+
+  event.type = type;
+  event.x = gesture->outX;
+  event.y = gesture->outY;
+  event.dx = (int16_t)(gesture->outX - gesture->downX);
+  event.dy = (int16_t)(gesture->outY - gesture->downY);
+  event.timestampMs = timestampMs;
+  gesture->emit(&event, gesture->context);
+}
+
+/**
+  * @brief  Absolute value
+  * @param  value  Input
+  * @retval |value|
+  */
+static int32_t TOUCH_Abs(int32_t value)
+{
+  return (value < 0) ? -value : value;
+}
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    touch_gesture.h
+  * @brief   Touch jitter filter and gesture recognizer interface
+  * @details This file contains the types and function prototypes of the
+  *          hardware independent part of the touch driver. Position samples
+  *          are smoothed and passed through a dead band, then classified into
+  *          tap, drag and swipe gestures.
+  *
+  *          The module depends only on <stdint.h> so recorded coordinate
+  *          traces can be replayed through it on the host.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __TOUCH_GESTURE_H__
+#define __TOUCH_GESTURE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define TOUCH_FILTER_SHIFT        2U      /* Smoothing weight 1/4 for new samples */
+#define TOUCH_DEADBAND_PX         2       /* Output moves only beyond this distance */
+#define TOUCH_DRAG_START_PX       12      /* Movement that turns a touch into a drag */
+#define TOUCH_TAP_MAX_MS          250U    /* Longest press still reported as a tap */
+#define TOUCH_SWIPE_MAX_MS        400U    /* Longest drag still reported as a swipe */
+#define TOUCH_SWIPE_MIN_PX        60      /* Shortest travel of a swipe */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Gesture event types
+ */
+typedef enum
+{
+  TOUCH_EVENT_DOWN = 0,     /*!< Finger landed */
+  TOUCH_EVENT_UP,           /*!< Finger lifted */
+  TOUCH_EVENT_TAP,          /*!< Short press without movement */
+  TOUCH_EVENT_DRAG,         /*!< Position changed during a drag */
+  TOUCH_EVENT_DRAG_END,     /*!< Drag finished without being a swipe */
+  TOUCH_EVENT_SWIPE_LEFT,
+  TOUCH_EVENT_SWIPE_RIGHT,
+  TOUCH_EVENT_SWIPE_UP,
+  TOUCH_EVENT_SWIPE_DOWN
+} TOUCH_EventType_t;
+
+/**
+ * @brief   Gesture event
+ */
+typedef struct
+{
+  TOUCH_EventType_t type;   /*!< Event type */
+  int16_t x;                /*!< Filtered position in pixels */
+  int16_t y;
+  int16_t dx;               /*!< Travel since touch down */
+  int16_t dy;
+  uint32_t timestampMs;     /*!< Time of the sample that caused the event */
+} TOUCH_Event_t;
+
+/**
+ * @brief   Event consumer
+ * @param   event    Event, only valid during the call
+ * @param   context  Pointer given to TOUCH_Gesture_Init()
+ */
+typedef void (*TOUCH_EmitFn_t)(const TOUCH_Event_t *event, void *context);
+
+/**
+ * @brief   Filter and recognizer state
+ */
+typedef struct
+{
+  uint8_t touched;          /*!< Finger currently down */
+  uint8_t dragging;         /*!< Movement exceeded TOUCH_DRAG_START_PX */
+  int32_t smoothX;          /*!< Smoothed position, 8 fractional bits */
+  int32_t smoothY;
+  int16_t outX;             /*!< Last reported position */
+  int16_t outY;
+  int16_t downX;            /*!< Position at touch down */
+  int16_t downY;
+  uint32_t downMs;          /*!< Time of touch down */
+  uint32_t lastMs;          /*!< Time of the last sample */
+  TOUCH_EmitFn_t emit;
+  void *context;
+} TOUCH_Gesture_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes a recognizer
+ * @param   gesture  State to initialize
+ * @param   emit     Event consumer
+ * @param   context  Passed back to the consumer
+ * @retval  None
+ */
+void TOUCH_Gesture_Init(TOUCH_Gesture_t *gesture, TOUCH_EmitFn_t emit, void *context);
+
+/**
+ * @brief   Feeds one position sample
+ * @details The first sample of a touch emits TOUCH_EVENT_DOWN; later samples
+ *          are smoothed and may emit TOUCH_EVENT_DRAG
+ * @param   gesture      Recognizer
+ * @param   x            Raw position in pixels
+ * @param   y            Raw position in pixels
+ * @param   timestampMs  Sample time
+ * @retval  None
+ */
+void TOUCH_Gesture_Sample(TOUCH_Gesture_t *gesture, int16_t x, int16_t y, uint32_t timestampMs);
+
+/**
+ * @brief   Reports that the finger was lifted
+ * @details Classifies the touch and emits TAP, SWIPE_x or DRAG_END, then UP
+ * @param   gesture      Recognizer
+ * @param   timestampMs  Release time
+ * @retval  None
+ */
+void TOUCH_Gesture_Release(TOUCH_Gesture_t *gesture, uint32_t timestampMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TOUCH_GESTURE_H__ */
@@ -0,0 +1,335 @@
+/**
+  ******************************************************************************
+  * @file    clock_gov.c
+  * @brief   Clock governor implementation
+  * @details This file provides the profile table, the switch sequence and
+  *          the retiming of the peripherals.
+  *
+  *          The switch is timed with the DWT cycle counter in laps: a lap
+  *          closes after every step that changes HCLK and is converted with
+  *          the HCLK it ran at. TIM2 cannot time it since it is one of the
+  *          clocks being changed; the measured time is what sets TIM2 right
+  *          again afterwards.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "clock_gov.h"
+#include "dwt.h"
+#include "profiler.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "usbh_core.h"
+#include "../FMC/fmc.h"
+#include "../I2C/i2c_bus.h"
+#include "../SPI/spi_bus.h"
+#include "../TIM/tim.h"
+#include "../TIM/timebase.h"
+#include "../UART/uart.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define CLKGOV_PLLM               4U      /* 2 MHz PLL input, shared with PLLSAI */
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Profile settings
+ */
+typedef struct
+{
+  uint32_t mhz;                 /*!< Resulting HCLK */
+  uint32_t pllN;
+  uint32_t pllP;                /*!< RCC_PLLP_DIVx */
+  uint32_t pllQ;
+  uint32_t voltageScale;        /*!< PWR_REGULATOR_VOLTAGE_SCALEx */
+  uint8_t overDrive;
+  uint8_t usbClock;             /*!< VCO / PLLQ is 48 MHz */
+  uint32_t ahbDivider;          /*!< RCC_SYSCLK_DIVx */
+  uint32_t apb1Divider;         /*!< RCC_HCLK_DIVx, APB1 at most 45 MHz */
+  uint32_t apb2Divider;         /*!< RCC_HCLK_DIVx, APB2 at most 90 MHz */
+  uint32_t flashLatency;        /*!< Wait states at 2.7 to 3.6 V */
+} CLKGOV_Config_t;
+
+/**
+ * @brief   Switch duration being measured
+ */
+typedef struct
+{
+  uint64_t ns;
+  uint32_t cycles;              /*!< CYCCNT at the start of the lap */
+  uint32_t hz;                  /*!< HCLK during the lap */
+} CLKGOV_Lap_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const CLKGOV_Config_t profiles[CLKGOV_PROFILE_COUNT] = {
+  /* 2 MHz * 180 / 2; USB would get 360 / 8 = 45 MHz */
+  [CLKGOV_PROFILE_180MHZ] = { 180U, 180U, RCC_PLLP_DIV2, 8U, PWR_REGULATOR_VOLTAGE_SCALE1, 1U, 0U,
+                              RCC_SYSCLK_DIV1, RCC_HCLK_DIV4, RCC_HCLK_DIV2, FLASH_LATENCY_5 },
+  [CLKGOV_PROFILE_168MHZ] = { 168U, 168U, RCC_PLLP_DIV2, 7U, PWR_REGULATOR_VOLTAGE_SCALE1, 0U, 1U,
+                              RCC_SYSCLK_DIV1, RCC_HCLK_DIV4, RCC_HCLK_DIV2, FLASH_LATENCY_5 },
+  /* Same PLL as 168 MHz: switching between the two needs no relock */
+  [CLKGOV_PROFILE_84MHZ]  = { 84U,  168U, RCC_PLLP_DIV2, 7U, PWR_REGULATOR_VOLTAGE_SCALE1, 0U, 1U,
+                              RCC_SYSCLK_DIV2, RCC_HCLK_DIV2, RCC_HCLK_DIV1, FLASH_LATENCY_2 },
+  /* 2 MHz * 192 / 8, USB 384 / 8 = 48 MHz */
+  [CLKGOV_PROFILE_48MHZ]  = { 48U,  192U, RCC_PLLP_DIV8, 8U, PWR_REGULATOR_VOLTAGE_SCALE3, 0U, 1U,
+                              RCC_SYSCLK_DIV1, RCC_HCLK_DIV2, RCC_HCLK_DIV1, FLASH_LATENCY_1 },
+};
+
+/* SystemClock_Config() sets up the 168 MHz profile */
+static CLKGOV_Profile_t current = CLKGOV_PROFILE_168MHZ;
+static CLKGOV_Stats_t stats;
+
+extern USBH_HandleTypeDef hUsbHostHS;
+extern UART_Handle_t uartHandle;
+
+/* Private function prototypes -----------------------------------------------*/
+static void CLKGOV_Relock(const CLKGOV_Config_t *from, const CLKGOV_Config_t *to, CLKGOV_Lap_t *lap);
+static void CLKGOV_Retime(uint64_t nowUs);
+static void CLKGOV_Lap(CLKGOV_Lap_t *lap);
+
+/**
+  * @brief  Switch to a profile
+  * @param  profile  Target profile
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CLKGOV_SetProfile(CLKGOV_Profile_t profile)
+{
+  const CLKGOV_Config_t *from;
+  const CLKGOV_Config_t *to;
+  RCC_ClkInitTypeDef clk = {0};
+  CLKGOV_Lap_t lap;
+  uint64_t startUs;
+  uint64_t switchNs;
+  uint32_t primask;
+  uint8_t relock;
+
+  if (profile >= CLKGOV_PROFILE_COUNT)
+  {
+    return HAL_ERROR;
+  }
+
+  DWT_Init();
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (profile == current)
+  {
+    __set_PRIMASK(primask);
+    return HAL_OK;
+  }
+  from = &profiles[current];
+  to = &profiles[profile];
+  if (!to->usbClock && (hUsbHostHS.device.is_connected != 0U))
+  {
+    stats.refused++;
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+  relock = (from->pllN != to->pllN) || (from->pllP != to->pllP) || (from->pllQ != to->pllQ) ||
+           (from->voltageScale != to->voltageScale) || (from->overDrive != to->overDrive);
+
+  startUs = TIMEBASE_GetUs();
+  lap.ns = 0U;
+  lap.cycles = DWT_GetCycles();
+  lap.hz = SystemCoreClock;
+
+  if (relock)
+  {
+    CLKGOV_Relock(from, to, &lap);
+  }
+
+  /* Raises the flash latency before and lowers it after the switch; the
+     HAL tick is reprogrammed on the way */
+  clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+  clk.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+  clk.AHBCLKDivider = to->ahbDivider;
+  clk.APB1CLKDivider = to->apb1Divider;
+  clk.APB2CLKDivider = to->apb2Divider;
+  if (HAL_RCC_ClockConfig(&clk, to->flashLatency) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  CLKGOV_Lap(&lap);
+  switchNs = lap.ns;
+
+  CLKGOV_Retime(startUs + (lap.ns / 1000U));
+  CLKGOV_Lap(&lap);
+
+  current = profile;
+  stats.switches++;
+  stats.relocks += relock;
+  stats.lastSwitchNs = (uint32_t)lap.ns;
+  stats.lastRetimeNs = (uint32_t)(lap.ns - switchNs);
+  if (stats.lastSwitchNs > stats.maxSwitchNs)
+  {
+    stats.maxSwitchNs = stats.lastSwitchNs;
+  }
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Current profile
+  * @param  None
+  * @retval Profile
+  */
+CLKGOV_Profile_t CLKGOV_GetProfile(void)
+{
+  return current;
+}
+
+/**
+  * @brief  HCLK of a profile
+  * @param  profile  Profile
+  * @retval MHz
+  */
+uint32_t CLKGOV_GetProfileMHz(CLKGOV_Profile_t profile)
+{
+  return (profile < CLKGOV_PROFILE_COUNT) ? profiles[profile].mhz : 0U;
+}
+
+/**
+  * @brief  Look up a profile by its HCLK
+  * @param  mhz      HCLK in MHz
+  * @param  profile  Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CLKGOV_FindProfile(uint32_t mhz, CLKGOV_Profile_t *profile)
+{
+  uint32_t i;
+
+  for (i = 0; i < CLKGOV_PROFILE_COUNT; i++)
+  {
+    if (profiles[i].mhz == mhz)
+    {
+      *profile = (CLKGOV_Profile_t)i;
+      return HAL_OK;
+    }
+  }
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Whether a profile gives USB its 48 MHz
+  * @param  profile  Profile
+  * @retval 1 if USB works in the profile
+  */
+uint8_t CLKGOV_HasUsbClock(CLKGOV_Profile_t profile)
+{
+  return (profile < CLKGOV_PROFILE_COUNT) ? profiles[profile].usbClock : 0U;
+}
+
+/**
+  * @brief  Read the governor statistics
+  * @param  dest  Destination
+  * @retval None
+  */
+void CLKGOV_GetStats(CLKGOV_Stats_t *dest)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *dest = stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Reconfigure the PLL, the regulator and the over-drive
+  * @details Leaves SYSCLK on HSE with the new PLL locked. The regulator
+  *          scale only changes with the PLL off and the over-drive only with
+  *          SYSCLK off the PLL.
+  * @param  from  Current profile
+  * @param  to    Target profile
+  * @param  lap   Switch timing
+  * @retval None
+  */
+static void CLKGOV_Relock(const CLKGOV_Config_t *from, const CLKGOV_Config_t *to, CLKGOV_Lap_t *lap)
+{
+  RCC_OscInitTypeDef osc = {0};
+  RCC_ClkInitTypeDef clk = {0};
+
+  clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+  clk.SYSCLKSource = RCC_SYSCLKSOURCE_HSE;
+  clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+  clk.APB1CLKDivider = RCC_HCLK_DIV1;
+  clk.APB2CLKDivider = RCC_HCLK_DIV1;
+  if (HAL_RCC_ClockConfig(&clk, __HAL_FLASH_GET_LATENCY()) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  CLKGOV_Lap(lap);
+
+  /* SDCLK is 4 MHz until the PLL is back */
+  FMC_SDRAM_UpdateRefreshRate();
+
+  if (from->overDrive && (HAL_PWREx_DisableOverDrive() != HAL_OK))
+  {
+    Error_Handler();
+  }
+
+  __HAL_RCC_PLL_DISABLE();
+  while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY) != RESET)
+  {
+  }
+  __HAL_PWR_VOLTAGESCALING_CONFIG(to->voltageScale);
+
+  osc.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+  osc.PLL.PLLState = RCC_PLL_ON;
+  osc.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+  osc.PLL.PLLM = CLKGOV_PLLM;
+  osc.PLL.PLLN = to->pllN;
+  osc.PLL.PLLP = to->pllP;
+  osc.PLL.PLLQ = to->pllQ;
+  if (HAL_RCC_OscConfig(&osc) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  while (__HAL_PWR_GET_FLAG(PWR_FLAG_VOSRDY) == RESET)
+  {
+  }
+
+  if (to->overDrive && (HAL_PWREx_EnableOverDrive() != HAL_OK))
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Retime the peripherals for the new bus clocks
+  * @param  nowUs  Current time, measured across the switch
+  * @retval None
+  */
+static void CLKGOV_Retime(uint64_t nowUs)
+{
+  FMC_SDRAM_UpdateRefreshRate();
+  TIMEBASE_UpdateClock(nowUs);
+  TIM_UpdateClock();
+  (void)UART_UpdateBaudRate(&uartHandle);
+  SPIBUS_UpdateClock();
+  I2CBUS_UpdateClock();
+  PROF_UpdateClock();
+
+  /* Same reload as vPortSetupTimerInterrupt() */
+  if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+  {
+    SysTick->LOAD = (configCPU_CLOCK_HZ / configTICK_RATE_HZ) - 1UL;
+    SysTick->VAL = 0U;
+  }
+}
+
+/**
+  * @brief  Close a lap of the switch timing
+  * @details Called right after a step that changed HCLK: the lap ran at the
+  *          HCLK before it
+  * @param  lap  Switch timing
+  * @retval None
+  */
+static void CLKGOV_Lap(CLKGOV_Lap_t *lap)
+{
+  uint32_t now = DWT_GetCycles();
+
+  lap->ns += ((uint64_t)(now - lap->cycles) * 1000000000U) / lap->hz;
+  lap->cycles = now;
+  lap->hz = SystemCoreClock;
+}
@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    clock_gov.h
+  * @brief   Clock governor interface
+  * @details This file contains the performance profiles and the function
+  *          prototypes of the clock governor. A profile sets SYSCLK, the bus
+  *          dividers, the flash latency and the regulator; after the switch
+  *          the governor retimes everything derived from a bus clock:
+  *          - the HAL tick (TIM6) and, once the kernel runs, SysTick
+  *          - TIM2 (TIMEBASE), kept continuous across the switch, TIM1 and
+  *            the TIM7 profiler clock
+  *          - USART1 baud rate, SPI5 prescaler, I2C3 timings
+  *          - the SDRAM refresh counter
+  *
+  *          Profiles that share the PLL settings (168 and 84 MHz) switch by
+  *          changing the AHB divider only. The others relock the PLL from
+  *          HSE, which takes a few hundred microseconds: the PLL feeds USB,
+  *          the regulator scale can only change with the PLL off, and the
+  *          over-drive only with SYSCLK off the PLL. PLLM is the same in all
+  *          profiles, so PLLSAI and with it the LTDC pixel clock never move.
+  *
+  *          USB OTG needs 48 MHz from PLLQ, which the 360 MHz VCO of the
+  *          180 MHz profile cannot give; that profile is refused while a USB
+  *          device is attached.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __CLOCK_GOV_H__
+#define __CLOCK_GOV_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Performance profiles, fastest first
+ */
+typedef enum
+{
+  CLKGOV_PROFILE_180MHZ = 0,    /*!< Over-drive, APB 45/90 MHz, no USB */
+  CLKGOV_PROFILE_168MHZ,        /*!< SystemClock_Config(), APB 42/84 MHz */
+  CLKGOV_PROFILE_84MHZ,         /*!< 168 MHz PLL, AHB / 2, APB 42/84 MHz */
+  CLKGOV_PROFILE_48MHZ,         /*!< Regulator scale 3, APB 24/48 MHz */
+  CLKGOV_PROFILE_COUNT
+} CLKGOV_Profile_t;
+
+/**
+ * @brief   Governor statistics
+ */
+typedef struct
+{
+  uint32_t switches;            /*!< Profile changes done */
+  uint32_t relocks;             /*!< Of which relocked the PLL */
+  uint32_t refused;             /*!< Refused while USB was in use */
+  uint32_t lastSwitchNs;        /*!< Last change, clock switch plus retiming */
+  uint32_t maxSwitchNs;         /*!< Longest change */
+  uint32_t lastRetimeNs;        /*!< Retiming part of the last change */
+} CLKGOV_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Switches to a profile and retimes the peripherals
+ * @details Runs with interrupts disabled, so no handler sees a peripheral
+ *          timed for the other clock; bytes on the UART or the I2C bus
+ *          during the switch may be lost. A failing RCC step ends in
+ *          Error_Handler(), like in SystemClock_Config().
+ * @note    Task or interrupt context
+ * @param   profile  Target profile
+ * @retval  HAL_OK, HAL_BUSY if the profile has no USB clock and a USB device
+ *          is attached, HAL_ERROR for an invalid profile
+ */
+HAL_StatusTypeDef CLKGOV_SetProfile(CLKGOV_Profile_t profile);
+
+/**
+ * @brief   Current profile
+ * @param   None
+ * @retval  Profile
+ */
+CLKGOV_Profile_t CLKGOV_GetProfile(void);
+
+/**
+ * @brief   HCLK of a profile
+ * @param   profile  Profile
+ * @retval  MHz
+ */
+uint32_t CLKGOV_GetProfileMHz(CLKGOV_Profile_t profile);
+
+/**
+ * @brief   Looks up a profile by its HCLK
+ * @param   mhz      HCLK in MHz
+ * @param   profile  Destination
+ * @retval  HAL_OK, HAL_ERROR if there is no such profile
+ */
+HAL_StatusTypeDef CLKGOV_FindProfile(uint32_t mhz, CLKGOV_Profile_t *profile);
+
+/**
+ * @brief   Whether a profile gives USB its 48 MHz
+ * @param   profile  Profile
+ * @retval  1 if USB works in the profile
+ */
+uint8_t CLKGOV_HasUsbClock(CLKGOV_Profile_t profile);
+
+/**
+ * @brief   Reads the governor statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void CLKGOV_GetStats(CLKGOV_Stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CLOCK_GOV_H__ */
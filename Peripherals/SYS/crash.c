@@ -0,0 +1,518 @@
+/**
+  ******************************************************************************
+  * @file    crash.c
+  * @brief   Crash capture implementation
+  * @details This file provides the post-mortem capture. The fault handlers
+  *          are naked trampolines into CRASH_FaultEntry(), which saves r4-r11
+  *          and moves to a private stack before any C code runs, so a fault
+  *          caused by a blown stack is captured as well. The dump goes to the
+  *          backup SRAM, which keeps its contents across a system reset, and
+  *          the MCU is reset at once; a unit is back in milliseconds instead
+  *          of hanging until someone cycles the power.
+  *
+  *          With a debugger attached the capture stops on a breakpoint
+  *          before the reset, so the fault can still be inspected live.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "crash.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define CRASH_MAGIC               0x43525348U   /* "CRSH" */
+#define CRASH_STACK_BYTES         512           /* Capture stack, pasted into asm */
+
+#define CRASH_DUMP                ((CRASH_Dump_t *)BKPSRAM_BASE)
+#define CRASH_BKPSRAM_SIZE        4096U
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Fault status bit name
+ */
+typedef struct
+{
+  uint32_t mask;
+  const char *name;
+} CRASH_Bit_t;
+
+/* Private variables ---------------------------------------------------------*/
+_Static_assert(sizeof(CRASH_Dump_t) <= CRASH_BKPSRAM_SIZE, "crash dump exceeds the backup SRAM");
+
+/**
+ * @brief   Stack of the capture and the callee-saved registers, both set
+ *          from CRASH_FaultEntry()
+ */
+__attribute__((used, aligned(8))) static uint32_t crashStack[CRASH_STACK_BYTES / sizeof(uint32_t)];
+__attribute__((used)) static uint32_t crashRegs[8];
+
+static volatile uint8_t capturing;
+static const char *resetCause = "unknown";
+
+static const CRASH_Bit_t cfsrBits[] = {
+  { SCB_CFSR_IACCVIOL_Msk,    "IACCVIOL" },
+  { SCB_CFSR_DACCVIOL_Msk,    "DACCVIOL" },
+  { SCB_CFSR_MUNSTKERR_Msk,   "MUNSTKERR" },
+  { SCB_CFSR_MSTKERR_Msk,     "MSTKERR" },
+  { SCB_CFSR_MLSPERR_Msk,     "MLSPERR" },
+  { SCB_CFSR_MMARVALID_Msk,   "MMARVALID" },
+  { SCB_CFSR_IBUSERR_Msk,     "IBUSERR" },
+  { SCB_CFSR_PRECISERR_Msk,   "PRECISERR" },
+  { SCB_CFSR_IMPRECISERR_Msk, "IMPRECISERR" },
+  { SCB_CFSR_UNSTKERR_Msk,    "UNSTKERR" },
+  { SCB_CFSR_STKERR_Msk,      "STKERR" },
+  { SCB_CFSR_LSPERR_Msk,      "LSPERR" },
+  { SCB_CFSR_BFARVALID_Msk,   "BFARVALID" },
+  { SCB_CFSR_UNDEFINSTR_Msk,  "UNDEFINSTR" },
+  { SCB_CFSR_INVSTATE_Msk,    "INVSTATE" },
+  { SCB_CFSR_INVPC_Msk,       "INVPC" },
+  { SCB_CFSR_NOCP_Msk,        "NOCP" },
+  { SCB_CFSR_UNALIGNED_Msk,   "UNALIGNED" },
+  { SCB_CFSR_DIVBYZERO_Msk,   "DIVBYZERO" },
+};
+
+static const CRASH_Bit_t hfsrBits[] = {
+  { SCB_HFSR_VECTTBL_Msk,     "VECTTBL" },
+  { SCB_HFSR_FORCED_Msk,      "FORCED" },
+  { SCB_HFSR_DEBUGEVT_Msk,    "DEBUGEVT" },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void CRASH_Fault(const uint32_t *frame, uint32_t excReturn, uint32_t cause) __attribute__((used, noreturn));
+static void CRASH_Store(uint32_t cause, uint32_t info, const uint32_t *frame, uint32_t sp, uint32_t excReturn);
+static void CRASH_Reset(void) __attribute__((noreturn));
+static void CRASH_Open(void);
+static uint32_t CRASH_RamEnd(uint32_t addr);
+static uint32_t CRASH_Checksum(const CRASH_Dump_t *dump);
+static uint8_t CRASH_IsValid(const CRASH_Dump_t *dump);
+
+/**
+  * @brief  Crash capture initialization
+  * @param  None
+  * @retval None
+  */
+void CRASH_Init(void)
+{
+  CRASH_Open();
+
+  /* Without these every fault escalates to HardFault with less detail */
+  SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk | SCB_SHCSR_BUSFAULTENA_Msk | SCB_SHCSR_USGFAULTENA_Msk;
+
+  if (__HAL_RCC_GET_FLAG(RCC_FLAG_LPWRRST))
+  {
+    resetCause = "low power";
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_WWDGRST))
+  {
+    resetCause = "window watchdog";
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_IWDGRST))
+  {
+    resetCause = "independent watchdog";
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_SFTRST))
+  {
+    resetCause = "software";
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_PORRST))
+  {
+    resetCause = "power on";
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_BORRST))
+  {
+    resetCause = "brown out";
+  }
+  else if (__HAL_RCC_GET_FLAG(RCC_FLAG_PINRST))
+  {
+    resetCause = "reset pin";
+  }
+  __HAL_RCC_CLEAR_RESET_FLAGS();
+}
+
+/**
+  * @brief  Print the dump of the previous run
+  * @param  None
+  * @retval None
+  */
+void CRASH_Report(void)
+{
+  CRASH_Dump_t *dump = CRASH_DUMP;
+  char fault[128];
+  uint32_t i;
+
+  printf("\r\nReset cause: %s\r\n", resetCause);
+  if (!CRASH_IsValid(dump) || dump->reported)
+  {
+    return;
+  }
+
+  dump->taskName[CRASH_TASK_NAME_LEN - 1U] = '\0';
+  CRASH_DecodeFault(dump, fault, sizeof(fault));
+
+  printf("*** Crash before reset: %s, dump %lu ***\r\n",
+         CRASH_CauseName(dump->cause), (unsigned long)dump->count);
+  printf("CRASH cause=%s info=%lu uptime=%lu count=%lu\r\n",
+         CRASH_CauseName(dump->cause), (unsigned long)dump->info,
+         (unsigned long)dump->uptimeMs, (unsigned long)dump->count);
+  printf("CRASH task=%s handle=%08lX\r\n",
+         (dump->taskName[0] != '\0') ? dump->taskName : "-", (unsigned long)dump->task);
+  printf("CRASH pc=%08lX lr=%08lX sp=%08lX xpsr=%08lX exc=%08lX\r\n",
+         (unsigned long)dump->frame[6], (unsigned long)dump->frame[5], (unsigned long)dump->sp,
+         (unsigned long)dump->frame[7], (unsigned long)dump->excReturn);
+  printf("CRASH r0=%08lX r1=%08lX r2=%08lX r3=%08lX r12=%08lX\r\n",
+         (unsigned long)dump->frame[0], (unsigned long)dump->frame[1], (unsigned long)dump->frame[2],
+         (unsigned long)dump->frame[3], (unsigned long)dump->frame[4]);
+  printf("CRASH r4=%08lX r5=%08lX r6=%08lX r7=%08lX r8=%08lX r9=%08lX r10=%08lX r11=%08lX\r\n",
+         (unsigned long)dump->regs[0], (unsigned long)dump->regs[1], (unsigned long)dump->regs[2],
+         (unsigned long)dump->regs[3], (unsigned long)dump->regs[4], (unsigned long)dump->regs[5],
+         (unsigned long)dump->regs[6], (unsigned long)dump->regs[7]);
+  printf("CRASH msp=%08lX psp=%08lX\r\n", (unsigned long)dump->msp, (unsigned long)dump->psp);
+  printf("CRASH cfsr=%08lX hfsr=%08lX mmfar=%08lX bfar=%08lX\r\n",
+         (unsigned long)dump->cfsr, (unsigned long)dump->hfsr,
+         (unsigned long)dump->mmfar, (unsigned long)dump->bfar);
+  printf("CRASH fault=%s\r\n", fault);
+  for (i = 0; i < dump->stackWords; i += 8U)
+  {
+    const uint32_t *w = &dump->stack[i];
+
+    printf("CRASH stack %08lX: %08lX %08lX %08lX %08lX %08lX %08lX %08lX %08lX\r\n",
+           (unsigned long)(dump->sp + (i * sizeof(uint32_t))),
+           (unsigned long)w[0], (unsigned long)w[1], (unsigned long)w[2], (unsigned long)w[3],
+           (unsigned long)w[4], (unsigned long)w[5], (unsigned long)w[6], (unsigned long)w[7]);
+  }
+  printf("CRASH end\r\n");
+
+  dump->reported = 1U;
+  dump->checksum = CRASH_Checksum(dump);
+}
+
+/**
+  * @brief  Last dump
+  * @param  None
+  * @retval Dump, NULL if none
+  */
+const CRASH_Dump_t *CRASH_GetDump(void)
+{
+  const CRASH_Dump_t *dump = CRASH_DUMP;
+
+  return CRASH_IsValid(dump) ? dump : NULL;
+}
+
+/**
+  * @brief  Forget the last dump
+  * @param  None
+  * @retval None
+  */
+void CRASH_Clear(void)
+{
+  CRASH_DUMP->magic = 0U;
+}
+
+/**
+  * @brief  Name of a capture cause
+  * @param  cause  CRASH_CAUSE_*
+  * @retval Constant string
+  */
+const char *CRASH_CauseName(uint32_t cause)
+{
+  switch (cause)
+  {
+    case CRASH_CAUSE_HARDFAULT:   return "HardFault";
+    case CRASH_CAUSE_MEMMANAGE:   return "MemManage";
+    case CRASH_CAUSE_BUSFAULT:    return "BusFault";
+    case CRASH_CAUSE_USAGEFAULT:  return "UsageFault";
+    case CRASH_CAUSE_ERROR:       return "Error_Handler";
+    case CRASH_CAUSE_ASSERT:      return "assert";
+    default:                      return "none";
+  }
+}
+
+/**
+  * @brief  Reset cause latched at boot
+  * @param  None
+  * @retval Constant string
+  */
+const char *CRASH_ResetCause(void)
+{
+  return resetCause;
+}
+
+/**
+  * @brief  Names of the fault status bits set
+  * @param  dump  Dump
+  * @param  text  Destination
+  * @param  size  Size of the destination
+  * @retval None
+  */
+void CRASH_DecodeFault(const CRASH_Dump_t *dump, char *text, uint32_t size)
+{
+  uint32_t len = 0U;
+  uint32_t i;
+
+  text[0] = '\0';
+  for (i = 0; i < (sizeof(cfsrBits) / sizeof(cfsrBits[0])); i++)
+  {
+    if (((dump->cfsr & cfsrBits[i].mask) != 0U) && (len < size))
+    {
+      len += (uint32_t)snprintf(text + len, size - len, "%s%s", (len != 0U) ? " " : "", cfsrBits[i].name);
+    }
+  }
+  for (i = 0; i < (sizeof(hfsrBits) / sizeof(hfsrBits[0])); i++)
+  {
+    if (((dump->hfsr & hfsrBits[i].mask) != 0U) && (len < size))
+    {
+      len += (uint32_t)snprintf(text + len, size - len, "%s%s", (len != 0U) ? " " : "", hfsrBits[i].name);
+    }
+  }
+  if (len == 0U)
+  {
+    (void)snprintf(text, size, "-");
+  }
+}
+
+/**
+  * @brief  Capture a software failure and reset
+  * @param  cause  CRASH_CAUSE_*
+  * @param  pc     Caller address
+  * @param  info   Cause specific value
+  * @retval None
+  */
+void CRASH_Capture(uint32_t cause, uint32_t pc, uint32_t info)
+{
+  uint32_t frame[8] = {0};
+  uint32_t sp;
+
+  __disable_irq();
+  if (capturing)
+  {
+    CRASH_Reset();
+  }
+  capturing = 1U;
+
+  /* Thread mode on the PSP for tasks, the MSP otherwise */
+  sp = ((__get_IPSR() == 0U) && ((__get_CONTROL() & CONTROL_SPSEL_Msk) != 0U)) ? __get_PSP() : __get_MSP();
+  frame[5] = (uint32_t)__builtin_return_address(0);
+  frame[6] = pc;
+  frame[7] = __get_xPSR();
+
+  CRASH_Store(cause, info, frame, sp, 0U);
+  CRASH_Reset();
+}
+
+/**
+  * @brief  configASSERT() failure
+  * @param  line  Source line of the assert
+  * @retval None
+  */
+void CRASH_Assert(uint32_t line)
+{
+  CRASH_Capture(CRASH_CAUSE_ASSERT, (uint32_t)__builtin_return_address(0), line);
+}
+
+/**
+  * @brief  Fault on purpose
+  * @param  None
+  * @retval None
+  */
+void CRASH_Test(void)
+{
+  /* Permanently undefined encoding: UsageFault, UNDEFINSTR */
+  __asm volatile("udf #0");
+}
+
+/**
+  * @brief  Common fault entry
+  * @details Saves r4-r11 before the compiler may use them and switches to
+  *          the capture stack: the faulting stack may be the cause.
+  * @param  None
+  * @retval None
+  */
+__attribute__((naked)) void CRASH_FaultEntry(void)
+{
+  __asm volatile("ldr   r3, =crashRegs                                    \n"
+                 "stmia r3, {r4-r11}                                      \n"
+                 "ldr   r3, =crashStack + " CRASH_XSTR(CRASH_STACK_BYTES) "\n"
+                 "mov   sp, r3                                            \n"
+                 "b     CRASH_Fault                                       \n");
+}
+
+/**
+  * @brief  Capture a fault and reset
+  * @param  frame      Exception frame
+  * @param  excReturn  EXC_RETURN
+  * @param  cause      CRASH_CAUSE_*
+  * @retval None
+  */
+static void CRASH_Fault(const uint32_t *frame, uint32_t excReturn, uint32_t cause)
+{
+  uint32_t sp;
+
+  __disable_irq();
+  if (capturing)
+  {
+    /* Faulted while capturing: keep what was stored */
+    CRASH_Reset();
+  }
+  capturing = 1U;
+
+  /* Basic or FP frame, plus the alignment word flagged in xPSR bit 9 */
+  sp = (uint32_t)frame + ((excReturn & 0x10U) ? 0x20U : 0x68U);
+  if ((CRASH_RamEnd((uint32_t)frame) != 0U) && ((frame[7] & (1UL << 9)) != 0U))
+  {
+    sp += 4U;
+  }
+
+  CRASH_Store(cause, 0U, frame, sp, excReturn);
+  CRASH_Reset();
+}
+
+/**
+  * @brief  Write the dump to the backup SRAM
+  * @param  cause      CRASH_CAUSE_*
+  * @param  info       Cause specific value
+  * @param  frame      r0, r1, r2, r3, r12, lr, pc, xpsr
+  * @param  sp         Stack pointer to snapshot from
+  * @param  excReturn  EXC_RETURN, 0 for software captures
+  * @retval None
+  */
+static void CRASH_Store(uint32_t cause, uint32_t info, const uint32_t *frame, uint32_t sp, uint32_t excReturn)
+{
+  CRASH_Dump_t *dump = CRASH_DUMP;
+  TaskHandle_t task;
+  uint32_t count;
+  uint32_t end;
+  uint32_t words;
+
+  /* Error_Handler() may run before CRASH_Init() */
+  CRASH_Open();
+  count = CRASH_IsValid(dump) ? (dump->count + 1U) : 1U;
+  memset(dump, 0, sizeof(*dump));
+  dump->count = count;
+  dump->cause = cause;
+  dump->info = info;
+  dump->uptimeMs = HAL_GetTick();
+  dump->sp = sp;
+  dump->excReturn = excReturn;
+  dump->msp = __get_MSP();
+  dump->psp = __get_PSP();
+  dump->cfsr = SCB->CFSR;
+  dump->hfsr = SCB->HFSR;
+  dump->mmfar = SCB->MMFAR;
+  dump->bfar = SCB->BFAR;
+
+  /* A wild stack pointer still leaves the fault registers */
+  if (CRASH_RamEnd((uint32_t)frame) >= ((uint32_t)frame + sizeof(dump->frame)))
+  {
+    memcpy(dump->frame, frame, sizeof(dump->frame));
+  }
+  if (excReturn != 0U)
+  {
+    memcpy(dump->regs, crashRegs, sizeof(dump->regs));
+  }
+
+  if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+  {
+    task = xTaskGetCurrentTaskHandle();
+    dump->task = (uint32_t)task;
+    if (CRASH_RamEnd((uint32_t)task) != 0U)
+    {
+      strncpy(dump->taskName, pcTaskGetName(task), CRASH_TASK_NAME_LEN - 1U);
+    }
+  }
+
+  end = CRASH_RamEnd(sp);
+  if ((end != 0U) && ((sp & 3U) == 0U))
+  {
+    words = (end - sp) / sizeof(uint32_t);
+    dump->stackWords = (words < CRASH_STACK_WORDS) ? words : CRASH_STACK_WORDS;
+    memcpy(dump->stack, (const void *)sp, dump->stackWords * sizeof(uint32_t));
+  }
+
+  dump->checksum = CRASH_Checksum(dump);
+  dump->magic = CRASH_MAGIC;
+  __DSB();
+}
+
+/**
+  * @brief  Reset after a capture
+  * @param  None
+  * @retval None
+  */
+static void CRASH_Reset(void)
+{
+  if ((CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk) != 0U)
+  {
+    /* Debugger attached: stop here, resuming resets */
+    __BKPT(0);
+  }
+  NVIC_SystemReset();
+}
+
+/**
+  * @brief  Enable writes to the backup SRAM
+  * @param  None
+  * @retval None
+  */
+static void CRASH_Open(void)
+{
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+  __HAL_RCC_BKPSRAM_CLK_ENABLE();
+}
+
+/**
+  * @brief  End of the RAM holding an address
+  * @param  addr  Address
+  * @retval End address, 0 if not in RAM
+  */
+static uint32_t CRASH_RamEnd(uint32_t addr)
+{
+  if ((addr >= SRAM1_BASE) && (addr < (SRAM1_BASE + (192U * 1024U))))
+  {
+    return SRAM1_BASE + (192U * 1024U);
+  }
+  if ((addr >= CCMDATARAM_BASE) && (addr < (CCMDATARAM_END + 1U)))
+  {
+    return CCMDATARAM_END + 1U;
+  }
+  if (((RCC->AHB3ENR & RCC_AHB3ENR_FMCEN) != 0U) &&
+      (addr >= 0xD0000000U) && (addr < (0xD0000000U + (8U * 1024U * 1024U))))
+  {
+    return 0xD0000000U + (8U * 1024U * 1024U);
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Checksum of a dump
+  * @param  dump  Dump
+  * @retval Checksum over everything after the checksum field
+  */
+static uint32_t CRASH_Checksum(const CRASH_Dump_t *dump)
+{
+  const uint32_t *word = &dump->count;
+  const uint32_t *end = (const uint32_t *)(const void *)(dump + 1);
+  uint32_t sum = 0x811C9DC5U;
+
+  while (word < end)
+  {
+    sum = ((sum << 5) | (sum >> 27)) ^ *word++;
+  }
+  return sum;
+}
+
+/**
+  * @brief  Check a dump
+  * @param  dump  Dump
+  * @retval 1 if valid
+  */
+static uint8_t CRASH_IsValid(const CRASH_Dump_t *dump)
+{
+  return ((dump->magic == CRASH_MAGIC) && (dump->stackWords <= CRASH_STACK_WORDS) &&
+          (dump->checksum == CRASH_Checksum(dump))) ? 1U : 0U;
+}
@@ -0,0 +1,180 @@
+/**
+  ******************************************************************************
+  * @file    crash.h
+  * @brief   Crash capture interface
+  * @details This file contains the types and function prototypes of the
+  *          post-mortem capture. Faults, Error_Handler() and kernel asserts
+  *          store the CPU state, the fault status registers, the running
+  *          task and a snippet of its stack in the 4 KB backup SRAM and
+  *          reset at once. The dump survives the reset and is printed on
+  *          the next boot; tools/crash_decode symbolizes it with the ELF.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __CRASH_H__
+#define __CRASH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Capture causes; plain numbers, they are pasted into the trampoline asm */
+#define CRASH_CAUSE_NONE          0
+#define CRASH_CAUSE_HARDFAULT     1
+#define CRASH_CAUSE_MEMMANAGE     2
+#define CRASH_CAUSE_BUSFAULT      3
+#define CRASH_CAUSE_USAGEFAULT    4
+#define CRASH_CAUSE_ERROR         5     /* Error_Handler() */
+#define CRASH_CAUSE_ASSERT        6     /* configASSERT() */
+
+#define CRASH_TASK_NAME_LEN       16U
+#define CRASH_STACK_WORDS         768U  /* Stack snippet, from the faulting SP up */
+
+/* Exported macros -----------------------------------------------------------*/
+#define CRASH_STR(x)              #x
+#define CRASH_XSTR(x)             CRASH_STR(x)
+
+/**
+ * @brief   Body of a naked fault handler
+ * @details Passes the stacked frame (from MSP or PSP, per EXC_RETURN), the
+ *          EXC_RETURN value and the cause to CRASH_FaultEntry() without
+ *          touching the stack or r4-r11.
+ */
+#define CRASH_TRAMPOLINE(cause)                            \
+  __asm volatile("tst   lr, #4                      \n"    \
+                 "ite   eq                          \n"    \
+                 "mrseq r0, msp                     \n"    \
+                 "mrsne r0, psp                     \n"    \
+                 "mov   r1, lr                      \n"    \
+                 "movs  r2, #" CRASH_XSTR(cause) "  \n"    \
+                 "b     CRASH_FaultEntry            \n")
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Dump kept in the backup SRAM
+ */
+typedef struct
+{
+  uint32_t magic;                        /*!< CRASH_MAGIC when valid */
+  uint32_t checksum;                     /*!< Over the rest of the dump */
+  uint32_t count;                        /*!< Captures since the backup SRAM was cleared */
+  uint32_t reported;                     /*!< Printed after the reset */
+  uint32_t cause;                        /*!< CRASH_CAUSE_* */
+  uint32_t info;                         /*!< Assert line, 0 otherwise */
+  uint32_t uptimeMs;                     /*!< HAL tick at capture */
+  uint32_t frame[8];                     /*!< r0, r1, r2, r3, r12, lr, pc, xpsr */
+  uint32_t regs[8];                      /*!< r4 to r11 */
+  uint32_t sp;                           /*!< SP before the exception */
+  uint32_t excReturn;                    /*!< EXC_RETURN, 0 for software captures */
+  uint32_t msp;
+  uint32_t psp;
+  uint32_t cfsr;
+  uint32_t hfsr;
+  uint32_t mmfar;
+  uint32_t bfar;
+  uint32_t task;                         /*!< Running task handle, 0 outside the kernel */
+  char taskName[CRASH_TASK_NAME_LEN];    /*!< Running task name */
+  uint32_t stackWords;                   /*!< Words valid in stack[] */
+  uint32_t stack[CRASH_STACK_WORDS];     /*!< Stack from sp up */
+} CRASH_Dump_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Enables the capture
+ * @details Opens the backup SRAM, enables the MemManage, BusFault and
+ *          UsageFault handlers and latches the reset cause.
+ * @note    Call right after SYS_Init(); captures before still work
+ * @param   None
+ * @retval  None
+ */
+void CRASH_Init(void);
+
+/**
+ * @brief   Prints the dump of the previous run once
+ * @details Full register set, decoded fault status and the stack snippet,
+ *          one "CRASH" line each, as read by tools/crash_decode.
+ * @note    Thread context; printf() may wait for ring space
+ * @param   None
+ * @retval  None
+ */
+void CRASH_Report(void);
+
+/**
+ * @brief   Reads the last dump
+ * @param   None
+ * @retval  Dump in the backup SRAM, NULL if there is none
+ */
+const CRASH_Dump_t *CRASH_GetDump(void);
+
+/**
+ * @brief   Forgets the last dump
+ * @param   None
+ * @retval  None
+ */
+void CRASH_Clear(void);
+
+/**
+ * @brief   Name of a capture cause
+ * @param   cause  CRASH_CAUSE_*
+ * @retval  Constant string
+ */
+const char *CRASH_CauseName(uint32_t cause);
+
+/**
+ * @brief   Reset cause latched by CRASH_Init()
+ * @param   None
+ * @retval  Constant string
+ */
+const char *CRASH_ResetCause(void);
+
+/**
+ * @brief   Names of the CFSR and HFSR bits set
+ * @param   dump  Dump
+ * @param   text  Destination
+ * @param   size  Size of the destination
+ * @retval  None
+ */
+void CRASH_DecodeFault(const CRASH_Dump_t *dump, char *text, uint32_t size);
+
+/**
+ * @brief   Captures a software failure and resets
+ * @param   cause  CRASH_CAUSE_ERROR or CRASH_CAUSE_ASSERT
+ * @param   pc     Caller address
+ * @param   info   Cause specific value
+ * @retval  None
+ */
+void CRASH_Capture(uint32_t cause, uint32_t pc, uint32_t info) __attribute__((noreturn));
+
+/**
+ * @brief   configASSERT() failure
+ * @param   line  Source line of the assert
+ * @retval  None
+ */
+void CRASH_Assert(uint32_t line) __attribute__((noreturn));
+
+/**
+ * @brief   Faults on purpose, to check the capture
+ * @param   None
+ * @retval  None
+ */
+void CRASH_Test(void);
+
+/**
+ * @brief   Common fault entry, branched to by CRASH_TRAMPOLINE()
+ * @note    r0 = stacked frame, r1 = EXC_RETURN, r2 = cause
+ * @param   None
+ * @retval  None
+ */
+void CRASH_FaultEntry(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRASH_H__ */
@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file    dwt.c
+  * @brief   DWT cycle counter implementation
+  * @details This file provides the enable sequence and conversion helpers
+  *          for the DWT cycle counter.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dwt.h"
+
+/**
+  * @brief  DWT cycle counter initialization
+  * @details Enables trace (TRCENA), clears and starts CYCCNT. Safe to call
+  *          more than once.
+  * @param  None
+  * @retval None
+  */
+void DWT_Init(void)
+{
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) != 0U)
+  {
+    return;
+  }
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief  Convert cycles to microseconds
+  * @param  cycles  Number of cycles
+  * @retval Microseconds
+  */
+uint32_t DWT_CyclesToUs(uint32_t cycles)
+{
+  return (uint32_t)(((uint64_t)cycles * 1000000U) / SystemCoreClock);
+}
@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file    dwt.h
+  * @brief   DWT cycle counter interface
+  * @details This file contains the helpers around the Cortex-M4 DWT cycle
+  *          counter, used to time code sections with single-cycle
+  *          resolution for benchmarks and profiling.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __DWT_H__
+#define __DWT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Enables the DWT cycle counter
+ * @details Turns on trace in the core debug block and starts CYCCNT
+ * @param   None
+ * @retval  None
+ */
+void DWT_Init(void);
+
+/**
+ * @brief   Reads the current cycle count
+ * @note    Wraps every 2^32 cycles (about 25 s at 168 MHz)
+ * @param   None
+ * @retval  Cycle counter value
+ */
+static inline uint32_t DWT_GetCycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+/**
+ * @brief   Converts a cycle delta to microseconds at the current HCLK
+ * @param   cycles  Number of cycles
+ * @retval  Duration in microseconds
+ */
+uint32_t DWT_CyclesToUs(uint32_t cycles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DWT_H__ */
@@ -0,0 +1,69 @@
+/**
+  ******************************************************************************
+  * @file    mem_sections.h
+  * @brief   Memory placement helpers
+  * @details This file provides attribute macros that place objects in the
+  *          dedicated memory sections declared in STM32F429XX_FLASH.ld.
+  *          Objects placed with the _BSS and NOINIT macros are NOT zeroed
+  *          by the startup code and must be initialised explicitly before
+  *          use; CCM_DATA objects and RAMFUNC code are copied from flash
+  *          like .data.
+  *
+  *          Hot data that only the CPU touches (ISR state, DSP buffers,
+  *          rings not fed by DMA) goes to CCM RAM, which no DMA or LTDC
+  *          traffic contends for. Hot code goes to SRAM: CCM RAM is not on
+  *          the instruction bus. Library and HAL functions, which cannot be
+  *          tagged, are listed in hot_functions.ld instead.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __MEM_SECTIONS_H__
+#define __MEM_SECTIONS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+ * @brief   Place an uninitialised object in the 64 KB core-coupled RAM
+ * @note    CCM RAM is only reachable by the CPU data bus. Never use it for
+ *          DMA buffers.
+ */
+#define CCM_BSS     __attribute__((section(".ccmbss"), aligned(4)))
+
+/**
+ * @brief   Place an initialised object in the core-coupled RAM
+ * @note    The initial value costs the same amount of flash.
+ */
+#define CCM_DATA    __attribute__((section(".ccmram"), aligned(4)))
+
+/**
+ * @brief   Run a function from internal SRAM
+ * @details Zero wait states at any clock instead of the ART accelerator
+ *          hit or miss; calls from flash go through a linker veneer. Not
+ *          usable for code that runs before the startup copy (SystemInit()
+ *          and what it calls).
+ */
+#define RAMFUNC     __attribute__((section(".RamFunc"), noinline))
+
+/**
+ * @brief   Place an uninitialised object in the 8 MB external SDRAM
+ * @note    Only valid after FMC_Init() has completed.
+ */
+#define SDRAM_BSS   __attribute__((section(".sdram"), aligned(4)))
+
+/**
+ * @brief   Place an object in internal SRAM that survives a warm reset
+ * @note    Contents are undefined after power-on; protect them with a magic
+ *          value or checksum.
+ */
+#define NOINIT      __attribute__((section(".noinit"), aligned(4)))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEM_SECTIONS_H__ */
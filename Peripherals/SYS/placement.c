@@ -0,0 +1,309 @@
+/**
+  ******************************************************************************
+  * @file    placement.c
+  * @brief   Hot code and data placement report implementation
+  * @details This file provides the section sizes, the USART1 interrupt
+  *          accounting and the kernel benchmark.
+  *
+  *          The FIR kernel is compiled twice from one inline body, once in
+  *          flash and once as RAMFUNC, so both placements are timed in the
+  *          same build. The biquad is the CMSIS-DSP function the filter
+  *          chains run, timed wherever hot_functions.ld put it.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "placement.h"
+#include "dwt.h"
+#include "mem_sections.h"
+#include "arm_math.h"
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Kernel working set, one copy in SRAM and one in CCM RAM
+ */
+typedef struct
+{
+  float32_t in[PLACE_BENCH_BLOCK];
+  float32_t out[PLACE_BENCH_BLOCK];
+  float32_t firCoeffs[PLACE_BENCH_TAPS];
+  float32_t firState[PLACE_BENCH_BLOCK + PLACE_BENCH_TAPS - 1U];
+  float32_t biquadCoeffs[5U * PLACE_BENCH_STAGES];
+  float32_t biquadState[2U * PLACE_BENCH_STAGES];
+  arm_biquad_cascade_df2T_instance_f32 biquad;
+} PLACE_BenchData_t;
+
+typedef void (*PLACE_Kernel_t)(PLACE_BenchData_t *data);
+
+/* Private variables ---------------------------------------------------------*/
+extern uint8_t _sramfunc;       /* Symbols defined in the linker script */
+extern uint8_t _eramfunc;
+extern uint8_t _sccmram;
+extern uint8_t _eccmram;
+extern uint8_t _sccmbss;
+extern uint8_t _eccmbss;
+
+static PLACE_BenchData_t sramData;
+CCM_BSS static PLACE_BenchData_t ccmData;
+
+static volatile PLACE_IsrStats_t uartIsr = { .minCycles = UINT32_MAX };
+
+/* Private function prototypes -----------------------------------------------*/
+static void PLACE_Prepare(PLACE_BenchData_t *data);
+static void PLACE_Measure(PLACE_Kernel_t kernel, PLACE_BenchData_t *data, PLACE_Result_t *result);
+static void PLACE_FlushArt(void);
+static void PLACE_FirFlash(PLACE_BenchData_t *data) __attribute__((noinline));
+static void PLACE_FirRam(PLACE_BenchData_t *data) RAMFUNC;
+static void PLACE_Biquad(PLACE_BenchData_t *data) __attribute__((noinline));
+
+/**
+  * @brief  Read the memory used by the placement
+  * @param  info  Destination
+  * @retval None
+  */
+void PLACE_GetInfo(PLACE_Info_t *info)
+{
+  info->ramCodeBytes = (uint32_t)(&_eramfunc - &_sramfunc);
+  info->ccmDataBytes = (uint32_t)(&_eccmram - &_sccmram);
+  info->ccmBssBytes = (uint32_t)(&_eccmbss - &_sccmbss);
+  info->ccmFreeBytes = PLACE_CCM_BYTES - info->ccmDataBytes - info->ccmBssBytes;
+}
+
+/**
+  * @brief  Tell whether a function runs from SRAM
+  * @param  function  Function address
+  * @retval 1 if in .ramfunc
+  */
+uint8_t PLACE_RunsFromRam(uint32_t function)
+{
+  const uint32_t address = function & ~1UL;
+
+  return ((address >= (uint32_t)&_sramfunc) && (address < (uint32_t)&_eramfunc)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Account one USART1 interrupt
+  * @param  cycles  Cycles spent
+  * @retval None
+  */
+RAMFUNC void PLACE_RecordUartIsr(uint32_t cycles)
+{
+  uartIsr.count++;
+  uartIsr.totalCycles += cycles;
+  if (cycles < uartIsr.minCycles)
+  {
+    uartIsr.minCycles = cycles;
+  }
+  if (cycles > uartIsr.maxCycles)
+  {
+    uartIsr.maxCycles = cycles;
+  }
+}
+
+/**
+  * @brief  Read the USART1 interrupt cost
+  * @param  stats  Destination
+  * @retval None
+  */
+void PLACE_GetUartIsr(PLACE_IsrStats_t *stats)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  stats->count = uartIsr.count;
+  stats->minCycles = uartIsr.minCycles;
+  stats->maxCycles = uartIsr.maxCycles;
+  stats->totalCycles = uartIsr.totalCycles;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Restart the USART1 interrupt accounting
+  * @param  None
+  * @retval None
+  */
+void PLACE_ResetUartIsr(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  uartIsr.count = 0U;
+  uartIsr.minCycles = UINT32_MAX;
+  uartIsr.maxCycles = 0U;
+  uartIsr.totalCycles = 0U;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Time the kernels in every placement
+  * @param  results  PLACE_BENCH_ROWS rows
+  * @retval None
+  */
+void PLACE_Benchmark(PLACE_Result_t *results)
+{
+  const uint8_t biquadInRam = PLACE_RunsFromRam((uint32_t)&arm_biquad_cascade_df2T_f32);
+  static const struct
+  {
+    const char *kernel;
+    PLACE_Kernel_t function;
+    uint8_t codeInRam;          /*!< 2: wherever the linker put the library */
+    uint8_t dataInCcm;
+  } rows[PLACE_BENCH_ROWS] = {
+    { "fir32",   PLACE_FirFlash, 0U, 0U },
+    { "fir32",   PLACE_FirFlash, 0U, 1U },
+    { "fir32",   PLACE_FirRam,   1U, 0U },
+    { "fir32",   PLACE_FirRam,   1U, 1U },
+    { "biquad4", PLACE_Biquad,   2U, 0U },
+    { "biquad4", PLACE_Biquad,   2U, 1U },
+  };
+  uint32_t i;
+
+  DWT_Init();
+  PLACE_Prepare(&sramData);
+  PLACE_Prepare(&ccmData);
+
+  for (i = 0; i < PLACE_BENCH_ROWS; i++)
+  {
+    results[i].kernel = rows[i].kernel;
+    results[i].codeInRam = (rows[i].codeInRam == 2U) ? biquadInRam : rows[i].codeInRam;
+    results[i].dataInCcm = rows[i].dataInCcm;
+    PLACE_Measure(rows[i].function, rows[i].dataInCcm ? &ccmData : &sramData, &results[i]);
+  }
+}
+
+/**
+  * @brief  Fill a working set
+  * @details A 32-tap moving average and four identical stable sections;
+  *          the values only matter for keeping the FPU off denormals.
+  * @param  data  Working set
+  * @retval None
+  */
+static void PLACE_Prepare(PLACE_BenchData_t *data)
+{
+  static const float32_t section[5] = { 0.2f, 0.4f, 0.2f, 0.5f, -0.25f };
+  uint32_t i;
+
+  for (i = 0; i < PLACE_BENCH_BLOCK; i++)
+  {
+    data->in[i] = (float32_t)((int32_t)(i % 16U) - 8);
+  }
+  for (i = 0; i < PLACE_BENCH_TAPS; i++)
+  {
+    data->firCoeffs[i] = 1.0f / (float32_t)PLACE_BENCH_TAPS;
+  }
+  for (i = 0; i < (5U * PLACE_BENCH_STAGES); i++)
+  {
+    data->biquadCoeffs[i] = section[i % 5U];
+  }
+  arm_fill_f32(0.0f, data->firState, PLACE_BENCH_BLOCK + PLACE_BENCH_TAPS - 1U);
+  arm_biquad_cascade_df2T_init_f32(&data->biquad, PLACE_BENCH_STAGES, data->biquadCoeffs, data->biquadState);
+}
+
+/**
+  * @brief  Time one kernel, cold then warm
+  * @param  kernel  Kernel
+  * @param  data    Working set
+  * @param  result  Row to fill
+  * @retval None
+  */
+static void PLACE_Measure(PLACE_Kernel_t kernel, PLACE_BenchData_t *data, PLACE_Result_t *result)
+{
+  uint32_t primask;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t i;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  PLACE_FlushArt();
+  start = DWT_GetCycles();
+  kernel(data);
+  result->coldCycles = DWT_GetCycles() - start;
+
+  result->warmCycles = UINT32_MAX;
+  for (i = 0; i < PLACE_BENCH_RUNS; i++)
+  {
+    start = DWT_GetCycles();
+    kernel(data);
+    cycles = DWT_GetCycles() - start;
+    if (cycles < result->warmCycles)
+    {
+      result->warmCycles = cycles;
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Empty the ART instruction and data caches
+  * @details A cache can only be reset while disabled
+  * @param  None
+  * @retval None
+  */
+static void PLACE_FlushArt(void)
+{
+  __HAL_FLASH_INSTRUCTION_CACHE_DISABLE();
+  __HAL_FLASH_DATA_CACHE_DISABLE();
+  __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+  __HAL_FLASH_DATA_CACHE_RESET();
+  __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+  __HAL_FLASH_DATA_CACHE_ENABLE();
+}
+
+/**
+  * @brief  FIR over one block, the body of both placements
+  * @param  data  Working set
+  * @retval None
+  */
+static inline __attribute__((always_inline)) void PLACE_Fir(PLACE_BenchData_t *data)
+{
+  float32_t *const history = data->firState;
+  float32_t acc;
+  uint32_t n;
+  uint32_t k;
+
+  /* New samples after the PLACE_BENCH_TAPS - 1 kept from the last block */
+  for (n = 0; n < PLACE_BENCH_BLOCK; n++)
+  {
+    history[PLACE_BENCH_TAPS - 1U + n] = data->in[n];
+  }
+  for (n = 0; n < PLACE_BENCH_BLOCK; n++)
+  {
+    acc = 0.0f;
+    for (k = 0; k < PLACE_BENCH_TAPS; k++)
+    {
+      acc += history[n + k] * data->firCoeffs[k];
+    }
+    data->out[n] = acc;
+  }
+  for (k = 0; k < (PLACE_BENCH_TAPS - 1U); k++)
+  {
+    history[k] = history[PLACE_BENCH_BLOCK + k];
+  }
+}
+
+/**
+  * @brief  Kernels under test
+  * @param  data  Working set
+  * @retval None
+  */
+static void PLACE_FirFlash(PLACE_BenchData_t *data)
+{
+  PLACE_Fir(data);
+}
+
+static void PLACE_FirRam(PLACE_BenchData_t *data)
+{
+  PLACE_Fir(data);
+}
+
+static void PLACE_Biquad(PLACE_BenchData_t *data)
+{
+  arm_biquad_cascade_df2T_f32(&data->biquad, data->in, data->out, PLACE_BENCH_BLOCK);
+}
@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    placement.h
+  * @brief   Hot code and data placement report interface
+  * @details This file contains the report and the cycle benchmark of the
+  *          placement set up by mem_sections.h and hot_functions.ld:
+  *          - the SRAM code and CCM RAM the build uses
+  *          - the USART1 interrupt cost, measured on every interrupt
+  *          - FIR and biquad kernels timed with code in flash or SRAM and
+  *            data in SRAM or CCM RAM, cold (ART caches flushed) and warm
+  *
+  *          Code fetched from SRAM shares the bus matrix S-bus with SRAM
+  *          data and DMA, while flash code has the I-bus to itself and CCM
+  *          data the D-bus; the benchmark shows which pair wins for a
+  *          kernel. The before and after of the UART interrupt are two
+  *          builds, HOT_PLACEMENT=OFF and ON.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __PLACEMENT_H__
+#define __PLACEMENT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define PLACE_CCM_BYTES           (64U * 1024U)
+#define PLACE_BENCH_BLOCK         64U       /* Samples per kernel call */
+#define PLACE_BENCH_TAPS          32U       /* FIR taps */
+#define PLACE_BENCH_STAGES        4U        /* Biquad sections */
+#define PLACE_BENCH_RUNS          16U       /* Warm runs, the best is kept */
+#define PLACE_BENCH_ROWS          6U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Memory used by the placement
+ */
+typedef struct
+{
+  uint32_t ramCodeBytes;        /*!< .ramfunc: RAMFUNC and hot_functions.ld */
+  uint32_t ccmDataBytes;        /*!< .ccmram, CCM_DATA */
+  uint32_t ccmBssBytes;         /*!< .ccmbss, CCM_BSS */
+  uint32_t ccmFreeBytes;
+} PLACE_Info_t;
+
+/**
+ * @brief   USART1 interrupt cost, HAL_UART_IRQHandler() included
+ */
+typedef struct
+{
+  uint32_t count;
+  uint32_t minCycles;           /*!< One received byte, the path to compare */
+  uint32_t maxCycles;           /*!< Includes console commands run in the callback */
+  uint64_t totalCycles;
+} PLACE_IsrStats_t;
+
+/**
+ * @brief   Benchmark row
+ */
+typedef struct
+{
+  const char *kernel;
+  uint8_t codeInRam;
+  uint8_t dataInCcm;
+  uint32_t coldCycles;          /*!< First call after flushing the ART caches */
+  uint32_t warmCycles;          /*!< Best of PLACE_BENCH_RUNS calls */
+} PLACE_Result_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Reads the memory used by the placement
+ * @param   info  Destination
+ * @retval  None
+ */
+void PLACE_GetInfo(PLACE_Info_t *info);
+
+/**
+ * @brief   Whether a function runs from SRAM
+ * @param   function  Function address
+ * @retval  1 if it was linked into .ramfunc
+ */
+uint8_t PLACE_RunsFromRam(uint32_t function);
+
+/**
+ * @brief   Accounts one USART1 interrupt
+ * @note    Called from USART1_IRQHandler()
+ * @param   cycles  DWT cycles spent in the interrupt
+ * @retval  None
+ */
+void PLACE_RecordUartIsr(uint32_t cycles);
+
+/**
+ * @brief   Reads the USART1 interrupt cost
+ * @param   stats  Destination
+ * @retval  None
+ */
+void PLACE_GetUartIsr(PLACE_IsrStats_t *stats);
+
+/**
+ * @brief   Restarts the USART1 interrupt accounting
+ * @param   None
+ * @retval  None
+ */
+void PLACE_ResetUartIsr(void);
+
+/**
+ * @brief   Times the kernels in every placement
+ * @details Runs with interrupts masked for a few milliseconds.
+ * @param   results  PLACE_BENCH_ROWS rows
+ * @retval  None
+ */
+void PLACE_Benchmark(PLACE_Result_t *results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PLACEMENT_H__ */
@@ -0,0 +1,233 @@
+/**
+  ******************************************************************************
+  * @file    profiler.c
+  * @brief   Sampling profiler implementation
+  * @details This file provides the TIM7 sample clock and the address table.
+  *
+  *          The table is open addressed: an address hashes to a slot and
+  *          takes the first free one of the next PROF_PROBES, so a hot loop
+  *          spread over neighbouring addresses does not pile up on one
+  *          slot. Slots are never freed until the next PROF_Start().
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "profiler.h"
+#include "../TIM/tim.h"
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define PROF_HASH(pc)             ((((pc) >> 1) * 2654435761UL) >> (32U - PROF_SLOT_BITS))
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   Sampled addresses
+ * @details In SRAM: CCM RAM is taken by the DSP and display buffers, and
+ *          the profiler is not on a path worth the space.
+ */
+static PROF_Entry_t table[PROF_SLOTS];
+
+static volatile uint32_t samples;
+static volatile uint32_t dropped;
+static volatile uint32_t used;
+static uint32_t rate;
+static volatile uint8_t running;
+
+/**
+ * @brief   TIM7 handle, only for the kernel clock lookup
+ */
+static const TIM_HandleTypeDef htim7 = { .Instance = TIM7 };
+
+/* Private function prototypes -----------------------------------------------*/
+static void PROF_Configure(void);
+
+/**
+  * @brief  Clear the table and start sampling
+  * @param  rateHz  Sample rate
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PROF_Start(uint32_t rateHz)
+{
+  if ((rateHz == 0U) || (rateHz > PROF_RATE_MAX_HZ))
+  {
+    return HAL_ERROR;
+  }
+
+  PROF_Stop();
+  memset(table, 0, sizeof(table));
+  samples = 0U;
+  dropped = 0U;
+  used = 0U;
+  rate = rateHz;
+
+  __HAL_RCC_TIM7_CLK_ENABLE();
+  PROF_Configure();
+
+  HAL_NVIC_SetPriority(TIM7_IRQn, PROF_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(TIM7_IRQn);
+
+  running = 1U;
+  TIM7->DIER = TIM_DIER_UIE;
+  TIM7->CR1 = TIM_CR1_CEN;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop sampling
+  * @param  None
+  * @retval None
+  */
+void PROF_Stop(void)
+{
+  if (!running)
+  {
+    return;
+  }
+
+  TIM7->CR1 = 0U;
+  TIM7->DIER = 0U;
+  HAL_NVIC_DisableIRQ(TIM7_IRQn);
+  HAL_NVIC_ClearPendingIRQ(TIM7_IRQn);
+  running = 0U;
+}
+
+/**
+  * @brief  Reload the sample period for the current timer clock
+  * @param  None
+  * @retval None
+  */
+void PROF_UpdateClock(void)
+{
+  if (running)
+  {
+    PROF_Configure();
+  }
+}
+
+/**
+  * @brief  Read the statistics
+  * @param  stats  Destination
+  * @retval None
+  */
+void PROF_GetStats(PROF_Stats_t *stats)
+{
+  stats->samples = samples;
+  stats->dropped = dropped;
+  stats->used = used;
+  stats->rateHz = rate;
+  stats->running = running;
+}
+
+/**
+  * @brief  Find the next entry in use
+  * @param  slot   First slot to look at
+  * @param  entry  Destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PROF_GetEntry(uint32_t *slot, PROF_Entry_t *entry)
+{
+  uint32_t i;
+
+  for (i = *slot; i < PROF_SLOTS; i++)
+  {
+    if (table[i].count != 0U)
+    {
+      *entry = table[i];
+      *slot = i + 1U;
+      return HAL_OK;
+    }
+  }
+  *slot = PROF_SLOTS;
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Collect the most sampled addresses
+  * @param  top    Destination
+  * @param  count  Entries wanted
+  * @retval Entries written
+  */
+uint32_t PROF_GetTop(PROF_Entry_t *top, uint32_t count)
+{
+  uint32_t found = 0U;
+  uint32_t i;
+  uint32_t j;
+
+  if (count == 0U)
+  {
+    return 0U;
+  }
+
+  for (i = 0; i < PROF_SLOTS; i++)
+  {
+    const PROF_Entry_t entry = table[i];
+
+    if ((entry.count == 0U) || ((found == count) && (entry.count <= top[count - 1U].count)))
+    {
+      continue;
+    }
+    /* Insertion into the sorted list, the last one falls off when full */
+    j = (found < count) ? found++ : (count - 1U);
+    while ((j > 0U) && (top[j - 1U].count < entry.count))
+    {
+      top[j] = top[j - 1U];
+      j--;
+    }
+    top[j] = entry;
+  }
+  return found;
+}
+
+/**
+  * @brief  Count one sample
+  * @param  frame  Stacked exception frame
+  * @retval None
+  */
+void PROF_Sample(const uint32_t *frame)
+{
+  const uint32_t pc = frame[6] & ~1UL;
+  uint32_t slot = PROF_HASH(pc);
+  uint32_t i;
+
+  TIM7->SR = ~TIM_SR_UIF;
+
+  for (i = 0; i < PROF_PROBES; i++)
+  {
+    if (table[slot].pc == pc)
+    {
+      table[slot].count++;
+      samples++;
+      return;
+    }
+    if (table[slot].count == 0U)
+    {
+      table[slot].pc = pc;
+      table[slot].count = 1U;
+      used++;
+      samples++;
+      return;
+    }
+    slot = (slot + 1U) & (PROF_SLOTS - 1U);
+  }
+  dropped++;
+}
+
+/**
+  * @brief  Program the sample period
+  * @details The prescaler only grows when the period does not fit the 16
+  *          bits of TIM7, so the rate stays as exact as the clock allows.
+  * @param  None
+  * @retval None
+  */
+static void PROF_Configure(void)
+{
+  const uint32_t ticks = TIM_GetClockHz(&htim7) / rate;
+  const uint32_t prescaler = ticks / 65536U;
+
+  TIM7->PSC = prescaler;
+  TIM7->ARR = (ticks / (prescaler + 1U)) - 1U;
+  TIM7->EGR = TIM_EGR_UG;
+  TIM7->SR = ~TIM_SR_UIF;
+}
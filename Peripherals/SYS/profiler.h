@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    profiler.h
+  * @brief   Sampling profiler interface
+  * @details This file contains the PC sampling profiler that feeds the hot
+  *          code placement. TIM7 interrupts the CPU at a fixed rate and the
+  *          stacked PC of whatever was running is counted in a table of
+  *          sampled addresses; tools/hot_place/hot_place.py maps the dumped
+  *          table to functions through the ELF and writes hot_functions.ld.
+  *
+  *          The DWT PC sampler only reaches a debugger over SWO, so the
+  *          samples are taken in software. The sampler runs at priority 1:
+  *          handlers at priority 0 (the HAL tick) and code with
+  *          interrupts masked are never sampled, the latter shows up at the
+  *          instruction that unmasks.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define PROF_SLOT_BITS            9U
+#define PROF_SLOTS                (1UL << PROF_SLOT_BITS) /* Distinct addresses */
+#define PROF_PROBES               8U        /* Slots tried before a sample is dropped */
+#define PROF_RATE_DEFAULT_HZ      4999U     /* Prime, does not beat with the 1 kHz tick */
+#define PROF_RATE_MAX_HZ          50000U
+#define PROF_IRQ_PRIORITY         1U        /* Preempts all but priority 0 */
+
+/* Exported macros -----------------------------------------------------------*/
+/**
+ * @brief   Body of the naked TIM7_IRQHandler()
+ * @details Hands the stacked exception frame to PROF_Sample(), which returns
+ *          from the interrupt itself
+ */
+#define PROF_TRAMPOLINE()                                  \
+  __asm volatile("tst   lr, #4                      \n"    \
+                 "ite   eq                          \n"    \
+                 "mrseq r0, msp                     \n"    \
+                 "mrsne r0, psp                     \n"    \
+                 "b     PROF_Sample                 \n")
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Sampled address
+ */
+typedef struct
+{
+  uint32_t pc;                  /*!< Thumb bit cleared */
+  uint32_t count;
+} PROF_Entry_t;
+
+/**
+ * @brief   Profiler statistics
+ */
+typedef struct
+{
+  uint32_t samples;             /*!< Counted samples */
+  uint32_t dropped;             /*!< Samples lost to a full table */
+  uint32_t used;                /*!< Slots in use */
+  uint32_t rateHz;
+  uint8_t running;
+} PROF_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Clears the table and starts sampling
+ * @param   rateHz  Sample rate, 1 to PROF_RATE_MAX_HZ
+ * @retval  HAL_OK, HAL_ERROR for a rate out of range
+ */
+HAL_StatusTypeDef PROF_Start(uint32_t rateHz);
+
+/**
+ * @brief   Stops sampling, the table is kept
+ * @param   None
+ * @retval  None
+ */
+void PROF_Stop(void);
+
+/**
+ * @brief   Keeps the sample rate after a clock change
+ * @note    Called by the clock governor; does nothing while stopped
+ * @param   None
+ * @retval  None
+ */
+void PROF_UpdateClock(void);
+
+/**
+ * @brief   Reads the statistics
+ * @param   stats  Destination
+ * @retval  None
+ */
+void PROF_GetStats(PROF_Stats_t *stats);
+
+/**
+ * @brief   Walks the table
+ * @param   slot   First slot to look at, advanced past the entry found
+ * @param   entry  Destination
+ * @retval  HAL_OK, HAL_ERROR when no entry is left
+ */
+HAL_StatusTypeDef PROF_GetEntry(uint32_t *slot, PROF_Entry_t *entry);
+
+/**
+ * @brief   Most sampled addresses
+ * @param   top    Destination, most samples first
+ * @param   count  Entries wanted
+ * @retval  Entries written
+ */
+uint32_t PROF_GetTop(PROF_Entry_t *top, uint32_t count);
+
+/**
+ * @brief   Counts one sample, branched to by PROF_TRAMPOLINE()
+ * @param   frame  Stacked exception frame, the PC is word 6
+ * @retval  None
+ */
+void PROF_Sample(const uint32_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PROFILER_H__ */
@@ -11,6 +11,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "sys.h"
+#include "crash.h"
+#include "../BOOT/boot_time.h"
 
 /**
   * @brief  System Initialization Function
@@ -28,9 +30,11 @@ void SYS_Init(void)
 {
   /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
   HAL_Init();
+  BOOTTIME_Mark("HAL_Init");
 
   /* Configure the system clock */
   SystemClock_Config();
+  BOOTTIME_Mark("SystemClock_Config");
 }
 
 /**
@@ -44,7 +48,8 @@ void SYS_Init(void)
   *          - APB2 peripheral clock at 84 MHz (HCLK/2)
   *          - Power regulator output voltage scale 1 (highest performance)
   *
-  * @note   This configuration provides maximum CPU performance
+  * @note   This is the 168 MHz profile of the clock governor, which
+  *         switches profiles at run time (clock_gov.c)
   * @param  None
   * @retval None
   */
@@ -91,24 +96,17 @@ void SystemClock_Config(void)
 /**
   * @brief  Error Handler Function
   * @details This function is executed in case of error occurrence.
-  *          It implements a simple infinite loop with interrupts disabled
-  *          to prevent further execution when a critical error occurs.
+  *          The caller address and the CPU state are stored in the backup
+  *          SRAM and the MCU is reset; the dump is printed on the next boot
+  *          (see crash.c).
   *
-  * @note   This is a basic implementation. Consider adding:
-  *         - LED blinking for visual error indication
-  *         - Error code storage in a non-volatile memory
-  *         - Watchdog reset after a timeout
-  *         - Debug message output if debug interface is available
+  * @note   With a debugger attached the capture stops on a breakpoint
+  *         before the reset.
   *
   * @param  None
   * @retval None
   */
 void Error_Handler(void)
 {
-  /* User can add his own implementation to report the HAL error return state */
-  __disable_irq();               /* Disable all interrupts */
-  while (1)                      /* Enter infinite loop to prevent further execution */
-  {
-    /* Could add LED blinking code here for visual error indication */
-  }
+  CRASH_Capture(CRASH_CAUSE_ERROR, (uint32_t)__builtin_return_address(0), 0U);
 }
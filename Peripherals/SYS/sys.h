@@ -41,7 +41,7 @@ void SystemClock_Config(void);
 /**
  * @brief   Error handler function
  * @details Called when a critical error occurs during peripheral initialization
- *          or operation. Implements failsafe behavior.
+ *          or operation. Records a crash dump and resets the MCU.
  * @param   None
  * @retval  None
  */
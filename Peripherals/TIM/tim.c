@@ -22,18 +22,21 @@ TIM_HandleTypeDef htim1;
 
 /**
   * @brief  TIM Initialization Function
-  * @details Configures the TIM1 peripheral with the following settings:
-  *          - Prescaler: 0 (no division)
+  * @details Configures the TIM1 peripheral as the sample clock of the
+  *          acquisition scheduler:
+  *          - Prescaler: timer clock / 1 MHz (1 us per count)
   *          - Counter mode: Up-counting
-  *          - Period: 65535 (maximum for 16-bit timer)
+  *          - Period: TIM_SAMPLE_PERIOD_DEFAULT_US (1 kHz)
   *          - Clock division: No division
   *          - Repetition counter: 0 (no repetition)
-  *          - Auto-reload preload: Disabled
+  *          - Auto-reload preload: Enabled, so period changes apply at the
+  *            next update
   *          - Clock source: Internal clock
-  *          - Master/Slave mode: Disabled
+  *          - TRGO: Update event, to clock slave timers
+  *          - Channel 1: PWM 1 without output pin; its compare event is the
+  *            hardware trigger for ADC conversions
   *
-  * @note   TIM1 is an advanced timer commonly used for precise timing,
-  *         PWM generation, or input capture applications
+  * @note   The counter is not started here, see ACQ_Start()
   * @param  None
   * @retval None
   */
@@ -41,15 +44,16 @@ void TIM_Init(void)
 {
   TIM_ClockConfigTypeDef sClockSourceConfig = {0};  /* Clock source configuration */
   TIM_MasterConfigTypeDef sMasterConfig = {0};      /* Master mode configuration */
+  TIM_OC_InitTypeDef sConfigOC = {0};               /* Trigger channel configuration */
 
   /* TIM1 basic configuration */
   htim1.Instance = TIM1;                            /* Select TIM1 peripheral */
-  htim1.Init.Prescaler = 0;                         /* No prescaling (1:1) */
+  htim1.Init.Prescaler = (TIM_GetClockHz(&htim1) / TIM_TICK_HZ) - 1U; /* 1 MHz count */
   htim1.Init.CounterMode = TIM_COUNTERMODE_UP;      /* Up-counting mode */
-  htim1.Init.Period = 65535;                        /* Maximum period (16-bit) */
+  htim1.Init.Period = TIM_SAMPLE_PERIOD_DEFAULT_US - 1U; /* Sample period */
   htim1.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1; /* No clock division */
   htim1.Init.RepetitionCounter = 0;                 /* No repetition */
-  htim1.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE; /* Auto-reload preload disabled */
+  htim1.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE; /* Glitch free period changes */
 
   /* Initialize the timer base with the specified parameters */
   if (HAL_TIM_Base_Init(&htim1) != HAL_OK)
@@ -64,11 +68,77 @@ void TIM_Init(void)
     Error_Handler();  /* Call error handler if configuration fails */
   }
 
+  if (HAL_TIM_PWM_Init(&htim1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
   /* Configure the timer master mode */
-  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET; /* Reset trigger output (TRGO) */
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE; /* Update event on TRGO */
   sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE; /* No master/slave mode */
   if (HAL_TIMEx_MasterConfigSynchronization(&htim1, &sMasterConfig) != HAL_OK)
   {
     Error_Handler();  /* Call error handler if configuration fails */
   }
+
+  /* Channel 1 compare fires right after each update and triggers the ADC */
+  sConfigOC.OCMode = TIM_OCMODE_PWM1;
+  sConfigOC.Pulse = TIM_TRIGGER_PULSE_US;
+  sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+  sConfigOC.OCNPolarity = TIM_OCNPOLARITY_HIGH;
+  sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  sConfigOC.OCIdleState = TIM_OCIDLESTATE_RESET;
+  sConfigOC.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+  if (HAL_TIM_PWM_ConfigChannel(&htim1, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Timer kernel clock
+  * @details APB timers run at twice the bus clock whenever the APB prescaler
+  *          is not 1
+  * @param  htim  Timer handle with Instance set
+  * @retval Clock in Hz
+  */
+uint32_t TIM_GetClockHz(const TIM_HandleTypeDef *htim)
+{
+  RCC_ClkInitTypeDef clkConfig;
+  uint32_t flashLatency;
+  uint32_t pclk;
+  uint32_t divider;
+
+  HAL_RCC_GetClockConfig(&clkConfig, &flashLatency);
+
+  if ((htim->Instance == TIM1) || (htim->Instance == TIM8) || (htim->Instance == TIM9) ||
+      (htim->Instance == TIM10) || (htim->Instance == TIM11))
+  {
+    pclk = HAL_RCC_GetPCLK2Freq();
+    divider = clkConfig.APB2CLKDivider;
+  }
+  else
+  {
+    pclk = HAL_RCC_GetPCLK1Freq();
+    divider = clkConfig.APB1CLKDivider;
+  }
+
+  return (divider == RCC_HCLK_DIV1) ? pclk : (pclk * 2U);
+}
+
+/**
+  * @brief  Reload the TIM1 prescaler for the current timer clock
+  * @param  None
+  * @retval None
+  */
+void TIM_UpdateClock(void)
+{
+  if (htim1.State == HAL_TIM_STATE_RESET)
+  {
+    return;
+  }
+
+  /* No update event here, it would fire an extra ADC trigger */
+  htim1.Init.Prescaler = (TIM_GetClockHz(&htim1) / TIM_TICK_HZ) - 1U;
+  __HAL_TIM_SET_PRESCALER(&htim1, htim1.Init.Prescaler);
 }
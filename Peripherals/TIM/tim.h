@@ -21,6 +21,11 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 
+/* Exported constants --------------------------------------------------------*/
+#define TIM_TICK_HZ                   1000000U  /* TIM1 count rate */
+#define TIM_SAMPLE_PERIOD_DEFAULT_US  1000U     /* Default sample period */
+#define TIM_TRIGGER_PULSE_US          1U        /* CC1 trigger offset after update */
+
 /* Exported functions prototypes ---------------------------------------------*/
 /**
  * @brief   Initializes Timer peripheral used in the application
@@ -31,11 +36,26 @@ extern "C" {
  */
 void TIM_Init(void);
 
+/**
+ * @brief   Returns the kernel clock of a timer
+ * @param   htim  Timer handle with Instance set
+ * @retval  Clock in Hz
+ */
+uint32_t TIM_GetClockHz(const TIM_HandleTypeDef *htim);
+
+/**
+ * @brief   Keeps the TIM1 count at TIM_TICK_HZ after a clock change
+ * @details The prescaler is preloaded: the sample period running keeps the
+ *          old rate, the next ones are exact. Does nothing before TIM_Init().
+ * @param   None
+ * @retval  None
+ */
+void TIM_UpdateClock(void);
+
 /* Exported variables ---------------------------------------------------------*/
 /**
  * @brief   TIM1 handle structure
- * @details Used by HAL functions to manage TIM1 operations
- *          typically used for PWM generation, precise timing or capture
+ * @details Sample clock of the acquisition scheduler (ACQ module)
  */
 extern TIM_HandleTypeDef htim1;
 
@@ -0,0 +1,200 @@
+/**
+  ******************************************************************************
+  * @file    timebase.c
+  * @brief   Monotonic microsecond timebase implementation
+  * @details This file provides TIM2 setup, the overflow extension and the
+  *          lock free 64-bit read.
+  *
+  *          The high word is only ever incremented together with clearing
+  *          the update flag, inside one short PRIMASK section. A reader takes
+  *          the high word, the counter and the update flag, and retries if
+  *          the high word moved meanwhile. If the flag is still pending the
+  *          overflow has happened but was not accounted yet (the reader
+  *          preempted or masked the overflow interrupt); it is then added
+  *          when the counter value is from after the wrap, i.e. small.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "timebase.h"
+#include "tim.h"
+#include "cmsis_os.h"
+
+/* Private variables ---------------------------------------------------------*/
+/**
+ * @brief   TIM2 handle structure
+ */
+static TIM_HandleTypeDef htim2;
+
+/**
+ * @brief   Upper 32 bits of the clock, counts TIM2 wraps
+ */
+static volatile uint32_t overflows;
+
+/**
+  * @brief  Timebase initialization
+  * @details TIM2 counts up at TIMEBASE_TICK_HZ over the full 32-bit range.
+  *          Only the update interrupt is used; it fires every 71.6 minutes.
+  * @param  None
+  * @retval None
+  */
+void TIMEBASE_Init(void)
+{
+  __HAL_RCC_TIM2_CLK_ENABLE();
+
+  htim2.Instance = TIM2;
+  htim2.Init.Prescaler = (TIM_GetClockHz(&htim2) / TIMEBASE_TICK_HZ) - 1U;
+  htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim2.Init.Period = 0xFFFFFFFFU;
+  htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+
+  if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  /* HAL_TIM_Base_Init() generates an update event to load the prescaler */
+  overflows = 0U;
+  __HAL_TIM_CLEAR_FLAG(&htim2, TIM_FLAG_UPDATE);
+
+  HAL_NVIC_SetPriority(TIM2_IRQn, TIMEBASE_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
+  if (HAL_TIM_Base_Start_IT(&htim2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+/**
+  * @brief  Read the 64-bit clock
+  * @param  None
+  * @retval Microseconds since TIMEBASE_Init()
+  */
+uint64_t TIMEBASE_GetUs(void)
+{
+  uint32_t high;
+  uint32_t low;
+  uint32_t pending;
+
+  do
+  {
+    high = overflows;
+    low = TIM2->CNT;
+    pending = TIM2->SR & TIM_SR_UIF;
+  } while (high != overflows);
+
+  if ((pending != 0U) && (low < 0x80000000U))
+  {
+    high++;
+  }
+
+  return ((uint64_t)high << 32) | low;
+}
+
+/**
+  * @brief  Time since a timestamp
+  * @param  sinceUs  Earlier timestamp
+  * @retval Elapsed microseconds
+  */
+uint64_t TIMEBASE_ElapsedUs(uint64_t sinceUs)
+{
+  return TIMEBASE_GetUs() - sinceUs;
+}
+
+/**
+  * @brief  Deadline check
+  * @param  deadlineUs  Absolute time
+  * @retval 1 if passed
+  */
+uint8_t TIMEBASE_Expired(uint64_t deadlineUs)
+{
+  return (TIMEBASE_GetUs() >= deadlineUs) ? 1U : 0U;
+}
+
+/**
+  * @brief  Busy wait
+  * @details Uses the low word only; unsigned subtraction handles the wrap.
+  * @param  us  Delay in microseconds
+  * @retval None
+  */
+void TIMEBASE_DelayUs(uint32_t us)
+{
+  uint32_t start = TIMEBASE_GetUs32();
+
+  while ((TIMEBASE_GetUs32() - start) < us)
+  {
+  }
+}
+
+/**
+  * @brief  Microseconds to kernel ticks
+  * @param  us  Microseconds
+  * @retval Ticks, rounded up and saturated
+  */
+uint32_t TIMEBASE_UsToOsTicks(uint64_t us)
+{
+  uint64_t ticks = ((us * configTICK_RATE_HZ) + (TIMEBASE_TICK_HZ - 1U)) / TIMEBASE_TICK_HZ;
+
+  return (ticks > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)ticks;
+}
+
+/**
+  * @brief  Cycles to microseconds
+  * @details Split in whole seconds and remainder so the product cannot
+  *          overflow for any realistic cycle count.
+  * @param  cycles  Cycle count
+  * @retval Microseconds
+  */
+uint64_t TIMEBASE_CyclesToUs(uint64_t cycles)
+{
+  uint64_t hz = SystemCoreClock;
+
+  return ((cycles / hz) * TIMEBASE_TICK_HZ) + (((cycles % hz) * TIMEBASE_TICK_HZ) / hz);
+}
+
+/**
+  * @brief  Retime TIM2 after a clock change
+  * @details The update event that loads the prescaler also clears the
+  *          counter and raises the update flag; both are put right before
+  *          interrupts are enabled again.
+  * @param  nowUs  Current time
+  * @retval None
+  */
+void TIMEBASE_UpdateClock(uint64_t nowUs)
+{
+  htim2.Init.Prescaler = (TIM_GetClockHz(&htim2) / TIMEBASE_TICK_HZ) - 1U;
+  TIM2->PSC = htim2.Init.Prescaler;
+  TIM2->EGR = TIM_EGR_UG;
+  TIM2->SR = ~TIM_SR_UIF;
+  overflows = (uint32_t)(nowUs >> 32);
+  TIM2->CNT = (uint32_t)nowUs;
+}
+
+/**
+  * @brief  TIM2 overflow interrupt
+  * @details The flag is cleared and the high word incremented as one step,
+  *          so no reader can see the flag cleared with the old high word.
+  *          Bypasses HAL_TIM_IRQHandler(), which clears the flag before the
+  *          callback runs.
+  * @param  None
+  * @retval None
+  */
+void TIMEBASE_IrqHandler(void)
+{
+  uint32_t primask;
+
+  if ((TIM2->SR & TIM_SR_UIF) == 0U)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  TIM2->SR = ~TIM_SR_UIF;
+  overflows++;
+  __set_PRIMASK(primask);
+}
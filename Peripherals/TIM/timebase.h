@@ -0,0 +1,142 @@
+/**
+  ******************************************************************************
+  * @file    timebase.h
+  * @brief   Monotonic microsecond timebase interface
+  * @details This file contains the function prototypes of the system wide
+  *          microsecond clock. TIM2, the 32-bit general purpose timer, counts
+  *          at 1 MHz from TIMEBASE_Init() on and its overflow interrupt
+  *          extends the count to 64 bits, so the clock never wraps.
+  *
+  *          Reads take no lock and may be done from tasks and from interrupts
+  *          of any priority, including interrupts that preempt or mask the
+  *          overflow interrupt itself.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __TIMEBASE_H__
+#define __TIMEBASE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define TIMEBASE_TICK_HZ          1000000U  /* TIM2 count rate */
+#define TIMEBASE_IRQ_PRIORITY     5U        /* Highest FreeRTOS safe priority */
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Initializes TIM2 as a free running 1 MHz counter
+ * @details Enables the overflow interrupt. Safe to call before the
+ *          scheduler and before any other peripheral
+ * @param   None
+ * @retval  None
+ */
+void TIMEBASE_Init(void);
+
+/**
+ * @brief   Reads the 64-bit clock
+ * @details Lock free; safe from tasks and interrupts
+ * @param   None
+ * @retval  Microseconds since TIMEBASE_Init()
+ */
+uint64_t TIMEBASE_GetUs(void);
+
+/**
+ * @brief   Reads the low 32 bits of the clock
+ * @note    Wraps every 71.6 minutes; cheapest read, enough for deltas
+ * @param   None
+ * @retval  Microseconds since TIMEBASE_Init(), modulo 2^32
+ */
+static inline uint32_t TIMEBASE_GetUs32(void)
+{
+  return TIM2->CNT;
+}
+
+/**
+ * @brief   Microseconds elapsed since a timestamp
+ * @param   sinceUs  Earlier value of TIMEBASE_GetUs()
+ * @retval  Elapsed microseconds
+ */
+uint64_t TIMEBASE_ElapsedUs(uint64_t sinceUs);
+
+/**
+ * @brief   Checks a deadline
+ * @param   deadlineUs  Absolute time on this clock
+ * @retval  1 once the deadline has passed, 0 otherwise
+ */
+uint8_t TIMEBASE_Expired(uint64_t deadlineUs);
+
+/**
+ * @brief   Busy waits
+ * @note    For short hardware delays; use osDelay() for anything longer
+ *          than a tick
+ * @param   us  Delay in microseconds
+ * @retval  None
+ */
+void TIMEBASE_DelayUs(uint32_t us);
+
+/**
+ * @brief   Converts microseconds to milliseconds, rounding down
+ * @param   us  Microseconds
+ * @retval  Milliseconds
+ */
+static inline uint64_t TIMEBASE_UsToMs(uint64_t us)
+{
+  return us / 1000U;
+}
+
+/**
+ * @brief   Converts milliseconds to microseconds
+ * @param   ms  Milliseconds
+ * @retval  Microseconds
+ */
+static inline uint64_t TIMEBASE_MsToUs(uint64_t ms)
+{
+  return ms * 1000U;
+}
+
+/**
+ * @brief   Converts microseconds to RTOS ticks, rounding up
+ * @details Rounding up makes a timeout built from it never expire early
+ * @param   us  Microseconds
+ * @retval  Kernel ticks
+ */
+uint32_t TIMEBASE_UsToOsTicks(uint64_t us);
+
+/**
+ * @brief   Converts CPU cycles to microseconds at the current HCLK
+ * @param   cycles  Cycle count, e.g. a DWT delta
+ * @retval  Microseconds
+ */
+uint64_t TIMEBASE_CyclesToUs(uint64_t cycles);
+
+/**
+ * @brief   Retimes TIM2 after a clock change
+ * @details Loads the prescaler for the current timer clock and sets the
+ *          clock to nowUs, which the caller measured across the change
+ *          (TIM2 counts at a wrong rate meanwhile).
+ * @note    Call with interrupts disabled
+ * @param   nowUs  Current time
+ * @retval  None
+ */
+void TIMEBASE_UpdateClock(uint64_t nowUs);
+
+/**
+ * @brief   TIM2 overflow interrupt entry
+ * @note    Called from TIM2_IRQHandler()
+ * @param   None
+ * @retval  None
+ */
+void TIMEBASE_IrqHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TIMEBASE_H__ */
@@ -120,3 +120,29 @@ UART_Status_t UART_Receive(UART_Handle_t* handle, uint8_t* data, uint16_t size,
 {
     return UART_HandleMode(handle, data, size, timeout, false);
 }
+
+UART_Status_t UART_UpdateBaudRate(UART_Handle_t* handle)
+{
+    UART_HandleTypeDef* huart;
+    uint32_t pclk;
+
+    if (handle == NULL || handle->huart == NULL || !handle->isInitialized) {
+        return UART_ERROR;
+    }
+
+    /* Same computation as UART_SetConfig() in the HAL */
+    huart = handle->huart;
+    if (huart->Instance == USART1 || huart->Instance == USART6) {
+        pclk = HAL_RCC_GetPCLK2Freq();
+    } else {
+        pclk = HAL_RCC_GetPCLK1Freq();
+    }
+
+    if (huart->Init.OverSampling == UART_OVERSAMPLING_8) {
+        huart->Instance->BRR = UART_BRR_SAMPLING8(pclk, huart->Init.BaudRate);
+    } else {
+        huart->Instance->BRR = UART_BRR_SAMPLING16(pclk, huart->Init.BaudRate);
+    }
+
+    return UART_OK;
+}
@@ -15,11 +15,18 @@ extern "C" {
 #include <stdbool.h>
 #include <stdio.h>
 
+#ifndef ENABLE_DEBUG
 #define ENABLE_DEBUG 1
+#endif
 
 #if ENABLE_DEBUG
+    /* printf() takes newlib locks, so debug output from interrupt handlers is dropped */
     #define DEBUG_PRINT(fmt, ...) \
-        printf("[FILE: %s, LINE: %d] " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__)
+        do { \
+            if (__get_IPSR() == 0U) { \
+                printf("[FILE: %s, LINE: %d] " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__); \
+            } \
+        } while (0)
 #else
     #define DEBUG_PRINT(fmt, ...) \
         ((void)0)  // Does nothing
@@ -108,6 +115,15 @@ UART_Status_t UART_Transmit(UART_Handle_t* handle, uint8_t* data, uint16_t size,
  */
 UART_Status_t UART_Receive(UART_Handle_t* handle, uint8_t* data, uint16_t size, uint32_t timeout);
 
+/**
+ * @brief Reprogram the baud rate register for the current APB clock
+ * Only BRR is written, so a running DMA reception keeps going. A byte on
+ * the wire during the clock change may be lost.
+ * @param handle UART handle pointer
+ * @return UART_Status_t Status of operation
+ */
+UART_Status_t UART_UpdateBaudRate(UART_Handle_t* handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,58 @@
+/**
+ * @file uart_cmdline.c
+ * @brief Console line assembly for the UART command interface
+ */
+
+#include "uart_cmdline.h"
+#include <string.h>
+
+void UART_CmdLine_Init(UART_CmdLine_t* line, UART_CmdLine_Handler_t handler)
+{
+    memset(line, 0, sizeof(*line));
+    line->handler = handler;
+}
+
+void UART_CmdLine_Reset(UART_CmdLine_t* line)
+{
+    line->length = 0;
+    line->buffer[0] = '\0';
+}
+
+void UART_CmdLine_Feed(UART_CmdLine_t* line, const uint8_t* data, uint16_t size)
+{
+    for (uint16_t i = 0; i < size; i++) {
+        const uint8_t byte = data[i];
+
+        line->buffer[line->length++] = (char)byte;
+
+        /* Line ending, or no room left for the terminator after this byte */
+        if (byte == '\r' || byte == '\n' || line->length >= UART_CMDLINE_SIZE - 1) {
+            line->buffer[line->length] = '\0';
+            line->lines++;
+            DEBUG_PRINT("Received command: %s", line->buffer);
+            if (line->handler != NULL) {
+                line->handler(line->buffer);
+            }
+            line->length = 0;
+        }
+    }
+}
+
+uint32_t UART_CmdLine_Drain(UART_CmdLine_t* line, RingBuffer_t* ring)
+{
+    uint8_t chunk[64];  /* Not a line-sized copy: this runs on the interrupt stack */
+    uint32_t taken = 0;
+    uint32_t available;
+
+    while ((available = RingBuffer_Available(ring)) > 0) {
+        uint16_t n = (available < sizeof(chunk)) ? (uint16_t)available : (uint16_t)sizeof(chunk);
+
+        for (uint16_t i = 0; i < n; i++) {
+            RingBuffer_Get(ring, &chunk[i]);
+        }
+        UART_CmdLine_Feed(line, chunk, n);
+        taken += n;
+    }
+
+    return taken;
+}
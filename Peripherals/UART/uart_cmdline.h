@@ -0,0 +1,72 @@
+/**
+ * @file uart_cmdline.h
+ * @brief Console line assembly for the UART command interface
+ *
+ * Received bytes are collected into a line; a CR or LF, or a full line,
+ * hands it to the command handler. No HAL dependency, so it also builds
+ * on the host (tools/host_sim).
+ */
+
+#ifndef UART_CMDLINE_H
+#define UART_CMDLINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "uart.h"
+#include "uart_ring_buffer.h"
+
+#define UART_CMDLINE_SIZE  512  /* Match RX_BUFFER_SIZE */
+
+/**
+ * @brief Command handler, gets the line with its terminator
+ */
+typedef UART_Status_t (*UART_CmdLine_Handler_t)(const char* cmd);
+
+/**
+ * @brief Line being assembled
+ */
+typedef struct {
+    char buffer[UART_CMDLINE_SIZE];
+    uint16_t length;                 /*!< Bytes in buffer */
+    UART_CmdLine_Handler_t handler;  /*!< Called for every complete line */
+    uint32_t lines;                  /*!< Lines handed to the handler */
+} UART_CmdLine_t;
+
+/**
+ * @brief Initialize the line assembly
+ * @param line Line state
+ * @param handler Command handler
+ */
+void UART_CmdLine_Init(UART_CmdLine_t* line, UART_CmdLine_Handler_t handler);
+
+/**
+ * @brief Drop the line being assembled
+ * @param line Line state
+ */
+void UART_CmdLine_Reset(UART_CmdLine_t* line);
+
+/**
+ * @brief Add received bytes, running the handler for each complete line
+ * @note A line of UART_CMDLINE_SIZE - 1 bytes without terminator is handed
+ *       over as it is
+ * @param line Line state
+ * @param data Received bytes
+ * @param size Number of bytes
+ */
+void UART_CmdLine_Feed(UART_CmdLine_t* line, const uint8_t* data, uint16_t size);
+
+/**
+ * @brief Feed everything waiting in a ring buffer
+ * @param line Line state
+ * @param ring Ring buffer to empty
+ * @return uint32_t Number of bytes taken
+ */
+uint32_t UART_CmdLine_Drain(UART_CmdLine_t* line, RingBuffer_t* ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UART_CMDLINE_H */
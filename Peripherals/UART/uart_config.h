@@ -34,6 +34,10 @@ extern "C" {
 #define UART_DMA_TX_STREAM       DMA2_Stream7
 #define UART_DMA_RX_STREAM       DMA2_Stream5
 
+/* USART1 and DMA stream interrupts: the callbacks wake FreeRTOS tasks
+   (bridge, stdout), so not above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY */
+#define UART_IRQ_PRIORITY        5
+
 /* Global DMA handles */
 extern DMA_HandleTypeDef hdma_uart1_tx;
 extern DMA_HandleTypeDef hdma_uart1_rx;
@@ -15,6 +15,9 @@ extern UART_Handle_t uartHandle;  // Define this in uart.c
 DMA_HandleTypeDef hdma_uart1_tx;
 DMA_HandleTypeDef hdma_uart1_rx;
 
+/* Event callback of the continuous reception, NULL for the console */
+static volatile UART_RxEventCallback_t rxEventCallback;
+
 UART_Status_t UART_DMA_Init(UART_Handle_t* handle)
 {
     if (handle == NULL || handle->huart == NULL) {
@@ -64,9 +67,9 @@ UART_Status_t UART_DMA_Init(UART_Handle_t* handle)
     __HAL_LINKDMA(handle->huart, hdmarx, hdma_uart1_rx);
 
     /* DMA interrupt configuration */
-    HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, 2, 0);
+    HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, UART_IRQ_PRIORITY, 0);
     HAL_NVIC_EnableIRQ(DMA2_Stream7_IRQn);
-    HAL_NVIC_SetPriority(DMA2_Stream5_IRQn, 2, 0);
+    HAL_NVIC_SetPriority(DMA2_Stream5_IRQn, UART_IRQ_PRIORITY, 0);
     HAL_NVIC_EnableIRQ(DMA2_Stream5_IRQn);
 
     __HAL_UART_ENABLE_IT(handle->huart, UART_IT_RXNE); // Enable Receive Data Register Not Empty interrupt
@@ -107,6 +110,9 @@ UART_Status_t UART_DMA_Transmit(UART_Handle_t* handle, uint8_t* data, uint16_t s
 
 UART_Status_t UART_DMA_Receive(UART_Handle_t* handle, uint8_t* data, uint16_t size, uint32_t timeout)
 {
+    /* Reception runs in the background into the ring buffer, nothing waits */
+    (void)timeout;
+
     if (handle == NULL || handle->huart == NULL || data == NULL || size == 0) {
         DEBUG_PRINT("DMA UART handle, huart, data is NULL or size is 0");
         return UART_ERROR;
@@ -117,6 +123,9 @@ UART_Status_t UART_DMA_Receive(UART_Handle_t* handle, uint8_t* data, uint16_t si
         return UART_ERROR;
     }
 
+    /* Back to the console: no more events for the continuous reception */
+    rxEventCallback = NULL;
+
     /* Start the DMA transfer */
     HAL_StatusTypeDef status = HAL_UART_Receive_DMA(handle->huart, handle->rxBuffer, handle->rxSize);
     if (status != HAL_OK) {
@@ -147,6 +156,32 @@ UART_Status_t UART_DMA_Receive(UART_Handle_t* handle, uint8_t* data, uint16_t si
     return UART_OK;
 }
 
+UART_Status_t UART_DMA_ReceiveToIdle(UART_Handle_t* handle, uint8_t* buffer, uint16_t size,
+                                     UART_RxEventCallback_t callback)
+{
+    if (handle == NULL || handle->huart == NULL || buffer == NULL || size == 0 || callback == NULL) {
+        DEBUG_PRINT("DMA UART handle, huart, buffer, callback is NULL or size is 0");
+        return UART_ERROR;
+    }
+
+    if (handle->huart->hdmarx == NULL || handle->huart->hdmarx->Init.Mode != DMA_CIRCULAR) {
+        DEBUG_PRINT("Continuous reception needs the circular RX DMA");
+        return UART_ERROR;
+    }
+
+    /* Drop the command reception of the console, if any */
+    (void)HAL_UART_AbortReceive(handle->huart);
+
+    rxEventCallback = callback;
+    if (HAL_UARTEx_ReceiveToIdle_DMA(handle->huart, buffer, size) != HAL_OK) {
+        rxEventCallback = NULL;
+        DEBUG_PRINT("DMA UART continuous reception failed");
+        return UART_ERROR;
+    }
+
+    return UART_OK;
+}
+
 /* UART Reception Complete Callback */
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
@@ -166,25 +201,34 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
         if (pos > 0) {
             DEBUG_PRINT("Received %d bytes in DMA mode", pos);
             UART_RingBuffer_PutData(huart->pRxBuffPtr, pos);
-            UART_Example_PreProcess(&uartHandle);
             /* Restart DMA reception */
             HAL_UART_Receive_DMA(huart, uartHandle.rxBuffer, uartHandle.rxSize);
         }
 
     } else if (uartHandle.config.mode == UART_MODE_INTERRUPT) {
-        /* In interrupt mode, receive one byte at a time */
+        /* In interrupt mode, receive one byte at a time; the HAL has moved
+           pRxBuffPtr past the byte, so go by the buffer it was started with */
         DEBUG_PRINT("Received 1 byte in Interrupt mode");
-        UART_RingBuffer_PutData(huart->pRxBuffPtr, 1);
-        UART_Example_PreProcess(&uartHandle);
+        UART_RingBuffer_PutData(uartHandle.rxBuffer, 1);
 
         /* Restart reception for next byte */
-        HAL_UART_Receive_IT(huart, huart->pRxBuffPtr, 1);
+        HAL_UART_Receive_IT(huart, uartHandle.rxBuffer, 1);
     }
 
-    /* Set reception complete flag */
+    /* Lines are assembled and run by the console task, not here */
     rxComplete = 1;
 }
 
+/* UART reception event callback (half, full or idle line, continuous reception) */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+    UART_RxEventCallback_t callback = rxEventCallback;
+
+    if (callback != NULL) {
+        callback(huart, Size);
+    }
+}
+
 /**
  * @brief DMA error callback
  * @param huart UART handle pointer
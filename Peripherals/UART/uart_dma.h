@@ -13,6 +13,13 @@ extern "C" {
 #include "uart.h"
 #include "uart_config.h"
 
+/**
+ * @brief Reception event callback of the continuous reception
+ * @param huart UART handle pointer
+ * @param size Write position of the DMA in the buffer
+ */
+typedef void (*UART_RxEventCallback_t)(UART_HandleTypeDef* huart, uint16_t size);
+
 /**
  * @brief Initialize UART DMA mode
  * @param handle UART handle pointer
@@ -40,6 +47,20 @@ UART_Status_t UART_DMA_Transmit(UART_Handle_t* handle, uint8_t* data, uint16_t s
  */
 UART_Status_t UART_DMA_Receive(UART_Handle_t* handle, uint8_t* data, uint16_t size, uint32_t timeout);
 
+/**
+ * @brief Start continuous reception into a circular buffer
+ * @note  The DMA keeps writing around the buffer; the callback gets the write
+ *        position on the half, full and idle line events, in interrupt
+ *        context, until UART_DMA_Receive() gives the UART back to the console
+ * @param handle UART handle pointer
+ * @param buffer Circular buffer (not in CCM RAM, the DMA cannot reach it)
+ * @param size Size of the buffer
+ * @param callback Reception event callback
+ * @return UART_Status_t Status of operation
+ */
+UART_Status_t UART_DMA_ReceiveToIdle(UART_Handle_t* handle, uint8_t* buffer, uint16_t size,
+                                     UART_RxEventCallback_t callback);
+
 
 #ifdef __cplusplus
 }
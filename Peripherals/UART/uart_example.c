@@ -7,8 +7,32 @@
 #include "stm32f4xx_hal_uart.h"
 #include "uart_config.h"
 #include "uart_blocking.h"
+#include "cmsis_os.h"
+#include "uart_cmdline.h"
+#include "heap_trace.h"
+#include "stdio_retarget.h"
+#include "l3gd20.h"
+#include "ahrs.h"
+#include "spi_bus.h"
+#include "i2c_bus.h"
+#include "stmpe811.h"
+#include "acq.h"
+#include "dsp_chain.h"
+#include "spectrum.h"
+#include "motion.h"
+#include "cdc_stream.h"
+#include "rtos.h"
+#include "logger.h"
+#include "bridge.h"
+#include "crash.h"
+#include "boot_time.h"
+#include "boot_init.h"
+#include "clock_gov.h"
+#include "profiler.h"
+#include "placement.h"
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 /* Constants for UART configuration */
 #define STATUS_MSG_SIZE          256   /* Maximum size for status message */
@@ -22,9 +46,10 @@ static uint8_t txBuffer[TX_BUFFER_SIZE];
 volatile uint8_t rxComplete = 0;
 volatile uint8_t txComplete = 0;
 
-/* Buffer management for improved reception */
-static uint16_t rxIndex = 0;
-static uint8_t cmdBuffer[RX_BUFFER_SIZE];
+/* Command line being assembled */
+static UART_CmdLine_t cmdLine;
+/* Set by the error callback: the console task drops the partial line */
+static volatile uint8_t rxLineDropped = 0;
 
 /* Welcome message */
 static const char* welcomeMsg = ANSI_COLOR_CYAN
@@ -37,6 +62,27 @@ static const char* welcomeMsg = ANSI_COLOR_CYAN
     "  int    - Send using Interrupts\r\n"
     "  block  - Send using Blocking mode\r\n"
     "  echo   - Echo back received text\r\n"
+    "  heap   - Heap report (heap mark: start leak window)\r\n"
+    "  sink   - stdout sink: sink swo|uart|usb\r\n"
+    "  bench  - printf throughput benchmark\r\n"
+    "  gyro   - Gyroscope rate and driver load\r\n"
+    "  ahrs   - Attitude and filter cost\r\n"
+    "  spi    - SPI bus queue statistics\r\n"
+    "  i2c    - I2C bus statistics and latency\r\n"
+    "  touch  - Touch statistics and gestures\r\n"
+    "  acq    - Timed acquisition statistics\r\n"
+    "  dsp    - Filter chain outputs and cost\r\n"
+    "  fft    - Spectrum: fft [bench|stream on|off|size|avg|overlap|axis N]\r\n"
+    "  motion - Motion classes, inference cost and memory\r\n"
+    "  cdc    - USB CDC stream (cdc bench KB: throughput)\r\n"
+    "  cpu    - CPU load and idle time\r\n"
+    "  log    - Logger on the RAM disk (log ram, log stop, log bench [KB])\r\n"
+    "  bridge - UART-USB bridge (bridge on [BAUD] [xon], +++ to leave)\r\n"
+    "  crash  - Last crash dump (crash clear, crash test: fault now)\r\n"
+    "  boot   - Boot stage times (boot init: deferred peripherals)\r\n"
+    "  clock  - CPU clock profile (clock 180|168|84|48, clock bench)\r\n"
+    "  prof   - PC profiler (prof start [HZ], prof stop, prof dump [SLOT])\r\n"
+    "  place  - Hot code placement, UART ISR cost (place bench|reset)\r\n"
     "================================="
     ANSI_COLOR_RESET "\r\n> ";
 
@@ -52,10 +98,10 @@ static void UART_Example_InitStructures(void)
     /* Initialize buffers */
     memset(rxBuffer, 0, RX_BUFFER_SIZE);
     memset(txBuffer, 0, TX_BUFFER_SIZE);
-    memset(cmdBuffer, 0, RX_BUFFER_SIZE);
 
-    rxIndex = 0;
+    UART_CmdLine_Init(&cmdLine, UART_Example_ProcessCommand);
     rxComplete = 0;
+    rxLineDropped = 0;
     txComplete = 0;
 }
 
@@ -106,7 +152,9 @@ UART_Status_t UART_Example_Init(void)
 }
 
 /**
- * @brief Efficient UART receive callback handling multiple characters
+ * @brief Runs the complete lines received so far
+ * @note  Called from the console task only: the RX callbacks just fill the
+ *        ring and set rxComplete, since commands may block or do file I/O
  * @param handle UART handle
  */
 void UART_Example_PreProcess(UART_Handle_t* handle)
@@ -116,49 +164,13 @@ void UART_Example_PreProcess(UART_Handle_t* handle)
         return;
     }
 
-    uint8_t tempBuf[RX_BUFFER_SIZE];
-    uint16_t bytesAvailable = RingBuffer_Available(&rxRingBuffer);
-
-    if (bytesAvailable == 0) {
+    if (RingBuffer_Available(&rxRingBuffer) == 0) {
         DEBUG_PRINT("No data available");
         return;
     }
 
-    /* Get data from ring buffer */
-    if (UART_RingBuffer_Receive(handle, tempBuf, bytesAvailable) != UART_OK) {
-        DEBUG_PRINT("Failed to get data from ring buffer");
-        return;
-    }
-
-    /* Process each received byte */
-    for (uint16_t i = 0; i < bytesAvailable; i++) {
-        /* Add byte to command buffer if there's space */
-        if (rxIndex < RX_BUFFER_SIZE - 1) {
-            cmdBuffer[rxIndex++] = tempBuf[i];
-
-            /* Check for line ending */
-            if (tempBuf[i] == '\r' || tempBuf[i] == '\n' || rxIndex >= RX_BUFFER_SIZE - 1) {
-                /* Null terminate the string */
-                cmdBuffer[rxIndex] = '\0';
-
-                /* Only process if we have actual content */
-                if (rxIndex > 0) {
-                    DEBUG_PRINT("Received command: %s", cmdBuffer);
-                    UART_Example_ProcessCommand((char*)cmdBuffer);
-                }
-
-                /* Reset buffer index */
-                rxIndex = 0;
-                memset(cmdBuffer, 0, RX_BUFFER_SIZE);
-            }
-        } else {
-            /* Buffer full, reset */
-            rxIndex = 0;
-            memset(cmdBuffer, 0, RX_BUFFER_SIZE);
-        }
-    }
-
-    rxComplete = 0;
+    /* Complete lines go to UART_Example_ProcessCommand() */
+    UART_CmdLine_Drain(&cmdLine, &rxRingBuffer);
 }
 
 /**
@@ -173,6 +185,12 @@ UART_Status_t UART_Example_ProcessCommand(const char* cmd)
         return UART_ERROR;
     }
 
+    /* Commands block (log bench, log stop) or do file I/O: never in a handler */
+    if (__get_IPSR() != 0U) {
+        DEBUG_PRINT("Command rejected in interrupt context");
+        return UART_ERROR;
+    }
+
     /* Remove CR/LF and create clean command */
     char cleanCmd[RX_BUFFER_SIZE];
     size_t cmdLen = strlen(cmd);
@@ -268,6 +286,726 @@ UART_Status_t UART_Example_ProcessCommand(const char* cmd)
         return UART_Example_SendMessage(ANSI_COLOR_GREEN "Switched to Blocking mode\r\n" ANSI_COLOR_RESET "> ");
     }
 
+    if (strcmp(cleanCmd, CMD_HEAP) == 0) {
+        HEAPTRACE_Report();
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Heap report printed\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strcmp(cleanCmd, CMD_HEAP " mark") == 0) {
+        HEAPTRACE_Mark();
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Leak window started\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strncmp(cleanCmd, CMD_SINK " ", sizeof(CMD_SINK)) == 0) {
+        const char* name = cleanCmd + sizeof(CMD_SINK);
+        for (int sink = 0; sink < (int)STDIO_SINK_COUNT; sink++) {
+            if (strcmp(name, STDIO_SinkName((STDIO_Sink_t)sink)) == 0) {
+                STDIO_SetSink((STDIO_Sink_t)sink);
+                return UART_Example_SendMessage(ANSI_COLOR_GREEN "stdout sink changed\r\n" ANSI_COLOR_RESET "> ");
+            }
+        }
+        return UART_Example_SendMessage(ANSI_COLOR_RED "Unknown sink\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strcmp(cleanCmd, CMD_BENCH) == 0) {
+        STDIO_Benchmark(200);
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Benchmark done\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strcmp(cleanCmd, CMD_GYRO) == 0) {
+        L3GD20_Sample_t sample = {0};
+        L3GD20_Stats_t gyroStats;
+        uint32_t load = L3GD20_GetCpuLoad();
+        char gyroMsg[STATUS_MSG_SIZE];
+
+        L3GD20_GetStats(&gyroStats);
+        (void)L3GD20_GetLatest(&sample);
+        snprintf(gyroMsg, sizeof(gyroMsg),
+            ANSI_COLOR_GREEN "\r\nGyro: x=%d y=%d z=%d mdps\r\n"
+            "Samples: %lu in %lu bursts, overruns %lu, skips %lu, errors %lu\r\n"
+            "CPU load: %lu.%02lu%%\r\n" ANSI_COLOR_RESET "> ",
+            (int)(sample.x * 1000.0f), (int)(sample.y * 1000.0f), (int)(sample.z * 1000.0f),
+            (unsigned long)gyroStats.samples, (unsigned long)gyroStats.bursts,
+            (unsigned long)gyroStats.overruns, (unsigned long)gyroStats.busySkips,
+            (unsigned long)gyroStats.errors,
+            (unsigned long)(load / 100U), (unsigned long)(load % 100U));
+        return UART_Example_SendMessage(gyroMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_AHRS) == 0) {
+        AHRS_Attitude_t attitude = {0};
+        AHRS_Stats_t ahrsStats;
+        char ahrsMsg[STATUS_MSG_SIZE];
+
+        AHRS_GetStats(&ahrsStats);
+        (void)AHRS_GetAttitude(&attitude);
+        snprintf(ahrsMsg, sizeof(ahrsMsg),
+            ANSI_COLOR_GREEN "\r\nAttitude: roll=%d pitch=%d yaw=%d cdeg\r\n"
+            "Updates: %lu, dropped %lu, bias %s\r\n"
+            "Cycles/update: last %lu, avg %lu, max %lu\r\n" ANSI_COLOR_RESET "> ",
+            (int)(attitude.euler.roll * (18000.0f / PI)),
+            (int)(attitude.euler.pitch * (18000.0f / PI)),
+            (int)(attitude.euler.yaw * (18000.0f / PI)),
+            (unsigned long)ahrsStats.updates, (unsigned long)ahrsStats.dropped,
+            ahrsStats.biasValid ? "calibrated" : "calibrating",
+            (unsigned long)ahrsStats.cyclesLast, (unsigned long)ahrsStats.cyclesAvg,
+            (unsigned long)ahrsStats.cyclesMax);
+        return UART_Example_SendMessage(ahrsMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_SPI) == 0) {
+        SPIBUS_Stats_t busStats;
+        uint32_t util = SPIBUS_GetUtilization();
+        char busMsg[STATUS_MSG_SIZE];
+
+        SPIBUS_GetStats(&busStats);
+        snprintf(busMsg, sizeof(busMsg),
+            ANSI_COLOR_GREEN "\r\nSPI5: %lu DMA + %lu polled transfers, %lu bytes, %lu errors\r\n"
+            "Queue: %lu waiting, peak %lu, reconfigs %lu\r\n"
+            "Utilization: %lu.%02lu%%\r\n" ANSI_COLOR_RESET "> ",
+            (unsigned long)busStats.transactions, (unsigned long)busStats.blocking,
+            (unsigned long)busStats.bytes, (unsigned long)busStats.errors,
+            (unsigned long)busStats.queueDepth, (unsigned long)busStats.queuePeak,
+            (unsigned long)busStats.reconfigs,
+            (unsigned long)(util / 100U), (unsigned long)(util % 100U));
+        return UART_Example_SendMessage(busMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_I2C) == 0) {
+        I2CBUS_Stats_t busStats;
+        I2CBUS_DeviceStats_t dev;
+        char busMsg[TX_BUFFER_SIZE - 1];
+        const size_t room = sizeof(busMsg) - sizeof(ANSI_COLOR_RESET "> ");
+        int len;
+
+        I2CBUS_GetStats(&busStats);
+        len = snprintf(busMsg, sizeof(busMsg),
+            ANSI_COLOR_GREEN "\r\nI2C3: %lu ok (%lu DMA), %lu errors (%lu NACK), %lu recoveries, queue peak %lu\r\n",
+            (unsigned long)busStats.transactions, (unsigned long)busStats.dmaTransfers,
+            (unsigned long)busStats.errors, (unsigned long)busStats.nacks,
+            (unsigned long)busStats.recoveries, (unsigned long)busStats.queuePeak);
+        for (uint32_t i = 0; (i < I2CBUS_MAX_DEVICES) && (len > 0) && ((size_t)len < room); i++) {
+            if (I2CBUS_GetDeviceStats(i, &dev) == HAL_OK) {
+                len += snprintf(busMsg + len, room - (size_t)len,
+                    "  0x%02X: %lu xfers, %lu err, avg %lu us, max %lu us\r\n",
+                    dev.address, (unsigned long)dev.transfers, (unsigned long)dev.errors,
+                    (unsigned long)(dev.transfers ? dev.totalUs / dev.transfers : 0U),
+                    (unsigned long)dev.maxUs);
+            }
+        }
+        if ((size_t)len >= room) {
+            len = (int)room - 1;
+        }
+        strcpy(busMsg + len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(busMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_TOUCH) == 0) {
+        STMPE811_Stats_t touchStats;
+        TOUCH_Event_t event;
+        osMessageQueueId_t queue = STMPE811_GetEventQueue();
+        char touchMsg[TX_BUFFER_SIZE - 1];
+        const size_t room = sizeof(touchMsg) - sizeof(ANSI_COLOR_RESET "> ");
+        int len;
+
+        STMPE811_GetStats(&touchStats);
+        len = snprintf(touchMsg, sizeof(touchMsg),
+            ANSI_COLOR_GREEN "\r\nTouch: %lu irqs, %lu samples in %lu batches, %lu overflows\r\n"
+            "Events: %lu posted, %lu dropped, %lu errors\r\n",
+            (unsigned long)touchStats.interrupts, (unsigned long)touchStats.samples,
+            (unsigned long)touchStats.batches, (unsigned long)touchStats.overflows,
+            (unsigned long)touchStats.events, (unsigned long)touchStats.dropped,
+            (unsigned long)touchStats.errors);
+
+        /* The console is the consumer of the gesture queue */
+        while ((queue != NULL) && (len > 0) && ((size_t)len < room) &&
+               (osMessageQueueGet(queue, &event, NULL, 0U) == osOK)) {
+            len += snprintf(touchMsg + len, room - (size_t)len,
+                "  %lu ms %s (%d,%d) d(%d,%d)\r\n",
+                (unsigned long)event.timestampMs, STMPE811_EventName(event.type),
+                event.x, event.y, event.dx, event.dy);
+        }
+        if ((size_t)len >= room) {
+            len = (int)room - 1;
+        }
+        strcpy(touchMsg + len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(touchMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_ACQ) == 0) {
+        ACQ_Stats_t acqStats;
+        ACQ_Sample_t sample = {0};
+        int32_t temp = 0;
+        char acqMsg[STATUS_MSG_SIZE];
+
+        ACQ_GetStats(&acqStats);
+        if (ACQ_GetLatest(&sample) == HAL_OK) {
+            temp = ACQ_ToCentiCelsius(&sample);
+        }
+        snprintf(acqMsg, sizeof(acqMsg),
+            ANSI_COLOR_GREEN "\r\nACQ: period %lu us, %lu samples in %lu blocks, %lu ADC errors (%lu lost)\r\n"
+            "Ticks: %lu, jobs %lu, latency %lu us (max %lu us)\r\n"
+            "Die temperature: %ld.%02ld C\r\n" ANSI_COLOR_RESET "> ",
+            (unsigned long)acqStats.periodUs, (unsigned long)acqStats.samples,
+            (unsigned long)acqStats.blocks, (unsigned long)acqStats.adcErrors,
+            (unsigned long)acqStats.samplesLost,
+            (unsigned long)acqStats.ticks, (unsigned long)acqStats.jobRuns,
+            (unsigned long)acqStats.latencyLastUs, (unsigned long)acqStats.latencyMaxUs,
+            (long)(temp / 100), (long)((temp < 0 ? -temp : temp) % 100));
+        return UART_Example_SendMessage(acqMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_DSP) == 0) {
+        DSPCHAIN_Stats_t chainStats;
+        char chainMsg[TX_BUFFER_SIZE - 1];
+        const size_t room = sizeof(chainMsg) - sizeof(ANSI_COLOR_RESET "> ");
+        int32_t centi;
+        int len;
+
+        len = snprintf(chainMsg, sizeof(chainMsg),
+            ANSI_COLOR_GREEN "\r\nChannel       Output   Rate   Blocks  Cycles/sample\r\n");
+        for (uint32_t ch = 0; (ch < DSPCHAIN_GetChannelCount()) && (len > 0) && ((size_t)len < room); ch++) {
+            (void)DSPCHAIN_GetStats(ch, &chainStats);
+            centi = (int32_t)(chainStats.latest * 100.0f);
+            len += snprintf(chainMsg + len, room - (size_t)len,
+                "%-10s %s%5ld.%02ld %4luHz %8lu %8lu.%02lu\r\n",
+                DSPCHAIN_GetName(ch), (centi < 0) ? "-" : " ",
+                (long)((centi < 0 ? -centi : centi) / 100), (long)((centi < 0 ? -centi : centi) % 100),
+                (unsigned long)chainStats.outputRateHz, (unsigned long)chainStats.blocks,
+                (unsigned long)(chainStats.centiCyclesPerSample / 100U),
+                (unsigned long)(chainStats.centiCyclesPerSample % 100U));
+        }
+        if ((size_t)len >= room) {
+            len = (int)room - 1;
+        }
+        strcpy(chainMsg + len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(chainMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_FFT) == 0) {
+        SPECTRUM_Config_t fftConfig;
+        SPECTRUM_Stats_t fftStats;
+        char fftMsg[STATUS_MSG_SIZE];
+
+        SPECTRUM_GetConfig(&fftConfig);
+        SPECTRUM_GetStats(&fftStats);
+        snprintf(fftMsg, sizeof(fftMsg),
+            ANSI_COLOR_GREEN "\r\nFFT: %u points, %u%% overlap, %u averages, axis %s\r\n"
+            "Frames: %lu, spectra %lu, streamed %lu, overruns %lu\r\n"
+            "Cycles: fft %lu, frame %lu, display %lu\r\n"
+            "Peak: %lu.%02lu Hz at %s%ld.%02ld dB\r\n" ANSI_COLOR_RESET "> ",
+            fftConfig.fftSize, fftConfig.overlapPercent, fftConfig.averages,
+            SPECTRUM_AxisName(fftConfig.axis),
+            (unsigned long)fftStats.transforms, (unsigned long)fftStats.spectra,
+            (unsigned long)fftStats.streamed, (unsigned long)fftStats.overruns,
+            (unsigned long)fftStats.cyclesFft, (unsigned long)fftStats.cyclesFrame,
+            (unsigned long)fftStats.cyclesSpectrogram,
+            (unsigned long)(fftStats.peakCentiHz / 100U), (unsigned long)(fftStats.peakCentiHz % 100U),
+            (fftStats.peakCentiDb < 0) ? "-" : "",
+            (long)((fftStats.peakCentiDb < 0 ? -fftStats.peakCentiDb : fftStats.peakCentiDb) / 100),
+            (long)((fftStats.peakCentiDb < 0 ? -fftStats.peakCentiDb : fftStats.peakCentiDb) % 100));
+        return UART_Example_SendMessage(fftMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_FFT " bench") == 0) {
+        SPECTRUM_Bench_t bench[5];
+        uint32_t count = SPECTRUM_Benchmark(bench, sizeof(bench) / sizeof(bench[0]));
+        char benchMsg[TX_BUFFER_SIZE - 1];
+        const size_t room = sizeof(benchMsg) - sizeof(ANSI_COLOR_RESET "> ");
+        int len;
+
+        len = snprintf(benchMsg, sizeof(benchMsg),
+            ANSI_COLOR_GREEN "\r\nSize   FFT cycles  Frame cycles  Frame us  Max rate\r\n");
+        for (uint32_t i = 0; (i < count) && (len > 0) && ((size_t)len < room); i++) {
+            len += snprintf(benchMsg + len, room - (size_t)len,
+                "%4u %12lu %13lu %9lu %7lu/s\r\n",
+                bench[i].fftSize, (unsigned long)bench[i].cycles,
+                (unsigned long)bench[i].cyclesFrame, (unsigned long)bench[i].usFrame,
+                (unsigned long)bench[i].maxSampleRate);
+        }
+        if ((size_t)len >= room) {
+            len = (int)room - 1;
+        }
+        strcpy(benchMsg + len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(benchMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_FFT " stream on") == 0) {
+        SPECTRUM_SetStream(1U);
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Spectrum stream on\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strcmp(cleanCmd, CMD_FFT " stream off") == 0) {
+        SPECTRUM_SetStream(0U);
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Spectrum stream off\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strncmp(cleanCmd, CMD_FFT " ", sizeof(CMD_FFT)) == 0) {
+        const char* arg = cleanCmd + sizeof(CMD_FFT);
+        SPECTRUM_Config_t fftConfig;
+        int valid = 1;
+
+        SPECTRUM_GetConfig(&fftConfig);
+        if (strncmp(arg, "size ", 5) == 0) {
+            unsigned long value = strtoul(arg + 5, NULL, 10);
+            valid = (value <= SPECTRUM_MAX_FFT);
+            fftConfig.fftSize = (uint16_t)value;
+        } else if (strncmp(arg, "avg ", 4) == 0) {
+            unsigned long value = strtoul(arg + 4, NULL, 10);
+            valid = (value <= SPECTRUM_MAX_AVERAGES);
+            fftConfig.averages = (uint8_t)value;
+        } else if (strncmp(arg, "overlap ", 8) == 0) {
+            unsigned long value = strtoul(arg + 8, NULL, 10);
+            valid = (value <= SPECTRUM_MAX_OVERLAP);
+            fftConfig.overlapPercent = (uint8_t)value;
+        } else if (strncmp(arg, "axis ", 5) == 0) {
+            fftConfig.axis = SPECTRUM_AXIS_COUNT;
+            for (int axis = 0; axis < (int)SPECTRUM_AXIS_COUNT; axis++) {
+                if (strcmp(arg + 5, SPECTRUM_AxisName((SPECTRUM_Axis_t)axis)) == 0) {
+                    fftConfig.axis = (SPECTRUM_Axis_t)axis;
+                }
+            }
+        } else {
+            valid = 0;
+        }
+
+        if (!valid || (SPECTRUM_Configure(&fftConfig) != HAL_OK)) {
+            return UART_Example_SendMessage(ANSI_COLOR_RED "Invalid spectrum setting\r\n" ANSI_COLOR_RESET "> ");
+        }
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Spectrum reconfigured\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strcmp(cleanCmd, CMD_MOTION) == 0) {
+        MOTION_Result_t result = {0};
+        MOTION_Stats_t motionStats;
+        char motionMsg[TX_BUFFER_SIZE - 1];
+        const size_t room = sizeof(motionMsg) - sizeof(ANSI_COLOR_RESET "> ");
+        const int valid = (MOTION_GetLatest(&result) == HAL_OK);
+        int len;
+
+        MOTION_GetStats(&motionStats);
+        len = snprintf(motionMsg, sizeof(motionMsg),
+            ANSI_COLOR_GREEN "\r\nModel %s: %lu inferences, %lu skipped, %lu errors\r\n"
+            "Cycles/inference: last %lu, max %lu\r\n"
+            "Memory: arena %lu, input %lu, weights %lu bytes\r\n",
+            motionModel.name, (unsigned long)motionStats.inferences,
+            (unsigned long)motionStats.skipped, (unsigned long)motionStats.errors,
+            (unsigned long)motionStats.cyclesLast, (unsigned long)motionStats.cyclesMax,
+            (unsigned long)motionStats.arenaBytes, (unsigned long)motionStats.inputBytes,
+            (unsigned long)motionStats.weightBytes);
+        for (uint32_t i = 0; valid && (i < motionModel.classCount) && (len > 0) && ((size_t)len < room); i++) {
+            len += snprintf(motionMsg + len, room - (size_t)len, "%c %-8s %3u%%\r\n",
+                (i == result.classIndex) ? '*' : ' ', motionModel.classNames[i],
+                (unsigned)(result.probs[i] * 100.0f + 0.5f));
+        }
+        if ((size_t)len >= room) {
+            len = (int)room - 1;
+        }
+        strcpy(motionMsg + len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(motionMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_CDC) == 0) {
+        CDCSTREAM_Stats_t cdcStats;
+        char cdcMsg[STATUS_MSG_SIZE];
+
+        CDCSTREAM_GetStats(&cdcStats);
+        snprintf(cdcMsg, sizeof(cdcMsg),
+            ANSI_COLOR_GREEN "\r\nCDC: %s, %lu connects\r\n"
+            "TX: %lu bytes in %lu transfers, %lu pending, %lu busy\r\n"
+            "RX: %lu bytes in %lu transfers, %lu stalls\r\n" ANSI_COLOR_RESET "> ",
+            cdcStats.connected ? "connected" : "no device", (unsigned long)cdcStats.connects,
+            (unsigned long)cdcStats.txBytes, (unsigned long)cdcStats.txTransfers,
+            (unsigned long)cdcStats.txPending, (unsigned long)cdcStats.txBusy,
+            (unsigned long)cdcStats.rxBytes, (unsigned long)cdcStats.rxTransfers,
+            (unsigned long)cdcStats.rxStalls);
+        return UART_Example_SendMessage(cdcMsg);
+    }
+
+    if (strncmp(cleanCmd, CMD_CDC " bench", sizeof(CMD_CDC " bench") - 1U) == 0) {
+        unsigned long kbytes = strtoul(cleanCmd + sizeof(CMD_CDC " bench") - 1U, NULL, 10);
+        CDCSTREAM_Bench_t bench;
+        HAL_StatusTypeDef benchStatus;
+        char cdcMsg[STATUS_MSG_SIZE];
+
+        benchStatus = CDCSTREAM_Benchmark((uint32_t)((kbytes != 0U) ? kbytes : 1024U) * 1024U, &bench);
+        snprintf(cdcMsg, sizeof(cdcMsg),
+            "%s\r\nCDC bench: %lu bytes out, %lu bytes in, %lu us\r\n"
+            "TX %lu.%03lu MB/s, RX %lu.%03lu MB/s\r\n" ANSI_COLOR_RESET "> ",
+            (benchStatus == HAL_OK) ? ANSI_COLOR_GREEN : ANSI_COLOR_RED,
+            (unsigned long)bench.txBytes, (unsigned long)bench.rxBytes, (unsigned long)bench.elapsedUs,
+            (unsigned long)(bench.txKBps / 1000U), (unsigned long)(bench.txKBps % 1000U),
+            (unsigned long)(bench.rxKBps / 1000U), (unsigned long)(bench.rxKBps % 1000U));
+        return UART_Example_SendMessage(cdcMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_CPU) == 0) {
+        RTOS_CpuLoad_t cpu;
+        char cpuMsg[STATUS_MSG_SIZE];
+
+        RTOS_GetCpuLoad(&cpu);
+        snprintf(cpuMsg, sizeof(cpuMsg),
+            ANSI_COLOR_GREEN "\r\nCPU load %lu.%02lu%% (peak %lu.%02lu%%), idle %lu.%02lu%% over %lu ms\r\n"
+            ANSI_COLOR_RESET "> ",
+            (unsigned long)(cpu.load / 100U), (unsigned long)(cpu.load % 100U),
+            (unsigned long)(cpu.peakLoad / 100U), (unsigned long)(cpu.peakLoad % 100U),
+            (unsigned long)(cpu.idle / 100U), (unsigned long)(cpu.idle % 100U),
+            (unsigned long)RTOS_LOAD_WINDOW_MS);
+        return UART_Example_SendMessage(cpuMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_LOG) == 0) {
+        LOGGER_Stats_t logStats;
+        char logMsg[TX_BUFFER_SIZE - 1];
+
+        LOGGER_GetStats(&logStats);
+        snprintf(logMsg, sizeof(logMsg),
+            ANSI_COLOR_GREEN "\r\nLogger: %s on ram, %lu ms\r\n"
+            "In: %lu records, %lu bytes, %lu dropped, %lu.%03lu MB/s\r\n"
+            "Out: %lu bytes in %lu writes, %lu.%03lu MB/s, write %lu us (max %lu)\r\n"
+            "Cache: %lu/%lu slots pending (max %lu), %lu errors\r\n" ANSI_COLOR_RESET "> ",
+            logStats.active ? "running" : "stopped",
+            (unsigned long)logStats.elapsedMs,
+            (unsigned long)logStats.records, (unsigned long)logStats.bytesIn,
+            (unsigned long)logStats.dropped,
+            (unsigned long)(logStats.inKBps / 1000U), (unsigned long)(logStats.inKBps % 1000U),
+            (unsigned long)logStats.bytesWritten, (unsigned long)logStats.slotsWritten,
+            (unsigned long)(logStats.writeKBps / 1000U), (unsigned long)(logStats.writeKBps % 1000U),
+            (unsigned long)logStats.writeUsLast, (unsigned long)logStats.writeUsMax,
+            (unsigned long)logStats.pending, (unsigned long)LOGGER_SLOT_COUNT,
+            (unsigned long)logStats.highWater, (unsigned long)logStats.errors);
+        return UART_Example_SendMessage(logMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_LOG " stop") == 0) {
+        if (LOGGER_Stop(5000U) != HAL_OK) {
+            return UART_Example_SendMessage(ANSI_COLOR_RED "Logger not stopped cleanly\r\n" ANSI_COLOR_RESET "> ");
+        }
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Logger stopped\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strncmp(cleanCmd, CMD_LOG " bench", sizeof(CMD_LOG " bench") - 1U) == 0) {
+        unsigned long kbytes = strtoul(cleanCmd + sizeof(CMD_LOG " bench") - 1U, NULL, 10);
+        LOGGER_Bench_t bench;
+        HAL_StatusTypeDef benchStatus;
+        char logMsg[STATUS_MSG_SIZE];
+
+        benchStatus = LOGGER_Benchmark((uint32_t)((kbytes != 0U) ? kbytes : 4096U) * 1024U, &bench);
+        snprintf(logMsg, sizeof(logMsg),
+            "%s\r\nLog bench: %lu bytes in %lu us, %lu.%03lu MB/s sustained\r\n"
+            "Device %lu.%03lu MB/s, write max %lu us, cache max %lu slots\r\n" ANSI_COLOR_RESET "> ",
+            (benchStatus == HAL_OK) ? ANSI_COLOR_GREEN : ANSI_COLOR_RED,
+            (unsigned long)bench.bytes, (unsigned long)bench.elapsedUs,
+            (unsigned long)(bench.KBps / 1000U), (unsigned long)(bench.KBps % 1000U),
+            (unsigned long)(bench.writeKBps / 1000U), (unsigned long)(bench.writeKBps % 1000U),
+            (unsigned long)bench.writeUsMax, (unsigned long)bench.highWater);
+        return UART_Example_SendMessage(logMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_LOG " ram") == 0) {
+        if (LOGGER_Start() != HAL_OK) {
+            return UART_Example_SendMessage(ANSI_COLOR_RED "Logger not started (busy or no device)\r\n" ANSI_COLOR_RESET "> ");
+        }
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Logger started\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strcmp(cleanCmd, CMD_BRIDGE) == 0) {
+        BRIDGE_Stats_t bridgeStats;
+        char bridgeMsg[TX_BUFFER_SIZE - 1];
+
+        BRIDGE_GetStats(&bridgeStats);
+        snprintf(bridgeMsg, sizeof(bridgeMsg),
+            ANSI_COLOR_GREEN "\r\nBridge: %s, %lu baud, %s, %lu ms, %lu sessions\r\n"
+            "UART>USB: %lu bytes, %lu xfers, %lu KB/s, lat %lu/%lu/%lu us, %lu busy, %lu lost\r\n"
+            "USB>UART: %lu bytes, %lu xfers, %lu KB/s, lat %lu/%lu/%lu us, %lu paused\r\n"
+            "XOFF sent %lu, peer pauses %lu, UART errors %lu\r\n" ANSI_COLOR_RESET "> ",
+            bridgeStats.active ? "running" : "stopped", (unsigned long)bridgeStats.baudRate,
+            (bridgeStats.flow == BRIDGE_FLOW_XONXOFF) ? "xon/xoff" : "no flow control",
+            (unsigned long)bridgeStats.elapsedMs, (unsigned long)bridgeStats.sessions,
+            (unsigned long)bridgeStats.toUsb.bytes, (unsigned long)bridgeStats.toUsb.transfers,
+            (unsigned long)bridgeStats.toUsb.KBps, (unsigned long)bridgeStats.toUsb.latencyUsLast,
+            (unsigned long)bridgeStats.toUsb.latencyUsAvg, (unsigned long)bridgeStats.toUsb.latencyUsMax,
+            (unsigned long)bridgeStats.toUsb.stalls, (unsigned long)bridgeStats.toUsb.overruns,
+            (unsigned long)bridgeStats.toUart.bytes, (unsigned long)bridgeStats.toUart.transfers,
+            (unsigned long)bridgeStats.toUart.KBps, (unsigned long)bridgeStats.toUart.latencyUsLast,
+            (unsigned long)bridgeStats.toUart.latencyUsAvg, (unsigned long)bridgeStats.toUart.latencyUsMax,
+            (unsigned long)bridgeStats.toUart.stalls,
+            (unsigned long)bridgeStats.xoffSent, (unsigned long)bridgeStats.peerPauses,
+            (unsigned long)bridgeStats.uartErrors);
+        return UART_Example_SendMessage(bridgeMsg);
+    }
+
+    if (strncmp(cleanCmd, CMD_BRIDGE " on", sizeof(CMD_BRIDGE " on") - 1U) == 0) {
+        const char* arg = cleanCmd + sizeof(CMD_BRIDGE " on") - 1U;
+        char* end;
+        unsigned long baud = strtoul(arg, &end, 10);
+        const BRIDGE_Flow_t flow = (strstr(end, "xon") != NULL) ? BRIDGE_FLOW_XONXOFF : BRIDGE_FLOW_NONE;
+
+        /* The reply goes out before the bridge takes the UART over */
+        if (BRIDGE_Start((uint32_t)baud, flow) != HAL_OK) {
+            return UART_Example_SendMessage(ANSI_COLOR_RED "Bridge not started (busy or no CDC device)\r\n" ANSI_COLOR_RESET "> ");
+        }
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Bridge on, send +++ after 1 s of silence to leave\r\n" ANSI_COLOR_RESET);
+    }
+
+    if (strcmp(cleanCmd, CMD_CRASH) == 0) {
+        const CRASH_Dump_t* dump = CRASH_GetDump();
+        char fault[96];
+        char crashMsg[TX_BUFFER_SIZE - 1];
+
+        if (dump == NULL) {
+            snprintf(crashMsg, sizeof(crashMsg),
+                ANSI_COLOR_GREEN "\r\nNo crash dump, last reset: %s\r\n" ANSI_COLOR_RESET "> ",
+                CRASH_ResetCause());
+            return UART_Example_SendMessage(crashMsg);
+        }
+
+        CRASH_DecodeFault(dump, fault, sizeof(fault));
+        snprintf(crashMsg, sizeof(crashMsg),
+            ANSI_COLOR_RED "\r\nCrash %lu: %s after %lu ms in '%.*s', last reset: %s\r\n"
+            "pc %08lX lr %08lX sp %08lX xpsr %08lX\r\n"
+            "cfsr %08lX hfsr %08lX mmfar %08lX bfar %08lX\r\n"
+            "%s, %lu stack words (full dump printed at boot)\r\n" ANSI_COLOR_RESET "> ",
+            (unsigned long)dump->count, CRASH_CauseName(dump->cause), (unsigned long)dump->uptimeMs,
+            (int)CRASH_TASK_NAME_LEN, (dump->taskName[0] != '\0') ? dump->taskName : "-",
+            CRASH_ResetCause(),
+            (unsigned long)dump->frame[6], (unsigned long)dump->frame[5],
+            (unsigned long)dump->sp, (unsigned long)dump->frame[7],
+            (unsigned long)dump->cfsr, (unsigned long)dump->hfsr,
+            (unsigned long)dump->mmfar, (unsigned long)dump->bfar,
+            fault, (unsigned long)dump->stackWords);
+        return UART_Example_SendMessage(crashMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_CRASH " clear") == 0) {
+        CRASH_Clear();
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Crash dump cleared\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if (strcmp(cleanCmd, CMD_CRASH " test") == 0) {
+        CRASH_Test();
+    }
+
+    if (strcmp(cleanCmd, CMD_BOOT) == 0) {
+        BOOTTIME_Mark_t mark;
+        char bootMsg[TX_BUFFER_SIZE - 1];
+        size_t len;
+        uint32_t i;
+
+        len = (size_t)snprintf(bootMsg, sizeof(bootMsg),
+            ANSI_COLOR_GREEN "\r\nStage            Took us    At us\r\n");
+        for (i = 0; BOOTTIME_GetMark(i, &mark) == HAL_OK; i++) {
+            /* Keep room for the prompt */
+            if (len + 40U >= sizeof(bootMsg)) {
+                break;
+            }
+            len += (size_t)snprintf(bootMsg + len, sizeof(bootMsg) - len, "%-15.15s %8lu %8lu\r\n",
+                mark.stage, (unsigned long)mark.durationUs, (unsigned long)mark.atUs);
+        }
+        snprintf(bootMsg + len, sizeof(bootMsg) - len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(bootMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_BOOT " init") == 0) {
+        static const char* const stateNames[] = { "down", "running", "up", "failed" };
+        BOOTINIT_Info_t info;
+        char bootMsg[TX_BUFFER_SIZE - 1];
+        size_t len;
+        uint32_t i;
+
+        len = (size_t)snprintf(bootMsg, sizeof(bootMsg),
+            ANSI_COLOR_GREEN "\r\nPeripheral State   By      Took us    At us\r\n");
+        for (i = 0; i < BOOTINIT_COUNT; i++) {
+            BOOTINIT_GetInfo((BOOTINIT_Id_t)i, &info);
+            len += (size_t)snprintf(bootMsg + len, sizeof(bootMsg) - len, "%-10s %-7s %-6s %8lu %8lu\r\n",
+                info.name, stateNames[info.state],
+                (info.state == BOOTINIT_STATE_DOWN) ? "-" : (info.onDemand ? "use" : "boot"),
+                (unsigned long)info.durationUs, (unsigned long)info.startUs);
+        }
+        snprintf(bootMsg + len, sizeof(bootMsg) - len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(bootMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_CLOCK) == 0) {
+        const CLKGOV_Profile_t profile = CLKGOV_GetProfile();
+        CLKGOV_Stats_t clockStats;
+        char clockMsg[TX_BUFFER_SIZE - 1];
+
+        CLKGOV_GetStats(&clockStats);
+        snprintf(clockMsg, sizeof(clockMsg),
+            ANSI_COLOR_GREEN "\r\nClock %lu MHz: HCLK %lu, APB1 %lu, APB2 %lu MHz, USB clock %s\r\n"
+            "Switches %lu (%lu relocks, %lu refused), last %lu.%lu us (retiming %lu.%lu us), max %lu.%lu us\r\n"
+            ANSI_COLOR_RESET "> ",
+            (unsigned long)CLKGOV_GetProfileMHz(profile),
+            (unsigned long)(HAL_RCC_GetHCLKFreq() / 1000000U),
+            (unsigned long)(HAL_RCC_GetPCLK1Freq() / 1000000U),
+            (unsigned long)(HAL_RCC_GetPCLK2Freq() / 1000000U),
+            CLKGOV_HasUsbClock(profile) ? "48 MHz" : "off",
+            (unsigned long)clockStats.switches, (unsigned long)clockStats.relocks,
+            (unsigned long)clockStats.refused,
+            (unsigned long)(clockStats.lastSwitchNs / 1000U), (unsigned long)((clockStats.lastSwitchNs % 1000U) / 100U),
+            (unsigned long)(clockStats.lastRetimeNs / 1000U), (unsigned long)((clockStats.lastRetimeNs % 1000U) / 100U),
+            (unsigned long)(clockStats.maxSwitchNs / 1000U), (unsigned long)((clockStats.maxSwitchNs % 1000U) / 100U));
+        return UART_Example_SendMessage(clockMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_CLOCK " bench") == 0) {
+        /* Every profile and back; the reply is sent at the start clock */
+        const CLKGOV_Profile_t start = CLKGOV_GetProfile();
+        CLKGOV_Stats_t clockStats;
+        char clockMsg[TX_BUFFER_SIZE - 1];
+        uint32_t toNs;
+        size_t len;
+        uint32_t i;
+
+        len = (size_t)snprintf(clockMsg, sizeof(clockMsg), ANSI_COLOR_GREEN "\r\nSwitch            To us   Back us\r\n");
+        for (i = 0; i < CLKGOV_PROFILE_COUNT; i++) {
+            if ((CLKGOV_Profile_t)i == start) {
+                continue;
+            }
+            if (CLKGOV_SetProfile((CLKGOV_Profile_t)i) != HAL_OK) {
+                len += (size_t)snprintf(clockMsg + len, sizeof(clockMsg) - len, "%3lu -> %3lu MHz   refused, USB in use\r\n",
+                    (unsigned long)CLKGOV_GetProfileMHz(start), (unsigned long)CLKGOV_GetProfileMHz((CLKGOV_Profile_t)i));
+                continue;
+            }
+            CLKGOV_GetStats(&clockStats);
+            toNs = clockStats.lastSwitchNs;
+            (void)CLKGOV_SetProfile(start);
+            CLKGOV_GetStats(&clockStats);
+            len += (size_t)snprintf(clockMsg + len, sizeof(clockMsg) - len, "%3lu -> %3lu MHz %6lu.%lu %7lu.%lu\r\n",
+                (unsigned long)CLKGOV_GetProfileMHz(start), (unsigned long)CLKGOV_GetProfileMHz((CLKGOV_Profile_t)i),
+                (unsigned long)(toNs / 1000U), (unsigned long)((toNs % 1000U) / 100U),
+                (unsigned long)(clockStats.lastSwitchNs / 1000U), (unsigned long)((clockStats.lastSwitchNs % 1000U) / 100U));
+        }
+        snprintf(clockMsg + len, sizeof(clockMsg) - len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(clockMsg);
+    }
+
+    if (strncmp(cleanCmd, CMD_CLOCK " ", 6) == 0) {
+        CLKGOV_Profile_t profile;
+        char clockMsg[STATUS_MSG_SIZE];
+        HAL_StatusTypeDef status;
+
+        if (CLKGOV_FindProfile((uint32_t)strtoul(cleanCmd + 6, NULL, 10), &profile) != HAL_OK) {
+            return UART_Example_SendMessage(ANSI_COLOR_RED "Profiles: 180, 168, 84, 48 MHz\r\n" ANSI_COLOR_RESET "> ");
+        }
+        status = CLKGOV_SetProfile(profile);
+        if (status == HAL_BUSY) {
+            return UART_Example_SendMessage(ANSI_COLOR_RED "No USB clock at that profile, detach the USB device first\r\n" ANSI_COLOR_RESET "> ");
+        }
+        snprintf(clockMsg, sizeof(clockMsg), ANSI_COLOR_GREEN "Clock %lu MHz\r\n" ANSI_COLOR_RESET "> ",
+            (unsigned long)CLKGOV_GetProfileMHz(profile));
+        return UART_Example_SendMessage(clockMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_PROF) == 0) {
+        PROF_Stats_t profStats;
+        PROF_Entry_t top[8];
+        char profMsg[TX_BUFFER_SIZE - 1];
+        uint32_t count;
+        uint32_t permille;
+        size_t len;
+        uint32_t i;
+
+        PROF_GetStats(&profStats);
+        count = PROF_GetTop(top, 8U);
+        len = (size_t)snprintf(profMsg, sizeof(profMsg),
+            ANSI_COLOR_GREEN "\r\nProfiler %s at %lu Hz: %lu samples, %lu dropped, %lu/%lu slots\r\n",
+            profStats.running ? "running" : "stopped", (unsigned long)profStats.rateHz,
+            (unsigned long)profStats.samples, (unsigned long)profStats.dropped,
+            (unsigned long)profStats.used, (unsigned long)PROF_SLOTS);
+        for (i = 0; i < count; i++) {
+            permille = (uint32_t)(((uint64_t)top[i].count * 1000U) / profStats.samples);
+            len += (size_t)snprintf(profMsg + len, sizeof(profMsg) - len, "  %08lx %8lu %3lu.%lu%%\r\n",
+                (unsigned long)top[i].pc, (unsigned long)top[i].count,
+                (unsigned long)(permille / 10U), (unsigned long)(permille % 10U));
+        }
+        snprintf(profMsg + len, sizeof(profMsg) - len, "Symbolize with tools/hot_place\r\n" ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(profMsg);
+    }
+
+    if ((strcmp(cleanCmd, CMD_PROF " start") == 0) || (strncmp(cleanCmd, CMD_PROF " start ", 11) == 0)) {
+        const uint32_t rateHz = (cleanCmd[10] == ' ') ? (uint32_t)strtoul(cleanCmd + 11, NULL, 10) : PROF_RATE_DEFAULT_HZ;
+        char profMsg[STATUS_MSG_SIZE];
+
+        if (PROF_Start(rateHz) != HAL_OK) {
+            snprintf(profMsg, sizeof(profMsg), ANSI_COLOR_RED "Rate 1 to %lu Hz\r\n" ANSI_COLOR_RESET "> ",
+                (unsigned long)PROF_RATE_MAX_HZ);
+            return UART_Example_SendMessage(profMsg);
+        }
+        snprintf(profMsg, sizeof(profMsg), ANSI_COLOR_GREEN "Profiling at %lu Hz\r\n" ANSI_COLOR_RESET "> ",
+            (unsigned long)rateHz);
+        return UART_Example_SendMessage(profMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_PROF " stop") == 0) {
+        PROF_Stop();
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "Profiler stopped\r\n" ANSI_COLOR_RESET "> ");
+    }
+
+    if ((strcmp(cleanCmd, CMD_PROF " dump") == 0) || (strncmp(cleanCmd, CMD_PROF " dump ", 10) == 0)) {
+        /* One page per reply; the PROF lines are the input of tools/hot_place */
+        uint32_t slot = (cleanCmd[9] == ' ') ? (uint32_t)strtoul(cleanCmd + 10, NULL, 10) : 0U;
+        PROF_Entry_t entry;
+        char profMsg[TX_BUFFER_SIZE - 1];
+        size_t len;
+
+        len = (size_t)snprintf(profMsg, sizeof(profMsg), ANSI_COLOR_GREEN "\r\n");
+        /* Keep room for the last line and the prompt */
+        while ((len + 48U < sizeof(profMsg)) && (PROF_GetEntry(&slot, &entry) == HAL_OK)) {
+            len += (size_t)snprintf(profMsg + len, sizeof(profMsg) - len, "PROF %08lx %lu\r\n",
+                (unsigned long)entry.pc, (unsigned long)entry.count);
+        }
+        if (slot < PROF_SLOTS) {
+            len += (size_t)snprintf(profMsg + len, sizeof(profMsg) - len, "More: prof dump %lu\r\n", (unsigned long)slot);
+        }
+        snprintf(profMsg + len, sizeof(profMsg) - len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(profMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_PLACE) == 0) {
+        PLACE_Info_t info;
+        PLACE_IsrStats_t isr;
+        char placeMsg[STATUS_MSG_SIZE];
+
+        PLACE_GetInfo(&info);
+        PLACE_GetUartIsr(&isr);
+        snprintf(placeMsg, sizeof(placeMsg),
+            ANSI_COLOR_GREEN "\r\nSRAM code %lu B, CCM data %lu B, CCM bss %lu B, CCM free %lu B\r\n"
+            "USART1 IRQ (HAL handler in %s): %lu, min %lu avg %lu max %lu cycles\r\n"
+            ANSI_COLOR_RESET "> ",
+            (unsigned long)info.ramCodeBytes, (unsigned long)info.ccmDataBytes,
+            (unsigned long)info.ccmBssBytes, (unsigned long)info.ccmFreeBytes,
+            PLACE_RunsFromRam((uint32_t)&HAL_UART_IRQHandler) ? "SRAM" : "flash",
+            (unsigned long)isr.count, (unsigned long)((isr.count != 0U) ? isr.minCycles : 0U),
+            (unsigned long)((isr.count != 0U) ? (isr.totalCycles / isr.count) : 0U),
+            (unsigned long)isr.maxCycles);
+        return UART_Example_SendMessage(placeMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_PLACE " bench") == 0) {
+        PLACE_Result_t results[PLACE_BENCH_ROWS];
+        char placeMsg[TX_BUFFER_SIZE - 1];
+        size_t len;
+        uint32_t i;
+
+        PLACE_Benchmark(results);
+        len = (size_t)snprintf(placeMsg, sizeof(placeMsg),
+            ANSI_COLOR_GREEN "\r\n%u samples Code   Data   Cold cyc  Warm cyc\r\n", (unsigned)PLACE_BENCH_BLOCK);
+        for (i = 0; i < PLACE_BENCH_ROWS; i++) {
+            len += (size_t)snprintf(placeMsg + len, sizeof(placeMsg) - len, "%-10s %-6s %-6s %8lu %9lu\r\n",
+                results[i].kernel, results[i].codeInRam ? "sram" : "flash", results[i].dataInCcm ? "ccm" : "sram",
+                (unsigned long)results[i].coldCycles, (unsigned long)results[i].warmCycles);
+        }
+        snprintf(placeMsg + len, sizeof(placeMsg) - len, ANSI_COLOR_RESET "> ");
+        return UART_Example_SendMessage(placeMsg);
+    }
+
+    if (strcmp(cleanCmd, CMD_PLACE " reset") == 0) {
+        PLACE_ResetUartIsr();
+        return UART_Example_SendMessage(ANSI_COLOR_GREEN "USART1 IRQ statistics cleared\r\n" ANSI_COLOR_RESET "> ");
+    }
+
     if (strncmp(cleanCmd, "echo ", 5) == 0) {
         /* Echo command - send back the received text */
         const char* textToEcho = cleanCmd + 5;  /* Skip "echo " prefix */
@@ -323,6 +1061,9 @@ UART_Status_t UART_Example_SendMessage(const char* msg)
 /* Enhanced callback for UART transmission complete */
 void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
 {
+    STDIO_UartTxCpltCallback(huart);
+    BRIDGE_UartTxCpltCallback(huart);
+
     if (huart == uartHandle.huart) {
         txComplete = 1;
         DEBUG_PRINT("UART transmission complete");
@@ -332,6 +1073,11 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
 
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 {
+    /* While bridging the reception belongs to the bridge */
+    if (BRIDGE_UartErrorCallback(huart)) {
+        return;
+    }
+
     if (huart == uartHandle.huart) {
 
         if (huart->ErrorCode & HAL_UART_ERROR_ORE) {
@@ -353,11 +1099,9 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
         __HAL_UART_CLEAR_NEFLAG(huart);
         __HAL_UART_CLEAR_OREFLAG(huart);
 
-        /* Restart reception */
-        rxComplete = 0;
-        rxIndex = 0;
+        /* Restart reception; the console task drops the partial line */
+        rxLineDropped = 1;
         memset(rxBuffer, 0, RX_BUFFER_SIZE);
-        memset(cmdBuffer, 0, RX_BUFFER_SIZE);
         /* Restart reception based on mode */
         if (uartHandle.config.mode == UART_MODE_DMA) {
             HAL_UART_Receive_DMA(huart, uartHandle.rxBuffer, uartHandle.rxSize);
@@ -368,18 +1112,30 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 }
 void UART_Example_MainLoop(void)
 {
-    if (UART_Example_Init() != UART_OK) {
-        DEBUG_PRINT("UART Example initialization failed");
-        return;
-    }
-
     while (1) {
-        /* Periodically process received data */
+        /* Line cut by a reception error */
+        if (rxLineDropped) {
+            rxLineDropped = 0;
+            UART_CmdLine_Reset(&cmdLine);
+        }
+
+        /* Periodically process received data; clear first so that bytes
+           arriving during the drain set the flag again */
         if (rxComplete) {
+            rxComplete = 0;
             UART_Example_PreProcess(&uartHandle);
-            rxComplete = 0;  // Reset the flag after processing
         }
 
-        HAL_Delay(PROCESS_INTERVAL_MS);  // Defined as 10ms in uart_example.h
+        /* Deferred peripherals, one per pass: no wait until all are up */
+        if (BOOTINIT_Poll()) {
+            continue;
+        }
+
+        /* Sleep in the console task; spin only if the kernel is not running */
+        if (osKernelGetState() == osKernelRunning) {
+            osDelay(PROCESS_INTERVAL_MS);
+        } else {
+            HAL_Delay(PROCESS_INTERVAL_MS);  // Defined as 10ms in uart_example.h
+        }
     }
 }
@@ -28,6 +28,27 @@
 #define CMD_INTERRUPT      "int"
 #define CMD_BLOCKING       "block"
 #define CMD_ECHO          "echo"      /* New echo command */
+#define CMD_HEAP           "heap"      /* Heap report, "heap mark" starts a leak window */
+#define CMD_SINK           "sink"      /* Select the stdout sink */
+#define CMD_BENCH          "bench"     /* printf throughput benchmark */
+#define CMD_GYRO           "gyro"      /* Gyroscope rate and driver statistics */
+#define CMD_AHRS           "ahrs"      /* Attitude estimate and filter cost */
+#define CMD_SPI            "spi"       /* SPI5 bus queue statistics */
+#define CMD_I2C            "i2c"       /* I2C3 bus statistics and device latency */
+#define CMD_TOUCH          "touch"     /* Touch statistics and pending gestures */
+#define CMD_ACQ            "acq"       /* Acquisition scheduler statistics */
+#define CMD_DSP            "dsp"       /* Filter chain outputs and cost */
+#define CMD_FFT            "fft"       /* Spectrum analyzer: stats, stream, bench, settings */
+#define CMD_MOTION         "motion"    /* Motion classifier output and cost */
+#define CMD_CDC            "cdc"       /* USB CDC stream counters and throughput */
+#define CMD_CPU            "cpu"       /* CPU load from the idle task run time */
+#define CMD_LOG            "log"       /* Sensor logger: stats, start, stop, bench */
+#define CMD_BRIDGE         "bridge"    /* UART-USB CDC bridge: stats, start */
+#define CMD_CRASH          "crash"     /* Last crash dump, clear, test fault */
+#define CMD_BOOT           "boot"      /* Boot stage times, deferred init table */
+#define CMD_CLOCK          "clock"     /* Clock profile: stats, switch, bench */
+#define CMD_PROF           "prof"      /* PC sampling profiler: top, start, stop, dump */
+#define CMD_PLACE          "place"     /* Hot code/data placement, UART ISR cost, bench */
 
 /* Timing and buffer management constants */
 #define UART_CHAR_TIMEOUT     100  /* Character receive timeout in ms */
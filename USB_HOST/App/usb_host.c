@@ -25,6 +25,7 @@
 #include "usbh_cdc.h"
 
 /* USER CODE BEGIN Includes */
+#include "../../Peripherals/CDC/cdc_stream.h"
 
 /* USER CODE END Includes */
 
@@ -102,10 +103,12 @@ static void USBH_UserProcess  (USBH_HandleTypeDef *phost, uint8_t id)
 
   case HOST_USER_DISCONNECTION:
   Appli_state = APPLICATION_DISCONNECT;
+  CDCSTREAM_OnDisconnect();
   break;
 
   case HOST_USER_CLASS_ACTIVE:
   Appli_state = APPLICATION_READY;
+  CDCSTREAM_OnConnect();
   break;
 
   case HOST_USER_CONNECTION:
@@ -511,11 +511,21 @@ uint8_t USBH_LL_GetToggle(USBH_HandleTypeDef *phost, uint8_t pipe)
 
 /**
   * @brief  Delay routine for the USB Host Library
+  * @note   The library delays in the host thread during enumeration (up to
+  *         a few hundred ms per port reset); block the thread instead of
+  *         spinning in HAL_Delay(), which starved the lower priority tasks
   * @param  Delay: Delay in ms
   * @retval None
   */
 void USBH_Delay(uint32_t Delay)
 {
+#if (USBH_USE_OS == 1)
+  if ((osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
+  {
+    (void)osDelay((Delay != 0U) ? Delay : 1U);
+    return;
+  }
+#endif
   HAL_Delay(Delay);
 }
 
@@ -97,7 +97,8 @@
 #if (USBH_USE_OS == 1)
   #include "cmsis_os.h"
   #define USBH_PROCESS_PRIO          osPriorityNormal
-  #define USBH_PROCESS_STACK_SIZE    ((uint16_t)128)
+  /* Bytes: osThreadNew() takes the stack size in bytes, not in words */
+  #define USBH_PROCESS_STACK_SIZE    ((uint16_t)(512U * 4U))
 #endif /* (USBH_USE_OS == 1) */
 
 /**
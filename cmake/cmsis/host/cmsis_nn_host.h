@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_nn_host.h
+  * @brief   Core intrinsics of the CMSIS-NN kernels for host builds
+  * @details Included ahead of every CMSIS-NN source when cmake/cmsis builds
+  *          for the host. On the target __SSAT, __USAT and __CLZ come from
+  *          cmsis_compiler.h, which arm_nn_math_types.h leaves out for
+  *          __GNUC_PYTHON__. These are the C versions CMSIS-DSP uses in
+  *          dsp/none.h; the DSP extension intrinsics (__SMLAD and friends)
+  *          are not needed, ARM_MATH_DSP stays undefined on the host.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __CMSIS_NN_HOST_H__
+#define __CMSIS_NN_HOST_H__
+
+#include <stdint.h>
+
+static inline __attribute__((always_inline)) uint8_t __CLZ(uint32_t data)
+{
+  uint8_t count = 0U;
+
+  if (data == 0U)
+  {
+    return 32U;
+  }
+  while ((data & 0x80000000U) == 0U)
+  {
+    count++;
+    data <<= 1U;
+  }
+  return count;
+}
+
+static inline __attribute__((always_inline)) int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  if ((sat >= 1U) && (sat <= 32U))
+  {
+    const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+    const int32_t min = -1 - max;
+
+    if (val > max)
+    {
+      return max;
+    }
+    if (val < min)
+    {
+      return min;
+    }
+  }
+  return val;
+}
+
+static inline __attribute__((always_inline)) uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  if (sat <= 31U)
+  {
+    const uint32_t max = (1U << sat) - 1U;
+
+    if (val > (int32_t)max)
+    {
+      return max;
+    }
+    if (val < 0)
+    {
+      return 0U;
+    }
+  }
+  return (uint32_t)val;
+}
+
+#endif /* __CMSIS_NN_HOST_H__ */
@@ -0,0 +1,338 @@
+/**
+  ******************************************************************************
+  * @file    gen_datasets.c
+  * @brief   Generator of the AHRS replay datasets
+  * @details Writes one CSV file per motion profile into the directory given
+  *          on the command line, in the format host_check.c replays:
+  *
+  *            # <name>: <description>
+  *            # check=tilt|full settle_s=<s> rms_deg=<deg> max_deg=<deg>
+  *            t_us,gx,gy,gz,ax,ay,az,mx,my,mz,qw,qx,qy,qz
+  *
+  *          one row per gyro sample: the timestamp, the rate in deg/s, the
+  *          accelerometer and magnetometer readings (all zero in rows
+  *          without one) and the true orientation. The true motion is
+  *          integrated in double precision from smooth body rates; the
+  *          readings are what the board would record of it:
+  *          - gyro at 760 Hz with timestamp jitter, a constant bias,
+  *            white noise and the 8.75 mdps resolution of the 250 dps range
+  *          - accelerometer and magnetometer at 95 Hz, the magnetometer
+  *            half a period later, with noise and, while moving, a linear
+  *            acceleration on the accelerometer
+  *          Every profile starts still for two seconds, so the service can
+  *          measure the gyro bias.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define ODR_HZ              760.0
+#define START_US            1000000.0
+#define JITTER_US           3.0
+#define SUBSTEPS            10U
+#define STILL_S             2.0
+#define AUX_DIVIDER         8U          /* Gyro samples per aux reading */
+#define GYRO_LSB_DPS        0.00875
+#define GYRO_NOISE_DPS      0.2
+#define ACCEL_NOISE         0.01        /* g */
+#define MAG_NOISE           0.01        /* Of the field */
+#define MAG_DIP_DEG         60.0
+#define DEG                 (M_PI / 180.0)
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Motion profile and the accuracy expected on it
+ */
+typedef struct
+{
+  const char *name;
+  const char *description;
+  const char *check;            /* "tilt": gravity direction only */
+  double settleS;               /* Error is scored after this */
+  double rmsDeg;
+  double maxDeg;
+  double durationS;
+  double start[3];              /* Roll, pitch, yaw at the start, deg */
+  uint8_t accel;
+  uint8_t mag;
+  double disturbanceG;          /* Linear acceleration while moving */
+  void (*rate)(double t, double w[3]);
+} Profile_t;
+
+/* Private function prototypes -----------------------------------------------*/
+static void RateStill(double t, double w[3]);
+static void RateSway(double t, double w[3]);
+static void RateHeading(double t, double w[3]);
+static void RateTumble(double t, double w[3]);
+
+/* Private variables ---------------------------------------------------------*/
+static const Profile_t profiles[] = {
+  {"static_tilt", "still at roll 25, pitch -15, yaw 40 deg",
+   "full", 10.0, 1.0, 2.0, 30.0, {25.0, -15.0, 40.0}, 1U, 1U, 0.0, RateStill},
+  {"tilt_sway", "roll and pitch sway up to 60 deg/s, accelerometer only",
+   "tilt", 3.0, 2.0, 5.0, 30.0, {0.0, 0.0, 0.0}, 1U, 0U, 0.05, RateSway},
+  {"heading", "yaw turns at up to 90 deg/s with tilt, accelerometer and magnetometer",
+   "full", 3.0, 3.0, 6.0, 40.0, {0.0, 0.0, 0.0}, 1U, 1U, 0.05, RateHeading},
+  {"gyro_only", "tumbling on all axes, no aiding: pure integration of the gyro",
+   "full", 2.0, 0.3, 0.5, 12.0, {0.0, 0.0, 0.0}, 0U, 0U, 0.0, RateTumble},
+};
+
+static const double gyroBias[3] = {1.2, -0.8, 0.5};
+static uint64_t lcg = 0x2545F4914F6CDD1DULL;
+
+/* Private functions ---------------------------------------------------------*/
+static double Uniform(void)
+{
+  lcg = (lcg * 6364136223846793005ULL) + 1442695040888963407ULL;
+  return ((double)(lcg >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static double Gaussian(void)
+{
+  return sqrt(-2.0 * log(Uniform())) * cos(2.0 * M_PI * Uniform());
+}
+
+static void RateStill(double t, double w[3])
+{
+  (void)t;
+  w[0] = 0.0;
+  w[1] = 0.0;
+  w[2] = 0.0;
+}
+
+static void RateSway(double t, double w[3])
+{
+  const double s = t - STILL_S;
+
+  RateStill(t, w);
+  if (s > 0.0)
+  {
+    w[0] = 60.0 * sin(2.0 * M_PI * 0.5 * s);
+    w[1] = 40.0 * sin(2.0 * M_PI * 0.3 * s);
+    w[2] = 10.0 * sin(2.0 * M_PI * 0.2 * s);
+  }
+}
+
+static void RateHeading(double t, double w[3])
+{
+  const double s = t - STILL_S;
+
+  RateStill(t, w);
+  if (s > 0.0)
+  {
+    w[0] = 20.0 * sin(2.0 * M_PI * 0.4 * s);
+    w[1] = 15.0 * sin(2.0 * M_PI * 0.25 * s);
+    w[2] = 90.0 * sin(2.0 * M_PI * 0.05 * s);
+  }
+}
+
+static void RateTumble(double t, double w[3])
+{
+  const double s = t - STILL_S;
+
+  RateStill(t, w);
+  if (s > 0.0)
+  {
+    w[0] = 45.0 * sin(2.0 * M_PI * 0.7 * s);
+    w[1] = 30.0 * (1.0 - cos(2.0 * M_PI * 0.4 * s));
+    w[2] = 60.0 * sin(2.0 * M_PI * 0.3 * s);
+  }
+}
+
+/**
+  * @brief  q = a (x) b, w x y z
+  */
+static void Product(const double a[4], const double b[4], double q[4])
+{
+  q[0] = (a[0] * b[0]) - (a[1] * b[1]) - (a[2] * b[2]) - (a[3] * b[3]);
+  q[1] = (a[0] * b[1]) + (a[1] * b[0]) + (a[2] * b[3]) - (a[3] * b[2]);
+  q[2] = (a[0] * b[2]) - (a[1] * b[3]) + (a[2] * b[0]) + (a[3] * b[1]);
+  q[3] = (a[0] * b[3]) + (a[1] * b[2]) - (a[2] * b[1]) + (a[3] * b[0]);
+}
+
+/**
+  * @brief  Advances the orientation by the body rate over dt, exactly for a
+  *         constant rate
+  */
+static void Rotate(double q[4], const double wDeg[3], double dt)
+{
+  const double wx = wDeg[0] * DEG;
+  const double wy = wDeg[1] * DEG;
+  const double wz = wDeg[2] * DEG;
+  const double rate = sqrt((wx * wx) + (wy * wy) + (wz * wz));
+  double step[4] = {1.0, 0.0, 0.0, 0.0};
+  double next[4];
+  double norm;
+  uint32_t i;
+
+  if (rate > 0.0)
+  {
+    const double s = sin(0.5 * rate * dt) / rate;
+
+    step[0] = cos(0.5 * rate * dt);
+    step[1] = wx * s;
+    step[2] = wy * s;
+    step[3] = wz * s;
+  }
+  Product(q, step, next);
+  norm = sqrt((next[0] * next[0]) + (next[1] * next[1]) + (next[2] * next[2]) + (next[3] * next[3]));
+  for (i = 0; i < 4U; i++)
+  {
+    q[i] = next[i] / norm;
+  }
+}
+
+/**
+  * @brief  Earth frame vector seen in the sensor frame, R(q)^T v
+  */
+static void ToSensor(const double q[4], const double v[3], double out[3])
+{
+  const double w = q[0];
+  const double x = q[1];
+  const double y = q[2];
+  const double z = q[3];
+
+  out[0] = ((1.0 - 2.0 * (y * y + z * z)) * v[0]) + (2.0 * (x * y + w * z) * v[1]) +
+           (2.0 * (x * z - w * y) * v[2]);
+  out[1] = (2.0 * (x * y - w * z) * v[0]) + ((1.0 - 2.0 * (x * x + z * z)) * v[1]) +
+           (2.0 * (y * z + w * x) * v[2]);
+  out[2] = (2.0 * (x * z + w * y) * v[0]) + (2.0 * (y * z - w * x) * v[1]) +
+           ((1.0 - 2.0 * (x * x + y * y)) * v[2]);
+}
+
+/**
+  * @brief  Orientation of yaw, then pitch, then roll (z-y-x)
+  */
+static void FromEuler(const double deg[3], double q[4])
+{
+  const double cr = cos(0.5 * deg[0] * DEG);
+  const double sr = sin(0.5 * deg[0] * DEG);
+  const double cp = cos(0.5 * deg[1] * DEG);
+  const double sp = sin(0.5 * deg[1] * DEG);
+  const double cy = cos(0.5 * deg[2] * DEG);
+  const double sy = sin(0.5 * deg[2] * DEG);
+
+  q[0] = (cr * cp * cy) + (sr * sp * sy);
+  q[1] = (sr * cp * cy) - (cr * sp * sy);
+  q[2] = (cr * sp * cy) + (sr * cp * sy);
+  q[3] = (cr * cp * sy) - (sr * sp * cy);
+}
+
+/**
+  * @brief  Writes one profile
+  * @param  dir      Output directory
+  * @param  profile  Profile
+  * @retval 0 on success
+  */
+static int Generate(const char *dir, const Profile_t *profile)
+{
+  const double gravity[3] = {0.0, 0.0, 1.0};
+  const double field[3] = {cos(MAG_DIP_DEG * DEG), 0.0, -sin(MAG_DIP_DEG * DEG)};
+  const uint32_t samples = (uint32_t)(profile->durationS * ODR_HZ);
+  char path[512];
+  double q[4];
+  double tPrev;
+  uint32_t k;
+  uint32_t i;
+  FILE *out;
+
+  snprintf(path, sizeof(path), "%s/%s.csv", dir, profile->name);
+  out = fopen(path, "w");
+  if (out == NULL)
+  {
+    fprintf(stderr, "FAILED: cannot write %s\n", path);
+    return 1;
+  }
+
+  fprintf(out, "# %s: %s\n", profile->name, profile->description);
+  fprintf(out, "# check=%s settle_s=%g rms_deg=%g max_deg=%g\n",
+          profile->check, profile->settleS, profile->rmsDeg, profile->maxDeg);
+  fprintf(out, "t_us,gx,gy,gz,ax,ay,az,mx,my,mz,qw,qx,qy,qz\n");
+
+  FromEuler(profile->start, q);
+  tPrev = 0.0;
+  for (k = 0; k < samples; k++)
+  {
+    const double tUs = START_US + round((k * 1.0e6 / ODR_HZ) + (JITTER_US * (2.0 * Uniform() - 1.0)));
+    const double t = (tUs - START_US) * 1.0e-6;
+    const double h = (t - tPrev) / SUBSTEPS;
+    double accel[3] = {0.0, 0.0, 0.0};
+    double mag[3] = {0.0, 0.0, 0.0};
+    double w[3];
+
+    /* Midpoint rates over the substeps up to the sample time */
+    for (i = 0; i < SUBSTEPS; i++)
+    {
+      profile->rate(tPrev + ((i + 0.5) * h), w);
+      Rotate(q, w, h);
+    }
+    tPrev = t;
+
+    profile->rate(t, w);
+    for (i = 0; i < 3U; i++)
+    {
+      w[i] += gyroBias[i] + (GYRO_NOISE_DPS * Gaussian());
+      w[i] = GYRO_LSB_DPS * round(w[i] / GYRO_LSB_DPS);
+    }
+
+    if (profile->accel && ((k % AUX_DIVIDER) == 0U))
+    {
+      double linear[3] = {0.0, 0.0, 0.0};
+
+      if (t > STILL_S)
+      {
+        linear[0] = profile->disturbanceG * sin(2.0 * M_PI * 1.3 * t);
+        linear[1] = profile->disturbanceG * cos(2.0 * M_PI * 0.9 * t);
+        linear[2] = profile->disturbanceG * sin(2.0 * M_PI * 0.7 * t);
+      }
+      ToSensor(q, gravity, accel);
+      for (i = 0; i < 3U; i++)
+      {
+        accel[i] += linear[i] + (ACCEL_NOISE * Gaussian());
+      }
+    }
+    if (profile->mag && ((k % AUX_DIVIDER) == (AUX_DIVIDER / 2U)))
+    {
+      ToSensor(q, field, mag);
+      for (i = 0; i < 3U; i++)
+      {
+        mag[i] += MAG_NOISE * Gaussian();
+      }
+    }
+
+    fprintf(out, "%.0f,%.5f,%.5f,%.5f,%.5f,%.5f,%.5f,%.5f,%.5f,%.5f,%.9f,%.9f,%.9f,%.9f\n",
+            tUs, w[0], w[1], w[2], accel[0], accel[1], accel[2], mag[0], mag[1], mag[2],
+            q[0], q[1], q[2], q[3]);
+  }
+
+  fclose(out);
+  return 0;
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  uint32_t p;
+
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s <output directory>\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  for (p = 0; p < (sizeof(profiles) / sizeof(profiles[0])); p++)
+  {
+    if (Generate(argv[1], &profiles[p]) != 0)
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,392 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Dataset replay check of the AHRS service
+  * @details Runs Peripherals/AHRS, the task, the bias calibration and both
+  *          filters, on recorded datasets (format in gen_datasets.c): the
+  *          gyro rows are delivered in watermark batches as the L3GD20
+  *          interrupt would, the accelerometer and magnetometer readings
+  *          handed in with AHRS_SetAccel()/AHRS_SetMag() at their time, and
+  *          every published attitude is compared with the true orientation
+  *          of its sample:
+  *          - "full" datasets score the angle of the rotation between the
+  *            estimate and the truth
+  *          - "tilt" datasets score the angle between the estimated and the
+  *            true gravity direction, heading being unobservable
+  *          Each dataset runs once per filter, in a child process, since the
+  *          service keeps its state in statics. The check fails if a sample
+  *          is dropped or published out of order, if the RMS or maximum
+  *          error after the settling time exceeds the limits of the dataset
+  *          or if an update takes longer than NS_PER_UPDATE_LIMIT on average.
+  *
+  *          The cost is measured by the service itself through the DWT
+  *          counter, which reads thread CPU time in ns here; the target
+  *          cycles are in the "ahrs" console report.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ahrs.h"
+#include "sim_ahrs.h"
+#include "sim_rtos.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define NS_PER_UPDATE_LIMIT 20000U      /* 1.5 % of the 760 Hz sample period */
+#define LINE_LENGTH         512U
+#define DEG                 (180.0 / M_PI)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint64_t timestampUs;
+  float32_t gyro[3];
+  float32_t accel[3];
+  float32_t mag[3];
+  double truth[4];
+} Row_t;
+
+typedef struct
+{
+  char name[64];
+  uint8_t tiltOnly;
+  double settleS;
+  double rmsLimit;
+  double maxLimit;
+  Row_t *rows;
+  uint32_t count;
+} Dataset_t;
+
+typedef struct
+{
+  uint64_t timestampUs;
+  float32_t q[4];
+} Estimate_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const defaultDatasets[] = {
+  AHRS_DATASET_DIR "/static_tilt.csv",
+  AHRS_DATASET_DIR "/tilt_sway.csv",
+  AHRS_DATASET_DIR "/heading.csv",
+  AHRS_DATASET_DIR "/gyro_only.csv",
+};
+
+static const char *const filterNames[] = {"madgwick", "mahony"};
+
+static Estimate_t *estimates;
+static uint32_t estimateCount;
+static uint32_t estimateCapacity;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Reads a dataset
+  * @param  path     CSV file
+  * @param  dataset  Destination
+  * @retval 0 on success
+  */
+static int LoadDataset(const char *path, Dataset_t *dataset)
+{
+  char line[LINE_LENGTH];
+  char check[16] = "";
+  uint32_t capacity = 0U;
+  uint32_t lineNumber = 0U;
+  FILE *in = fopen(path, "r");
+
+  memset(dataset, 0, sizeof(*dataset));
+  if (in == NULL)
+  {
+    printf("FAILED: cannot read %s\n", path);
+    return 1;
+  }
+
+  while (fgets(line, sizeof(line), in) != NULL)
+  {
+    Row_t row;
+    unsigned long long timestampUs;
+
+    lineNumber++;
+    if (line[0] == '#')
+    {
+      if (dataset->name[0] == '\0')
+      {
+        (void)sscanf(line, "# %63[^:]", dataset->name);
+      }
+      else
+      {
+        (void)sscanf(line, "# check=%15s settle_s=%lf rms_deg=%lf max_deg=%lf",
+                     check, &dataset->settleS, &dataset->rmsLimit, &dataset->maxLimit);
+      }
+      continue;
+    }
+    if (line[0] == 't')
+    {
+      continue;
+    }
+    if (sscanf(line, "%llu,%f,%f,%f,%f,%f,%f,%f,%f,%f,%lf,%lf,%lf,%lf", &timestampUs,
+               &row.gyro[0], &row.gyro[1], &row.gyro[2],
+               &row.accel[0], &row.accel[1], &row.accel[2],
+               &row.mag[0], &row.mag[1], &row.mag[2],
+               &row.truth[0], &row.truth[1], &row.truth[2], &row.truth[3]) != 14)
+    {
+      printf("FAILED: %s:%u does not parse\n", path, (unsigned)lineNumber);
+      fclose(in);
+      return 1;
+    }
+    row.timestampUs = timestampUs;
+
+    if (dataset->count == capacity)
+    {
+      Row_t *rows;
+
+      capacity = (capacity == 0U) ? 8192U : (2U * capacity);
+      rows = realloc(dataset->rows, capacity * sizeof(Row_t));
+      if (rows == NULL)
+      {
+        printf("FAILED: out of memory\n");
+        fclose(in);
+        return 1;
+      }
+      dataset->rows = rows;
+    }
+    dataset->rows[dataset->count++] = row;
+  }
+  fclose(in);
+
+  if ((strcmp(check, "tilt") != 0) && (strcmp(check, "full") != 0))
+  {
+    printf("FAILED: %s has no check line\n", path);
+    return 1;
+  }
+  dataset->tiltOnly = (strcmp(check, "tilt") == 0) ? 1U : 0U;
+  if (dataset->count <= AHRS_BIAS_SAMPLES)
+  {
+    printf("FAILED: %s is shorter than the bias calibration\n", path);
+    return 1;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Records every published attitude, runs in the AHRS task
+  */
+static void OnAttitude(const AHRS_Attitude_t *attitude, void *context)
+{
+  (void)context;
+
+  if (estimateCount < estimateCapacity)
+  {
+    estimates[estimateCount].timestampUs = attitude->timestampUs;
+    memcpy(estimates[estimateCount].q, attitude->q, sizeof(attitude->q));
+  }
+  estimateCount++;
+}
+
+/**
+  * @brief  Feeds the dataset to the service as the board would
+  * @details Aux readings are handed in at their row time; the gyro rows go
+  *          out in watermark batches, each processed before the next.
+  */
+static void Replay(const Dataset_t *dataset)
+{
+  L3GD20_Sample_t batch[L3GD20_FIFO_WATERMARK];
+  uint32_t fill = 0U;
+  uint32_t i;
+
+  for (i = 0; i < dataset->count; i++)
+  {
+    const Row_t *row = &dataset->rows[i];
+
+    SIM_SetTimeUs(row->timestampUs);
+    if ((row->accel[0] != 0.0f) || (row->accel[1] != 0.0f) || (row->accel[2] != 0.0f))
+    {
+      AHRS_SetAccel(row->accel);
+    }
+    if ((row->mag[0] != 0.0f) || (row->mag[1] != 0.0f) || (row->mag[2] != 0.0f))
+    {
+      AHRS_SetMag(row->mag);
+    }
+
+    batch[fill].timestampUs = row->timestampUs;
+    batch[fill].x = row->gyro[0];
+    batch[fill].y = row->gyro[1];
+    batch[fill].z = row->gyro[2];
+    if ((++fill == L3GD20_FIFO_WATERMARK) || ((i + 1U) == dataset->count))
+    {
+      SIM_GyroBatch(batch, fill);
+      SIM_WaitIdle();
+      fill = 0U;
+    }
+  }
+}
+
+/**
+  * @brief  Error of an estimate, degrees
+  * @param  q         Estimate
+  * @param  truth     True orientation
+  * @param  tiltOnly  Score the gravity direction only
+  * @retval Angle
+  */
+static double ErrorDeg(const float32_t q[4], const double truth[4], uint8_t tiltOnly)
+{
+  double dot;
+
+  if (tiltOnly)
+  {
+    /* Last rows of the rotation matrices: earth z in the sensor frame */
+    const double e[3] = {
+      2.0 * ((q[1] * q[3]) - (q[0] * q[2])),
+      2.0 * ((q[2] * q[3]) + (q[0] * q[1])),
+      1.0 - (2.0 * ((q[1] * q[1]) + (q[2] * q[2]))),
+    };
+    const double t[3] = {
+      2.0 * ((truth[1] * truth[3]) - (truth[0] * truth[2])),
+      2.0 * ((truth[2] * truth[3]) + (truth[0] * truth[1])),
+      1.0 - (2.0 * ((truth[1] * truth[1]) + (truth[2] * truth[2]))),
+    };
+
+    dot = ((e[0] * t[0]) + (e[1] * t[1]) + (e[2] * t[2])) /
+          sqrt(((e[0] * e[0]) + (e[1] * e[1]) + (e[2] * e[2])) *
+               ((t[0] * t[0]) + (t[1] * t[1]) + (t[2] * t[2])));
+    return acos(fmin(1.0, fmax(-1.0, dot))) * DEG;
+  }
+
+  dot = fabs((q[0] * truth[0]) + (q[1] * truth[1]) + (q[2] * truth[2]) + (q[3] * truth[3]));
+  return 2.0 * acos(fmin(1.0, dot)) * DEG;
+}
+
+/**
+  * @brief  Replays one dataset through one filter and scores it
+  * @param  path  Dataset
+  * @param  type  Filter
+  * @retval EXIT_SUCCESS or EXIT_FAILURE
+  */
+static int Run(const char *path, AHRS_FilterType_t type)
+{
+  Dataset_t dataset;
+  AHRS_Stats_t stats;
+  double sumSquares = 0.0;
+  double worst = 0.0;
+  uint32_t scored = 0U;
+  uint32_t failures = 0U;
+  uint32_t k;
+
+  if (LoadDataset(path, &dataset) != 0)
+  {
+    return EXIT_FAILURE;
+  }
+  estimateCapacity = dataset.count - AHRS_BIAS_SAMPLES;
+  estimates = calloc(estimateCapacity, sizeof(Estimate_t));
+  if (estimates == NULL)
+  {
+    printf("FAILED: out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  AHRS_Init(type);
+  AHRS_SetCallback(OnAttitude, NULL);
+  Replay(&dataset);
+  AHRS_GetStats(&stats);
+
+  /* Update k is the step of row AHRS_BIAS_SAMPLES + k */
+  for (k = 0; (k < estimateCount) && (k < estimateCapacity); k++)
+  {
+    const Row_t *row = &dataset.rows[AHRS_BIAS_SAMPLES + k];
+    double error;
+
+    if (estimates[k].timestampUs != row->timestampUs)
+    {
+      printf("FAILED: %s %s: update %u stamped %llu us, sample %llu us\n", dataset.name,
+             filterNames[type], (unsigned)k, (unsigned long long)estimates[k].timestampUs,
+             (unsigned long long)row->timestampUs);
+      return EXIT_FAILURE;
+    }
+    if ((double)(row->timestampUs - dataset.rows[0].timestampUs) < (dataset.settleS * 1.0e6))
+    {
+      continue;
+    }
+    error = ErrorDeg(estimates[k].q, row->truth, dataset.tiltOnly);
+    sumSquares += error * error;
+    worst = fmax(worst, error);
+    scored++;
+  }
+
+  printf("%-12s %-8s %5u updates, %s error rms %.2f / max %.2f deg (limit %.1f / %.1f), "
+         "%u ns per update (max %u)\n", dataset.name, filterNames[type], (unsigned)stats.updates,
+         dataset.tiltOnly ? "tilt" : "attitude", sqrt(sumSquares / (scored ? scored : 1U)), worst,
+         dataset.rmsLimit, dataset.maxLimit, (unsigned)stats.cyclesAvg, (unsigned)stats.cyclesMax);
+
+  if ((stats.dropped != 0U) || (stats.updates != estimateCapacity) ||
+      (estimateCount != estimateCapacity) || !stats.biasValid)
+  {
+    printf("FAILED: %s %s: %u of %u samples filtered, %u dropped\n", dataset.name,
+           filterNames[type], (unsigned)stats.updates, (unsigned)estimateCapacity,
+           (unsigned)stats.dropped);
+    failures++;
+  }
+  if ((scored == 0U) || (sqrt(sumSquares / scored) > dataset.rmsLimit) ||
+      (worst > dataset.maxLimit))
+  {
+    printf("FAILED: %s %s accuracy\n", dataset.name, filterNames[type]);
+    failures++;
+  }
+  if (stats.cyclesAvg > NS_PER_UPDATE_LIMIT)
+  {
+    printf("FAILED: %s %s update cost\n", dataset.name, filterNames[type]);
+    failures++;
+  }
+
+  return (failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  const char *const *paths = defaultDatasets;
+  uint32_t count = sizeof(defaultDatasets) / sizeof(defaultDatasets[0]);
+  uint32_t failures = 0U;
+  uint32_t d;
+  uint32_t f;
+
+  /* Recorded datasets on the command line replace the generated ones */
+  if (argc > 1)
+  {
+    paths = (const char *const *)&argv[1];
+    count = (uint32_t)(argc - 1);
+  }
+
+  for (d = 0; d < count; d++)
+  {
+    for (f = 0; f < (sizeof(filterNames) / sizeof(filterNames[0])); f++)
+    {
+      int status;
+      pid_t child;
+
+      fflush(stdout);
+      child = fork();
+      if (child == 0)
+      {
+        exit(Run(paths[d], (AHRS_FilterType_t)f));
+      }
+      if ((child < 0) || (waitpid(child, &status, 0) != child) ||
+          !WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS))
+      {
+        failures++;
+      }
+    }
+  }
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u runs\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+/**
+  ******************************************************************************
+  * @file    sim_ahrs.c
+  * @brief   Board stand-in, AHRS check
+  * @details The RTOS and the core come from tools/common. Here the L3GD20
+  *          driver is replaced by SIM_GyroBatch(), which calls the
+  *          registered consumers with the interrupts masked, and the
+  *          timebase by a clock the check sets.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_ahrs.h"
+#include "stack_monitor.h"
+#include "timebase.h"
+
+/* Private variables ---------------------------------------------------------*/
+static L3GD20_Callback_t gyroCallbacks[L3GD20_MAX_CALLBACKS];
+static void *gyroContexts[L3GD20_MAX_CALLBACKS];
+static uint32_t gyroCallbackCount;
+
+static volatile uint64_t simNowUs;
+
+/* Timebase ------------------------------------------------------------------*/
+uint64_t TIMEBASE_GetUs(void)
+{
+  return simNowUs;
+}
+
+void SIM_SetTimeUs(uint64_t nowUs)
+{
+  simNowUs = nowUs;
+  SIM_TIM2.CNT = (uint32_t)nowUs;
+}
+
+/* Stack monitor -------------------------------------------------------------*/
+void STACKMON_Watch(osThreadId_t thread, uint32_t stackBytes)
+{
+  (void)thread;
+  (void)stackBytes;
+}
+
+/* L3GD20 --------------------------------------------------------------------*/
+HAL_StatusTypeDef L3GD20_AddCallback(L3GD20_Callback_t callback, void *context)
+{
+  if (gyroCallbackCount >= L3GD20_MAX_CALLBACKS)
+  {
+    return HAL_ERROR;
+  }
+  gyroCallbacks[gyroCallbackCount] = callback;
+  gyroContexts[gyroCallbackCount] = context;
+  gyroCallbackCount++;
+  return HAL_OK;
+}
+
+uint32_t L3GD20_GetOdrHz(void)
+{
+  return L3GD20_ODR_HZ;
+}
+
+/* Controls ------------------------------------------------------------------*/
+void SIM_GyroBatch(const L3GD20_Sample_t *samples, uint32_t count)
+{
+  uint32_t primask;
+  uint32_t i;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (i = 0; i < gyroCallbackCount; i++)
+  {
+    gyroCallbacks[i](samples, count, gyroContexts[i]);
+  }
+  __set_PRIMASK(primask);
+}
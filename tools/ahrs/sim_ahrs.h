@@ -0,0 +1,24 @@
+/**
+  ******************************************************************************
+  * @file    sim_ahrs.h
+  * @brief   Controls of the board stand-in, AHRS check
+  * @details The check sets the timebase and delivers gyro batches as the
+  *          L3GD20 DMA interrupt would; SIM_WaitIdle() of sim_rtos.h waits
+  *          for the AHRS task to work through them.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SIM_AHRS_H__
+#define __SIM_AHRS_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "l3gd20.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+void SIM_SetTimeUs(uint64_t nowUs);
+void SIM_GyroBatch(const L3GD20_Sample_t *samples, uint32_t count);
+
+#endif /* __SIM_AHRS_H__ */
@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOSConfig.h
+  * @brief   FreeRTOS configuration of the host port
+  * @details Core/Inc/FreeRTOSConfig.h where the kernel behaviour matters to
+  *          the code under test (preemption, mutexes, static allocation,
+  *          heap_4), without the Cortex-M interrupt priorities, the newlib
+  *          reentrancy glibc has no use for and the services no host check
+  *          runs (timers, trace, run time statistics).
+  *
+  *          configASSERT() calls vAssertCalled(), which the check provides:
+  *          it counts instead of stopping, so a check can see an assert the
+  *          code under test is expected to hit. The port takes the idle
+  *          hook, see port.c.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Kernel --------------------------------------------------------------------*/
+#define configUSE_PREEMPTION                     1
+#define configSUPPORT_STATIC_ALLOCATION          1
+#define configSUPPORT_DYNAMIC_ALLOCATION         1
+#define configUSE_IDLE_HOOK                      1
+#define configUSE_TICK_HOOK                      0
+#define configTICK_RATE_HZ                       ((TickType_t)1000)
+#define configMAX_PRIORITIES                     ( 56 )
+#define configMINIMAL_STACK_SIZE                 ((uint16_t)128)
+#define configTOTAL_HEAP_SIZE                    ((size_t)65536)
+#define configMAX_TASK_NAME_LEN                  ( 16 )
+#define configUSE_16_BIT_TICKS                   0
+#define configUSE_MUTEXES                        1
+#define configUSE_RECURSIVE_MUTEXES              1
+#define configUSE_COUNTING_SEMAPHORES            1
+#define configUSE_TASK_NOTIFICATIONS             1
+#define configUSE_NEWLIB_REENTRANT               0
+#define configCHECK_FOR_STACK_OVERFLOW           0
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION  0
+#define configUSE_CO_ROUTINES                    0
+#define configUSE_TIMERS                         0
+
+/* API functions included ----------------------------------------------------*/
+#define INCLUDE_vTaskDelete                      1
+#define INCLUDE_vTaskDelay                       1
+#define INCLUDE_vTaskSuspend                     1
+#define INCLUDE_xTaskGetSchedulerState           1
+#define INCLUDE_xTaskGetCurrentTaskHandle        1
+#define INCLUDE_xQueueGetMutexHolder             1
+
+/* Asserts -------------------------------------------------------------------*/
+void vAssertCalled(const char *file, int line);
+#define configASSERT( x ) if ((x) == 0) { vAssertCalled(__FILE__, __LINE__); }
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,420 @@
+/**
+  ******************************************************************************
+  * @file    port.c
+  * @brief   FreeRTOS port to POSIX threads for the host checks
+  * @details Runs the kernel of Middlewares/Third_Party/FreeRTOS unchanged on
+  *          the host, so the code under test blocks, wakes and is preempted
+  *          by the real scheduler, not by an imitation of it.
+  *
+  *          - Every task is a POSIX thread. Only the thread of the task the
+  *            kernel selected runs; the others wait on their own condition
+  *            variable. The thread record lives at the top of the task stack
+  *            and is what pxTopOfStack points to, so the TCB leads to it.
+  *          - Interrupts are the PRIMASK of host_core, shared with the device
+  *            models; the critical nesting is the global of the Cortex-M4
+  *            port, so a yield requested inside a section is taken on exit.
+  *          - The tick is a thread that masks interrupts and calls
+  *            xTaskIncrementTick() every 1/configTICK_RATE_HZ. A context
+  *            switch it requests, or an ISR does, is taken at the next port
+  *            call of the running task (yield, critical exit): preemption is
+  *            late, but never lands inside the C library the task is in.
+  *          - The port takes the idle hook, to sleep instead of spinning
+  *            until a switch is pending.
+  *          - vTaskEndScheduler() returns from vTaskStartScheduler() in the
+  *            thread that called it, so a check can look at the outcome.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "FreeRTOS.h"
+#include "task.h"
+#include "main.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define PORT_NS_PER_S             1000000000L
+#define PORT_TICK_NS              (PORT_NS_PER_S / (long)configTICK_RATE_HZ)
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Host thread of a task, at the top of its stack
+ */
+typedef struct
+{
+  pthread_t thread;
+  pthread_cond_t wake;               /*!< Signalled when the task may run */
+  TaskFunction_t code;
+  void *params;
+  volatile uint8_t exiting;          /*!< Deleted itself, ends on its switch */
+} PORT_Thread_t;
+
+/* Private variables ---------------------------------------------------------*/
+static volatile UBaseType_t uxCriticalNesting = 0xaaaaaaaaUL;
+
+/**
+ * @brief   Run token: the task allowed to execute, under runLock
+ */
+static pthread_mutex_t runLock = PTHREAD_MUTEX_INITIALIZER;
+static PORT_Thread_t *running;
+
+static pthread_cond_t endCond = PTHREAD_COND_INITIALIZER;
+static atomic_uint ended;
+static atomic_uint yieldPending;
+static pthread_t tickThread;
+
+/**
+ * @brief   Task of the calling thread, NULL outside the tasks
+ */
+static _Thread_local PORT_Thread_t *self;
+
+/* Private function prototypes -----------------------------------------------*/
+static PORT_Thread_t *PORT_Current(void);
+static void PORT_Wait(PORT_Thread_t *thread);
+static void PORT_Unlock(void *arg);
+static void PORT_Pend(void);
+static void PORT_Switch(void);
+static void *PORT_TaskEntry(void *arg);
+static void *PORT_Tick(void *arg);
+
+/**
+  * @brief  Set up the thread of a new task
+  * @param  pxTopOfStack  Top of the task stack
+  * @param  pxCode        Task function
+  * @param  pvParameters  Task argument
+  * @retval Top of stack for the TCB, the thread record
+  */
+StackType_t *pxPortInitialiseStack(StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters)
+{
+  PORT_Thread_t *thread;
+  int error;
+
+  thread = (PORT_Thread_t *)(((uintptr_t)pxTopOfStack - sizeof(PORT_Thread_t)) & ~(uintptr_t)15U);
+  thread->code = pxCode;
+  thread->params = pvParameters;
+  thread->exiting = 0U;
+  pthread_cond_init(&thread->wake, NULL);
+
+  error = pthread_create(&thread->thread, NULL, PORT_TaskEntry, thread);
+  configASSERT(error == 0);
+  (void)error;
+
+  return (StackType_t *)thread;
+}
+
+/**
+  * @brief  Start the first task and the tick
+  * @details Returns once a task calls vTaskEndScheduler()
+  * @param  None
+  * @retval pdFALSE
+  */
+BaseType_t xPortStartScheduler(void)
+{
+  PORT_Thread_t *first = PORT_Current();
+
+  uxCriticalNesting = 0U;
+  atomic_store(&ended, 0U);
+  atomic_store(&yieldPending, 0U);
+
+  pthread_mutex_lock(&runLock);
+  running = first;
+  pthread_cond_signal(&first->wake);
+  pthread_mutex_unlock(&runLock);
+
+  pthread_create(&tickThread, NULL, PORT_Tick, NULL);
+
+  /* vTaskStartScheduler() masked them for the start */
+  __enable_irq();
+
+  pthread_mutex_lock(&runLock);
+  while (atomic_load(&ended) == 0U)
+  {
+    pthread_cond_wait(&endCond, &runLock);
+  }
+  pthread_mutex_unlock(&runLock);
+
+  pthread_join(tickThread, NULL);
+  return pdFALSE;
+}
+
+/**
+  * @brief  Stop the scheduler and park the calling task
+  * @param  None
+  * @retval None
+  */
+void vPortEndScheduler(void)
+{
+  pthread_mutex_lock(&runLock);
+  atomic_store(&ended, 1U);
+  running = NULL;
+  pthread_cond_broadcast(&endCond);
+  __enable_irq();
+  PORT_Wait(self);
+  pthread_mutex_unlock(&runLock);
+}
+
+/**
+  * @brief  Request a context switch
+  * @details Switches now unless interrupts are masked; then on the exit
+  *          of the critical section, as PendSV would
+  * @param  None
+  * @retval None
+  */
+void vPortYield(void)
+{
+  if (self == NULL)
+  {
+    return;
+  }
+
+  if ((uxCriticalNesting == 0U) && (__get_PRIMASK() == 0U))
+  {
+    PORT_Switch();
+  }
+  else
+  {
+    PORT_Pend();
+  }
+}
+
+/**
+  * @brief  Request a context switch from an interrupt handler
+  * @param  None
+  * @retval None
+  */
+void vPortYieldFromISR(void)
+{
+  PORT_Pend();
+}
+
+/**
+  * @brief  Enter a critical section
+  * @param  None
+  * @retval None
+  */
+void vPortEnterCritical(void)
+{
+  __disable_irq();
+  uxCriticalNesting++;
+}
+
+/**
+  * @brief  Leave a critical section, taking a pending switch at the outermost
+  * @param  None
+  * @retval None
+  */
+void vPortExitCritical(void)
+{
+  configASSERT(uxCriticalNesting != 0U);
+  uxCriticalNesting--;
+  if (uxCriticalNesting == 0U)
+  {
+    __enable_irq();
+    if ((self != NULL) && (atomic_load(&yieldPending) != 0U))
+    {
+      PORT_Switch();
+    }
+  }
+}
+
+void vPortDisableInterrupts(void)
+{
+  __disable_irq();
+}
+
+void vPortEnableInterrupts(void)
+{
+  __enable_irq();
+}
+
+uint32_t ulPortSetInterruptMask(void)
+{
+  uint32_t mask = __get_PRIMASK();
+
+  __disable_irq();
+  return mask;
+}
+
+void vPortClearInterruptMask(uint32_t ulMask)
+{
+  __set_PRIMASK(ulMask);
+}
+
+/**
+  * @brief  The running task deleted itself: its thread ends on the switch
+  * @param  None
+  * @retval None
+  */
+void vPortTaskExiting(void)
+{
+  self->exiting = 1U;
+}
+
+/**
+  * @brief  Reclaim the thread of a deleted task before its stack is freed
+  * @param  pxTCB  Task control block, led by pxTopOfStack
+  * @retval None
+  */
+void vPortCleanUpTCB(void *pxTCB)
+{
+  PORT_Thread_t *thread = *(PORT_Thread_t **)pxTCB;
+
+  if (thread->exiting == 0U)
+  {
+    pthread_cancel(thread->thread);
+  }
+  pthread_join(thread->thread, NULL);
+  pthread_cond_destroy(&thread->wake);
+}
+
+/**
+  * @brief  Idle hook: sleep until a context switch is pending
+  * @param  None
+  * @retval None
+  */
+void vApplicationIdleHook(void)
+{
+  pthread_mutex_lock(&runLock);
+  while (atomic_load(&yieldPending) == 0U)
+  {
+    pthread_cond_wait(&self->wake, &runLock);
+  }
+  pthread_mutex_unlock(&runLock);
+
+  PORT_Switch();
+}
+
+/**
+  * @brief  Thread record of the task the kernel selected
+  * @param  None
+  * @retval Thread record
+  */
+static PORT_Thread_t *PORT_Current(void)
+{
+  return *(PORT_Thread_t **)xTaskGetCurrentTaskHandle();
+}
+
+/**
+  * @brief  Wait for the run token, runLock held
+  * @details A task deleted by another one is cancelled here
+  * @param  thread  Calling task
+  * @retval None
+  */
+static void PORT_Wait(PORT_Thread_t *thread)
+{
+  pthread_cleanup_push(PORT_Unlock, NULL);
+  while (running != thread)
+  {
+    pthread_cond_wait(&thread->wake, &runLock);
+  }
+  pthread_cleanup_pop(0);
+}
+
+static void PORT_Unlock(void *arg)
+{
+  (void)arg;
+  pthread_mutex_unlock(&runLock);
+}
+
+/**
+  * @brief  Latch a context switch for the running task to take
+  * @param  None
+  * @retval None
+  */
+static void PORT_Pend(void)
+{
+  pthread_mutex_lock(&runLock);
+  atomic_store(&yieldPending, 1U);
+  if (running != NULL)
+  {
+    pthread_cond_signal(&running->wake);
+  }
+  pthread_mutex_unlock(&runLock);
+}
+
+/**
+  * @brief  Hand the run token to the task the kernel selects
+  * @details The calling task waits for its next turn, or ends if it
+  *          deleted itself
+  * @param  None
+  * @retval None
+  */
+static void PORT_Switch(void)
+{
+  PORT_Thread_t *next;
+
+  __disable_irq();
+  pthread_mutex_lock(&runLock);
+  atomic_store(&yieldPending, 0U);
+  vTaskSwitchContext();
+  next = PORT_Current();
+  if (next != self)
+  {
+    running = next;
+    pthread_cond_signal(&next->wake);
+  }
+  __enable_irq();
+
+  if (self->exiting != 0U)
+  {
+    pthread_mutex_unlock(&runLock);
+    pthread_exit(NULL);
+  }
+  PORT_Wait(self);
+  pthread_mutex_unlock(&runLock);
+}
+
+/**
+  * @brief  Thread of a task: waits for the first turn, runs the function
+  * @param  arg  Thread record
+  * @retval None
+  */
+static void *PORT_TaskEntry(void *arg)
+{
+  self = (PORT_Thread_t *)arg;
+
+  pthread_mutex_lock(&runLock);
+  PORT_Wait(self);
+  pthread_mutex_unlock(&runLock);
+
+  self->code(self->params);
+
+  /* A task function must not return, as on the Cortex-M4 port */
+  configASSERT(0);
+  vTaskDelete(NULL);
+  return NULL;
+}
+
+/**
+  * @brief  Kernel tick, at configTICK_RATE_HZ of the host clock
+  * @param  arg  Unused
+  * @retval None
+  */
+static void *PORT_Tick(void *arg)
+{
+  struct timespec next;
+
+  (void)arg;
+  clock_gettime(CLOCK_MONOTONIC, &next);
+  while (atomic_load(&ended) == 0U)
+  {
+    next.tv_nsec += PORT_TICK_NS;
+    if (next.tv_nsec >= PORT_NS_PER_S)
+    {
+      next.tv_nsec -= PORT_NS_PER_S;
+      next.tv_sec++;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+    __disable_irq();
+    if ((atomic_load(&ended) == 0U) && (xTaskIncrementTick() != pdFALSE))
+    {
+      PORT_Pend();
+    }
+    __enable_irq();
+  }
+  return NULL;
+}
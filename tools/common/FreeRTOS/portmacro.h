@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    portmacro.h
+  * @brief   FreeRTOS port to POSIX threads for the host checks
+  * @details Types and port macros of the host port, see port.c. The
+  *          interrupt mask is the PRIMASK of host_core (sim_core.c), so a
+  *          critical section keeps the kernel tick and the device models
+  *          out just as on the board.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Type definitions ----------------------------------------------------------*/
+#define portCHAR          char
+#define portFLOAT         float
+#define portDOUBLE        double
+#define portLONG          long
+#define portSHORT         short
+#define portSTACK_TYPE    unsigned long
+#define portBASE_TYPE     long
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+  typedef uint16_t TickType_t;
+  #define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+  typedef uint32_t TickType_t;
+  #define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+  #define portTICK_TYPE_IS_ATOMIC 1
+#endif
+
+/* Architecture specifics ----------------------------------------------------*/
+#define portSTACK_GROWTH          ( -1 )
+#define portTICK_PERIOD_MS        ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT        8
+#define portPOINTER_SIZE_TYPE     uintptr_t
+#define portNOP()
+
+/* Scheduler utilities -------------------------------------------------------*/
+void vPortYield(void);
+#define portYIELD()                                 vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired )    if( xSwitchRequired != pdFALSE ) vPortYieldFromISR()
+#define portYIELD_FROM_ISR( x )                     portEND_SWITCHING_ISR( x )
+
+/* Critical section management -----------------------------------------------*/
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+void vPortDisableInterrupts(void);
+void vPortEnableInterrupts(void);
+uint32_t ulPortSetInterruptMask(void);
+void vPortClearInterruptMask(uint32_t ulMask);
+void vPortYieldFromISR(void);
+
+#define portDISABLE_INTERRUPTS()                    vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()                     vPortEnableInterrupts()
+#define portENTER_CRITICAL()                        vPortEnterCritical()
+#define portEXIT_CRITICAL()                         vPortExitCritical()
+#define portSET_INTERRUPT_MASK_FROM_ISR()           ulPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )      vPortClearInterruptMask( x )
+
+/* Task deletion -------------------------------------------------------------*/
+void vPortCleanUpTCB(void *pxTCB);
+void vPortTaskExiting(void);
+#define portCLEAN_UP_TCB( pxTCB )                                   vPortCleanUpTCB( pxTCB )
+#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )  vPortTaskExiting()
+
+/* Task function macros ------------------------------------------------------*/
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_os.h
+  * @brief   Host build stand-in for CMSIS-RTOS2
+  * @details Threads and message queues on POSIX threads, the calls the
+  *          host-built Peripherals code makes; sim_rtos.c implements them.
+  *          A put never blocks, a get blocks only with a timeout other
+  *          than 0, as in the driver and service code that uses them.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __CMSIS_OS_H__
+#define __CMSIS_OS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define osWaitForever             0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  osOK              = 0,
+  osError           = -1,
+  osErrorTimeout    = -2,
+  osErrorResource   = -3
+} osStatus_t;
+
+typedef enum
+{
+  osPriorityNormal       = 24,
+  osPriorityAboveNormal  = 32,
+  osPriorityHigh         = 40
+} osPriority_t;
+
+typedef void *osThreadId_t;
+typedef void *osMessageQueueId_t;
+typedef void (*osThreadFunc_t)(void *argument);
+typedef struct osMessageQueueAttr osMessageQueueAttr_t;
+
+typedef struct
+{
+  const char *name;
+  uint32_t stack_size;
+  osPriority_t priority;
+} osThreadAttr_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr);
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout);
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CMSIS_OS_H__ */
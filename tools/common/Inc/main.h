@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file    main.h
+  * @brief   Host build stand-in for Core/Inc/main.h
+  * @details The simulated HAL, Error_Handler() and the board pins of the
+  *          devices the host checks model, with the names and ports of
+  *          Core/Inc/main.h.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+void Error_Handler(void);
+
+/* Private defines -----------------------------------------------------------*/
+#define NCS_MEMS_SPI_Pin          GPIO_PIN_1
+#define NCS_MEMS_SPI_GPIO_Port    GPIOC
+#define MEMS_INT2_Pin             GPIO_PIN_2
+#define MEMS_INT2_GPIO_Port       GPIOA
+#define TP_INT1_Pin               GPIO_PIN_15
+#define TP_INT1_GPIO_Port         GPIOA
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H */
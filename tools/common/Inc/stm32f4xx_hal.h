@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal.h
+  * @brief   Simulated HAL for host builds
+  * @details The subset of the STM32F4 HAL and CMSIS the host-built
+  *          Peripherals code uses, with the same names, types and
+  *          constants. Register blocks are plain structures in host memory
+  *          (USART1, DMA2_Stream5, GPIOA, ...). Two implementations sit
+  *          behind it:
+  *          - sim_hal.c moves the data between the UART, DMA and CRC blocks
+  *            on a virtual clock and runs the interrupt handlers by priority
+  *          - sim_core.c only keeps the state a device model reads or sets:
+  *            pin levels, the NVIC enables and priorities, PRIMASK shared by
+  *            the threads of a check
+  *          Only what the code under test touches is there: including this
+  *          header from a module that needs more fails at compile time
+  *          instead of at run time.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4XX_HAL_H__
+#define __STM32F4XX_HAL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+#include "stm32f4xx_hal_dma.h"
+#include "stm32f4xx_hal_uart.h"
+#include "stm32f4xx_hal_crc.h"
+#include "stm32f4xx_hal_gpio.h"
+#include "stm32f4xx_hal_spi.h"
+
+/* HAL core ------------------------------------------------------------------*/
+#define TICK_INT_PRIORITY         0U        /* As stm32f4xx_hal_conf.h */
+#define HAL_MAX_DELAY             0xFFFFFFFFU
+
+extern __IO uint32_t uwTick;
+
+uint32_t HAL_GetTick(void);
+void HAL_IncTick(void);
+void HAL_Delay(uint32_t Delay);
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_SetPendingIRQ(IRQn_Type IRQn);
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+
+uint32_t HAL_RCC_GetSysClockFreq(void);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4XX_HAL_H__ */
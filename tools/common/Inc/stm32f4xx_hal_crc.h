@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_crc.h
+  * @brief   Simulated HAL for host builds: CRC
+  * @details The CRC unit of the F4: CRC-32 polynomial 0x04C11DB7, reset
+  *          value 0xFFFFFFFF, 32-bit words fed most significant bit first,
+  *          no reflection and no final XOR.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4XX_HAL_CRC_H__
+#define __STM32F4XX_HAL_CRC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  HAL_CRC_STATE_RESET = 0x00U,
+  HAL_CRC_STATE_READY = 0x01U,
+  HAL_CRC_STATE_BUSY  = 0x02U
+} HAL_CRC_StateTypeDef;
+
+typedef struct
+{
+  CRC_TypeDef *Instance;
+  HAL_LockTypeDef Lock;
+  __IO HAL_CRC_StateTypeDef State;
+} CRC_HandleTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc);
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4XX_HAL_CRC_H__ */
@@ -0,0 +1,199 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_def.h
+  * @brief   Simulated HAL for host builds: common definitions
+  * @details Status and lock types, register blocks and bits, and the CMSIS
+  *          core functions of the simulated device. See stm32f4xx_hal.h.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4XX_HAL_DEF_H__
+#define __STM32F4XX_HAL_DEF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported macros -----------------------------------------------------------*/
+#define __IO                      volatile
+#define __weak                    __attribute__((weak))
+#define UNUSED(X)                 (void)(X)
+
+#define SET_BIT(REG, BIT)         ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)       ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)        ((REG) & (BIT))
+#define READ_REG(REG)             ((REG))
+#define WRITE_REG(REG, VAL)       ((REG) = (VAL))
+#define ATOMIC_SET_BIT(REG, BIT)  SET_BIT(REG, BIT)
+#define ATOMIC_CLEAR_BIT(REG, BIT) CLEAR_BIT(REG, BIT)
+
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__) \
+  do                                                               \
+  {                                                                \
+    (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__);           \
+    (__DMA_HANDLE__).Parent = (__HANDLE__);                        \
+  } while (0U)
+
+/* Clock gates have nothing to gate */
+#define __HAL_RCC_DMA2_CLK_ENABLE()   ((void)0)
+#define __HAL_RCC_CRC_CLK_ENABLE()    ((void)0)
+#define __HAL_RCC_USART1_CLK_ENABLE() ((void)0)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  RESET = 0U,
+  SET = !RESET
+} FlagStatus, ITStatus;
+
+typedef enum
+{
+  HAL_UNLOCKED = 0x00U,
+  HAL_LOCKED   = 0x01U
+} HAL_LockTypeDef;
+
+/**
+ * @brief   Interrupt numbers of the device, the ones the sim raises
+ */
+typedef enum
+{
+  EXTI2_IRQn         = 8,
+  USART1_IRQn        = 37,
+  EXTI15_10_IRQn     = 40,
+  TIM6_DAC_IRQn      = 54,
+  DMA2_Stream5_IRQn  = 68,
+  DMA2_Stream7_IRQn  = 70,
+  SIM_IRQn_COUNT     = 91
+} IRQn_Type;
+
+/* Register blocks -----------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t SR;
+  __IO uint32_t DR;
+  __IO uint32_t BRR;
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t CR3;
+  __IO uint32_t GTPR;
+} USART_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t NDTR;
+  __IO uint32_t PAR;
+  __IO uint32_t M0AR;           /*!< Not used: a host address does not fit */
+  __IO uint32_t M1AR;
+  __IO uint32_t FCR;
+} DMA_Stream_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t DR;
+  __IO uint8_t  IDR;
+  uint8_t       RESERVED0;
+  uint16_t      RESERVED1;
+  __IO uint32_t CR;
+} CRC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t IDR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CNT;
+} TIM_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CYCCNT;
+} DWT_Type;
+
+extern USART_TypeDef SIM_USART1;
+extern USART_TypeDef SIM_USART6;
+extern DMA_Stream_TypeDef SIM_DMA2_Stream5;
+extern DMA_Stream_TypeDef SIM_DMA2_Stream7;
+extern CRC_TypeDef SIM_CRC;
+extern GPIO_TypeDef SIM_GPIOA;
+extern GPIO_TypeDef SIM_GPIOC;
+extern TIM_TypeDef SIM_TIM2;
+
+#define USART1                    (&SIM_USART1)
+#define USART6                    (&SIM_USART6)
+#define DMA2_Stream5              (&SIM_DMA2_Stream5)
+#define DMA2_Stream7              (&SIM_DMA2_Stream7)
+#define CRC                       (&SIM_CRC)
+#define GPIOA                     (&SIM_GPIOA)
+#define GPIOC                     (&SIM_GPIOC)
+#define TIM2                      (&SIM_TIM2)
+#define DWT                       (SIM_CycleCounter())   /* CYCCNT read on access */
+
+/* Register bits -------------------------------------------------------------*/
+#define USART_SR_PE               0x0001U
+#define USART_SR_FE               0x0002U
+#define USART_SR_NE               0x0004U
+#define USART_SR_ORE              0x0008U
+#define USART_SR_IDLE             0x0010U
+#define USART_SR_RXNE             0x0020U
+#define USART_SR_TC               0x0040U
+#define USART_SR_TXE              0x0080U
+
+#define USART_CR1_RE              0x0004U
+#define USART_CR1_TE              0x0008U
+#define USART_CR1_IDLEIE          0x0010U
+#define USART_CR1_RXNEIE          0x0020U
+#define USART_CR1_TCIE            0x0040U
+#define USART_CR1_TXEIE           0x0080U
+#define USART_CR1_PEIE            0x0100U
+#define USART_CR1_M               0x1000U
+#define USART_CR1_UE              0x2000U
+#define USART_CR1_OVER8           0x8000U
+
+#define USART_CR2_STOP_1          0x2000U
+
+#define USART_CR3_EIE             0x0001U
+#define USART_CR3_DMAR            0x0040U
+#define USART_CR3_DMAT            0x0080U
+
+#define DMA_SxCR_EN               0x00000001U
+#define DMA_SxCR_TEIE             0x00000004U
+#define DMA_SxCR_HTIE             0x00000008U
+#define DMA_SxCR_TCIE             0x00000010U
+#define DMA_SxCR_CIRC             0x00000100U
+#define DMA_SxCR_DBM              0x00040000U
+
+#define CRC_CR_RESET              0x00000001U
+
+/* CMSIS core ----------------------------------------------------------------*/
+uint32_t __get_IPSR(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq(void);
+void __enable_irq(void);
+DWT_Type *SIM_CycleCounter(void);
+#define __NOP()                   ((void)0)
+#define __DSB()                   ((void)0)
+#define __ISB()                   ((void)0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4XX_HAL_DEF_H__ */
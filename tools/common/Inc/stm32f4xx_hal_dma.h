@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_dma.h
+  * @brief   Simulated HAL for host builds: DMA
+  * @details Stream handles as in the HAL. The sim moves one byte per UART
+  *          request and counts NDTR down the way the stream does, reloading
+  *          it in circular mode.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4XX_HAL_DMA_H__
+#define __STM32F4XX_HAL_DMA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define DMA_CHANNEL_4             0x08000000U
+
+#define DMA_PERIPH_TO_MEMORY      0x00000000U
+#define DMA_MEMORY_TO_PERIPH      0x00000040U
+
+#define DMA_PINC_DISABLE          0x00000000U
+#define DMA_MINC_ENABLE           0x00000400U
+#define DMA_PDATAALIGN_BYTE       0x00000000U
+#define DMA_MDATAALIGN_BYTE       0x00000000U
+
+#define DMA_NORMAL                0x00000000U
+#define DMA_CIRCULAR              DMA_SxCR_CIRC
+
+#define DMA_PRIORITY_LOW          0x00000000U
+#define DMA_PRIORITY_HIGH         0x00020000U
+
+#define DMA_FIFOMODE_DISABLE      0x00000000U
+
+#define HAL_DMA_ERROR_NONE        0x00000000U
+
+/* Stream event flags, LISR/HISR in the device */
+#define SIM_DMA_FLAG_HT           0x01U
+#define SIM_DMA_FLAG_TC           0x02U
+
+/* Exported macros -----------------------------------------------------------*/
+#define __HAL_DMA_GET_COUNTER(__HANDLE__) ((__HANDLE__)->Instance->NDTR)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Channel;
+  uint32_t Direction;
+  uint32_t PeriphInc;
+  uint32_t MemInc;
+  uint32_t PeriphDataAlignment;
+  uint32_t MemDataAlignment;
+  uint32_t Mode;
+  uint32_t Priority;
+  uint32_t FIFOMode;
+  uint32_t FIFOThreshold;
+  uint32_t MemBurst;
+  uint32_t PeriphBurst;
+} DMA_InitTypeDef;
+
+typedef enum
+{
+  HAL_DMA_STATE_RESET = 0x00U,
+  HAL_DMA_STATE_READY = 0x01U,
+  HAL_DMA_STATE_BUSY  = 0x02U
+} HAL_DMA_StateTypeDef;
+
+typedef struct __DMA_HandleTypeDef
+{
+  DMA_Stream_TypeDef *Instance;
+  DMA_InitTypeDef Init;
+  HAL_LockTypeDef Lock;
+  __IO HAL_DMA_StateTypeDef State;
+  void *Parent;
+  void (*XferCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+  void (*XferHalfCpltCallback)(struct __DMA_HandleTypeDef *hdma);
+  void (*XferErrorCallback)(struct __DMA_HandleTypeDef *hdma);
+  void (*XferAbortCallback)(struct __DMA_HandleTypeDef *hdma);
+  __IO uint32_t ErrorCode;
+  uint8_t *Memory;              /*!< Sim: the memory address M0AR cannot hold */
+  uint32_t Length;              /*!< Sim: NDTR at the start of the transfer */
+  uint8_t Flags;                /*!< Sim: SIM_DMA_FLAG_* raised by the stream */
+} DMA_HandleTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4XX_HAL_DMA_H__ */
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_gpio.h
+  * @brief   Simulated HAL for host builds: GPIO
+  * @details Input levels only: a device model drives its pins through IDR
+  *          and the code under test reads them back with HAL_GPIO_ReadPin().
+  *          The init structure is taken and ignored.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4XX_HAL_GPIO_H__
+#define __STM32F4XX_HAL_GPIO_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  GPIO_PIN_RESET = 0U,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define GPIO_PIN_1                ((uint16_t)0x0002U)
+#define GPIO_PIN_2                ((uint16_t)0x0004U)
+#define GPIO_PIN_15               ((uint16_t)0x8000U)
+
+#define GPIO_MODE_IT_FALLING      0x10210000U
+#define GPIO_PULLUP               0x00000001U
+
+/* Exported functions prototypes ---------------------------------------------*/
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4XX_HAL_GPIO_H__ */
@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_spi.h
+  * @brief   Simulated HAL for host builds: SPI
+  * @details The clock mode constants a device description carries. The bus
+  *          itself is modelled by the check at the SPIBUS_* interface.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4XX_HAL_SPI_H__
+#define __STM32F4XX_HAL_SPI_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SPI_POLARITY_LOW          0x00000000U
+#define SPI_PHASE_1EDGE           0x00000000U
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4XX_HAL_SPI_H__ */
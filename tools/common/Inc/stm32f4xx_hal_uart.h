@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_uart.h
+  * @brief   Simulated HAL for host builds: UART
+  * @details Handle, states and the blocking, interrupt and DMA transfer
+  *          functions of the HAL, including reception to idle. The
+  *          callbacks are weak as in the HAL, for the code under test to
+  *          override.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4XX_HAL_UART_H__
+#define __STM32F4XX_HAL_UART_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+#include "stm32f4xx_hal_dma.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define UART_WORDLENGTH_8B        0x00000000U
+#define UART_WORDLENGTH_9B        USART_CR1_M
+#define UART_STOPBITS_1           0x00000000U
+#define UART_STOPBITS_2           USART_CR2_STOP_1
+#define UART_PARITY_NONE          0x00000000U
+#define UART_PARITY_EVEN          0x00000400U
+#define UART_PARITY_ODD           0x00000600U
+#define UART_MODE_RX              USART_CR1_RE
+#define UART_MODE_TX              USART_CR1_TE
+#define UART_MODE_TX_RX           (USART_CR1_TE | USART_CR1_RE)
+#define UART_HWCONTROL_NONE       0x00000000U
+#define UART_OVERSAMPLING_16      0x00000000U
+#define UART_OVERSAMPLING_8       USART_CR1_OVER8
+
+#define HAL_UART_ERROR_NONE       0x00000000U
+#define HAL_UART_ERROR_PE         0x00000001U
+#define HAL_UART_ERROR_NE         0x00000002U
+#define HAL_UART_ERROR_FE         0x00000004U
+#define HAL_UART_ERROR_ORE        0x00000008U
+#define HAL_UART_ERROR_DMA        0x00000010U
+
+#define HAL_UART_RECEPTION_STANDARD 0x00000000U
+#define HAL_UART_RECEPTION_TOIDLE   0x00000001U
+
+#define HAL_UART_RXEVENT_TC       0x00000000U
+#define HAL_UART_RXEVENT_HT       0x00000001U
+#define HAL_UART_RXEVENT_IDLE     0x00000002U
+
+#define UART_CR1_REG_INDEX        1U
+#define UART_CR2_REG_INDEX        2U
+#define UART_CR3_REG_INDEX        3U
+#define UART_IT_MASK              0x0000FFFFU
+
+#define UART_IT_PE                ((uint32_t)(UART_CR1_REG_INDEX << 28U | USART_CR1_PEIE))
+#define UART_IT_TXE               ((uint32_t)(UART_CR1_REG_INDEX << 28U | USART_CR1_TXEIE))
+#define UART_IT_TC                ((uint32_t)(UART_CR1_REG_INDEX << 28U | USART_CR1_TCIE))
+#define UART_IT_RXNE              ((uint32_t)(UART_CR1_REG_INDEX << 28U | USART_CR1_RXNEIE))
+#define UART_IT_IDLE              ((uint32_t)(UART_CR1_REG_INDEX << 28U | USART_CR1_IDLEIE))
+#define UART_IT_ERR               ((uint32_t)(UART_CR3_REG_INDEX << 28U | USART_CR3_EIE))
+
+#define UART_FLAG_TXE             USART_SR_TXE
+#define UART_FLAG_TC              USART_SR_TC
+#define UART_FLAG_RXNE            USART_SR_RXNE
+#define UART_FLAG_IDLE            USART_SR_IDLE
+#define UART_FLAG_ORE             USART_SR_ORE
+
+/* Exported macros -----------------------------------------------------------*/
+#define UART_DIV_SAMPLING16(_PCLK_, _BAUD_)      ((uint32_t)((((uint64_t)(_PCLK_))*25U)/(4U*((uint64_t)(_BAUD_)))))
+#define UART_DIVMANT_SAMPLING16(_PCLK_, _BAUD_)  (UART_DIV_SAMPLING16((_PCLK_), (_BAUD_))/100U)
+#define UART_DIVFRAQ_SAMPLING16(_PCLK_, _BAUD_)  ((((UART_DIV_SAMPLING16((_PCLK_), (_BAUD_)) - (UART_DIVMANT_SAMPLING16((_PCLK_), (_BAUD_)) * 100U)) * 16U) \
+                                                   + 50U) / 100U)
+#define UART_BRR_SAMPLING16(_PCLK_, _BAUD_)      ((UART_DIVMANT_SAMPLING16((_PCLK_), (_BAUD_)) << 4U) + \
+                                                  (UART_DIVFRAQ_SAMPLING16((_PCLK_), (_BAUD_)) & 0xF0U) + \
+                                                  (UART_DIVFRAQ_SAMPLING16((_PCLK_), (_BAUD_)) & 0x0FU))
+
+#define UART_DIV_SAMPLING8(_PCLK_, _BAUD_)       ((uint32_t)((((uint64_t)(_PCLK_))*25U)/(2U*((uint64_t)(_BAUD_)))))
+#define UART_DIVMANT_SAMPLING8(_PCLK_, _BAUD_)   (UART_DIV_SAMPLING8((_PCLK_), (_BAUD_))/100U)
+#define UART_DIVFRAQ_SAMPLING8(_PCLK_, _BAUD_)   ((((UART_DIV_SAMPLING8((_PCLK_), (_BAUD_)) - (UART_DIVMANT_SAMPLING8((_PCLK_), (_BAUD_)) * 100U)) * 8U) \
+                                                   + 50U) / 100U)
+#define UART_BRR_SAMPLING8(_PCLK_, _BAUD_)       ((UART_DIVMANT_SAMPLING8((_PCLK_), (_BAUD_)) << 4U) + \
+                                                  ((UART_DIVFRAQ_SAMPLING8((_PCLK_), (_BAUD_)) & 0xF8U) << 1U) + \
+                                                  (UART_DIVFRAQ_SAMPLING8((_PCLK_), (_BAUD_)) & 0x07U))
+
+#define __HAL_UART_ENABLE_IT(__HANDLE__, __INTERRUPT__)                                                   \
+  ((((__INTERRUPT__) >> 28U) == UART_CR1_REG_INDEX) ? ((__HANDLE__)->Instance->CR1 |= ((__INTERRUPT__) & UART_IT_MASK)) : \
+   (((__INTERRUPT__) >> 28U) == UART_CR2_REG_INDEX) ? ((__HANDLE__)->Instance->CR2 |= ((__INTERRUPT__) & UART_IT_MASK)) : \
+   ((__HANDLE__)->Instance->CR3 |= ((__INTERRUPT__) & UART_IT_MASK)))
+#define __HAL_UART_DISABLE_IT(__HANDLE__, __INTERRUPT__)                                                   \
+  ((((__INTERRUPT__) >> 28U) == UART_CR1_REG_INDEX) ? ((__HANDLE__)->Instance->CR1 &= ~((__INTERRUPT__) & UART_IT_MASK)) : \
+   (((__INTERRUPT__) >> 28U) == UART_CR2_REG_INDEX) ? ((__HANDLE__)->Instance->CR2 &= ~((__INTERRUPT__) & UART_IT_MASK)) : \
+   ((__HANDLE__)->Instance->CR3 &= ~((__INTERRUPT__) & UART_IT_MASK)))
+#define __HAL_UART_GET_FLAG(__HANDLE__, __FLAG__) (((__HANDLE__)->Instance->SR & (__FLAG__)) == (__FLAG__))
+
+/* The HAL reads SR then DR, which clears every error flag, IDLE and RXNE */
+#define __HAL_UART_CLEAR_PEFLAG(__HANDLE__) \
+  ((__HANDLE__)->Instance->SR &= ~(USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE | USART_SR_IDLE | USART_SR_RXNE))
+#define __HAL_UART_CLEAR_FEFLAG(__HANDLE__)   __HAL_UART_CLEAR_PEFLAG(__HANDLE__)
+#define __HAL_UART_CLEAR_NEFLAG(__HANDLE__)   __HAL_UART_CLEAR_PEFLAG(__HANDLE__)
+#define __HAL_UART_CLEAR_OREFLAG(__HANDLE__)  __HAL_UART_CLEAR_PEFLAG(__HANDLE__)
+#define __HAL_UART_CLEAR_IDLEFLAG(__HANDLE__) __HAL_UART_CLEAR_PEFLAG(__HANDLE__)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t BaudRate;
+  uint32_t WordLength;
+  uint32_t StopBits;
+  uint32_t Parity;
+  uint32_t Mode;
+  uint32_t HwFlowCtl;
+  uint32_t OverSampling;
+} UART_InitTypeDef;
+
+typedef enum
+{
+  HAL_UART_STATE_RESET      = 0x00U,
+  HAL_UART_STATE_READY      = 0x20U,
+  HAL_UART_STATE_BUSY       = 0x24U,
+  HAL_UART_STATE_BUSY_TX    = 0x21U,
+  HAL_UART_STATE_BUSY_RX    = 0x22U,
+  HAL_UART_STATE_BUSY_TX_RX = 0x23U,
+  HAL_UART_STATE_TIMEOUT    = 0xA0U,
+  HAL_UART_STATE_ERROR      = 0xE0U
+} HAL_UART_StateTypeDef;
+
+typedef uint32_t HAL_UART_RxTypeTypeDef;
+typedef uint32_t HAL_UART_RxEventTypeTypeDef;
+
+typedef struct __UART_HandleTypeDef
+{
+  USART_TypeDef *Instance;
+  UART_InitTypeDef Init;
+  const uint8_t *pTxBuffPtr;
+  uint16_t TxXferSize;
+  __IO uint16_t TxXferCount;
+  uint8_t *pRxBuffPtr;
+  uint16_t RxXferSize;
+  __IO uint16_t RxXferCount;
+  __IO HAL_UART_RxTypeTypeDef ReceptionType;
+  __IO HAL_UART_RxEventTypeTypeDef RxEventType;
+  DMA_HandleTypeDef *hdmatx;
+  DMA_HandleTypeDef *hdmarx;
+  HAL_LockTypeDef Lock;
+  __IO HAL_UART_StateTypeDef gState;
+  __IO HAL_UART_StateTypeDef RxState;
+  __IO uint32_t ErrorCode;
+} UART_HandleTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart);
+void HAL_UART_MspInit(UART_HandleTypeDef *huart);
+void HAL_UART_MspDeInit(UART_HandleTypeDef *huart);
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart);
+
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UART_AbortReceiveCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4XX_HAL_UART_H__ */
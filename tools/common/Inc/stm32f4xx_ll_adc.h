@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_ll_adc.h
+  * @brief   Host build stand-in for the LL ADC helpers
+  * @details The VREFINT conversion Peripherals/DSP/dsp_chain_table.c uses,
+  *          with a fixed factory calibration in place of the one read from
+  *          system memory.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __STM32F4xx_LL_ADC_H
+#define __STM32F4xx_LL_ADC_H
+
+/* Exported constants --------------------------------------------------------*/
+#define LL_ADC_RESOLUTION_12B     0x00000000U
+#define VREFINT_CAL_VREF          3300U     /* mV */
+#define SIM_VREFINT_CAL           1500U     /* VREFINT reading at VREFINT_CAL_VREF */
+
+/* Exported macros -----------------------------------------------------------*/
+#define __LL_ADC_CALC_VREFANALOG_VOLTAGE(__VREFINT_ADC_DATA__, __ADC_RESOLUTION__) \
+  (((uint32_t)SIM_VREFINT_CAL * VREFINT_CAL_VREF) / (uint32_t)(__VREFINT_ADC_DATA__))
+
+#endif /* __STM32F4xx_LL_ADC_H */
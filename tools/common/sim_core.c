@@ -0,0 +1,164 @@
+/**
+  ******************************************************************************
+  * @file    sim_core.c
+  * @brief   Core and pin stand-in for host builds
+  * @details Implements the CMSIS core functions, the GPIO and NVIC calls
+  *          and HAL_Delay() of Inc/ for the checks described in sim_core.h.
+  *          PRIMASK is one global mutex: setting it takes the mutex,
+  *          clearing it gives it back, so a masked section runs alone.
+  *          HAL_Delay() returns at once, device models keep their own time.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_core.h"
+#include "dwt.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_HANDLER_IPSR          11U       /* SVCall, any exception will do */
+
+/* Exported variables --------------------------------------------------------*/
+GPIO_TypeDef SIM_GPIOA;
+GPIO_TypeDef SIM_GPIOC;
+TIM_TypeDef SIM_TIM2;
+
+/* Private variables ---------------------------------------------------------*/
+static pthread_mutex_t masked = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local uint32_t primask;
+static _Thread_local uint8_t handlerMode;
+static _Thread_local DWT_Type dwt;
+
+static uint8_t cyclesDriven;
+static uint32_t cycleCount;
+
+static uint8_t irqEnabled[SIM_IRQn_COUNT];
+static uint32_t irqPriority[SIM_IRQn_COUNT];
+
+/* Controls ------------------------------------------------------------------*/
+void SIM_CoreReset(void)
+{
+  memset(&SIM_GPIOA, 0, sizeof(SIM_GPIOA));
+  memset(&SIM_GPIOC, 0, sizeof(SIM_GPIOC));
+  memset(&SIM_TIM2, 0, sizeof(SIM_TIM2));
+  memset(irqEnabled, 0, sizeof(irqEnabled));
+  memset(irqPriority, 0, sizeof(irqPriority));
+  cyclesDriven = 0U;
+}
+
+void SIM_SetCycleCount(uint32_t cycles)
+{
+  cycleCount = cycles;
+  cyclesDriven = 1U;
+}
+
+void SIM_SetHandlerMode(uint8_t on)
+{
+  handlerMode = on;
+}
+
+uint8_t SIM_IrqEnabled(IRQn_Type IRQn, uint32_t *priority)
+{
+  if (priority != NULL)
+  {
+    *priority = irqPriority[IRQn];
+  }
+  return irqEnabled[IRQn];
+}
+
+/* Core ----------------------------------------------------------------------*/
+uint32_t __get_IPSR(void)
+{
+  return (handlerMode != 0U) ? SIM_HANDLER_IPSR : 0U;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+  return primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+  if ((priMask != 0U) && (primask == 0U))
+  {
+    pthread_mutex_lock(&masked);
+  }
+  else if ((priMask == 0U) && (primask != 0U))
+  {
+    pthread_mutex_unlock(&masked);
+  }
+  primask = priMask & 1U;
+}
+
+void __disable_irq(void)
+{
+  __set_PRIMASK(1U);
+}
+
+void __enable_irq(void)
+{
+  __set_PRIMASK(0U);
+}
+
+DWT_Type *SIM_CycleCounter(void)
+{
+  struct timespec now;
+
+  if (cyclesDriven)
+  {
+    dwt.CYCCNT = cycleCount;
+    return &dwt;
+  }
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  dwt.CYCCNT = (uint32_t)(((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+  return &dwt;
+}
+
+void DWT_Init(void)
+{
+}
+
+/* HAL -----------------------------------------------------------------------*/
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  (void)GPIOx;
+  (void)GPIO_Init;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  return ((GPIOx->IDR & GPIO_Pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  (void)SubPriority;
+  irqPriority[IRQn] = PreemptPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  irqEnabled[IRQn] = 1U;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  irqEnabled[IRQn] = 0U;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  (void)Delay;
+}
+
+void Error_Handler(void)
+{
+  printf("FAILED: Error_Handler()\n");
+  exit(EXIT_FAILURE);
+}
@@ -0,0 +1,67 @@
+/**
+  ******************************************************************************
+  * @file    sim_core.h
+  * @brief   Core and pin stand-in for host builds: control interface
+  * @details The other side of the HAL functions sim_core.c implements, for
+  *          the device models and checks that do not need the virtual-time
+  *          model of sim_hal.c:
+  *          - every thread of a check stands for a task or an interrupt
+  *            handler; PRIMASK set by one of them keeps the others out of
+  *            their masked sections, as on the single core
+  *          - a thread can pretend to run in handler mode for __get_IPSR()
+  *          - the DWT cycle counter reads the CPU time of the calling thread
+  *            in nanoseconds, unless a device model drives it with
+  *            SIM_SetCycleCount()
+  *          - pins are the IDR bits a device model sets; the NVIC keeps the
+  *            enable and priority of each line for the model to check
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SIM_CORE_H__
+#define __SIM_CORE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Clears the pins, the NVIC and TIM2, and gives DWT back to the
+ *          thread CPU time
+ * @param   None
+ * @retval  None
+ */
+void SIM_CoreReset(void);
+
+/**
+ * @brief   Drives the DWT cycle counter from a device model clock
+ * @param   cycles  Value CYCCNT reads until the next call or SIM_CoreReset()
+ * @retval  None
+ */
+void SIM_SetCycleCount(uint32_t cycles);
+
+/**
+ * @brief   Makes the calling thread run in handler or thread mode
+ * @param   on  Non-zero for handler mode
+ * @retval  None
+ */
+void SIM_SetHandlerMode(uint8_t on);
+
+/**
+ * @brief   State of an interrupt line in the NVIC
+ * @param   IRQn      Interrupt number
+ * @param   priority  Preemption priority set last, may be NULL
+ * @retval  1 if enabled, 0 otherwise
+ */
+uint8_t SIM_IrqEnabled(IRQn_Type IRQn, uint32_t *priority);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_CORE_H__ */
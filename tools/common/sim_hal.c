@@ -0,0 +1,1630 @@
+/**
+  ******************************************************************************
+  * @file    sim_hal.c
+  * @brief   Simulated STM32F429 for host builds
+  * @details This file provides the virtual clock and event loop, the NVIC
+  *          model, USART1 with its two DMA streams, the CRC unit, and the
+  *          HAL functions on top of them.
+  *
+  *          The HAL functions follow stm32f4xx_hal_uart.c and
+  *          stm32f4xx_hal_dma.c of the firmware tree step for step where
+  *          the code under test can see the difference: handle states, the
+  *          order of callbacks, when NDTR is reloaded, which flags an
+  *          interrupt handler clears. Interrupt sources are level sensitive
+  *          as on the device; a flag no handler clears keeps its interrupt
+  *          firing, and SIM_SetIsrCost() lets time move while it does.
+  *
+  *          A received byte clears IDLE: on the device the sequence that
+  *          clears it (SR then DR read) is the one reading the byte.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_hal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_THREAD_PRIORITY       256U      /* Below every interrupt */
+#define SIM_TICK_NS               1000000U
+#define SIM_NEVER                 UINT64_MAX
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint64_t atNs;                /*!< End of the stop bit */
+  uint8_t byte;
+} SIM_RxByte_t;
+
+/* Private variables ---------------------------------------------------------*/
+USART_TypeDef SIM_USART1;
+USART_TypeDef SIM_USART6;
+DMA_Stream_TypeDef SIM_DMA2_Stream5;
+DMA_Stream_TypeDef SIM_DMA2_Stream7;
+CRC_TypeDef SIM_CRC;
+
+__IO uint32_t uwTick;
+
+static uint64_t nowNs;
+static uint64_t nextTickNs;
+static uint64_t lastTickNs;
+static uint32_t isrCostNs = SIM_ISR_COST_NS;
+static SIM_Stats_t stats;
+
+/* NVIC */
+static const IRQn_Type irqNumbers[SIM_IRQ_COUNT] = {
+  USART1_IRQn, DMA2_Stream5_IRQn, DMA2_Stream7_IRQn, TIM6_DAC_IRQn
+};
+static uint32_t irqPriority[SIM_IRQ_COUNT];
+static uint8_t irqEnabled[SIM_IRQ_COUNT];
+static uint8_t irqLatched[SIM_IRQ_COUNT];
+static uint8_t irqPending[SIM_IRQ_COUNT];
+static uint64_t irqPendingSinceNs[SIM_IRQ_COUNT];
+static uint32_t activePriority = SIM_THREAD_PRIORITY;
+static uint32_t activeIpsr;
+static uint32_t primask;
+
+/* USART1 */
+static UART_HandleTypeDef *uart1;
+static SIM_RxByte_t rxQueue[SIM_RX_QUEUE_SIZE];
+static uint32_t rxHead;
+static uint32_t rxCount;
+static uint64_t rxQueueEndNs;
+static uint64_t rxLastNs;
+static uint64_t idleAtNs = SIM_NEVER;
+static uint64_t txDoneNs = SIM_NEVER;
+static uint8_t txShift;
+static uint8_t txHold;
+static uint8_t txHolding;
+static uint8_t txCapture[SIM_TX_CAPTURE_SIZE];
+static uint32_t txCaptureHead;
+static uint32_t txCaptureCount;
+
+/* DMA2 streams 5 and 7 */
+static DMA_HandleTypeDef *dmaRx;
+static DMA_HandleTypeDef *dmaTx;
+
+/* CRC */
+static uint32_t crcTable[256];
+
+/* Private function prototypes -----------------------------------------------*/
+static void SIM_Process(uint64_t untilNs);
+static uint8_t SIM_DispatchOne(void);
+static uint8_t SIM_IrqLevel(SIM_Irq_t irq);
+static int SIM_IrqIndex(IRQn_Type IRQn);
+static void SIM_UartReceive(uint8_t byte);
+static void SIM_UartWriteDr(uint8_t byte);
+static uint8_t SIM_UartReadDr(void);
+static void SIM_UartShiftDone(void);
+static void SIM_DmaRequestRx(void);
+static void SIM_DmaRequestTx(void);
+static void SIM_DmaStart(DMA_HandleTypeDef *hdma, uint8_t *memory, uint32_t length);
+static HAL_StatusTypeDef SIM_UartWaitFlag(UART_HandleTypeDef *huart, uint32_t flag, uint32_t tickstart, uint32_t timeout);
+static void SIM_UartStartReceiveDma(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+static void SIM_UartEndRxTransfer(UART_HandleTypeDef *huart);
+static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
+static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
+static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
+static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void UART_Receive_IT(UART_HandleTypeDef *huart);
+static void UART_Transmit_IT(UART_HandleTypeDef *huart);
+static void UART_EndTransmit_IT(UART_HandleTypeDef *huart);
+
+/* Control -------------------------------------------------------------------*/
+/**
+  * @brief  Power the simulated device up
+  * @param  None
+  * @retval None
+  */
+void SIM_Reset(void)
+{
+  memset(&SIM_USART1, 0, sizeof(SIM_USART1));
+  memset(&SIM_USART6, 0, sizeof(SIM_USART6));
+  memset(&SIM_DMA2_Stream5, 0, sizeof(SIM_DMA2_Stream5));
+  memset(&SIM_DMA2_Stream7, 0, sizeof(SIM_DMA2_Stream7));
+  SIM_USART1.SR = USART_SR_TXE | USART_SR_TC;
+  SIM_USART6.SR = USART_SR_TXE | USART_SR_TC;
+  SIM_CRC.DR = 0xFFFFFFFFU;
+
+  nowNs = 0U;
+  lastTickNs = 0U;
+  nextTickNs = SIM_TICK_NS;
+  uwTick = 0U;
+  memset(&stats, 0, sizeof(stats));
+
+  memset(irqPriority, 0, sizeof(irqPriority));
+  memset(irqEnabled, 0, sizeof(irqEnabled));
+  memset(irqLatched, 0, sizeof(irqLatched));
+  memset(irqPending, 0, sizeof(irqPending));
+  activePriority = SIM_THREAD_PRIORITY;
+  activeIpsr = 0U;
+  primask = 0U;
+
+  uart1 = NULL;
+  rxHead = 0U;
+  rxCount = 0U;
+  rxQueueEndNs = 0U;
+  rxLastNs = 0U;
+  idleAtNs = SIM_NEVER;
+  txDoneNs = SIM_NEVER;
+  txHolding = 0U;
+  txCaptureHead = 0U;
+  txCaptureCount = 0U;
+  dmaRx = NULL;
+  dmaTx = NULL;
+
+  /* HAL_InitTick() */
+  HAL_NVIC_SetPriority(TIM6_DAC_IRQn, TICK_INT_PRIORITY, 0U);
+  HAL_NVIC_EnableIRQ(TIM6_DAC_IRQn);
+}
+
+/**
+  * @brief  Set the time charged per handler run
+  * @param  ns  Nanoseconds
+  * @retval None
+  */
+void SIM_SetIsrCost(uint32_t ns)
+{
+  isrCostNs = (ns != 0U) ? ns : 1U;
+}
+
+/**
+  * @brief  Read the virtual time
+  * @param  None
+  * @retval Nanoseconds since SIM_Reset()
+  */
+uint64_t SIM_NowNs(void)
+{
+  return nowNs;
+}
+
+/**
+  * @brief  USART1 frame time
+  * @details Baud rate from BRR and the clock as the USART derives it, one
+  *          start bit, 8 or 9 data bits and 1 or 2 stop bits
+  * @param  None
+  * @retval Nanoseconds per byte
+  */
+uint32_t SIM_UartFrameNs(void)
+{
+  const uint32_t brr = SIM_USART1.BRR;
+  const uint32_t bits = 1U + ((SIM_USART1.CR1 & USART_CR1_M) ? 9U : 8U) +
+                        ((SIM_USART1.CR2 & USART_CR2_STOP_1) ? 2U : 1U);
+  uint64_t divider;
+
+  /* Baud = PCLK2 / divider, with the fraction in sixteenths or eighths */
+  if (SIM_USART1.CR1 & USART_CR1_OVER8)
+  {
+    divider = ((uint64_t)(brr >> 4) * 8U) + (brr & 0x7U);
+  }
+  else
+  {
+    divider = brr;
+  }
+  if (divider == 0U)
+  {
+    divider = 1U;
+  }
+  return (uint32_t)(((uint64_t)bits * divider * 1000000000ULL) / SIM_PCLK2_HZ);
+}
+
+/**
+  * @brief  Queue bytes on the RX line
+  * @param  data   Bytes
+  * @param  size   Number of bytes
+  * @param  gapNs  Idle line before the first byte
+  * @retval Bytes queued
+  */
+uint32_t SIM_UartInject(const uint8_t *data, uint32_t size, uint32_t gapNs)
+{
+  const uint32_t frameNs = SIM_UartFrameNs();
+  uint64_t atNs = ((rxCount != 0U) && (rxQueueEndNs > nowNs)) ? rxQueueEndNs : nowNs;
+  uint32_t i;
+
+  atNs += gapNs;
+  for (i = 0; (i < size) && (rxCount < SIM_RX_QUEUE_SIZE); i++)
+  {
+    atNs += frameNs;
+    rxQueue[(rxHead + rxCount) % SIM_RX_QUEUE_SIZE].atNs = atNs;
+    rxQueue[(rxHead + rxCount) % SIM_RX_QUEUE_SIZE].byte = data[i];
+    rxCount++;
+    rxQueueEndNs = atNs;
+  }
+  return i;
+}
+
+/**
+  * @brief  Arrival time of the last byte received
+  * @param  None
+  * @retval Nanoseconds
+  */
+uint64_t SIM_UartLastRxNs(void)
+{
+  return rxLastNs;
+}
+
+/**
+  * @brief  Read back the transmitted bytes
+  * @param  data  Destination
+  * @param  size  Room in data
+  * @retval Bytes read
+  */
+uint32_t SIM_UartTxRead(uint8_t *data, uint32_t size)
+{
+  uint32_t n = 0U;
+
+  while ((n < size) && (txCaptureCount != 0U))
+  {
+    data[n++] = txCapture[txCaptureHead];
+    txCaptureHead = (txCaptureHead + 1U) % SIM_TX_CAPTURE_SIZE;
+    txCaptureCount--;
+  }
+  return n;
+}
+
+/**
+  * @brief  Run for a while
+  * @param  ns  Nanoseconds
+  * @retval None
+  */
+void SIM_RunFor(uint64_t ns)
+{
+  SIM_Process(nowNs + ns);
+}
+
+/**
+  * @brief  Run until the RX queue is empty and both lines are idle
+  * @param  limitNs  Longest run
+  * @retval 1 if idle
+  */
+uint8_t SIM_RunUntilIdle(uint64_t limitNs)
+{
+  const uint64_t endNs = nowNs + limitNs;
+  uint64_t nextNs;
+
+  while ((rxCount != 0U) || (idleAtNs != SIM_NEVER) || (txDoneNs != SIM_NEVER))
+  {
+    if (nowNs >= endNs)
+    {
+      return 0U;
+    }
+    nextNs = (rxCount != 0U) ? rxQueue[rxHead].atNs : SIM_NEVER;
+    nextNs = (idleAtNs < nextNs) ? idleAtNs : nextNs;
+    nextNs = (txDoneNs < nextNs) ? txDoneNs : nextNs;
+    SIM_Process((nextNs < endNs) ? nextNs : endNs);
+  }
+  /* Handlers of the last events */
+  SIM_Process(nowNs);
+  return 1U;
+}
+
+/**
+  * @brief  Read the counters
+  * @param  stats  Destination
+  * @retval None
+  */
+void SIM_GetStats(SIM_Stats_t *result)
+{
+  *result = stats;
+}
+
+/* Event loop ----------------------------------------------------------------*/
+/**
+  * @brief  Advance the virtual time, raising events and taking interrupts
+  * @details Called again from handlers (HAL_GetTick() in a wait): the inner
+  *          call takes only interrupts that preempt the running handler.
+  * @param  untilNs  Time to reach
+  * @retval None
+  */
+static void SIM_Process(uint64_t untilNs)
+{
+  uint64_t nextNs;
+
+  for (;;)
+  {
+    /* Events due, in time order */
+    for (;;)
+    {
+      const uint64_t rxNs = (rxCount != 0U) ? rxQueue[rxHead].atNs : SIM_NEVER;
+
+      nextNs = nextTickNs;
+      nextNs = (rxNs < nextNs) ? rxNs : nextNs;
+      nextNs = (idleAtNs < nextNs) ? idleAtNs : nextNs;
+      nextNs = (txDoneNs < nextNs) ? txDoneNs : nextNs;
+      if (nextNs > nowNs)
+      {
+        break;
+      }
+
+      if (nextNs == rxNs)
+      {
+        const uint8_t byte = rxQueue[rxHead].byte;
+
+        rxHead = (rxHead + 1U) % SIM_RX_QUEUE_SIZE;
+        rxCount--;
+        SIM_UartReceive(byte);
+      }
+      else if (nextNs == idleAtNs)
+      {
+        idleAtNs = SIM_NEVER;
+        SIM_USART1.SR |= USART_SR_IDLE;
+      }
+      else if (nextNs == txDoneNs)
+      {
+        SIM_UartShiftDone();
+      }
+      else
+      {
+        nextTickNs += SIM_TICK_NS;
+        irqLatched[SIM_IRQ_TICK] = 1U;
+      }
+    }
+
+    if (SIM_DispatchOne())
+    {
+      continue;
+    }
+    if (nextNs > untilNs)
+    {
+      break;
+    }
+    nowNs = nextNs;
+  }
+
+  if (nowNs < untilNs)
+  {
+    nowNs = untilNs;
+  }
+}
+
+/**
+  * @brief  Take the most urgent interrupt that preempts the running code
+  * @details Equal priorities go by interrupt number, as in the NVIC
+  * @param  None
+  * @retval 1 if a handler ran
+  */
+static uint8_t SIM_DispatchOne(void)
+{
+  int best = -1;
+  uint32_t savedPriority;
+  uint32_t savedIpsr;
+  int i;
+
+  for (i = 0; i < (int)SIM_IRQ_COUNT; i++)
+  {
+    if (irqLatched[i] || SIM_IrqLevel((SIM_Irq_t)i))
+    {
+      if (!irqPending[i])
+      {
+        irqPending[i] = 1U;
+        irqPendingSinceNs[i] = nowNs;
+      }
+    }
+    else
+    {
+      irqPending[i] = 0U;
+    }
+  }
+
+  if (primask)
+  {
+    return 0U;
+  }
+  for (i = 0; i < (int)SIM_IRQ_COUNT; i++)
+  {
+    if (!irqPending[i] || !irqEnabled[i] || (irqPriority[i] >= activePriority))
+    {
+      continue;
+    }
+    if ((best < 0) || (irqPriority[i] < irqPriority[best]) ||
+        ((irqPriority[i] == irqPriority[best]) && (irqNumbers[i] < irqNumbers[best])))
+    {
+      best = i;
+    }
+  }
+  if (best < 0)
+  {
+    return 0U;
+  }
+
+  irqLatched[best] = 0U;
+  irqPending[best] = 0U;
+  stats.irqs[best]++;
+  if ((nowNs - irqPendingSinceNs[best]) > stats.irqMaxLatencyNs[best])
+  {
+    stats.irqMaxLatencyNs[best] = nowNs - irqPendingSinceNs[best];
+  }
+
+  savedPriority = activePriority;
+  savedIpsr = activeIpsr;
+  activePriority = irqPriority[best];
+  activeIpsr = (uint32_t)irqNumbers[best] + 16U;
+
+  switch ((SIM_Irq_t)best)
+  {
+    case SIM_IRQ_USART1:
+      if (uart1 != NULL)
+      {
+        HAL_UART_IRQHandler(uart1);
+      }
+      break;
+    case SIM_IRQ_DMA_RX:
+      HAL_DMA_IRQHandler(dmaRx);
+      break;
+    case SIM_IRQ_DMA_TX:
+      HAL_DMA_IRQHandler(dmaTx);
+      break;
+    default:
+      HAL_IncTick();
+      break;
+  }
+
+  activePriority = savedPriority;
+  activeIpsr = savedIpsr;
+  nowNs += isrCostNs;
+  stats.irqBusyNs += isrCostNs;
+  return 1U;
+}
+
+/**
+  * @brief  Interrupt request line of a peripheral
+  * @param  irq  Interrupt
+  * @retval 1 while requesting
+  */
+static uint8_t SIM_IrqLevel(SIM_Irq_t irq)
+{
+  const uint32_t sr = SIM_USART1.SR;
+  const uint32_t cr1 = SIM_USART1.CR1;
+  const uint32_t cr3 = SIM_USART1.CR3;
+  const DMA_HandleTypeDef *hdma;
+
+  switch (irq)
+  {
+    case SIM_IRQ_USART1:
+      return (((sr & USART_SR_RXNE) && (cr1 & USART_CR1_RXNEIE)) ||
+              ((sr & USART_SR_TXE) && (cr1 & USART_CR1_TXEIE)) ||
+              ((sr & USART_SR_TC) && (cr1 & USART_CR1_TCIE)) ||
+              ((sr & USART_SR_IDLE) && (cr1 & USART_CR1_IDLEIE)) ||
+              ((sr & USART_SR_ORE) && ((cr1 & USART_CR1_RXNEIE) || (cr3 & USART_CR3_EIE)))) ? 1U : 0U;
+    case SIM_IRQ_DMA_RX:
+    case SIM_IRQ_DMA_TX:
+      hdma = (irq == SIM_IRQ_DMA_RX) ? dmaRx : dmaTx;
+      if (hdma == NULL)
+      {
+        return 0U;
+      }
+      return (((hdma->Flags & SIM_DMA_FLAG_HT) && (hdma->Instance->CR & DMA_SxCR_HTIE)) ||
+              ((hdma->Flags & SIM_DMA_FLAG_TC) && (hdma->Instance->CR & DMA_SxCR_TCIE))) ? 1U : 0U;
+    default:
+      return 0U;
+  }
+}
+
+static int SIM_IrqIndex(IRQn_Type IRQn)
+{
+  int i;
+
+  for (i = 0; i < (int)SIM_IRQ_COUNT; i++)
+  {
+    if (irqNumbers[i] == IRQn)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* USART1 and its DMA streams ------------------------------------------------*/
+/**
+  * @brief  A byte arrives on the RX line
+  * @param  byte  Received byte
+  * @retval None
+  */
+static void SIM_UartReceive(uint8_t byte)
+{
+  stats.rxBytes++;
+  rxLastNs = nowNs;
+
+  if (((SIM_USART1.CR1 & (USART_CR1_UE | USART_CR1_RE)) != (USART_CR1_UE | USART_CR1_RE)))
+  {
+    stats.rxDisabled++;
+    return;
+  }
+
+  idleAtNs = nowNs + SIM_UartFrameNs();
+  SIM_USART1.SR &= ~USART_SR_IDLE;
+
+  if (SIM_USART1.SR & USART_SR_RXNE)
+  {
+    /* The shift register content is lost, DR keeps the unread byte */
+    SIM_USART1.SR |= USART_SR_ORE;
+    stats.rxOverruns++;
+    return;
+  }
+  SIM_USART1.DR = byte;
+  SIM_USART1.SR |= USART_SR_RXNE;
+  SIM_DmaRequestRx();
+}
+
+/**
+  * @brief  Read DR, clearing RXNE and the error flags
+  * @param  None
+  * @retval Byte
+  */
+static uint8_t SIM_UartReadDr(void)
+{
+  SIM_USART1.SR &= ~(USART_SR_RXNE | USART_SR_ORE | USART_SR_NE | USART_SR_FE | USART_SR_PE);
+  return (uint8_t)SIM_USART1.DR;
+}
+
+/**
+  * @brief  Write DR: into the shift register if free, else held in DR
+  * @param  byte  Byte to send
+  * @retval None
+  */
+static void SIM_UartWriteDr(uint8_t byte)
+{
+  SIM_USART1.SR &= ~USART_SR_TC;
+  if (txDoneNs == SIM_NEVER)
+  {
+    txShift = byte;
+    txDoneNs = nowNs + SIM_UartFrameNs();
+    SIM_USART1.SR |= USART_SR_TXE;
+    SIM_DmaRequestTx();
+  }
+  else
+  {
+    txHold = byte;
+    txHolding = 1U;
+    SIM_USART1.SR &= ~USART_SR_TXE;
+  }
+}
+
+/**
+  * @brief  The stop bit of the byte in the shift register went out
+  * @param  None
+  * @retval None
+  */
+static void SIM_UartShiftDone(void)
+{
+  stats.txBytes++;
+  if (txCaptureCount < SIM_TX_CAPTURE_SIZE)
+  {
+    txCapture[(txCaptureHead + txCaptureCount) % SIM_TX_CAPTURE_SIZE] = txShift;
+    txCaptureCount++;
+  }
+  else
+  {
+    stats.txCaptureLost++;
+  }
+
+  if (txHolding)
+  {
+    txHolding = 0U;
+    txShift = txHold;
+    txDoneNs += SIM_UartFrameNs();
+    SIM_USART1.SR |= USART_SR_TXE;
+    SIM_DmaRequestTx();
+  }
+  else
+  {
+    txDoneNs = SIM_NEVER;
+    SIM_USART1.SR |= USART_SR_TC;
+  }
+}
+
+/**
+  * @brief  RXNE with DMAR set: stream 5 moves the byte and counts NDTR down
+  * @param  None
+  * @retval None
+  */
+static void SIM_DmaRequestRx(void)
+{
+  DMA_Stream_TypeDef *const stream = DMA2_Stream5;
+
+  if ((dmaRx == NULL) || !(SIM_USART1.CR3 & USART_CR3_DMAR) || !(stream->CR & DMA_SxCR_EN) ||
+      (stream->NDTR == 0U))
+  {
+    return;
+  }
+
+  dmaRx->Memory[dmaRx->Length - stream->NDTR] = SIM_UartReadDr();
+  stats.rxDmaBytes++;
+  stream->NDTR--;
+  if (stream->NDTR == (dmaRx->Length / 2U))
+  {
+    dmaRx->Flags |= SIM_DMA_FLAG_HT;
+  }
+  if (stream->NDTR == 0U)
+  {
+    dmaRx->Flags |= SIM_DMA_FLAG_TC;
+    if (stream->CR & DMA_SxCR_CIRC)
+    {
+      stream->NDTR = dmaRx->Length;
+    }
+    else
+    {
+      stream->CR &= ~DMA_SxCR_EN;
+    }
+  }
+}
+
+/**
+  * @brief  TXE with DMAT set: stream 7 feeds the next byte
+  * @param  None
+  * @retval None
+  */
+static void SIM_DmaRequestTx(void)
+{
+  DMA_Stream_TypeDef *const stream = DMA2_Stream7;
+  uint8_t byte;
+
+  if ((dmaTx == NULL) || !(SIM_USART1.CR3 & USART_CR3_DMAT) || !(stream->CR & DMA_SxCR_EN) ||
+      (stream->NDTR == 0U) || !(SIM_USART1.SR & USART_SR_TXE))
+  {
+    return;
+  }
+
+  byte = dmaTx->Memory[dmaTx->Length - stream->NDTR];
+  stream->NDTR--;
+  if (stream->NDTR == (dmaTx->Length / 2U))
+  {
+    dmaTx->Flags |= SIM_DMA_FLAG_HT;
+  }
+  if (stream->NDTR == 0U)
+  {
+    dmaTx->Flags |= SIM_DMA_FLAG_TC;
+    if (stream->CR & DMA_SxCR_CIRC)
+    {
+      stream->NDTR = dmaTx->Length;
+    }
+    else
+    {
+      stream->CR &= ~DMA_SxCR_EN;
+    }
+  }
+  SIM_UartWriteDr(byte);
+}
+
+/**
+  * @brief  HAL_DMA_Start_IT()
+  * @param  hdma    Stream handle
+  * @param  memory  Buffer
+  * @param  length  Bytes
+  * @retval None
+  */
+static void SIM_DmaStart(DMA_HandleTypeDef *hdma, uint8_t *memory, uint32_t length)
+{
+  hdma->State = HAL_DMA_STATE_BUSY;
+  hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+  hdma->Memory = memory;
+  hdma->Length = length;
+  hdma->Flags = 0U;
+  hdma->Instance->NDTR = length;
+  hdma->Instance->CR |= DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+  if (hdma->XferHalfCpltCallback != NULL)
+  {
+    hdma->Instance->CR |= DMA_SxCR_HTIE;
+  }
+  hdma->Instance->CR |= DMA_SxCR_EN;
+}
+
+/* HAL: core -----------------------------------------------------------------*/
+uint32_t __get_IPSR(void)
+{
+  return activeIpsr;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+  return primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+  primask = priMask & 1U;
+  if (!primask)
+  {
+    SIM_Process(nowNs);
+  }
+}
+
+void __disable_irq(void)
+{
+  primask = 1U;
+}
+
+void __enable_irq(void)
+{
+  __set_PRIMASK(0U);
+}
+
+/**
+  * @brief  Read the tick, charging the time of one polling loop pass
+  * @details A tick frozen for SIM_STALL_MS while the code polls it is the
+  *          hang the device would be in; it is reported and ends the run.
+  * @param  None
+  * @retval Milliseconds
+  */
+uint32_t HAL_GetTick(void)
+{
+  SIM_Process(nowNs + SIM_POLL_NS);
+  if ((nowNs - lastTickNs) > ((uint64_t)SIM_STALL_MS * SIM_TICK_NS))
+  {
+    fprintf(stderr, "sim: hang at %.3f ms, the tick has not moved for %u ms: "
+            "polled with IPSR %u at priority %u, the tick runs at %u%s\n",
+            (double)nowNs / 1e6, (unsigned)SIM_STALL_MS, (unsigned)activeIpsr,
+            (unsigned)activePriority, (unsigned)irqPriority[SIM_IRQ_TICK],
+            primask ? " and interrupts are masked" : "");
+    exit(2);
+  }
+  return uwTick;
+}
+
+void HAL_IncTick(void)
+{
+  uwTick++;
+  lastTickNs = nowNs;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  const uint32_t tickstart = HAL_GetTick();
+  uint32_t wait = Delay;
+
+  if (wait < HAL_MAX_DELAY)
+  {
+    wait++;
+  }
+  while ((HAL_GetTick() - tickstart) < wait)
+  {
+  }
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  const int i = SIM_IrqIndex(IRQn);
+
+  (void)SubPriority;
+  if (i >= 0)
+  {
+    irqPriority[i] = PreemptPriority & 0xFU;
+  }
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  const int i = SIM_IrqIndex(IRQn);
+
+  if (i >= 0)
+  {
+    irqEnabled[i] = 1U;
+  }
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  const int i = SIM_IrqIndex(IRQn);
+
+  if (i >= 0)
+  {
+    irqEnabled[i] = 0U;
+  }
+}
+
+void HAL_NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+  const int i = SIM_IrqIndex(IRQn);
+
+  if (i >= 0)
+  {
+    irqLatched[i] = 1U;
+  }
+}
+
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  const int i = SIM_IrqIndex(IRQn);
+
+  if (i >= 0)
+  {
+    irqLatched[i] = 0U;
+  }
+}
+
+uint32_t HAL_RCC_GetSysClockFreq(void)
+{
+  return SIM_HCLK_HZ;
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void)
+{
+  return SIM_HCLK_HZ;
+}
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+  return SIM_PCLK1_HZ;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+  return SIM_PCLK2_HZ;
+}
+
+/**
+  * @brief  Error_Handler() of the firmware records a crash and resets
+  * @param  None
+  * @retval None
+  */
+void Error_Handler(void)
+{
+  fprintf(stderr, "sim: Error_Handler() at %.3f ms\n", (double)nowNs / 1e6);
+  exit(2);
+}
+
+/* HAL: DMA ------------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  hdma->State = HAL_DMA_STATE_BUSY;
+  hdma->Instance->CR = hdma->Init.Channel | hdma->Init.Direction | hdma->Init.PeriphInc |
+                       hdma->Init.MemInc | hdma->Init.Mode | hdma->Init.Priority;
+  hdma->Instance->NDTR = 0U;
+  hdma->Flags = 0U;
+  hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+  hdma->State = HAL_DMA_STATE_READY;
+
+  if (hdma->Instance == DMA2_Stream5)
+  {
+    dmaRx = hdma;
+  }
+  else if (hdma->Instance == DMA2_Stream7)
+  {
+    dmaTx = hdma;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  hdma->Instance->CR = 0U;
+  hdma->Instance->NDTR = 0U;
+  hdma->Flags = 0U;
+  hdma->State = HAL_DMA_STATE_RESET;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
+{
+  hdma->Instance->CR &= ~(DMA_SxCR_EN | DMA_SxCR_TCIE | DMA_SxCR_HTIE | DMA_SxCR_TEIE);
+  hdma->Flags = 0U;
+  hdma->State = HAL_DMA_STATE_READY;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stream interrupt, half transfer then transfer complete
+  * @param  hdma  Stream handle
+  * @retval None
+  */
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+  if (hdma == NULL)
+  {
+    return;
+  }
+
+  if ((hdma->Flags & SIM_DMA_FLAG_HT) && (hdma->Instance->CR & DMA_SxCR_HTIE))
+  {
+    hdma->Flags &= ~SIM_DMA_FLAG_HT;
+    if (!(hdma->Instance->CR & DMA_SxCR_CIRC))
+    {
+      hdma->Instance->CR &= ~DMA_SxCR_HTIE;
+    }
+    if (hdma->XferHalfCpltCallback != NULL)
+    {
+      hdma->XferHalfCpltCallback(hdma);
+    }
+  }
+
+  if ((hdma->Flags & SIM_DMA_FLAG_TC) && (hdma->Instance->CR & DMA_SxCR_TCIE))
+  {
+    hdma->Flags &= ~SIM_DMA_FLAG_TC;
+    if (!(hdma->Instance->CR & DMA_SxCR_CIRC))
+    {
+      hdma->Instance->CR &= ~(DMA_SxCR_TCIE | DMA_SxCR_HTIE | DMA_SxCR_TEIE);
+      hdma->State = HAL_DMA_STATE_READY;
+    }
+    if (hdma->XferCpltCallback != NULL)
+    {
+      hdma->XferCpltCallback(hdma);
+    }
+  }
+}
+
+/* HAL: CRC ------------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t crc;
+
+  if (hcrc == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0; i < 256U; i++)
+  {
+    crc = i << 24;
+    for (j = 0; j < 8U; j++)
+    {
+      crc = (crc & 0x80000000U) ? ((crc << 1) ^ 0x04C11DB7U) : (crc << 1);
+    }
+    crcTable[i] = crc;
+  }
+  hcrc->State = HAL_CRC_STATE_READY;
+  return HAL_OK;
+}
+
+uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  uint32_t crc = hcrc->Instance->DR;
+  uint32_t word;
+  uint32_t i;
+  int shift;
+
+  hcrc->State = HAL_CRC_STATE_BUSY;
+  for (i = 0; i < BufferLength; i++)
+  {
+    word = pBuffer[i];
+    for (shift = 24; shift >= 0; shift -= 8)
+    {
+      crc = (crc << 8) ^ crcTable[((crc >> 24) ^ (word >> shift)) & 0xFFU];
+    }
+  }
+  hcrc->Instance->DR = crc;
+  hcrc->State = HAL_CRC_STATE_READY;
+  return crc;
+}
+
+uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  hcrc->Instance->DR = 0xFFFFFFFFU;
+  return HAL_CRC_Accumulate(hcrc, pBuffer, BufferLength);
+}
+
+/* HAL: UART -----------------------------------------------------------------*/
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+  USART_TypeDef *instance;
+  uint32_t pclk;
+
+  if (huart == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (huart->gState == HAL_UART_STATE_RESET)
+  {
+    huart->Lock = HAL_UNLOCKED;
+    HAL_UART_MspInit(huart);
+  }
+  huart->gState = HAL_UART_STATE_BUSY;
+
+  /* UART_SetConfig() */
+  instance = huart->Instance;
+  instance->CR1 &= ~USART_CR1_UE;
+  instance->CR2 = (instance->CR2 & ~USART_CR2_STOP_1) | huart->Init.StopBits;
+  instance->CR1 = (instance->CR1 & ~(USART_CR1_M | 0x0600U | USART_CR1_TE | USART_CR1_RE | USART_CR1_OVER8)) |
+                  huart->Init.WordLength | huart->Init.Parity | huart->Init.Mode | huart->Init.OverSampling;
+  pclk = ((instance == USART1) || (instance == USART6)) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+  instance->BRR = (huart->Init.OverSampling == UART_OVERSAMPLING_8) ?
+                  UART_BRR_SAMPLING8(pclk, huart->Init.BaudRate) : UART_BRR_SAMPLING16(pclk, huart->Init.BaudRate);
+  instance->CR1 |= USART_CR1_UE;
+
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_READY;
+  huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->RxEventType = HAL_UART_RXEVENT_TC;
+
+  if (instance == USART1)
+  {
+    uart1 = huart;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
+{
+  if (huart == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  huart->gState = HAL_UART_STATE_BUSY;
+  huart->Instance->CR1 &= ~USART_CR1_UE;
+  HAL_UART_MspDeInit(huart);
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_RESET;
+  huart->RxState = HAL_UART_STATE_RESET;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->Lock = HAL_UNLOCKED;
+  return HAL_OK;
+}
+
+/**
+  * @brief  USART1 interrupt setup of Core/Src/stm32f4xx_hal_msp.c
+  * @param  huart  UART handle
+  * @retval None
+  */
+__weak void HAL_UART_MspInit(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == USART1)
+  {
+    HAL_NVIC_SetPriority(USART1_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(USART1_IRQn);
+  }
+}
+
+__weak void HAL_UART_MspDeInit(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == USART1)
+  {
+    HAL_NVIC_DisableIRQ(USART1_IRQn);
+  }
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  uint32_t tickstart;
+
+  if (huart->gState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if ((pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_BUSY_TX;
+  tickstart = HAL_GetTick();
+  huart->TxXferSize = Size;
+  huart->TxXferCount = Size;
+
+  while (huart->TxXferCount > 0U)
+  {
+    if (SIM_UartWaitFlag(huart, USART_SR_TXE, tickstart, Timeout) != HAL_OK)
+    {
+      huart->gState = HAL_UART_STATE_READY;
+      return HAL_TIMEOUT;
+    }
+    SIM_UartWriteDr(*pData++);
+    huart->TxXferCount--;
+  }
+  if (SIM_UartWaitFlag(huart, USART_SR_TC, tickstart, Timeout) != HAL_OK)
+  {
+    huart->gState = HAL_UART_STATE_READY;
+    return HAL_TIMEOUT;
+  }
+
+  huart->gState = HAL_UART_STATE_READY;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  uint32_t tickstart;
+
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if ((pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  tickstart = HAL_GetTick();
+  huart->RxXferSize = Size;
+  huart->RxXferCount = Size;
+
+  while (huart->RxXferCount > 0U)
+  {
+    if (SIM_UartWaitFlag(huart, USART_SR_RXNE, tickstart, Timeout) != HAL_OK)
+    {
+      huart->RxState = HAL_UART_STATE_READY;
+      return HAL_TIMEOUT;
+    }
+    *pData++ = SIM_UartReadDr();
+    huart->RxXferCount--;
+  }
+
+  huart->RxState = HAL_UART_STATE_READY;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+  if (huart->gState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if ((pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->pTxBuffPtr = pData;
+  huart->TxXferSize = Size;
+  huart->TxXferCount = Size;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_BUSY_TX;
+  __HAL_UART_ENABLE_IT(huart, UART_IT_TXE);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if ((pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxBuffPtr = pData;
+  huart->RxXferSize = Size;
+  huart->RxXferCount = Size;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  __HAL_UART_ENABLE_IT(huart, UART_IT_ERR);
+  __HAL_UART_ENABLE_IT(huart, UART_IT_RXNE);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+  if (huart->gState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if ((pData == NULL) || (Size == 0U) || (huart->hdmatx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->pTxBuffPtr = pData;
+  huart->TxXferSize = Size;
+  huart->TxXferCount = Size;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->gState = HAL_UART_STATE_BUSY_TX;
+
+  huart->hdmatx->XferCpltCallback = UART_DMATransmitCplt;
+  huart->hdmatx->XferHalfCpltCallback = UART_DMATxHalfCplt;
+  huart->hdmatx->XferErrorCallback = NULL;
+  huart->hdmatx->XferAbortCallback = NULL;
+  SIM_DmaStart(huart->hdmatx, (uint8_t *)pData, Size);
+
+  huart->Instance->SR &= ~USART_SR_TC;
+  huart->Instance->CR3 |= USART_CR3_DMAT;
+  SIM_DmaRequestTx();
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if ((pData == NULL) || (Size == 0U) || (huart->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  SIM_UartStartReceiveDma(huart, pData, Size);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if ((pData == NULL) || (Size == 0U) || (huart->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+  huart->RxEventType = HAL_UART_RXEVENT_TC;
+  SIM_UartStartReceiveDma(huart, pData, Size);
+  __HAL_UART_CLEAR_IDLEFLAG(huart);
+  __HAL_UART_ENABLE_IT(huart, UART_IT_IDLE);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
+{
+  huart->Instance->CR1 &= ~(USART_CR1_RXNEIE | USART_CR1_PEIE);
+  huart->Instance->CR3 &= ~USART_CR3_EIE;
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    huart->Instance->CR1 &= ~USART_CR1_IDLEIE;
+  }
+  if (huart->Instance->CR3 & USART_CR3_DMAR)
+  {
+    huart->Instance->CR3 &= ~USART_CR3_DMAR;
+    if (huart->hdmarx != NULL)
+    {
+      (void)HAL_DMA_Abort(huart->hdmarx);
+    }
+  }
+
+  huart->RxXferCount = 0U;
+  __HAL_UART_CLEAR_OREFLAG(huart);
+  huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  return HAL_OK;
+}
+
+/**
+  * @brief  USART1 interrupt, in the order of the HAL handler
+  * @param  huart  UART handle
+  * @retval None
+  */
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+  const uint32_t isrflags = huart->Instance->SR;
+  const uint32_t cr1its = huart->Instance->CR1;
+  const uint32_t cr3its = huart->Instance->CR3;
+  const uint32_t errorflags = isrflags & (USART_SR_PE | USART_SR_FE | USART_SR_ORE | USART_SR_NE);
+  uint16_t remaining;
+
+  if (errorflags == 0U)
+  {
+    if ((isrflags & USART_SR_RXNE) && (cr1its & USART_CR1_RXNEIE))
+    {
+      UART_Receive_IT(huart);
+      return;
+    }
+  }
+
+  if ((errorflags != 0U) && ((cr3its & USART_CR3_EIE) || (cr1its & (USART_CR1_RXNEIE | USART_CR1_PEIE))))
+  {
+    if (isrflags & USART_SR_ORE)
+    {
+      huart->ErrorCode |= HAL_UART_ERROR_ORE;
+    }
+
+    if (huart->ErrorCode != HAL_UART_ERROR_NONE)
+    {
+      if ((isrflags & USART_SR_RXNE) && (cr1its & USART_CR1_RXNEIE))
+      {
+        UART_Receive_IT(huart);
+      }
+
+      if ((huart->ErrorCode & HAL_UART_ERROR_ORE) || (huart->Instance->CR3 & USART_CR3_DMAR))
+      {
+        SIM_UartEndRxTransfer(huart);
+        if (huart->Instance->CR3 & USART_CR3_DMAR)
+        {
+          huart->Instance->CR3 &= ~USART_CR3_DMAR;
+          if (huart->hdmarx != NULL)
+          {
+            /* UART_DMAAbortOnError() */
+            (void)HAL_DMA_Abort(huart->hdmarx);
+            huart->RxXferCount = 0U;
+            huart->TxXferCount = 0U;
+          }
+        }
+        HAL_UART_ErrorCallback(huart);
+      }
+      else
+      {
+        HAL_UART_ErrorCallback(huart);
+        huart->ErrorCode = HAL_UART_ERROR_NONE;
+      }
+    }
+    return;
+  }
+
+  if ((huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE) && (isrflags & USART_SR_IDLE) &&
+      (cr1its & USART_CR1_IDLEIE))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+
+    if ((huart->Instance->CR3 & USART_CR3_DMAR) && (huart->hdmarx != NULL))
+    {
+      /* Nothing since the last DMA event: already reported */
+      remaining = (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx);
+      if ((remaining > 0U) && (remaining < huart->RxXferSize))
+      {
+        huart->RxXferCount = remaining;
+        if (huart->hdmarx->Init.Mode != DMA_CIRCULAR)
+        {
+          huart->Instance->CR1 &= ~(USART_CR1_PEIE | USART_CR1_IDLEIE);
+          huart->Instance->CR3 &= ~(USART_CR3_EIE | USART_CR3_DMAR);
+          huart->RxState = HAL_UART_STATE_READY;
+          huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+          (void)HAL_DMA_Abort(huart->hdmarx);
+        }
+        huart->RxEventType = HAL_UART_RXEVENT_IDLE;
+        HAL_UARTEx_RxEventCallback(huart, (uint16_t)(huart->RxXferSize - huart->RxXferCount));
+      }
+    }
+    return;
+  }
+
+  if ((isrflags & USART_SR_TXE) && (cr1its & USART_CR1_TXEIE))
+  {
+    UART_Transmit_IT(huart);
+    return;
+  }
+
+  if ((isrflags & USART_SR_TC) && (cr1its & USART_CR1_TCIE))
+  {
+    UART_EndTransmit_IT(huart);
+    return;
+  }
+}
+
+__weak void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__weak void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__weak void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__weak void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__weak void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__weak void HAL_UART_AbortReceiveCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  UNUSED(huart);
+  UNUSED(Size);
+}
+
+/**
+  * @brief  UART_WaitOnFlagUntilTimeout()
+  * @param  huart      UART handle
+  * @param  flag       SR flag to wait for
+  * @param  tickstart  Start of the transfer
+  * @param  timeout    Milliseconds, HAL_MAX_DELAY for none
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SIM_UartWaitFlag(UART_HandleTypeDef *huart, uint32_t flag, uint32_t tickstart, uint32_t timeout)
+{
+  while (!(huart->Instance->SR & flag))
+  {
+    if (timeout != HAL_MAX_DELAY)
+    {
+      if ((timeout == 0U) || ((HAL_GetTick() - tickstart) > timeout))
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+    else
+    {
+      (void)HAL_GetTick();
+    }
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  UART_Start_Receive_DMA()
+  * @param  huart  UART handle
+  * @param  pData  Buffer
+  * @param  Size   Bytes
+  * @retval None
+  */
+static void SIM_UartStartReceiveDma(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  huart->pRxBuffPtr = pData;
+  huart->RxXferSize = Size;
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+
+  huart->hdmarx->XferCpltCallback = UART_DMAReceiveCplt;
+  huart->hdmarx->XferHalfCpltCallback = UART_DMARxHalfCplt;
+  huart->hdmarx->XferErrorCallback = NULL;
+  huart->hdmarx->XferAbortCallback = NULL;
+  SIM_DmaStart(huart->hdmarx, pData, Size);
+
+  __HAL_UART_CLEAR_OREFLAG(huart);
+  __HAL_UART_ENABLE_IT(huart, UART_IT_ERR);
+  huart->Instance->CR3 |= USART_CR3_DMAR;
+}
+
+/**
+  * @brief  UART_EndRxTransfer()
+  * @param  huart  UART handle
+  * @retval None
+  */
+static void SIM_UartEndRxTransfer(UART_HandleTypeDef *huart)
+{
+  huart->Instance->CR1 &= ~(USART_CR1_RXNEIE | USART_CR1_PEIE);
+  huart->Instance->CR3 &= ~USART_CR3_EIE;
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    huart->Instance->CR1 &= ~USART_CR1_IDLEIE;
+  }
+  huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+}
+
+static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)hdma->Parent;
+
+  if (!(hdma->Instance->CR & DMA_SxCR_CIRC))
+  {
+    /* The last byte is still on the line: TC ends the transfer */
+    huart->TxXferCount = 0U;
+    huart->Instance->CR3 &= ~USART_CR3_DMAT;
+    __HAL_UART_ENABLE_IT(huart, UART_IT_TC);
+  }
+  else
+  {
+    HAL_UART_TxCpltCallback(huart);
+  }
+}
+
+static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  HAL_UART_TxHalfCpltCallback((UART_HandleTypeDef *)hdma->Parent);
+}
+
+static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)hdma->Parent;
+
+  if (!(hdma->Instance->CR & DMA_SxCR_CIRC))
+  {
+    huart->RxXferCount = 0U;
+    huart->Instance->CR1 &= ~USART_CR1_PEIE;
+    huart->Instance->CR3 &= ~(USART_CR3_EIE | USART_CR3_DMAR);
+    huart->RxState = HAL_UART_STATE_READY;
+    if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+    {
+      huart->Instance->CR1 &= ~USART_CR1_IDLEIE;
+    }
+  }
+
+  huart->RxEventType = HAL_UART_RXEVENT_TC;
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    HAL_UARTEx_RxEventCallback(huart, huart->RxXferSize);
+  }
+  else
+  {
+    HAL_UART_RxCpltCallback(huart);
+  }
+}
+
+static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)hdma->Parent;
+
+  huart->RxEventType = HAL_UART_RXEVENT_HT;
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    HAL_UARTEx_RxEventCallback(huart, (uint16_t)(huart->RxXferSize / 2U));
+  }
+  else
+  {
+    HAL_UART_RxHalfCpltCallback(huart);
+  }
+}
+
+/**
+  * @brief  RXNE: next byte of an interrupt reception
+  * @details Outside a reception DR is not read, so RXNE stays set as with
+  *          the HAL
+  * @param  huart  UART handle
+  * @retval None
+  */
+static void UART_Receive_IT(UART_HandleTypeDef *huart)
+{
+  if (huart->RxState != HAL_UART_STATE_BUSY_RX)
+  {
+    return;
+  }
+
+  *huart->pRxBuffPtr++ = SIM_UartReadDr();
+  if (--huart->RxXferCount == 0U)
+  {
+    huart->Instance->CR1 &= ~(USART_CR1_RXNEIE | USART_CR1_PEIE);
+    huart->Instance->CR3 &= ~USART_CR3_EIE;
+    huart->RxState = HAL_UART_STATE_READY;
+    huart->RxEventType = HAL_UART_RXEVENT_TC;
+    if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+    {
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      huart->Instance->CR1 &= ~USART_CR1_IDLEIE;
+      HAL_UARTEx_RxEventCallback(huart, huart->RxXferSize);
+    }
+    else
+    {
+      HAL_UART_RxCpltCallback(huart);
+    }
+  }
+}
+
+/**
+  * @brief  TXE: next byte of an interrupt transmission
+  * @param  huart  UART handle
+  * @retval None
+  */
+static void UART_Transmit_IT(UART_HandleTypeDef *huart)
+{
+  if (huart->gState != HAL_UART_STATE_BUSY_TX)
+  {
+    return;
+  }
+
+  SIM_UartWriteDr(*huart->pTxBuffPtr++);
+  if (--huart->TxXferCount == 0U)
+  {
+    __HAL_UART_DISABLE_IT(huart, UART_IT_TXE);
+    __HAL_UART_ENABLE_IT(huart, UART_IT_TC);
+  }
+}
+
+/**
+  * @brief  TC: the last byte left the shift register
+  * @param  huart  UART handle
+  * @retval None
+  */
+static void UART_EndTransmit_IT(UART_HandleTypeDef *huart)
+{
+  __HAL_UART_DISABLE_IT(huart, UART_IT_TC);
+  huart->gState = HAL_UART_STATE_READY;
+  HAL_UART_TxCpltCallback(huart);
+}
@@ -0,0 +1,161 @@
+/**
+  ******************************************************************************
+  * @file    sim_hal.h
+  * @brief   Simulated STM32F429 for host builds: control interface
+  * @details The simulated HAL (tools/common/Inc) runs the code under test against a
+  *          virtual clock. This interface is the other side of it, for the
+  *          host programs driving a simulation:
+  *          - bytes injected on the USART1 RX line arrive one frame time
+  *            apart at the baud rate programmed in BRR, and end with an
+  *            idle line detection one frame later
+  *          - the RX DMA (DMA2 stream 5) and TX DMA (stream 7) move one
+  *            byte per request and count NDTR down, reloading it in
+  *            circular mode; the TX line is captured for reading back
+  *          - interrupts are taken by NVIC priority, so a handler waiting
+  *            for an interrupt of the same or lower priority waits for good,
+  *            as on the board; HAL_GetTick() reports such a hang and exits
+  *          - the HAL tick is TIM6 at TICK_INT_PRIORITY, every millisecond
+  *
+  *          Time only moves in SIM_Run*(), HAL_GetTick() (SIM_POLL_NS per
+  *          call, the cost of a polling loop) and per handler run
+  *          (SIM_SetIsrCost()). Everything is deterministic: the same
+  *          program gives the same timings on any host.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SIM_HAL_H__
+#define __SIM_HAL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SIM_HCLK_HZ               180000000U
+#define SIM_PCLK1_HZ              45000000U
+#define SIM_PCLK2_HZ              90000000U
+
+#define SIM_RX_QUEUE_SIZE         16384U    /* Injected bytes not yet on the line */
+#define SIM_TX_CAPTURE_SIZE       16384U    /* Transmitted bytes not yet read back */
+#define SIM_POLL_NS               1000U     /* Charged per HAL_GetTick() */
+#define SIM_ISR_COST_NS           500U      /* Default charge per handler run */
+#define SIM_STALL_MS              1000U     /* Tick frozen this long in a wait: hang */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Interrupts of the simulation
+ */
+typedef enum
+{
+  SIM_IRQ_USART1 = 0,
+  SIM_IRQ_DMA_RX,               /*!< DMA2 stream 5 */
+  SIM_IRQ_DMA_TX,               /*!< DMA2 stream 7 */
+  SIM_IRQ_TICK,                 /*!< TIM6 */
+  SIM_IRQ_COUNT
+} SIM_Irq_t;
+
+/**
+ * @brief   Simulation counters
+ */
+typedef struct
+{
+  uint32_t rxBytes;             /*!< Bytes that arrived on the RX line */
+  uint32_t rxDmaBytes;          /*!< Of which moved by the RX DMA */
+  uint32_t rxOverruns;          /*!< Lost: the previous byte was still in DR */
+  uint32_t rxDisabled;          /*!< Lost: receiver off */
+  uint32_t txBytes;             /*!< Bytes sent on the TX line */
+  uint32_t txCaptureLost;       /*!< Sent while the capture was full */
+  uint32_t irqs[SIM_IRQ_COUNT];
+  uint64_t irqMaxLatencyNs[SIM_IRQ_COUNT]; /*!< Pending to handler entry */
+  uint64_t irqBusyNs;           /*!< Time charged to handlers */
+} SIM_Stats_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Powers the simulated device up
+ * @details Time zero, registers at their reset values, no interrupt
+ *          enabled but the tick, queues and counters empty
+ * @param   None
+ * @retval  None
+ */
+void SIM_Reset(void);
+
+/**
+ * @brief   Time charged per handler run
+ * @param   ns  Nanoseconds, at least 1 so that an interrupt storm still
+ *              lets time move
+ * @retval  None
+ */
+void SIM_SetIsrCost(uint32_t ns);
+
+/**
+ * @brief   Virtual time
+ * @param   None
+ * @retval  Nanoseconds since SIM_Reset()
+ */
+uint64_t SIM_NowNs(void);
+
+/**
+ * @brief   USART1 frame time at the programmed baud rate and format
+ * @param   None
+ * @retval  Nanoseconds per byte on the line
+ */
+uint32_t SIM_UartFrameNs(void);
+
+/**
+ * @brief   Queues bytes on the USART1 RX line
+ * @details The first byte ends gapNs plus one frame after the previous
+ *          queued byte (or now), the others back to back
+ * @param   data   Bytes
+ * @param   size   Number of bytes
+ * @param   gapNs  Idle line before the first byte
+ * @retval  Bytes queued, less than size when the queue is full
+ */
+uint32_t SIM_UartInject(const uint8_t *data, uint32_t size, uint32_t gapNs);
+
+/**
+ * @brief   Arrival time of the last byte received
+ * @param   None
+ * @retval  Nanoseconds
+ */
+uint64_t SIM_UartLastRxNs(void);
+
+/**
+ * @brief   Reads back the bytes sent on USART1 TX
+ * @param   data  Destination
+ * @param   size  Room in data
+ * @retval  Bytes read
+ */
+uint32_t SIM_UartTxRead(uint8_t *data, uint32_t size);
+
+/**
+ * @brief   Runs the simulation for a while
+ * @param   ns  Nanoseconds
+ * @retval  None
+ */
+void SIM_RunFor(uint64_t ns);
+
+/**
+ * @brief   Runs until the injected bytes are received and the lines idle
+ * @param   limitNs  Longest run
+ * @retval  1 if idle, 0 at the limit
+ */
+uint8_t SIM_RunUntilIdle(uint64_t limitNs);
+
+/**
+ * @brief   Reads the counters
+ * @param   stats  Destination
+ * @retval  None
+ */
+void SIM_GetStats(SIM_Stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_HAL_H__ */
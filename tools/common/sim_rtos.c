@@ -0,0 +1,175 @@
+/**
+  ******************************************************************************
+  * @file    sim_rtos.c
+  * @brief   CMSIS-RTOS2 stand-in for host builds
+  * @details Implements the threads and message queues of Inc/cmsis_os.h on
+  *          POSIX threads, as described in sim_rtos.h. Thread attributes
+  *          are taken and ignored: the host schedules the threads.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_rtos.h"
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private types -------------------------------------------------------------*/
+typedef struct SimQueue
+{
+  struct SimQueue *next;
+  pthread_mutex_t lock;
+  pthread_cond_t changed;
+  uint8_t *buffer;
+  uint32_t msgSize;
+  uint32_t capacity;
+  uint32_t head;
+  uint32_t count;
+  uint32_t waiting;           /* Threads blocked on an empty queue */
+} SimQueue_t;
+
+typedef struct
+{
+  osThreadFunc_t func;
+  void *argument;
+} SimThread_t;
+
+/* Private variables ---------------------------------------------------------*/
+static pthread_mutex_t registry = PTHREAD_MUTEX_INITIALIZER;
+static SimQueue_t *queues;
+
+/* Threads -------------------------------------------------------------------*/
+static void *SIM_ThreadEntry(void *argument)
+{
+  SimThread_t thread = *(SimThread_t *)argument;
+
+  free(argument);
+  thread.func(thread.argument);
+  return NULL;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+  SimThread_t *thread = malloc(sizeof(*thread));
+  pthread_t id;
+
+  (void)attr;
+
+  if (thread == NULL)
+  {
+    return NULL;
+  }
+  thread->func = func;
+  thread->argument = argument;
+  if (pthread_create(&id, NULL, SIM_ThreadEntry, thread) != 0)
+  {
+    free(thread);
+    return NULL;
+  }
+  pthread_detach(id);
+  return (osThreadId_t)thread;
+}
+
+/* Message queues ------------------------------------------------------------*/
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr)
+{
+  SimQueue_t *queue;
+
+  (void)attr;
+
+  queue = calloc(1U, sizeof(*queue));
+  if (queue == NULL)
+  {
+    return NULL;
+  }
+  queue->buffer = malloc((size_t)msg_count * msg_size);
+  if (queue->buffer == NULL)
+  {
+    free(queue);
+    return NULL;
+  }
+  pthread_mutex_init(&queue->lock, NULL);
+  pthread_cond_init(&queue->changed, NULL);
+  queue->msgSize = msg_size;
+  queue->capacity = msg_count;
+
+  pthread_mutex_lock(&registry);
+  queue->next = queues;
+  queues = queue;
+  pthread_mutex_unlock(&registry);
+  return queue;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+  SimQueue_t *queue = mq_id;
+  osStatus_t status = osErrorResource;
+
+  (void)msg_prio;
+  (void)timeout;
+
+  pthread_mutex_lock(&queue->lock);
+  if (queue->count < queue->capacity)
+  {
+    const uint32_t slot = (queue->head + queue->count) % queue->capacity;
+
+    memcpy(&queue->buffer[slot * queue->msgSize], msg_ptr, queue->msgSize);
+    queue->count++;
+    pthread_cond_broadcast(&queue->changed);
+    status = osOK;
+  }
+  pthread_mutex_unlock(&queue->lock);
+  return status;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+  SimQueue_t *queue = mq_id;
+
+  if (msg_prio != NULL)
+  {
+    *msg_prio = 0U;
+  }
+
+  pthread_mutex_lock(&queue->lock);
+  while ((queue->count == 0U) && (timeout != 0U))
+  {
+    queue->waiting++;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_cond_wait(&queue->changed, &queue->lock);
+    queue->waiting--;
+  }
+  if (queue->count == 0U)
+  {
+    pthread_mutex_unlock(&queue->lock);
+    return osErrorResource;
+  }
+  memcpy(msg_ptr, &queue->buffer[queue->head * queue->msgSize], queue->msgSize);
+  queue->head = (queue->head + 1U) % queue->capacity;
+  queue->count--;
+  pthread_mutex_unlock(&queue->lock);
+  return osOK;
+}
+
+/* Controls ------------------------------------------------------------------*/
+void SIM_WaitIdle(void)
+{
+  SimQueue_t *queue;
+
+  pthread_mutex_lock(&registry);
+  queue = queues;
+  pthread_mutex_unlock(&registry);
+
+  for (; queue != NULL; queue = queue->next)
+  {
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->count != 0U) || (queue->waiting == 0U))
+    {
+      pthread_cond_wait(&queue->changed, &queue->lock);
+    }
+    pthread_mutex_unlock(&queue->lock);
+  }
+}
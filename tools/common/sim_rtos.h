@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file    sim_rtos.h
+  * @brief   CMSIS-RTOS2 stand-in for host builds: control interface
+  * @details Every thread is a pthread and every message queue a ring under
+  *          a mutex; the check waits here for the threads to work through
+  *          what it queued.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SIM_RTOS_H__
+#define __SIM_RTOS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "cmsis_os.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Waits until every queue is empty with a thread blocked on it
+ * @details A consumer blocked on its empty queue has finished the work of
+ *          every message it took. Only for queues some thread reads with a
+ *          timeout: it waits for good on one nobody blocks on.
+ * @param   None
+ * @retval  None
+ */
+void SIM_WaitIdle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_RTOS_H__ */
@@ -0,0 +1,272 @@
+#!/usr/bin/env python
+"""Symbolize the crash dumps printed by Peripherals/SYS/crash.c.
+
+After a fault, Error_Handler() or a failed kernel assert, the firmware stores
+the CPU state in the backup SRAM, resets, and prints the dump on the next
+boot as "CRASH ..." lines. Save the console output and run:
+
+    tools/crash_decode/crash_decode.py console.log build/STM32F429I-DISC1.elf
+
+The registers, the decoded fault status and a probable call chain are
+printed. The call chain comes from the stack snippet: every word that is a
+Thumb return address into the ELF text (odd, and right after a BL or BLX) is
+taken as a frame, innermost first. Stale return addresses left on the stack
+by earlier calls show up too, so read it as a hint and start from pc and lr.
+
+Function names come from the ELF symbol table; with arm-none-eabi-addr2line
+on the PATH (or --addr2line) file and line numbers are added. The ELF must
+be the one the unit runs.
+
+Only the Python standard library is used.
+"""
+
+from __future__ import print_function
+
+import argparse
+import bisect
+import re
+import shutil
+import struct
+import subprocess
+import sys
+
+CFSR_BITS = [
+    (0, "IACCVIOL", "instruction fetch from a no-execute or protected region"),
+    (1, "DACCVIOL", "data access violation, address in MMFAR if MMARVALID"),
+    (3, "MUNSTKERR", "MemManage fault on exception return unstacking"),
+    (4, "MSTKERR", "MemManage fault on exception entry stacking"),
+    (5, "MLSPERR", "MemManage fault during lazy FP state preservation"),
+    (7, "MMARVALID", "MMFAR holds the faulting address"),
+    (8, "IBUSERR", "bus error on instruction fetch"),
+    (9, "PRECISERR", "precise data bus error, address in BFAR if BFARVALID"),
+    (10, "IMPRECISERR", "imprecise data bus error, pc is past the access"),
+    (11, "UNSTKERR", "bus fault on exception return unstacking"),
+    (12, "STKERR", "bus fault on exception entry stacking, likely a stack overflow"),
+    (13, "LSPERR", "bus fault during lazy FP state preservation"),
+    (15, "BFARVALID", "BFAR holds the faulting address"),
+    (16, "UNDEFINSTR", "undefined instruction"),
+    (17, "INVSTATE", "invalid EPSR state, e.g. a call through an even address"),
+    (18, "INVPC", "invalid EXC_RETURN or PC load"),
+    (19, "NOCP", "coprocessor access while disabled"),
+    (24, "UNALIGNED", "unaligned access with UNALIGN_TRP set"),
+    (25, "DIVBYZERO", "divide by zero with DIV_0_TRP set"),
+]
+
+HFSR_BITS = [
+    (1, "VECTTBL", "bus fault on a vector table read"),
+    (30, "FORCED", "escalated from a configurable fault, see CFSR"),
+    (31, "DEBUGEVT", "debug event"),
+]
+
+SHF_EXECINSTR = 0x4
+SHT_SYMTAB = 2
+STT_FUNC = 2
+
+
+class Elf(object):
+    """Minimal little-endian ELF32 reader: executable sections and functions."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        d = self.data
+        if d[:4] != b"\x7fELF" or d[4] != 1 or d[5] != 1:
+            raise ValueError("%s: not a little-endian ELF32 file" % path)
+        shoff, = struct.unpack_from("<I", d, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", d, 0x2E)
+        sections = [struct.unpack_from("<IIIIIIIIII", d, shoff + i * shentsize) for i in range(shnum)]
+
+        self.code = []
+        for s in sections:
+            name, stype, flags, addr, offset, size = s[:6]
+            if flags & SHF_EXECINSTR and stype != 8:  # not NOBITS
+                self.code.append((addr, addr + size, offset))
+
+        funcs = {}
+        for s in sections:
+            if s[1] != SHT_SYMTAB:
+                continue
+            strtab = sections[s[6]]
+            for off in range(s[4], s[4] + s[5], 16):
+                st_name, value, size, info, _, _ = struct.unpack_from("<IIIBBH", d, off)
+                if info & 0xF != STT_FUNC or value == 0:
+                    continue
+                start = strtab[4] + st_name
+                name = d[start:d.index(b"\0", start)].decode("ascii", "replace")
+                funcs[value & ~1] = (name, size)
+        self.func_addrs = sorted(funcs)
+        self.funcs = funcs
+
+    def in_code(self, addr):
+        return any(lo <= addr < hi for lo, hi, _ in self.code)
+
+    def halfword(self, addr):
+        for lo, hi, offset in self.code:
+            if lo <= addr and addr + 2 <= hi:
+                return struct.unpack_from("<H", self.data, offset + addr - lo)[0]
+        return None
+
+    def function(self, addr):
+        i = bisect.bisect_right(self.func_addrs, addr) - 1
+        if i < 0:
+            return None
+        start = self.func_addrs[i]
+        name, size = self.funcs[start]
+        if size and addr >= start + size:
+            return None
+        return "%s+0x%x" % (name, addr - start)
+
+    def is_return_address(self, value):
+        """Odd address into the text, right after a BL, BLX imm or BLX reg."""
+        if not value & 1:
+            return False
+        addr = value & ~1
+        if not self.in_code(addr):
+            return False
+        hw1 = self.halfword(addr - 4)
+        hw2 = self.halfword(addr - 2)
+        if hw1 is not None and hw2 is not None and hw1 & 0xF800 == 0xF000 and \
+                (hw2 & 0xD000 == 0xD000 or hw2 & 0xD001 == 0xC000):
+            return True
+        return hw2 is not None and hw2 & 0xFF87 == 0x4780
+
+
+class Addr2Line(object):
+    def __init__(self, tool, elf_path):
+        self.tool = shutil.which(tool) if hasattr(shutil, "which") else None
+        self.elf_path = elf_path
+
+    def lookup(self, addrs):
+        if not self.tool or not self.elf_path or not addrs:
+            return {}
+        out = subprocess.run([self.tool, "-e", self.elf_path] + ["0x%08x" % a for a in addrs],
+                             stdout=subprocess.PIPE, universal_newlines=True, check=False).stdout
+        return dict(zip(addrs, out.splitlines()))
+
+
+def parse_dumps(lines):
+    """Group the CRASH lines into dumps, one per "CRASH cause=" line."""
+    dumps = []
+    current = None
+    for line in lines:
+        m = re.search(r"\bCRASH (.*)$", line.rstrip("\r\n"))
+        if not m:
+            continue
+        body = m.group(1)
+        if body.startswith("cause="):
+            current = {"fields": {}, "stack": []}
+            dumps.append(current)
+        if current is None:
+            continue
+        if body == "end":
+            current = None
+            continue
+        s = re.match(r"stack ([0-9A-Fa-f]{8}):((?: [0-9A-Fa-f]{8})+)", body)
+        if s:
+            base = int(s.group(1), 16)
+            for i, word in enumerate(s.group(2).split()):
+                current["stack"].append((base + 4 * i, int(word, 16)))
+            continue
+        if body.startswith("fault="):
+            current["fields"]["fault"] = body[len("fault="):]
+            continue
+        for key, value in re.findall(r"(\w+)=(\S+)", body):
+            current["fields"][key] = value
+    return dumps
+
+
+def hexfield(fields, key):
+    try:
+        return int(fields.get(key, "0"), 16)
+    except ValueError:
+        return 0
+
+
+def describe(elf, addr, lines):
+    name = elf.function(addr & ~1) if elf else None
+    where = lines.get(addr & ~1, "")
+    if where.startswith("??"):
+        where = ""
+    return " ".join(x for x in (name or "?", where) if x)
+
+
+def decode(dump, elf, a2l, max_frames):
+    f = dump["fields"]
+    pc = hexfield(f, "pc")
+    lr = hexfield(f, "lr")
+    cfsr = hexfield(f, "cfsr")
+    hfsr = hexfield(f, "hfsr")
+
+    frames = []
+    if elf:
+        for addr, value in dump["stack"]:
+            if elf.is_return_address(value):
+                frames.append((addr, value))
+                if len(frames) >= max_frames:
+                    break
+
+    # Return addresses point after the call: look up the call itself
+    lookups = [pc & ~1, (lr & ~1) - 2] + [(v & ~1) - 2 for _, v in frames]
+    lines = a2l.lookup(sorted(set(a for a in lookups if a > 0)))
+
+    print("Crash %s: %s, uptime %s ms, task %s" % (f.get("count", "?"), f.get("cause", "?"),
+                                                   f.get("uptime", "?"), f.get("task", "-")))
+    if f.get("cause") == "assert":
+        print("  configASSERT() at line %s of the caller's FreeRTOS source" % f.get("info", "?"))
+    print("  pc  %08x  %s" % (pc, describe(elf, pc, lines)))
+    if lr >= 0xFFFFFFE0:
+        print("  lr  %08x  (EXC_RETURN: the fault hit an exception entry)" % lr)
+    else:
+        print("  lr  %08x  %s" % (lr, describe(elf, (lr & ~1) - 2, lines)))
+    print("  sp  %08x  xpsr %s  exc %s  msp %s  psp %s" % (hexfield(f, "sp"), f.get("xpsr", "?"),
+                                                         f.get("exc", "?"), f.get("msp", "?"),
+                                                         f.get("psp", "?")))
+    regs = ["r%d=%s" % (i, f.get("r%d" % i, "?")) for i in range(13)]
+    print("  " + " ".join(regs[:7]))
+    print("  " + " ".join(regs[7:]))
+
+    print("Fault status: cfsr %08x hfsr %08x" % (cfsr, hfsr))
+    for bit, name, text in CFSR_BITS:
+        if cfsr & (1 << bit):
+            print("  %-12s %s" % (name, text))
+    for bit, name, text in HFSR_BITS:
+        if hfsr & (1 << bit):
+            print("  %-12s %s" % (name, text))
+    if cfsr & (1 << 7):
+        print("  MemManage address %08x" % hexfield(f, "mmfar"))
+    if cfsr & (1 << 15):
+        print("  Bus fault address %08x" % hexfield(f, "bfar"))
+
+    if not elf:
+        return
+    print("Probable call chain, innermost first (%d stack words):" % len(dump["stack"]))
+    for addr, value in frames:
+        print("  [%08x] %08x  %s" % (addr, value, describe(elf, (value & ~1) - 2, lines)))
+    if not frames:
+        print("  none found")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("log", help="console output holding the CRASH lines, - for stdin")
+    parser.add_argument("elf", nargs="?", help="firmware ELF of the unit")
+    parser.add_argument("--addr2line", default="arm-none-eabi-addr2line")
+    parser.add_argument("--all", action="store_true", help="decode every dump, not only the last")
+    parser.add_argument("--frames", type=int, default=24, help="longest call chain")
+    args = parser.parse_args()
+
+    stream = sys.stdin if args.log == "-" else open(args.log, "r", errors="replace")
+    with stream:
+        dumps = parse_dumps(stream)
+    if not dumps:
+        sys.exit("no CRASH dump found in %s" % args.log)
+
+    elf = Elf(args.elf) if args.elf else None
+    a2l = Addr2Line(args.addr2line, args.elf)
+    for dump in (dumps if args.all else dumps[-1:]):
+        decode(dump, elf, a2l, args.frames)
+        print()
+
+
+if __name__ == "__main__":
+    main()
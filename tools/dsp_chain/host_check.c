@@ -0,0 +1,531 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Double precision equivalence check of the filter chains
+  * @details Runs Peripherals/DSP on the host CMSIS-DSP build and compares
+  *          every output sample with a double precision model of the same
+  *          table: direct form II transposed biquads, FIR decimators that
+  *          keep every M-th output of the full convolution and moving
+  *          averages summed from scratch. The chain must match to within
+  *          TOLERANCE of its largest output, with the same output count:
+  *          - the board table of dsp_chain_table.c, fed scan blocks through
+  *            the ACQ block callback
+  *          - three channels built from one table, called in turn with one
+  *            to three blocks at a time, covering every stage type, chained
+  *            decimators, asymmetric taps and windows longer than a block
+  *          - a long moving average on a large offset, to a tighter
+  *            tolerance, where a running sum alone would drift
+  *          - tables DSPCHAIN_Init() must reject
+  *          The cost per input sample is reported from the chain statistics,
+  *          in host ns: the DWT counter reads process CPU time here.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dsp_chain.h"
+#include "sim_acq.h"
+#include "stm32f4xx_ll_adc.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define TOLERANCE           5e-5        /* Of the largest output; float rounding
+                                           through the 0.02 fs sections reaches 2e-5 */
+#define DRIFT_TOLERANCE     1e-5        /* Moving average alone; a running sum
+                                           never rebuilt drifts past 3e-5 */
+#define BOARD_SAMPLES       32000U      /* 32 s at 1 kHz, whole ACQ blocks */
+#define MIXED_SAMPLES       48000U      /* 750 blocks of 64, 1000 of 48 */
+#define DRIFT_SAMPLES       200000U
+#define CHANNELS            3U
+
+/* Private variables ---------------------------------------------------------*/
+static float32_t biquadSections[3U * 5U];
+static float32_t fullSections[3U * 5U];
+static float32_t taps15[15];
+static float32_t taps24[24];
+static float32_t taps9[9];
+
+static const DSPCHAIN_Stage_t biquadStages[] = {
+  { DSPCHAIN_STAGE_BIQUAD,         biquadSections,  3U, 1U },
+};
+
+static const DSPCHAIN_Stage_t decimateStages[] = {
+  { DSPCHAIN_STAGE_FIR_DECIMATE,   taps15,         15U, 2U },
+  { DSPCHAIN_STAGE_FIR_DECIMATE,   taps24,         24U, 4U },
+  { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,           50U, 1U },
+};
+
+static const DSPCHAIN_Stage_t fullStages[] = {
+  { DSPCHAIN_STAGE_BIQUAD,         fullSections,    2U, 1U },
+  { DSPCHAIN_STAGE_FIR_DECIMATE,   taps9,           9U, 3U },
+  { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,            7U, 1U },
+  { DSPCHAIN_STAGE_BIQUAD,         &fullSections[10], 1U, 1U },
+};
+
+static const DSPCHAIN_Stage_t driftStages[] = {
+  { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,          200U, 1U },
+};
+
+static const DSPCHAIN_Channel_t mixedTable[CHANNELS] = {
+  { "biquad3",     1000U, 64U, 1U, biquadStages },
+  { "decimate2x4", 1000U, 64U, 3U, decimateStages },
+  { "all_stages",  1000U, 48U, 4U, fullStages },
+};
+
+static const DSPCHAIN_Channel_t driftTable[] = {
+  { "average200",  1000U, 40U, 1U, driftStages },
+};
+
+static float32_t *inputs[CHANNELS];
+static float32_t *outputs[CHANNELS];
+static uint32_t outputCounts[CHANNELS];
+static double *reference;
+static double *work[2];
+static uint32_t lcg = 12345U;
+static uint32_t failures;
+
+/* Private functions ---------------------------------------------------------*/
+static double Uniform(void)
+{
+  lcg = (lcg * 1103515245U) + 12345U;
+  return ((double)(lcg >> 8) + 0.5) / 16777216.0;
+}
+
+static double Gaussian(void)
+{
+  return sqrt(-2.0 * log(Uniform())) * cos(2.0 * M_PI * Uniform());
+}
+
+/**
+  * @brief  RBJ cookbook low pass section, {b0, b1, b2, -a1, -a2}
+  */
+static void Lowpass(float32_t *section, double f0, double q)
+{
+  const double w = 2.0 * M_PI * f0;
+  const double alpha = sin(w) / (2.0 * q);
+  const double a0 = 1.0 + alpha;
+
+  section[0] = (float32_t)(((1.0 - cos(w)) / 2.0) / a0);
+  section[1] = (float32_t)((1.0 - cos(w)) / a0);
+  section[2] = section[0];
+  section[3] = (float32_t)((2.0 * cos(w)) / a0);
+  section[4] = (float32_t)(-(1.0 - alpha) / a0);
+}
+
+/**
+  * @brief  RBJ cookbook band pass section, 0 dB peak
+  */
+static void Bandpass(float32_t *section, double f0, double q)
+{
+  const double w = 2.0 * M_PI * f0;
+  const double alpha = sin(w) / (2.0 * q);
+  const double a0 = 1.0 + alpha;
+
+  section[0] = (float32_t)(alpha / a0);
+  section[1] = 0.0f;
+  section[2] = (float32_t)(-alpha / a0);
+  section[3] = (float32_t)((2.0 * cos(w)) / a0);
+  section[4] = (float32_t)(-(1.0 - alpha) / a0);
+}
+
+/**
+  * @brief  Random taps summing to one, so the order matters
+  */
+static void RandomTaps(float32_t *taps, uint32_t count)
+{
+  double sum = 0.0;
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    taps[i] = (float32_t)(Uniform() + 0.1);
+    sum += taps[i];
+  }
+  for (i = 0; i < count; i++)
+  {
+    taps[i] = (float32_t)(taps[i] / sum);
+  }
+}
+
+/**
+  * @brief  Double precision model of one stage
+  * @param  stage  Stage descriptor
+  * @param  in     Input signal from the start
+  * @param  count  Input samples
+  * @param  out    Output signal
+  * @retval Output samples
+  */
+static uint32_t RefStage(const DSPCHAIN_Stage_t *stage, const double *in, uint32_t count, double *out)
+{
+  uint32_t n;
+  uint32_t k;
+
+  switch (stage->type)
+  {
+    case DSPCHAIN_STAGE_BIQUAD:
+      memcpy(out, in, count * sizeof(double));
+      for (k = 0; k < stage->length; k++)
+      {
+        const float32_t *c = &stage->coeffs[5U * k];
+        double d1 = 0.0;
+        double d2 = 0.0;
+
+        for (n = 0; n < count; n++)
+        {
+          const double x = out[n];
+          const double y = (c[0] * x) + d1;
+
+          d1 = (c[1] * x) + (c[3] * y) + d2;
+          d2 = (c[2] * x) + (c[4] * y);
+          out[n] = y;
+        }
+      }
+      return count;
+
+    case DSPCHAIN_STAGE_FIR_DECIMATE:
+      /* y[n] = sum of coeffs[k] x[n M - (length - 1) + k], taps time reversed */
+      for (n = 0; n < (count / stage->decimation); n++)
+      {
+        const int64_t last = (int64_t)n * stage->decimation;
+        double acc = 0.0;
+
+        for (k = 0; k < stage->length; k++)
+        {
+          const int64_t i = last - (int64_t)(stage->length - 1U) + (int64_t)k;
+
+          if (i >= 0)
+          {
+            acc += stage->coeffs[k] * in[i];
+          }
+        }
+        out[n] = acc;
+      }
+      return count / stage->decimation;
+
+    default:
+      for (n = 0; n < count; n++)
+      {
+        double acc = 0.0;
+
+        for (k = 0; (k < stage->length) && (k <= n); k++)
+        {
+          acc += in[n - k];
+        }
+        out[n] = acc / stage->length;
+      }
+      return count;
+  }
+}
+
+/**
+  * @brief  Double precision model of a channel
+  * @param  config  Channel descriptor
+  * @param  in      Input samples
+  * @param  count   Input samples
+  * @retval Output samples, in reference
+  */
+static uint32_t RefChain(const DSPCHAIN_Channel_t *config, const float32_t *in, uint32_t count)
+{
+  uint32_t s;
+  uint32_t n;
+
+  for (n = 0; n < count; n++)
+  {
+    work[0][n] = in[n];
+  }
+  for (s = 0; s < config->stageCount; s++)
+  {
+    count = RefStage(&config->stages[s], work[s & 1U], count, work[(s + 1U) & 1U]);
+  }
+  memcpy(reference, work[config->stageCount & 1U], count * sizeof(double));
+  return count;
+}
+
+/**
+  * @brief  Compares a channel output with its double precision model
+  * @param  channel   Channel index, after DSPCHAIN_Init()
+  * @param  in        Input fed to the channel
+  * @param  count     Input samples
+  * @param  out       Output of the channel
+  * @param  produced  Output samples
+  * @param  tolerance Largest error allowed, of the largest output
+  * @retval None
+  */
+static void Compare(uint32_t channel, const float32_t *in, uint32_t count,
+                    const float32_t *out, uint32_t produced, double tolerance)
+{
+  const DSPCHAIN_Channel_t *config = DSPCHAIN_GetConfig(channel);
+  DSPCHAIN_Stats_t stats;
+  const uint32_t expected = RefChain(config, in, count);
+  double peak = 0.0;
+  double worst = 0.0;
+  uint32_t n;
+
+  (void)DSPCHAIN_GetStats(channel, &stats);
+  for (n = 0; n < expected; n++)
+  {
+    peak = fmax(peak, fabs(reference[n]));
+    if (n < produced)
+    {
+      worst = fmax(worst, fabs(out[n] - reference[n]));
+    }
+  }
+
+  printf("%-12s %6u in, %5u out at %4u Hz, error %.2e of the largest output, "
+         "%u.%02u ns per sample\n", config->name, (unsigned)count, (unsigned)produced,
+         (unsigned)stats.outputRateHz, worst / peak,
+         (unsigned)(stats.centiCyclesPerSample / 100U),
+         (unsigned)(stats.centiCyclesPerSample % 100U));
+  if ((produced != expected) || (stats.samplesOut != produced) || (peak == 0.0) ||
+      ((worst / peak) > tolerance))
+  {
+    printf("FAILED: %s: %u outputs of %u\n", config->name, (unsigned)produced, (unsigned)expected);
+    failures++;
+  }
+}
+
+/**
+  * @brief  Output consumer of the board chains
+  */
+static void Collect(uint32_t channel, const float32_t *out, uint32_t count, void *context)
+{
+  (void)context;
+
+  if (channel < CHANNELS)
+  {
+    memcpy(&outputs[channel][outputCounts[channel]], out, count * sizeof(float32_t));
+    outputCounts[channel] += count;
+  }
+}
+
+/**
+  * @brief  Board table through the ACQ block callback
+  * @details VDDA with 50 Hz ripple and a die temperature swinging slowly,
+  *          as 12-bit readings with noise; the chain input is recorded with
+  *          the conversions dsp_chain_table.c applies.
+  */
+static void CheckBoard(void)
+{
+  ACQ_Sample_t block[ACQ_BLOCK_SAMPLES];
+  uint32_t n;
+  uint32_t i;
+
+  memset(outputCounts, 0, sizeof(outputCounts));
+  if (DSPCHAIN_StartSensorChains() != HAL_OK)
+  {
+    printf("FAILED: DSPCHAIN_StartSensorChains()\n");
+    failures++;
+    return;
+  }
+  DSPCHAIN_SetOutputCallback(Collect, NULL);
+
+  for (n = 0; n < BOARD_SAMPLES; n += ACQ_BLOCK_SAMPLES)
+  {
+    for (i = 0; i < ACQ_BLOCK_SAMPLES; i++)
+    {
+      const double t = (double)(n + i) * 1.0e-3;
+      const double vdda = 3300.0 + (20.0 * sin(2.0 * M_PI * 50.0 * t)) + (5.0 * Gaussian());
+      ACQ_Sample_t *sample = &block[i];
+
+      sample->timestampUs = (uint64_t)(n + i) * 1000U;
+      sample->raw[0] = (uint16_t)lround((SIM_VREFINT_CAL * 3300.0) / vdda);
+      sample->raw[1] = (uint16_t)lround(950.0 + (30.0 * sin(2.0 * M_PI * 0.05 * t)) +
+                                        (3.0 * Gaussian()));
+      inputs[0][n + i] = (float32_t)__LL_ADC_CALC_VREFANALOG_VOLTAGE(sample->raw[0],
+                                                                     LL_ADC_RESOLUTION_12B);
+      inputs[1][n + i] = (float32_t)ACQ_ToCentiCelsius(sample) * 0.01f;
+    }
+    SIM_AcqBlock(block, ACQ_BLOCK_SAMPLES);
+  }
+  DSPCHAIN_SetOutputCallback(NULL, NULL);
+
+  for (i = 0; i < DSPCHAIN_GetChannelCount(); i++)
+  {
+    Compare(i, inputs[i], BOARD_SAMPLES, outputs[i], outputCounts[i], TOLERANCE);
+  }
+}
+
+/**
+  * @brief  Three test channels from one table, processed in turn
+  */
+static void CheckMixed(void)
+{
+  uint32_t produced[CHANNELS] = {0U};
+  uint32_t consumed[CHANNELS] = {0U};
+  uint8_t pending;
+  uint32_t c;
+  uint32_t n;
+
+  if (DSPCHAIN_Init(mixedTable, CHANNELS) != HAL_OK)
+  {
+    printf("FAILED: DSPCHAIN_Init() of the test table\n");
+    failures++;
+    return;
+  }
+
+  for (c = 0; c < CHANNELS; c++)
+  {
+    for (n = 0; n < MIXED_SAMPLES; n++)
+    {
+      const double t = (double)n * 1.0e-3;
+
+      inputs[c][n] = (float32_t)(2.0 + sin(2.0 * M_PI * 3.0 * t) + (0.5 * sin(2.0 * M_PI * 97.0 * t)) +
+                                 (0.3 * Gaussian()));
+    }
+  }
+
+  /* One to three blocks per call, channels interleaved; MIXED_SAMPLES is a
+     multiple of every block size */
+  do
+  {
+    pending = 0U;
+    for (c = 0; c < CHANNELS; c++)
+    {
+      uint32_t count = mixedTable[c].blockSize * (1U + (uint32_t)(3.0 * Uniform()));
+
+      if (count > (MIXED_SAMPLES - consumed[c]))
+      {
+        count = MIXED_SAMPLES - consumed[c];
+      }
+      if (count > 0U)
+      {
+        produced[c] += DSPCHAIN_Process(c, &inputs[c][consumed[c]], count, &outputs[c][produced[c]]);
+        consumed[c] += count;
+        pending = 1U;
+      }
+    }
+  } while (pending);
+
+  for (c = 0; c < CHANNELS; c++)
+  {
+    Compare(c, inputs[c], consumed[c], outputs[c], produced[c], TOLERANCE);
+  }
+}
+
+/**
+  * @brief  Long moving average on a large offset
+  */
+static void CheckDrift(void)
+{
+  float32_t *in = malloc(DRIFT_SAMPLES * sizeof(float32_t));
+  float32_t *out = malloc(DRIFT_SAMPLES * sizeof(float32_t));
+  uint32_t produced;
+  uint32_t n;
+
+  if ((in == NULL) || (out == NULL) || (DSPCHAIN_Init(driftTable, 1U) != HAL_OK))
+  {
+    printf("FAILED: drift channel setup\n");
+    failures++;
+    free(in);
+    free(out);
+    return;
+  }
+
+  for (n = 0; n < DRIFT_SAMPLES; n++)
+  {
+    in[n] = (float32_t)(1000.0 + Gaussian());
+  }
+  produced = DSPCHAIN_Process(0U, in, DRIFT_SAMPLES, out);
+  Compare(0U, in, DRIFT_SAMPLES, out, produced, DRIFT_TOLERANCE);
+  free(in);
+  free(out);
+}
+
+/**
+  * @brief  Tables DSPCHAIN_Init() must refuse
+  */
+static void CheckRejected(void)
+{
+  static const DSPCHAIN_Stage_t decimate8[] = {
+    { DSPCHAIN_STAGE_FIR_DECIMATE,   taps9,   9U, 8U },
+  };
+  static const DSPCHAIN_Stage_t tooLong[] = {
+    { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL, (uint16_t)(DSPCHAIN_STATE_WORDS + 1U), 1U },
+  };
+  static const DSPCHAIN_Stage_t empty[] = {
+    { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,    0U, 1U },
+  };
+  static const DSPCHAIN_Stage_t noTaps[] = {
+    { DSPCHAIN_STAGE_BIQUAD,         NULL,    1U, 1U },
+  };
+  static const DSPCHAIN_Stage_t five[] = {
+    { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,    2U, 1U },
+    { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,    2U, 1U },
+    { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,    2U, 1U },
+    { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,    2U, 1U },
+    { DSPCHAIN_STAGE_MOVING_AVERAGE, NULL,    2U, 1U },
+  };
+  static const DSPCHAIN_Channel_t rejected[] = {
+    { "indivisible", 1000U, 60U, 1U, decimate8 },
+    { "arena",       1000U, 32U, 1U, tooLong },
+    { "empty",       1000U, 32U, 1U, empty },
+    { "no_coeffs",   1000U, 32U, 1U, noTaps },
+    { "five_stages", 1000U, 32U, 5U, five },
+    { "block_0",     1000U,  0U, 1U, empty },
+    { "block_65",    1000U, (uint16_t)(DSPCHAIN_MAX_BLOCK + 1U), 1U, driftStages },
+  };
+  uint32_t i;
+
+  for (i = 0; i < (sizeof(rejected) / sizeof(rejected[0])); i++)
+  {
+    if (DSPCHAIN_Init(&rejected[i], 1U) != HAL_ERROR)
+    {
+      printf("FAILED: table \"%s\" accepted\n", rejected[i].name);
+      failures++;
+    }
+  }
+  if (DSPCHAIN_Init(mixedTable, DSPCHAIN_MAX_CHANNELS + 1U) != HAL_ERROR)
+  {
+    printf("FAILED: %u channels accepted\n", (unsigned)(DSPCHAIN_MAX_CHANNELS + 1U));
+    failures++;
+  }
+  printf("%u invalid tables rejected\n", (unsigned)(sizeof(rejected) / sizeof(rejected[0]) + 1U));
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  uint32_t c;
+
+  for (c = 0; c < CHANNELS; c++)
+  {
+    inputs[c] = malloc(MIXED_SAMPLES * sizeof(float32_t));
+    outputs[c] = malloc(MIXED_SAMPLES * sizeof(float32_t));
+  }
+  reference = malloc(DRIFT_SAMPLES * sizeof(double));
+  work[0] = malloc(DRIFT_SAMPLES * sizeof(double));
+  work[1] = malloc(DRIFT_SAMPLES * sizeof(double));
+  if ((inputs[CHANNELS - 1U] == NULL) || (outputs[CHANNELS - 1U] == NULL) ||
+      (reference == NULL) || (work[0] == NULL) || (work[1] == NULL))
+  {
+    printf("FAILED: out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  Lowpass(&biquadSections[0], 0.05, 0.7071);
+  Bandpass(&biquadSections[5], 0.1, 5.0);
+  Lowpass(&biquadSections[10], 0.2, 1.3);
+  Lowpass(&fullSections[0], 0.02, 0.5412);
+  Lowpass(&fullSections[5], 0.02, 1.3066);
+  Bandpass(&fullSections[10], 0.05, 2.0);
+  RandomTaps(taps15, 15U);
+  RandomTaps(taps24, 24U);
+  RandomTaps(taps9, 9U);
+
+  CheckBoard();
+  CheckMixed();
+  CheckDrift();
+  CheckRejected();
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u checks\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @file    sim_acq.c
+  * @brief   Acquisition stand-in, filter chain check
+  * @details Replaces Peripherals/ACQ for dsp_chain_table.c: the block
+  *          consumer is kept and called by SIM_AcqBlock(), and the
+  *          temperature conversion follows acq.c with fixed calibration
+  *          values.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_acq.h"
+#include "stm32f4xx_ll_adc.h"
+#include <stddef.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_TEMP_CAL1             943       /* Reading at 30 degC */
+#define SIM_TEMP_CAL2             1223      /* Reading at 110 degC */
+
+/* Private variables ---------------------------------------------------------*/
+static ACQ_BlockCallback_t blockCallback;
+static void *blockContext;
+
+/* ACQ -----------------------------------------------------------------------*/
+void ACQ_SetBlockCallback(ACQ_BlockCallback_t callback, void *context)
+{
+  blockCallback = callback;
+  blockContext = context;
+}
+
+int32_t ACQ_ToCentiCelsius(const ACQ_Sample_t *sample)
+{
+  int32_t vref = (sample->raw[0] != 0U) ? (int32_t)sample->raw[0] : 1;
+  int32_t sense = ((int32_t)sample->raw[1] * (int32_t)SIM_VREFINT_CAL) / vref;
+
+  return (((sense - SIM_TEMP_CAL1) * (110 - 30) * 100) / (SIM_TEMP_CAL2 - SIM_TEMP_CAL1)) + 3000;
+}
+
+void SIM_AcqBlock(const ACQ_Sample_t *samples, uint32_t count)
+{
+  if (blockCallback != NULL)
+  {
+    blockCallback(samples, count, blockContext);
+  }
+}
@@ -0,0 +1,20 @@
+/**
+  ******************************************************************************
+  * @file    sim_acq.h
+  * @brief   Controls of the acquisition stand-in, filter chain check
+  * @details The check delivers scan blocks as the ADC DMA interrupt would.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SIM_ACQ_H__
+#define __SIM_ACQ_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "acq.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+void SIM_AcqBlock(const ACQ_Sample_t *samples, uint32_t count);
+
+#endif /* __SIM_ACQ_H__ */
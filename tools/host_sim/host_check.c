@@ -0,0 +1,505 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host check and benchmarks of the UART, DMA and CRC code
+  * @details Runs Peripherals/UART and Peripherals/CRC against the simulated
+  *          HAL:
+  *          - ring buffer: capacity, order, wrap
+  *          - command line assembly: terminators, split input, long lines
+  *          - circular DMA reception to idle: half, full and idle events,
+  *            their positions and times, NDTR, the data at each position
+  *          - interrupt mode console: one byte per interrupt into a command
+  *          - transmission in DMA, interrupt and blocking mode: bytes on the
+  *            line, duration, interrupts taken
+  *          - CRC against a bitwise reference
+  *          then measures the host cost of the ring buffer, line assembly
+  *          and CRC, and the interrupt load of a kilobyte received in
+  *          interrupt mode against DMA with idle detection. The virtual
+  *          figures are the same on every host.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_hal.h"
+#include "host_console.h"
+#include "uart_dma.h"
+#include "uart_interrupt.h"
+#include "uart_blocking.h"
+#include "uart_ring_buffer.h"
+#include "uart_cmdline.h"
+#include "crc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define DMA_RING_SIZE   64U         /* Small, so that the checks wrap it */
+#define BENCH_OPS       2000000U
+#define BENCH_CRC_WORDS 256U        /* 1 KB */
+#define BENCH_RX_BYTES  1024U
+#define RUN_LIMIT_NS    1000000000ULL
+
+#define CHECK(cond, ...)                              \
+  do                                                  \
+  {                                                   \
+    if (!(cond))                                      \
+    {                                                 \
+      printf("FAILED: %s:%d: ", __FILE__, __LINE__);  \
+      printf(__VA_ARGS__);                            \
+      printf("\n");                                   \
+      failures++;                                     \
+    }                                                 \
+  } while (0)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t failures;
+static uint32_t lcg = 12345U;
+static uint8_t dmaRing[DMA_RING_SIZE];
+static char lines[4][UART_CMDLINE_SIZE];
+static uint32_t lineCount;
+static volatile uint32_t benchSink;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t Random(void)
+{
+  lcg = (lcg * 1103515245U) + 12345U;
+  return lcg >> 8;
+}
+
+static double HostNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static UART_Status_t RecordLine(const char *cmd)
+{
+  if (lineCount < 4U)
+  {
+    strcpy(lines[lineCount], cmd);
+  }
+  lineCount++;
+  return UART_OK;
+}
+
+static UART_Status_t CountLine(const char *cmd)
+{
+  benchSink += (uint8_t)cmd[0];
+  return UART_OK;
+}
+
+/**
+  * @brief  CRC unit model, one bit at a time
+  */
+static uint32_t ReferenceCrc(const uint32_t *data, uint32_t size)
+{
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t i;
+  int bit;
+
+  for (i = 0; i < size; i++)
+  {
+    crc ^= data[i];
+    for (bit = 0; bit < 32; bit++)
+    {
+      crc = (crc & 0x80000000U) ? ((crc << 1) ^ 0x04C11DB7U) : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+/* Checks --------------------------------------------------------------------*/
+static void CheckRingBuffer(void)
+{
+  RingBuffer_t ring;
+  uint8_t byte = 0U;
+  uint32_t i;
+  uint32_t errors = 0U;
+
+  RingBuffer_Init(&ring);
+  CHECK(RingBuffer_IsEmpty(&ring), "new ring not empty");
+  CHECK(!RingBuffer_Get(&ring, &byte), "get from empty ring");
+
+  for (i = 0; i < RING_BUFFER_SIZE; i++)
+  {
+    errors += RingBuffer_Put(&ring, (uint8_t)i) ? 0U : 1U;
+  }
+  CHECK(errors == 0U, "%u puts failed below capacity", (unsigned)errors);
+  CHECK(RingBuffer_IsFull(&ring), "ring not full at %u", (unsigned)RING_BUFFER_SIZE);
+  CHECK(!RingBuffer_Put(&ring, 0xAAU), "put into full ring");
+
+  /* Half out, half in again: the indices wrap */
+  for (i = 0; i < (RING_BUFFER_SIZE / 2U); i++)
+  {
+    errors += (RingBuffer_Get(&ring, &byte) && (byte == (uint8_t)i)) ? 0U : 1U;
+  }
+  for (i = 0; i < (RING_BUFFER_SIZE / 2U); i++)
+  {
+    errors += RingBuffer_Put(&ring, (uint8_t)(i + RING_BUFFER_SIZE)) ? 0U : 1U;
+  }
+  for (i = RING_BUFFER_SIZE / 2U; i < (RING_BUFFER_SIZE + (RING_BUFFER_SIZE / 2U)); i++)
+  {
+    errors += (RingBuffer_Get(&ring, &byte) && (byte == (uint8_t)i)) ? 0U : 1U;
+  }
+  CHECK(errors == 0U, "%u bytes out of order across the wrap", (unsigned)errors);
+  CHECK(RingBuffer_Available(&ring) == 0U, "%u bytes left", (unsigned)RingBuffer_Available(&ring));
+}
+
+static void CheckCmdLine(void)
+{
+  UART_CmdLine_t line;
+  RingBuffer_t ring;
+  uint8_t longLine[600];
+  uint32_t i;
+
+  UART_CmdLine_Init(&line, RecordLine);
+  lineCount = 0U;
+  UART_CmdLine_Feed(&line, (const uint8_t *)"status\r", 7U);
+  CHECK((lineCount == 1U) && (strcmp(lines[0], "status\r") == 0), "status\\r not one line");
+
+  /* CR LF gives an empty second line, as on the board */
+  lineCount = 0U;
+  UART_CmdLine_Feed(&line, (const uint8_t *)"a\r\nb\n", 5U);
+  CHECK((lineCount == 3U) && (strcmp(lines[0], "a\r") == 0) && (strcmp(lines[1], "\n") == 0) &&
+        (strcmp(lines[2], "b\n") == 0), "a\\r\\nb\\n gave %u lines", (unsigned)lineCount);
+
+  lineCount = 0U;
+  UART_CmdLine_Feed(&line, (const uint8_t *)"ec", 2U);
+  UART_CmdLine_Feed(&line, (const uint8_t *)"ho hi", 5U);
+  CHECK(lineCount == 0U, "line handed over before its terminator");
+  UART_CmdLine_Feed(&line, (const uint8_t *)"\n", 1U);
+  CHECK((lineCount == 1U) && (strcmp(lines[0], "echo hi\n") == 0), "split line not joined");
+
+  lineCount = 0U;
+  memset(longLine, 'x', sizeof(longLine));
+  UART_CmdLine_Feed(&line, longLine, (uint16_t)sizeof(longLine));
+  CHECK((lineCount == 1U) && (strlen(lines[0]) == (UART_CMDLINE_SIZE - 1U)),
+        "long line: %u lines", (unsigned)lineCount);
+  CHECK(line.length == (sizeof(longLine) - (UART_CMDLINE_SIZE - 1U)), "long line: %u bytes kept",
+        (unsigned)line.length);
+
+  UART_CmdLine_Reset(&line);
+  lineCount = 0U;
+  RingBuffer_Init(&ring);
+  for (i = 0; i < 200U; i++)
+  {
+    RingBuffer_Put(&ring, ((i % 50U) == 49U) ? (uint8_t)'\n' : (uint8_t)('a' + (i % 26U)));
+  }
+  CHECK(UART_CmdLine_Drain(&line, &ring) == 200U, "drain did not take everything");
+  CHECK((lineCount == 4U) && (strlen(lines[3]) == 50U), "drain: %u lines", (unsigned)lineCount);
+  CHECK(RingBuffer_IsEmpty(&ring), "drain left bytes");
+}
+
+/**
+  * @brief  Continuous reception as the bridge uses it
+  */
+static void CheckDmaReceive(void)
+{
+  static const uint32_t chunks[] = { 10U, 30U, 24U, 5U, 70U };
+  static const struct
+  {
+    uint16_t size;
+    uint8_t type;
+  } expected[] = {
+    { 10U, HAL_UART_RXEVENT_IDLE },   /* 10 */
+    { 32U, HAL_UART_RXEVENT_HT },     /* 40: half way */
+    { 40U, HAL_UART_RXEVENT_IDLE },
+    { 64U, HAL_UART_RXEVENT_TC },     /* 64: wrap, the idle after it is not reported */
+    { 5U, HAL_UART_RXEVENT_IDLE },    /* 69 */
+    { 32U, HAL_UART_RXEVENT_HT },     /* 139: wraps again */
+    { 64U, HAL_UART_RXEVENT_TC },
+    { 11U, HAL_UART_RXEVENT_IDLE }
+  };
+  uint8_t sent[256];
+  uint32_t sentCount = 0U;
+  uint32_t frameNs;
+  uint32_t i;
+  uint32_t c;
+  SIM_Stats_t stats;
+
+  CHECK(HOST_ConsoleInit(UART_MODE_DMA) == UART_OK, "UART_Init DMA");
+  CHECK(UART_DMA_ReceiveToIdle(&uartHandle, dmaRing, DMA_RING_SIZE, HOST_ConsoleRxEvent) == UART_OK, "UART_DMA_ReceiveToIdle");
+  frameNs = SIM_UartFrameNs();
+
+  for (c = 0; c < (sizeof(chunks) / sizeof(chunks[0])); c++)
+  {
+    const uint32_t eventsBefore = hostConsole.eventCount;
+
+    for (i = 0; i < chunks[c]; i++)
+    {
+      sent[sentCount + i] = (uint8_t)Random();
+    }
+    SIM_UartInject(&sent[sentCount], chunks[c], 200000U);
+    sentCount += chunks[c];
+    CHECK(SIM_RunUntilIdle(RUN_LIMIT_NS), "chunk %u: line did not go idle", (unsigned)c);
+
+    /* The idle event comes one frame after the last stop bit */
+    if ((hostConsole.eventCount > eventsBefore) &&
+        (hostConsole.events[hostConsole.eventCount - 1U].type == HAL_UART_RXEVENT_IDLE))
+    {
+      const uint64_t delay = hostConsole.events[hostConsole.eventCount - 1U].atNs - SIM_UartLastRxNs();
+
+      CHECK((delay >= frameNs) && (delay <= (frameNs + SIM_ISR_COST_NS)),
+            "chunk %u: idle event %llu ns after the last byte, frame %u ns", (unsigned)c,
+            (unsigned long long)delay, (unsigned)frameNs);
+    }
+  }
+
+  CHECK(hostConsole.eventCount == (sizeof(expected) / sizeof(expected[0])), "%u RX events",
+        (unsigned)hostConsole.eventCount);
+  for (i = 0; (i < hostConsole.eventCount) && (i < (sizeof(expected) / sizeof(expected[0]))); i++)
+  {
+    const HOST_RxEvent_t *event = &hostConsole.events[i];
+
+    CHECK((event->size == expected[i].size) && (event->type == expected[i].type),
+          "event %u: size %u type %u, expected size %u type %u", (unsigned)i, (unsigned)event->size,
+          (unsigned)event->type, (unsigned)expected[i].size, (unsigned)expected[i].type);
+
+  }
+  CHECK((hostConsole.rxCount == sentCount) && (memcmp(sent, hostConsole.rx, sentCount) == 0),
+        "data read at the event positions differs from the data sent (%u of %u bytes)",
+        (unsigned)hostConsole.rxCount, (unsigned)sentCount);
+  CHECK(__HAL_DMA_GET_COUNTER(huart1.hdmarx) == (DMA_RING_SIZE - (sentCount % DMA_RING_SIZE)),
+        "NDTR %u after %u bytes", (unsigned)__HAL_DMA_GET_COUNTER(huart1.hdmarx), (unsigned)sentCount);
+
+  SIM_GetStats(&stats);
+  CHECK((stats.rxDmaBytes == sentCount) && (stats.rxOverruns == 0U), "%u bytes by DMA, %u overruns",
+        (unsigned)stats.rxDmaBytes, (unsigned)stats.rxOverruns);
+  CHECK(stats.irqs[SIM_IRQ_USART1] == (sizeof(chunks) / sizeof(chunks[0])),
+        "%u USART1 interrupts for %u idle lines", (unsigned)stats.irqs[SIM_IRQ_USART1],
+        (unsigned)(sizeof(chunks) / sizeof(chunks[0])));
+  CHECK(hostConsole.errors == 0U, "%u UART errors", (unsigned)hostConsole.errors);
+}
+
+/**
+  * @brief  Console in interrupt mode: byte by byte into the command line
+  */
+static void CheckInterruptConsole(void)
+{
+  static const char command[] = "status\r";
+  SIM_Stats_t stats;
+
+  CHECK(HOST_ConsoleInit(UART_MODE_INTERRUPT) == UART_OK, "UART_Init interrupt");
+  CHECK(HAL_UART_Receive_IT(&huart1, uartHandle.rxBuffer, 1U) == HAL_OK, "HAL_UART_Receive_IT");
+
+  SIM_UartInject((const uint8_t *)command, sizeof(command) - 1U, 0U);
+  CHECK(HOST_ConsoleRun(RUN_LIMIT_NS), "line did not go idle");
+
+  SIM_GetStats(&stats);
+  CHECK((hostConsole.commandCount == 1U) && (strcmp(hostConsole.commands[0], command) == 0),
+        "%u commands, first \"%s\"", (unsigned)hostConsole.commandCount, hostConsole.commands[0]);
+  CHECK(stats.irqs[SIM_IRQ_USART1] == (sizeof(command) - 1U), "%u USART1 interrupts for %u bytes",
+        (unsigned)stats.irqs[SIM_IRQ_USART1], (unsigned)(sizeof(command) - 1U));
+  CHECK(stats.rxOverruns == 0U, "%u overruns", (unsigned)stats.rxOverruns);
+}
+
+/**
+  * @brief  One message in each transmit mode
+  */
+static void CheckTransmit(void)
+{
+  static const UART_Mode_t modes[] = { UART_MODE_DMA, UART_MODE_INTERRUPT, UART_MODE_BLOCKING };
+  static const char *const names[] = { "DMA", "interrupt", "blocking" };
+  uint8_t message[100];
+  uint8_t line[sizeof(message) + 1U];
+  uint64_t startNs;
+  uint64_t durationNs;
+  uint64_t wireNs;
+  uint32_t n;
+  uint32_t m;
+  UART_Status_t status;
+  SIM_Stats_t stats;
+
+  for (m = 0; m < (sizeof(modes) / sizeof(modes[0])); m++)
+  {
+    for (n = 0; n < sizeof(message); n++)
+    {
+      message[n] = (uint8_t)Random();
+    }
+
+    CHECK(HOST_ConsoleInit(modes[m]) == UART_OK, "%s: UART_Init", names[m]);
+    wireNs = (uint64_t)sizeof(message) * SIM_UartFrameNs();
+    startNs = SIM_NowNs();
+    status = UART_Transmit(&uartHandle, message, sizeof(message), UART_TIMEOUT);
+    durationNs = SIM_NowNs() - startNs;
+
+    n = SIM_UartTxRead(line, sizeof(line));
+    SIM_GetStats(&stats);
+    CHECK(status == UART_OK, "%s: status %d", names[m], (int)status);
+    CHECK((n == sizeof(message)) && (memcmp(line, message, n) == 0), "%s: %u bytes on the line differ",
+          names[m], (unsigned)n);
+
+    /* Back to back on the line, then the completion poll: a few microseconds */
+    CHECK((durationNs >= wireNs) && (durationNs <= (wireNs + 20000U)), "%s: %llu ns for %llu ns on the line",
+          names[m], (unsigned long long)durationNs, (unsigned long long)wireNs);
+
+    switch (modes[m])
+    {
+      case UART_MODE_DMA:
+        /* Half and full transfer, then TC on the USART */
+        CHECK((stats.irqs[SIM_IRQ_DMA_TX] == 2U) && (stats.irqs[SIM_IRQ_USART1] == 1U),
+              "DMA: %u stream and %u USART1 interrupts", (unsigned)stats.irqs[SIM_IRQ_DMA_TX],
+              (unsigned)stats.irqs[SIM_IRQ_USART1]);
+        CHECK(hostConsole.txDone == 1U, "DMA: %u completions", (unsigned)hostConsole.txDone);
+        break;
+      case UART_MODE_INTERRUPT:
+        /* TXE per byte, then TC */
+        CHECK(stats.irqs[SIM_IRQ_USART1] == (sizeof(message) + 1U), "interrupt: %u USART1 interrupts",
+              (unsigned)stats.irqs[SIM_IRQ_USART1]);
+        CHECK(hostConsole.txDone == 1U, "interrupt: %u completions", (unsigned)hostConsole.txDone);
+        break;
+      default:
+        CHECK(stats.irqs[SIM_IRQ_USART1] == 0U, "blocking: %u USART1 interrupts",
+              (unsigned)stats.irqs[SIM_IRQ_USART1]);
+        break;
+    }
+  }
+}
+
+static void CheckCrc(void)
+{
+  uint32_t word = 0x12345678U;
+  uint32_t data[BENCH_CRC_WORDS];
+  uint32_t i;
+
+  CRC_Init();
+  CHECK(CRC_Calculate(&word, 1U) == 0xDF8A8A2BU, "CRC of 0x12345678 is 0x%08X",
+        (unsigned)CRC_Calculate(&word, 1U));
+
+  for (i = 0; i < BENCH_CRC_WORDS; i++)
+  {
+    data[i] = (Random() << 8) ^ Random();
+  }
+  CHECK(CRC_Calculate(data, BENCH_CRC_WORDS) == ReferenceCrc(data, BENCH_CRC_WORDS), "CRC of 1 KB differs");
+  CHECK(CRC_Calculate(data, BENCH_CRC_WORDS) == CRC_Calculate(data, BENCH_CRC_WORDS), "CRC not reset per call");
+}
+
+/* Benchmarks ----------------------------------------------------------------*/
+static void BenchHost(void)
+{
+  static RingBuffer_t ring;
+  static UART_CmdLine_t line;
+  static uint8_t text[4096];
+  uint32_t data[BENCH_CRC_WORDS];
+  uint8_t byte = 0U;
+  double start;
+  double putGetNs;
+  double putDataNs;
+  double feedNs;
+  double crcNs;
+  uint32_t i;
+
+  for (i = 0; i < sizeof(text); i++)
+  {
+    text[i] = ((i % 64U) == 63U) ? (uint8_t)'\n' : (uint8_t)('a' + (i % 26U));
+  }
+  for (i = 0; i < BENCH_CRC_WORDS; i++)
+  {
+    data[i] = Random();
+  }
+
+  RingBuffer_Init(&ring);
+  start = HostNs();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    RingBuffer_Put(&ring, (uint8_t)i);
+    RingBuffer_Get(&ring, &byte);
+    benchSink += byte;
+  }
+  putGetNs = (HostNs() - start) / BENCH_OPS;
+
+  UART_RingBuffer_Init();
+  start = HostNs();
+  for (i = 0; i < (BENCH_OPS / 256U); i++)
+  {
+    UART_RingBuffer_PutData(text, 256U);
+    UART_RingBuffer_Init();
+  }
+  putDataNs = (HostNs() - start) / ((BENCH_OPS / 256U) * 256U);
+
+  UART_CmdLine_Init(&line, CountLine);
+  start = HostNs();
+  for (i = 0; i < (BENCH_OPS / sizeof(text)); i++)
+  {
+    UART_CmdLine_Feed(&line, text, sizeof(text));
+  }
+  feedNs = (HostNs() - start) / ((BENCH_OPS / sizeof(text)) * sizeof(text));
+
+  CRC_Init();
+  start = HostNs();
+  for (i = 0; i < 2000U; i++)
+  {
+    benchSink += CRC_Calculate(data, BENCH_CRC_WORDS);
+  }
+  crcNs = (HostNs() - start) / 2000U;
+
+  printf("host: ring put+get %.1f ns, PutData %.1f ns/byte, line assembly %.1f ns/byte, CRC %.0f ns/KB\n",
+         putGetNs, putDataNs, feedNs, crcNs);
+}
+
+/**
+  * @brief  Interrupts and handler time for 1 KB of console input
+  */
+static void BenchRxLoad(void)
+{
+  uint8_t text[BENCH_RX_BYTES];
+  SIM_Stats_t it;
+  SIM_Stats_t dma;
+  uint32_t i;
+
+  for (i = 0; i < sizeof(text); i++)
+  {
+    text[i] = ((i % 64U) == 63U) ? (uint8_t)'\r' : (uint8_t)('a' + (i % 26U));
+  }
+
+  HOST_ConsoleInit(UART_MODE_INTERRUPT);
+  HAL_UART_Receive_IT(&huart1, uartHandle.rxBuffer, 1U);
+  SIM_UartInject(text, sizeof(text), 0U);
+  HOST_ConsoleRun(RUN_LIMIT_NS);
+  SIM_GetStats(&it);
+  CHECK(hostConsole.commandCount == (sizeof(text) / 64U), "interrupt mode: %u of %u commands",
+        (unsigned)hostConsole.commandCount, (unsigned)(sizeof(text) / 64U));
+
+  HOST_ConsoleInit(UART_MODE_DMA);
+  UART_DMA_ReceiveToIdle(&uartHandle, dmaRing, DMA_RING_SIZE, HOST_ConsoleRxEvent);
+  SIM_UartInject(text, sizeof(text), 0U);
+  SIM_RunUntilIdle(RUN_LIMIT_NS);
+  SIM_GetStats(&dma);
+  CHECK(dma.rxDmaBytes == sizeof(text), "DMA mode: %u of %u bytes", (unsigned)dma.rxDmaBytes,
+        (unsigned)sizeof(text));
+
+  printf("sim:  1 KB at %u baud, interrupt mode %u IRQs, DMA to idle %u IRQs (%u B ring), "
+         "%u ns per handler\n", (unsigned)UART_DEFAULT_BAUDRATE,
+         (unsigned)(it.irqs[SIM_IRQ_USART1] + it.irqs[SIM_IRQ_DMA_RX]),
+         (unsigned)(dma.irqs[SIM_IRQ_USART1] + dma.irqs[SIM_IRQ_DMA_RX]), (unsigned)DMA_RING_SIZE,
+         (unsigned)SIM_ISR_COST_NS);
+}
+
+/**
+  * @brief  Host check entry point
+  * @retval 0 if all checks passed
+  */
+int main(void)
+{
+  CheckRingBuffer();
+  CheckCmdLine();
+  CheckDmaReceive();
+  CheckInterruptConsole();
+  CheckTransmit();
+  CheckCrc();
+  BenchHost();
+  BenchRxLoad();
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u checks\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,226 @@
+/**
+  ******************************************************************************
+  * @file    host_console.c
+  * @brief   Host stand-in for the console and bridge of the firmware
+  * @details UART_Example_PreProcess() and the callbacks below are those of
+  *          uart_example.c with the application commands and the other
+  *          UART users (stdout, bridge) taken out. Reception is left to the
+  *          caller, which picks the path to test; HOST_ConsoleRxEvent()
+  *          takes the place of the bridge on the continuous reception and
+  *          HOST_ConsoleRun() that of the console task.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_console.h"
+#include "sim_hal.h"
+#include "uart_config.h"
+#include "uart_example.h"
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+UART_HandleTypeDef huart1;
+UART_Handle_t uartHandle;
+volatile uint8_t rxComplete = 0;
+volatile uint8_t txComplete = 0;
+HOST_Console_t hostConsole;
+
+static uint8_t rxBuffer[RX_BUFFER_SIZE];
+static uint8_t txBuffer[TX_BUFFER_SIZE];
+static UART_CmdLine_t cmdLine;
+static volatile uint8_t rxLineDropped = 0;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Records the command instead of running it
+  * @param  cmd  Line with its terminator
+  * @retval UART status
+  */
+static UART_Status_t HOST_ConsoleCommand(const char *cmd)
+{
+  if (hostConsole.commandCount < HOST_CONSOLE_COMMANDS)
+  {
+    strncpy(hostConsole.commands[hostConsole.commandCount], cmd, UART_CMDLINE_SIZE - 1U);
+  }
+  hostConsole.commandCount++;
+  return UART_OK;
+}
+
+/**
+  * @brief  Appends received data to the record
+  * @param  data  Bytes
+  * @param  size  Number of bytes
+  * @retval None
+  */
+static void HOST_ConsoleCopy(const uint8_t *data, uint32_t size)
+{
+  uint32_t i;
+
+  for (i = 0; (i < size) && (hostConsole.rxCount < HOST_CONSOLE_RX_SIZE); i++)
+  {
+    hostConsole.rx[hostConsole.rxCount++] = data[i];
+  }
+}
+
+/* Exported functions --------------------------------------------------------*/
+UART_Status_t HOST_ConsoleInit(UART_Mode_t mode)
+{
+  const UART_Config_t config = {
+    .instance = USART1,
+    .baudRate = UART_DEFAULT_BAUDRATE,
+    .wordLength = UART_WORDLENGTH_8B,
+    .stopBits = UART_STOPBITS_1,
+    .parity = UART_PARITY_NONE,
+    .mode = mode
+  };
+
+  SIM_Reset();
+  memset(&huart1, 0, sizeof(huart1));
+  memset(&uartHandle, 0, sizeof(uartHandle));
+  memset(&hostConsole, 0, sizeof(hostConsole));
+  memset(&hdma_uart1_tx, 0, sizeof(hdma_uart1_tx));
+  memset(&hdma_uart1_rx, 0, sizeof(hdma_uart1_rx));
+  UART_CmdLine_Init(&cmdLine, HOST_ConsoleCommand);
+  rxComplete = 0;
+  rxLineDropped = 0;
+  txComplete = 0;
+
+  uartHandle.huart = &huart1;
+  uartHandle.rxBuffer = rxBuffer;
+  uartHandle.txBuffer = txBuffer;
+  uartHandle.rxSize = RX_BUFFER_SIZE;
+  uartHandle.txSize = TX_BUFFER_SIZE;
+  uartHandle.config = config;
+
+  UART_RingBuffer_Init();
+  return UART_Init(&uartHandle, &config);
+}
+
+/**
+  * @brief  As in uart_example.c
+  * @param  handle  UART handle
+  * @retval None
+  */
+void UART_Example_PreProcess(UART_Handle_t *handle)
+{
+  if ((handle == NULL) || (handle->rxBuffer == NULL))
+  {
+    return;
+  }
+
+  if (RingBuffer_Available(&rxRingBuffer) == 0U)
+  {
+    return;
+  }
+
+  UART_CmdLine_Drain(&cmdLine, &rxRingBuffer);
+}
+
+/**
+  * @brief  One pass of the console loop of uart_example.c
+  * @param  None
+  * @retval None
+  */
+static void HOST_ConsolePoll(void)
+{
+  if (rxLineDropped)
+  {
+    rxLineDropped = 0;
+    UART_CmdLine_Reset(&cmdLine);
+  }
+
+  if (rxComplete)
+  {
+    rxComplete = 0;
+    UART_Example_PreProcess(&uartHandle);
+  }
+}
+
+uint8_t HOST_ConsoleRun(uint64_t limitNs)
+{
+  const uint64_t endNs = SIM_NowNs() + limitNs;
+  const uint64_t passNs = (uint64_t)PROCESS_INTERVAL_MS * 1000000ULL;
+  uint64_t leftNs;
+  uint8_t idle;
+
+  do
+  {
+    leftNs = endNs - SIM_NowNs();
+    idle = SIM_RunUntilIdle((leftNs < passNs) ? leftNs : passNs);
+    HOST_ConsolePoll();
+  } while (!idle && (SIM_NowNs() < endNs));
+
+  return idle;
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart == uartHandle.huart)
+  {
+    txComplete = 1;
+    hostConsole.txDone++;
+  }
+}
+
+/**
+  * @brief  As in uart_example.c: clear, flag the line, restart reception
+  * @param  huart  UART handle
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart != uartHandle.huart)
+  {
+    return;
+  }
+
+  hostConsole.errors++;
+  __HAL_UART_CLEAR_OREFLAG(huart);
+  rxLineDropped = 1;
+  if (uartHandle.config.mode == UART_MODE_DMA)
+  {
+    HAL_UART_Receive_DMA(huart, uartHandle.rxBuffer, uartHandle.rxSize);
+  }
+  else if (uartHandle.config.mode == UART_MODE_INTERRUPT)
+  {
+    HAL_UART_Receive_IT(huart, uartHandle.rxBuffer, 1);
+  }
+}
+
+/**
+  * @brief  Records the event and the new data instead of forwarding to USB
+  * @details The data goes from the last position read to the new one, over
+  *          the end of the buffer if the position went back, as the bridge
+  *          reads it
+  * @param  huart  UART handle
+  * @param  size   Write position in the DMA buffer
+  * @retval None
+  */
+void HOST_ConsoleRxEvent(UART_HandleTypeDef *huart, uint16_t size)
+{
+  HOST_RxEvent_t *event;
+
+  if (huart != uartHandle.huart)
+  {
+    return;
+  }
+
+  if (size < hostConsole.rxPos)
+  {
+    HOST_ConsoleCopy(huart->pRxBuffPtr + hostConsole.rxPos, huart->RxXferSize - hostConsole.rxPos);
+    hostConsole.rxPos = 0U;
+  }
+  HOST_ConsoleCopy(huart->pRxBuffPtr + hostConsole.rxPos, size - hostConsole.rxPos);
+  hostConsole.rxPos = (size == huart->RxXferSize) ? 0U : size;
+
+  if (hostConsole.eventCount < HOST_CONSOLE_EVENTS)
+  {
+    event = &hostConsole.events[hostConsole.eventCount];
+    event->size = size;
+    event->type = (uint8_t)huart->RxEventType;
+    event->atNs = SIM_NowNs();
+  }
+  hostConsole.eventCount++;
+}
@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    host_console.h
+  * @brief   Host stand-in for the console and bridge of the firmware
+  * @details Peripherals/UART calls into uart_example.c, which pulls in the
+  *          whole application. This module provides the same symbols with
+  *          the console data path of uart_example.c (ring buffer, line
+  *          assembly), a reception event callback in place of the bridge,
+  *          and records what reaches the commands and the bridge.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __HOST_CONSOLE_H__
+#define __HOST_CONSOLE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "uart.h"
+#include "uart_cmdline.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define HOST_CONSOLE_COMMANDS     16U       /* Commands recorded */
+#define HOST_CONSOLE_EVENTS       256U      /* Bridge RX events recorded */
+#define HOST_CONSOLE_RX_SIZE      4096U     /* Bridge RX data recorded */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   RX event as HOST_ConsoleRxEvent() got it
+ */
+typedef struct
+{
+  uint16_t size;                /*!< Write position in the DMA buffer */
+  uint8_t type;                 /*!< HAL_UART_RXEVENT_* */
+  uint64_t atNs;                /*!< Virtual time of the callback */
+} HOST_RxEvent_t;
+
+/**
+ * @brief   What the console and the bridge saw
+ */
+typedef struct
+{
+  char commands[HOST_CONSOLE_COMMANDS][UART_CMDLINE_SIZE];
+  uint32_t commandCount;        /*!< All commands, also those not recorded */
+  HOST_RxEvent_t events[HOST_CONSOLE_EVENTS];
+  uint32_t eventCount;          /*!< All events, also those not recorded */
+  uint8_t rx[HOST_CONSOLE_RX_SIZE]; /*!< Read from the DMA buffer at the events */
+  uint32_t rxCount;
+  uint16_t rxPos;               /*!< DMA buffer position read up to */
+  uint32_t errors;              /*!< HAL_UART_ErrorCallback() runs */
+  uint32_t txDone;              /*!< HAL_UART_TxCpltCallback() runs */
+} HOST_Console_t;
+
+/* Exported variables --------------------------------------------------------*/
+extern UART_HandleTypeDef huart1;
+extern UART_Handle_t uartHandle;
+extern HOST_Console_t hostConsole;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Resets the simulation and brings USART1 up as UART_Example_Init()
+ * @param   mode  Transfer mode
+ * @retval  UART status
+ */
+UART_Status_t HOST_ConsoleInit(UART_Mode_t mode);
+
+/**
+ * @brief   Reception event callback standing in for the bridge
+ * @note    Register with UART_DMA_ReceiveToIdle()
+ * @param   huart  UART handle
+ * @param   size   Write position in the DMA buffer
+ * @retval  None
+ */
+void HOST_ConsoleRxEvent(UART_HandleTypeDef *huart, uint16_t size);
+
+/**
+ * @brief   Runs the simulation with the console task polling
+ * @details A console loop pass every PROCESS_INTERVAL_MS of virtual time,
+ *          and one after the line goes idle, as the task would
+ * @param   limitNs  Longest run
+ * @retval  1 if idle, 0 at the limit
+ */
+uint8_t HOST_ConsoleRun(uint64_t limitNs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HOST_CONSOLE_H__ */
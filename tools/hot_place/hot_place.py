@@ -0,0 +1,217 @@
+#!/usr/bin/env python
+"""Turn a sampling profile into the hot function list of the linker script.
+
+The firmware profiler (Peripherals/SYS/profiler.c) counts the interrupted PC
+at a fixed rate. Profile the workload and save the console output:
+
+    > prof start
+    ... run the workload ...
+    > prof stop
+    > prof dump            (and "prof dump N" while it says More:)
+
+then map the samples to functions and update hot_functions.ld:
+
+    tools/hot_place/hot_place.py console.log build/Sensor_Console.elf \\
+        --map build/Sensor_Console.map --output hot_functions.ld
+
+Functions are taken most sampled first until --budget bytes of SRAM code or
+--coverage of the samples is reached; functions below --min-share are never
+taken. A plain symbol list (one name per line, optionally followed by a
+sample count) from another profiler can be given with --symbols instead of
+the log; the ELF is then the only, optional, positional argument and gives
+the function sizes for the budget.
+
+With --output only the block between the "hot_place" markers is rewritten;
+the hand written entries above it (code listed before any profile was
+taken) are kept and not listed twice. With --map, functions without a
+.text.NAME input section of their own (assembly, or code built without
+-ffunction-sections) are reported and skipped, since no pattern could move
+them.
+
+The ELF must be the one that was profiled. Only the Python standard library
+is used; the ELF reader is shared with tools/crash_decode.
+"""
+
+from __future__ import print_function
+
+import argparse
+import bisect
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "crash_decode"))
+from crash_decode import Elf  # noqa: E402
+
+BEGIN_MARK = "/* hot_place: begin, generated by tools/hot_place/hot_place.py */"
+END_MARK = "/* hot_place: end */"
+
+# Code that runs before the startup code has copied .ramfunc
+NEVER = set([
+    "Reset_Handler",
+    "SystemInit",
+    "BOOTTIME_Start",
+    "BOOTTIME_Mark",
+    "BOOTTIME_NowUs",
+    "BOOTTIME_HclkHz",
+    "HAL_RCC_GetSysClockFreq",
+    "__aeabi_uldivmod",
+    "__udivmoddi4",
+    "Default_Handler",
+])
+
+
+def parse_profile(lines):
+    """PROF lines of "prof dump": the last count seen for each address."""
+    counts = {}
+    for line in lines:
+        m = re.search(r"\bPROF ([0-9A-Fa-f]{8}) (\d+)", line)
+        if m:
+            counts[int(m.group(1), 16)] = int(m.group(2))
+    return counts
+
+
+def parse_symbols(lines):
+    """One function per line, an optional sample count after it."""
+    samples = {}
+    for line in lines:
+        fields = line.split("#", 1)[0].split()
+        if not fields:
+            continue
+        samples[fields[0]] = samples.get(fields[0], 0) + (int(fields[1]) if len(fields) > 1 else 1)
+    return samples
+
+
+def functions_of(elf, counts):
+    """Sum the address samples per function; unknown addresses go to None."""
+    samples = {}
+    for addr, count in counts.items():
+        i = bisect.bisect_right(elf.func_addrs, addr) - 1
+        name = None
+        if i >= 0:
+            start = elf.func_addrs[i]
+            fname, size = elf.funcs[start]
+            if not size or addr < start + size:
+                name = fname
+        samples[name] = samples.get(name, 0) + count
+    return samples
+
+
+def sizes_of(elf):
+    return dict((name, size) for name, size in elf.funcs.values())
+
+
+def map_sections(path):
+    """Names NAME with a .text.NAME input section in the linker map."""
+    names = set()
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            m = re.match(r"\s*\.text\.(\S+)", line)
+            if m:
+                names.add(m.group(1))
+    return names
+
+
+def hand_listed(text):
+    """Functions listed outside the generated block."""
+    start = text.find(BEGIN_MARK)
+    end = text.find(END_MARK)
+    if start >= 0 and end > start:
+        text = text[:start] + text[end + len(END_MARK):]
+    return set(re.findall(r"\*\(\.text\.([^)\s]+)\)", text))
+
+
+def write_block(path, names, comment):
+    block = [BEGIN_MARK, "/* %s */" % comment]
+    block += ["*(.text.%s)" % name for name in names]
+    block.append(END_MARK)
+    block = "\n".join(block)
+
+    text = open(path, "r").read() if os.path.exists(path) else ""
+    start = text.find(BEGIN_MARK)
+    end = text.find(END_MARK)
+    if start >= 0 and end > start:
+        text = text[:start] + block + text[end + len(END_MARK):]
+    else:
+        text = text.rstrip("\n") + ("\n\n" if text else "") + block + "\n"
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("log", nargs="?", help="console output holding the PROF lines, - for stdin")
+    parser.add_argument("elf", nargs="?", help="firmware ELF that was profiled")
+    parser.add_argument("--symbols", help="symbol list to use instead of the PROF lines")
+    parser.add_argument("--map", help="linker map, to skip functions without their own section")
+    parser.add_argument("--output", help="hot_functions.ld to update, the list is printed otherwise")
+    parser.add_argument("--budget", type=int, default=16384, help="SRAM code bytes to spend")
+    parser.add_argument("--coverage", type=float, default=90.0, help="percent of the samples to cover")
+    parser.add_argument("--min-share", type=float, default=0.5, help="least percent of the samples to take")
+    args = parser.parse_args()
+
+    if args.symbols:
+        with open(args.symbols, "r", errors="replace") as f:
+            samples = parse_symbols(f)
+        elf = Elf(args.elf or args.log) if (args.elf or args.log) else None
+    else:
+        if not args.log or not args.elf:
+            parser.error("the log and the ELF are needed without --symbols")
+        stream = sys.stdin if args.log == "-" else open(args.log, "r", errors="replace")
+        with stream:
+            counts = parse_profile(stream)
+        if not counts:
+            sys.exit("no PROF line found in %s" % args.log)
+        elf = Elf(args.elf)
+        samples = functions_of(elf, counts)
+
+    sizes = sizes_of(elf) if elf else {}
+    sections = map_sections(args.map) if args.map else None
+    listed = hand_listed(open(args.output).read()) if args.output and os.path.exists(args.output) else set()
+
+    total = sum(samples.values())
+    if not total:
+        sys.exit("no samples")
+    unknown = samples.pop(None, 0)
+
+    chosen = []
+    spent = 0
+    covered = 0
+    print("%-36s %8s %6s %6s  %s" % ("Function", "Samples", "%", "Bytes", "Placement"))
+    for name, count in sorted(samples.items(), key=lambda item: -item[1]):
+        share = 100.0 * count / total
+        size = sizes.get(name, 0)
+        if name in NEVER:
+            verdict = "no, runs before the copy"
+        elif sections is not None and name not in sections:
+            verdict = "no, no .text.%s section" % name
+        elif name in listed:
+            verdict = "listed by hand"
+            covered += count
+        elif share < args.min_share or 100.0 * covered / total >= args.coverage:
+            verdict = "-"
+        elif spent + size > args.budget:
+            verdict = "no, over budget"
+        else:
+            verdict = "sram"
+            chosen.append(name)
+            spent += size
+            covered += count
+        print("%-36s %8d %6.1f %6s  %s" % (name[:36], count, share, size or "?", verdict))
+    if unknown:
+        print("%-36s %8d %6.1f" % ("(outside any function)", unknown, 100.0 * unknown / total))
+
+    print("%d functions, %d bytes of SRAM code, %.1f%% of %d samples covered"
+          % (len(chosen), spent, 100.0 * covered / total, total))
+
+    comment = "%d functions, %d bytes, %.1f%% of %d samples" % (len(chosen), spent, 100.0 * covered / total, total)
+    if args.output:
+        write_block(args.output, chosen, comment)
+        print("updated %s" % args.output)
+    else:
+        for name in chosen:
+            print("*(.text.%s)" % name)
+
+
+if __name__ == "__main__":
+    main()
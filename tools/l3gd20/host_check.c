@@ -0,0 +1,345 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host check of the L3GD20 driver against a register-level model
+  * @details Runs Peripherals/L3GD20/l3gd20.c unchanged on sim_gyro.c:
+  *          - WHO_AM_I: 0xD4 (L3GD20) and 0xD3 (I3G4250D) are taken, with
+  *            their output rates; anything else, the L3GD20H 0xD7 included,
+  *            fails before a single register is written
+  *          - the register writes of L3GD20_Init() for each full scale, in
+  *            order, and EXTI2 at a FreeRTOS safe priority
+  *          - streaming on both parts: every sample the device produced
+  *            reaches the consumer once and in order, converted exactly,
+  *            with timestamps within one output period of when the model
+  *            produced it, and consecutive samples one device period apart
+  *          - a bus stall that overflows the FIFO, once ahead of the
+  *            FIFO_SRC read (760 Hz case) and once ahead of the burst
+  *            (800 Hz case): the overrun is counted, only the overwritten
+  *            samples are missing, the timestamps hold and streaming goes
+  *            on afterwards
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_gyro.h"
+#include "sim_core.h"
+#include "l3gd20.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define MAX_RECEIVED        8192U
+#define STREAM_US           2000000U
+#define STALL_US            60000U      /* Longer than a full FIFO at 800 Hz */
+#define DRIFT_US            32U         /* Integer microsecond sample times */
+#define MAX_SYSCALL_PRIO    5U          /* configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY */
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint8_t whoAmI;
+  HAL_StatusTypeDef status;
+  uint32_t odrHz;
+} IdCase_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const IdCase_t idCases[] = {
+  {L3GD20_ID, HAL_OK, L3GD20_ODR_HZ},
+  {I3G4250D_ID, HAL_OK, I3G4250D_ODR_HZ},
+  {0xD7U, HAL_ERROR, 0U},
+  {0x00U, HAL_ERROR, 0U},
+  {0xFFU, HAL_ERROR, 0U},
+};
+
+static const float sensitivities[] = {0.00875f, 0.0175f, 0.070f};
+static const uint8_t ctrl4Values[] = {L3GD20_CTRL4_FS_250, L3GD20_CTRL4_FS_500, L3GD20_CTRL4_FS_2000};
+
+static L3GD20_Sample_t received[MAX_RECEIVED];
+static uint32_t receivedBurst[MAX_RECEIVED];
+static uint32_t receivedCount;
+static uint32_t burstCount;
+static uint32_t failures;
+
+/* Private functions ---------------------------------------------------------*/
+static void Fail(const char *what)
+{
+  printf("FAILED: %s\n", what);
+  failures++;
+}
+
+static void Consumer(const L3GD20_Sample_t *samples, uint32_t count, void *context)
+{
+  uint32_t i;
+
+  (void)context;
+  burstCount++;
+  for (i = 0; (i < count) && (receivedCount < MAX_RECEIVED); i++)
+  {
+    receivedBurst[receivedCount] = burstCount;
+    received[receivedCount++] = samples[i];
+  }
+}
+
+/**
+  * @brief  Powers the device down once the running chain let go of the bus
+  */
+static void Shutdown(void)
+{
+  while (L3GD20_WriteReg(L3GD20_REG_CTRL1, 0x00U) != HAL_OK)
+  {
+    SIM_Run(1U);
+  }
+  SIM_Run(1000U);
+}
+
+/**
+  * @brief  Sample index of a raw X count, the inverse of SIM_GyroRaw()
+  */
+static uint32_t IndexOf(int16_t rawX)
+{
+  uint32_t inverse = 1U;
+  uint32_t i;
+
+  /* 7^-1 modulo 2^16: Newton steps on the odd multiplier */
+  for (i = 0; i < 5U; i++)
+  {
+    inverse = (inverse * (2U - (7U * inverse))) & 0xFFFFU;
+  }
+  return (((uint32_t)(uint16_t)rawX - 100U) * inverse) & 0xFFFFU;
+}
+
+static void CheckId(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < (sizeof(idCases) / sizeof(idCases[0])); i++)
+  {
+    const IdCase_t *c = &idCases[i];
+    HAL_StatusTypeDef status;
+    uint32_t writes;
+
+    SIM_GyroReset(c->whoAmI);
+    status = L3GD20_Init(L3GD20_FS_2000DPS);
+    (void)SIM_GyroWrites(&writes);
+
+    printf("WHO_AM_I 0x%02X: %s", (unsigned)c->whoAmI, (status == HAL_OK) ? "taken" : "refused");
+    if (status == HAL_OK)
+    {
+      printf(", %u Hz", (unsigned)L3GD20_GetOdrHz());
+    }
+    printf(", %u register writes\n", (unsigned)writes);
+
+    if (status != c->status)
+    {
+      Fail("WHO_AM_I acceptance");
+    }
+    else if ((status == HAL_OK) && (L3GD20_GetOdrHz() != c->odrHz))
+    {
+      Fail("output rate of the detected part");
+    }
+    else if ((status != HAL_OK) && (writes != 0U))
+    {
+      Fail("registers written on an unknown part");
+    }
+    if (status == HAL_OK)
+    {
+      Shutdown();
+    }
+  }
+}
+
+static void CheckInit(void)
+{
+  uint32_t fs;
+
+  for (fs = 0; fs < 3U; fs++)
+  {
+    const SIM_Write_t expected[] = {
+      {L3GD20_REG_CTRL1, 0x00U},
+      {L3GD20_REG_CTRL2, 0x00U},
+      {L3GD20_REG_CTRL3, L3GD20_CTRL3_I2_WTM},
+      {L3GD20_REG_CTRL4, ctrl4Values[fs]},
+      {L3GD20_REG_FIFO_CTRL, L3GD20_FIFO_MODE_BYPASS},
+      {L3GD20_REG_FIFO_CTRL, L3GD20_FIFO_MODE_STREAM | L3GD20_FIFO_WATERMARK},
+      {L3GD20_REG_CTRL5, L3GD20_CTRL5_FIFO_EN},
+      {L3GD20_REG_CTRL1, L3GD20_CTRL1_ODR760_BW100 | L3GD20_CTRL1_PD | L3GD20_CTRL1_XYZ_EN},
+    };
+    const SIM_Write_t *writes;
+    uint32_t count;
+    uint32_t priority;
+    uint32_t i;
+    uint8_t enabled;
+    uint8_t match;
+
+    SIM_GyroReset(L3GD20_ID);
+    if (L3GD20_Init((L3GD20_FullScale_t)fs) != HAL_OK)
+    {
+      Fail("L3GD20_Init()");
+      continue;
+    }
+    writes = SIM_GyroWrites(&count);
+    match = (count == (sizeof(expected) / sizeof(expected[0])));
+    for (i = 0; match && (i < count); i++)
+    {
+      match = (writes[i].reg == expected[i].reg) && (writes[i].value == expected[i].value);
+    }
+
+    enabled = SIM_IrqEnabled(EXTI2_IRQn, &priority);
+    printf("Full scale %u: %u register writes %s, EXTI2 %s at priority %u\n", (unsigned)fs,
+           (unsigned)count, match ? "as expected" : "differ",
+           enabled ? "enabled" : "disabled", (unsigned)priority);
+    if (!match)
+    {
+      Fail("initialization sequence");
+    }
+    if (!enabled || (priority < MAX_SYSCALL_PRIO))
+    {
+      Fail("EXTI2 setup");
+    }
+    Shutdown();
+  }
+}
+
+/**
+  * @brief  Streams for STREAM_US and checks what the consumer got
+  * @param  whoAmI   Part
+  * @param  fs       Full scale
+  * @param  stallAt  Time into the run of a STALL_US bus stall, 0 for none
+  * @retval None
+  */
+static void CheckStream(uint8_t whoAmI, L3GD20_FullScale_t fs, uint32_t stallAt)
+{
+  const float sensitivity = sensitivities[fs];
+  L3GD20_Stats_t before;
+  L3GD20_Stats_t after;
+  uint32_t periodUs;
+  uint32_t gaps = 0U;
+  uint32_t previous = 0U;
+  double worstError = 0.0;
+  double worstSpacing = 0.0;
+  uint32_t i;
+
+  SIM_GyroReset(whoAmI);
+  receivedCount = 0U;
+  L3GD20_GetStats(&before);
+  if (L3GD20_Init(fs) != HAL_OK)
+  {
+    Fail("L3GD20_Init()");
+    return;
+  }
+  periodUs = 1000000U / L3GD20_GetOdrHz();
+
+  if (stallAt != 0U)
+  {
+    SIM_Run(stallAt);
+    SIM_StallBus(STALL_US);
+    SIM_Run(STREAM_US - stallAt);
+  }
+  else
+  {
+    SIM_Run(STREAM_US);
+  }
+  L3GD20_GetStats(&after);
+
+  for (i = 0; i < receivedCount; i++)
+  {
+    const L3GD20_Sample_t *s = &received[i];
+    const int16_t rawX = (int16_t)lroundf(s->x / sensitivity);
+    const uint32_t index = IndexOf(rawX);
+
+    if ((index >= SIM_GyroProduced()) ||
+        (s->x != ((float)SIM_GyroRaw(index, 0U) * sensitivity)) ||
+        (s->y != ((float)SIM_GyroRaw(index, 1U) * sensitivity)) ||
+        (s->z != ((float)SIM_GyroRaw(index, 2U) * sensitivity)))
+    {
+      Fail("sample conversion");
+      return;
+    }
+    if ((i != 0U) && (index <= previous))
+    {
+      Fail("sample order");
+      return;
+    }
+    if (i != 0U)
+    {
+      gaps += index - previous - 1U;
+      /* Within a burst the driver spaces the samples by the output period */
+      if ((index == previous + 1U) && (receivedBurst[i] == receivedBurst[i - 1U]))
+      {
+        worstSpacing = fmax(worstSpacing, fabs((double)(s->timestampUs - received[i - 1U].timestampUs) -
+                                               (1000000.0 / (double)L3GD20_GetOdrHz())));
+      }
+    }
+    else
+    {
+      gaps += index;
+    }
+    worstError = fmax(worstError, fabs((double)s->timestampUs - (double)SIM_GyroSampleUs(index)));
+    previous = index;
+  }
+
+  printf("%s %u Hz%s: %u of %u samples in %u bursts, %u overwritten, %u overruns, "
+         "timestamp error %.0f us, spacing error %.0f us\n",
+         (whoAmI == I3G4250D_ID) ? "I3G4250D" : "L3GD20", (unsigned)L3GD20_GetOdrHz(),
+         (stallAt != 0U) ? " with a bus stall" : "", (unsigned)receivedCount,
+         (unsigned)SIM_GyroProduced(), (unsigned)(after.bursts - before.bursts),
+         (unsigned)SIM_GyroDropped(), (unsigned)(after.overruns - before.overruns),
+         worstError, worstSpacing);
+
+  if ((receivedCount + SIM_GyroDropped() + SIM_GyroStored()) != SIM_GyroProduced())
+  {
+    Fail("samples lost or repeated");
+  }
+  if (gaps != SIM_GyroDropped())
+  {
+    Fail("missing samples other than the overwritten ones");
+  }
+  if ((SIM_GyroProduced() - 1U - previous) != SIM_GyroStored())
+  {
+    Fail("samples left behind in the FIFO");
+  }
+  if ((stallAt != 0U) != ((after.overruns - before.overruns) != 0U))
+  {
+    Fail("overrun count");
+  }
+  if ((stallAt != 0U) && (received[receivedCount - 1U].timestampUs < (uint64_t)stallAt + STALL_US))
+  {
+    Fail("streaming after the stall");
+  }
+  if (after.errors != before.errors)
+  {
+    Fail("SPI errors");
+  }
+  if ((worstError > (double)(periodUs + DRIFT_US)) || (worstSpacing > 1.0))
+  {
+    Fail("sample timestamps");
+  }
+  Shutdown();
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  if (L3GD20_AddCallback(Consumer, NULL) != HAL_OK)
+  {
+    Fail("L3GD20_AddCallback()");
+  }
+
+  CheckId();
+  CheckInit();
+  CheckStream(L3GD20_ID, L3GD20_FS_2000DPS, 0U);
+  CheckStream(I3G4250D_ID, L3GD20_FS_250DPS, 0U);
+  CheckStream(L3GD20_ID, L3GD20_FS_500DPS, 700000U);
+  CheckStream(I3G4250D_ID, L3GD20_FS_2000DPS, 700000U);
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u checks\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,419 @@
+/**
+  ******************************************************************************
+  * @file    sim_gyro.c
+  * @brief   Register-level L3GD20 / I3G4250D model for host builds
+  * @details Implements the SPIBUS_* interface and TIMEBASE_GetUs() for
+  *          Peripherals/L3GD20 on top of the device model described in
+  *          sim_gyro.h, and drives the INT2 pin, DWT and TIM2 of sim_core.c.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_gyro.h"
+#include "sim_core.h"
+#include "l3gd20.h"
+#include "spi_bus.h"
+#include "timebase.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_FIFO_DEPTH            32U
+#define SIM_MAX_SAMPLES           65536U    /* Sample times kept */
+#define SIM_QUEUE_SIZE            4U
+#define SIM_FIFO_MODE_MASK        0xE0U
+#define SIM_WATERMARK_MASK        0x1FU
+
+/* Private variables ---------------------------------------------------------*/
+static uint64_t nowUs;
+
+static uint8_t whoAmI;
+static uint8_t regs[0x40];
+static uint8_t fifo[SIM_FIFO_DEPTH][6];
+static uint8_t output[6];               /* OUT_X_L..OUT_Z_H outside the FIFO */
+static uint32_t fifoHead;
+static uint32_t fifoCount;
+static uint32_t odrHz;
+static uint8_t powered;
+static uint64_t powerOnUs;
+static uint32_t sinceOn;                /* Samples since the last power up */
+static uint32_t produced;
+static uint32_t dropped;
+static uint64_t sampleUs[SIM_MAX_SAMPLES];
+static uint8_t int2;
+
+static SIM_Write_t writes[SIM_MAX_WRITES];
+static uint32_t writeCount;
+
+static SPIBUS_Transaction_t *queue[SIM_QUEUE_SIZE];
+static uint32_t queueHead;
+static uint32_t queueCount;
+static uint64_t transferDoneUs;
+static uint64_t busFreeUs;
+static SPIBUS_Stats_t busStats;
+
+/* Private functions ---------------------------------------------------------*/
+static uint8_t FifoStream(void)
+{
+  return ((regs[L3GD20_REG_CTRL5] & L3GD20_CTRL5_FIFO_EN) != 0U) &&
+         ((regs[L3GD20_REG_FIFO_CTRL] & SIM_FIFO_MODE_MASK) == L3GD20_FIFO_MODE_STREAM);
+}
+
+static uint8_t FifoSource(void)
+{
+  uint8_t value = (uint8_t)(fifoCount & L3GD20_FIFO_SRC_FSS);
+
+  if (FifoStream() && (fifoCount >= (regs[L3GD20_REG_FIFO_CTRL] & SIM_WATERMARK_MASK)))
+  {
+    value |= L3GD20_FIFO_SRC_WTM;
+  }
+  if (fifoCount == SIM_FIFO_DEPTH)
+  {
+    value |= L3GD20_FIFO_SRC_OVRN;
+  }
+  if (fifoCount == 0U)
+  {
+    value |= L3GD20_FIFO_SRC_EMPTY;
+  }
+  return value;
+}
+
+static void Produce(void)
+{
+  uint8_t raw[6];
+  uint32_t axis;
+
+  if (produced >= SIM_MAX_SAMPLES)
+  {
+    printf("FAILED: simulation longer than %u samples\n", (unsigned)SIM_MAX_SAMPLES);
+    exit(EXIT_FAILURE);
+  }
+  for (axis = 0; axis < 3U; axis++)
+  {
+    const uint16_t value = (uint16_t)SIM_GyroRaw(produced, axis);
+
+    raw[2U * axis] = (uint8_t)(value & 0xFFU);
+    raw[(2U * axis) + 1U] = (uint8_t)(value >> 8);
+  }
+  sampleUs[produced++] = nowUs;
+  sinceOn++;
+
+  if (!FifoStream())
+  {
+    memcpy(output, raw, sizeof(output));
+    return;
+  }
+  if (fifoCount == SIM_FIFO_DEPTH)
+  {
+    fifoHead = (fifoHead + 1U) % SIM_FIFO_DEPTH;
+    fifoCount--;
+    dropped++;
+  }
+  memcpy(fifo[(fifoHead + fifoCount) % SIM_FIFO_DEPTH], raw, sizeof(raw));
+  fifoCount++;
+}
+
+static uint8_t ReadByte(uint8_t reg)
+{
+  uint8_t value;
+
+  if (reg == L3GD20_REG_WHO_AM_I)
+  {
+    return whoAmI;
+  }
+  if (reg == L3GD20_REG_FIFO_SRC)
+  {
+    return FifoSource();
+  }
+  if ((reg >= L3GD20_REG_OUT_X_L) && (reg < (L3GD20_REG_OUT_X_L + 6U)))
+  {
+    const uint32_t offset = reg - L3GD20_REG_OUT_X_L;
+
+    if (!FifoStream() || (fifoCount == 0U))
+    {
+      return output[offset];
+    }
+    value = fifo[fifoHead][offset];
+    if (offset == 5U)
+    {
+      /* OUT_Z_H completes the sample: it leaves the FIFO */
+      memcpy(output, fifo[fifoHead], sizeof(output));
+      fifoHead = (fifoHead + 1U) % SIM_FIFO_DEPTH;
+      fifoCount--;
+    }
+    return value;
+  }
+  return regs[reg];
+}
+
+static void WriteByte(uint8_t reg, uint8_t value)
+{
+  if (writeCount < SIM_MAX_WRITES)
+  {
+    writes[writeCount].reg = reg;
+    writes[writeCount].value = value;
+    writeCount++;
+  }
+
+  if ((reg < L3GD20_REG_CTRL1) || (reg == L3GD20_REG_STATUS) || (reg == L3GD20_REG_FIFO_SRC) ||
+      ((reg >= L3GD20_REG_OUT_X_L) && (reg < (L3GD20_REG_OUT_X_L + 6U))))
+  {
+    return;                               /* Read only */
+  }
+  regs[reg] = value;
+
+  if ((reg == L3GD20_REG_FIFO_CTRL) && ((value & SIM_FIFO_MODE_MASK) == L3GD20_FIFO_MODE_BYPASS))
+  {
+    fifoHead = 0U;
+    fifoCount = 0U;
+  }
+  if (reg == L3GD20_REG_CTRL1)
+  {
+    const uint8_t on = ((value & L3GD20_CTRL1_PD) != 0U) && ((value & L3GD20_CTRL1_XYZ_EN) != 0U);
+
+    if (on && !powered)
+    {
+      powerOnUs = nowUs;
+      sinceOn = 0U;
+    }
+    powered = on;
+  }
+}
+
+/**
+  * @brief  One chip-select cycle: address byte, then data
+  */
+static void Transfer(const uint8_t *txData, uint8_t *rxData, uint16_t length)
+{
+  const uint8_t command = (txData != NULL) ? txData[0] : 0U;
+  uint8_t reg = command & 0x3FU;
+  uint16_t i;
+
+  if (rxData != NULL)
+  {
+    rxData[0] = 0xFFU;
+  }
+  for (i = 1U; i < length; i++)
+  {
+    if ((command & L3GD20_SPI_READ) != 0U)
+    {
+      const uint8_t value = ReadByte(reg);
+
+      if (rxData != NULL)
+      {
+        rxData[i] = value;
+      }
+    }
+    else
+    {
+      WriteByte(reg, (txData != NULL) ? txData[i] : 0U);
+    }
+
+    if ((command & L3GD20_SPI_AUTO_INC) != 0U)
+    {
+      /* With the FIFO enabled the data registers wrap for bursts */
+      reg = ((reg == (L3GD20_REG_OUT_X_L + 5U)) && FifoStream()) ?
+            L3GD20_REG_OUT_X_L : (uint8_t)((reg + 1U) & 0x3FU);
+    }
+  }
+  busStats.bytes += length;
+}
+
+static void StartNext(void)
+{
+  if (queueCount != 0U)
+  {
+    const uint32_t length = queue[queueHead]->length;
+
+    const uint64_t startUs = (busFreeUs > nowUs) ? busFreeUs : nowUs;
+
+    transferDoneUs = startUs + (((uint64_t)length * 8U * 1000000U) + SIM_SPI_HZ - 1U) / SIM_SPI_HZ;
+  }
+}
+
+static void Int2Update(void)
+{
+  const uint8_t level = ((regs[L3GD20_REG_CTRL3] & L3GD20_CTRL3_I2_WTM) != 0U) &&
+                        ((FifoSource() & L3GD20_FIFO_SRC_WTM) != 0U);
+
+  if (level)
+  {
+    SIM_GPIOA.IDR |= MEMS_INT2_Pin;
+  }
+  else
+  {
+    SIM_GPIOA.IDR &= ~(uint32_t)MEMS_INT2_Pin;
+  }
+  if (level && !int2 && SIM_IrqEnabled(EXTI2_IRQn, NULL))
+  {
+    int2 = level;
+    L3GD20_IrqHandler();
+  }
+  int2 = level;
+}
+
+/* Exported functions --------------------------------------------------------*/
+void SIM_GyroReset(uint8_t value)
+{
+  if (queueCount != 0U)
+  {
+    printf("FAILED: device reset with a transaction on the bus\n");
+    exit(EXIT_FAILURE);
+  }
+  memset(regs, 0, sizeof(regs));
+  memset(output, 0, sizeof(output));
+  whoAmI = value;
+  odrHz = (value == I3G4250D_ID) ? I3G4250D_ODR_HZ : L3GD20_ODR_HZ;
+  fifoHead = 0U;
+  fifoCount = 0U;
+  powered = 0U;
+  sinceOn = 0U;
+  produced = 0U;
+  dropped = 0U;
+  int2 = 0U;
+  writeCount = 0U;
+  SIM_CoreReset();
+  busFreeUs = 0U;
+}
+
+void SIM_Run(uint64_t us)
+{
+  const uint64_t end = nowUs + us;
+
+  while (nowUs < end)
+  {
+    nowUs++;
+    SIM_SetCycleCount((uint32_t)(nowUs * SIM_HCLK_MHZ));
+    SIM_TIM2.CNT = (uint32_t)nowUs;
+
+    if (powered && (nowUs >= powerOnUs + ((((uint64_t)sinceOn + 1U) * 1000000U) / odrHz)))
+    {
+      Produce();
+    }
+
+    if ((queueCount != 0U) && (nowUs >= transferDoneUs))
+    {
+      SPIBUS_Transaction_t *transaction = queue[queueHead];
+
+      queueHead = (queueHead + 1U) % SIM_QUEUE_SIZE;
+      queueCount--;
+      Transfer(transaction->txData, transaction->rxData, transaction->length);
+      busStats.transactions++;
+      StartNext();
+      transaction->status = HAL_OK;
+      if (transaction->callback != NULL)
+      {
+        transaction->callback(transaction);
+      }
+    }
+
+    Int2Update();
+  }
+}
+
+uint64_t SIM_NowUs(void)
+{
+  return nowUs;
+}
+
+void SIM_StallBus(uint32_t us)
+{
+  busFreeUs = nowUs + us;
+}
+
+uint8_t SIM_GyroReg(uint8_t reg)
+{
+  return (reg == L3GD20_REG_FIFO_SRC) ? FifoSource() :
+         (reg == L3GD20_REG_WHO_AM_I) ? whoAmI : regs[reg & 0x3FU];
+}
+
+const SIM_Write_t *SIM_GyroWrites(uint32_t *count)
+{
+  *count = writeCount;
+  return writes;
+}
+
+uint32_t SIM_GyroProduced(void)
+{
+  return produced;
+}
+
+uint32_t SIM_GyroDropped(void)
+{
+  return dropped;
+}
+
+uint32_t SIM_GyroStored(void)
+{
+  return fifoCount;
+}
+
+uint64_t SIM_GyroSampleUs(uint32_t index)
+{
+  return (index < produced) ? sampleUs[index] : 0U;
+}
+
+int16_t SIM_GyroRaw(uint32_t index, uint32_t axis)
+{
+  switch (axis)
+  {
+    case 0U:
+      return (int16_t)(uint16_t)((index * 7U) + 100U);
+    case 1U:
+      return (int16_t)(uint16_t)(0U - (index * 13U));
+    default:
+      return (int16_t)(uint16_t)(index ^ 0x5A5AU);
+  }
+}
+
+/* SPI bus -------------------------------------------------------------------*/
+HAL_StatusTypeDef SPIBUS_Submit(SPIBUS_Transaction_t *transaction)
+{
+  if ((transaction->device == NULL) || (transaction->device->csPin != NCS_MEMS_SPI_Pin) ||
+      (transaction->length == 0U) || (queueCount == SIM_QUEUE_SIZE))
+  {
+    return HAL_ERROR;
+  }
+  if (transaction->status == HAL_BUSY)
+  {
+    return HAL_BUSY;
+  }
+
+  transaction->status = HAL_BUSY;
+  queue[(queueHead + queueCount) % SIM_QUEUE_SIZE] = transaction;
+  queueCount++;
+  if (queueCount == 1U)
+  {
+    StartNext();
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef SPIBUS_TransferBlocking(const SPIBUS_Device_t *device,
+                                          const uint8_t *txData, uint8_t *rxData,
+                                          uint16_t length, uint32_t timeoutMs)
+{
+  (void)timeoutMs;
+
+  if ((device == NULL) || (device->csPin != NCS_MEMS_SPI_Pin) || (queueCount != 0U))
+  {
+    return HAL_ERROR;
+  }
+  Transfer(txData, rxData, length);
+  busStats.blocking++;
+  return HAL_OK;
+}
+
+void SPIBUS_GetStats(SPIBUS_Stats_t *stats)
+{
+  *stats = busStats;
+}
+
+/* Timebase ------------------------------------------------------------------*/
+uint64_t TIMEBASE_GetUs(void)
+{
+  return nowUs;
+}
@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    sim_gyro.h
+  * @brief   Register-level L3GD20 / I3G4250D model for host builds
+  * @details Stands behind SPIBUS_Submit() and SPIBUS_TransferBlocking():
+  *          every chip-select cycle is decoded as on the device (address
+  *          byte with the read and auto-increment flags, then data), so the
+  *          driver runs unchanged against it.
+  *          - WHO_AM_I, CTRL1-5, FIFO_CTRL, FIFO_SRC and OUT_X_L..OUT_Z_H
+  *          - 32-level FIFO in bypass or stream mode; reading OUT_Z_H pops
+  *            a sample and auto-increment wraps back to OUT_X_L
+  *          - INT2 follows the watermark flag when CTRL3 routes it, and a
+  *            rising edge with EXTI2 enabled runs L3GD20_IrqHandler()
+  *          - samples come at the DR=11 rate of the part (760 or 800 Hz)
+  *            once CTRL1 powers it up; their raw values are a function of
+  *            the sample index (SIM_GyroRaw()) so a consumer can tell a
+  *            missing or repeated sample
+  *          - a DMA transaction completes after its SCK time at 5.25 MHz;
+  *            SIM_StallBus() stands for traffic of the other bus devices
+  *
+  *          Time is virtual and only moves in SIM_Run().
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SIM_GYRO_H__
+#define __SIM_GYRO_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SIM_SPI_HZ                5250000U  /* SPI5 SCK at 168 MHz HCLK */
+#define SIM_HCLK_MHZ              168U
+#define SIM_MAX_WRITES            64U       /* Register writes recorded */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief   Register write seen on the bus
+ */
+typedef struct
+{
+  uint8_t reg;
+  uint8_t value;
+} SIM_Write_t;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Powers the device up again
+ * @details Clears the registers, the FIFO, the write log, EXTI2 and the
+ *          sample counters; exits if a transaction is still on the bus
+ * @param   whoAmI  WHO_AM_I value, which also selects the output rate
+ * @retval  None
+ */
+void SIM_GyroReset(uint8_t whoAmI);
+
+/**
+ * @brief   Advances the virtual clock
+ * @param   us  Microseconds to run
+ * @retval  None
+ */
+void SIM_Run(uint64_t us);
+
+/**
+ * @brief   Current virtual time
+ * @param   None
+ * @retval  Microseconds since the start
+ */
+uint64_t SIM_NowUs(void);
+
+/**
+ * @brief   Keeps the bus busy with other traffic
+ * @details Transactions starting within the next us microseconds wait for
+ *          the end of it; the one running, if any, is not affected
+ * @param   us  Duration in microseconds
+ * @retval  None
+ */
+void SIM_StallBus(uint32_t us);
+
+/**
+ * @brief   Reads a device register without side effects
+ * @param   reg  Register address
+ * @retval  Value
+ */
+uint8_t SIM_GyroReg(uint8_t reg);
+
+/**
+ * @brief   Register writes since SIM_GyroReset(), in order
+ * @param   count  Number of writes
+ * @retval  Write log
+ */
+const SIM_Write_t *SIM_GyroWrites(uint32_t *count);
+
+/**
+ * @brief   Samples produced since power up
+ * @param   None
+ * @retval  Count
+ */
+uint32_t SIM_GyroProduced(void);
+
+/**
+ * @brief   Samples overwritten in the full FIFO
+ * @param   None
+ * @retval  Count
+ */
+uint32_t SIM_GyroDropped(void);
+
+/**
+ * @brief   Samples waiting in the FIFO
+ * @param   None
+ * @retval  Count
+ */
+uint32_t SIM_GyroStored(void);
+
+/**
+ * @brief   Time a sample was produced
+ * @param   index  Sample index since power up
+ * @retval  Virtual time in microseconds
+ */
+uint64_t SIM_GyroSampleUs(uint32_t index);
+
+/**
+ * @brief   Raw value of a sample
+ * @param   index  Sample index since power up
+ * @param   axis   0..2 for X, Y, Z
+ * @retval  Raw count
+ */
+int16_t SIM_GyroRaw(uint32_t index, uint32_t axis);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_GYRO_H__ */
@@ -0,0 +1,242 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host check of the logging pipeline
+  * @details Feeds records through the slot cache into a raw log on a RAM
+  *          disk, with a writer that stalls periodically so the cache fills
+  *          and drops records, then reads the log back. The check fails if a
+  *          record is corrupt, if the sequence gaps do not add up to the
+  *          drops, or if the device saw anything but whole-slot writes
+  *          (the last partial slot and the header sector aside).
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "log_cache.h"
+#include "log_file.h"
+#include "ram_disk.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SLOT_SIZE       32768U
+#define SLOT_COUNT      16U
+#define SECTOR_SIZE     512U
+#define DISK_SECTORS    32768U      /* 16 MB */
+#define RECORDS         25000U      /* About 12 MB */
+#define STALL_EVERY     8000U       /* Records between writer stalls */
+#define STALL_LENGTH    1800U       /* Records produced while stalled */
+#define RECORD_SYNC     0x474CU
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Layout of LOGGER_RecordHeader_t (logger.h)
+ */
+typedef struct
+{
+  uint16_t sync;
+  uint8_t type;
+  uint8_t reserved;
+  uint16_t length;
+  uint16_t sequence;
+  uint64_t timestampUs;
+} RecordHeader_t;
+
+/* Private variables ---------------------------------------------------------*/
+static int32_t (*diskWrite)(BLOCKDEV_t *dev, uint32_t lba, const void *data, uint32_t count);
+static uint32_t slotWrites;
+static uint32_t otherWrites;
+static uint32_t misaligned;
+static uint32_t lcg = 12345U;
+
+/**
+  * @brief  RAM disk write, counting the write sizes
+  */
+static int32_t CountingWrite(BLOCKDEV_t *dev, uint32_t lba, const void *data, uint32_t count)
+{
+  if (count == (SLOT_SIZE / SECTOR_SIZE))
+  {
+    slotWrites++;
+    if ((lba % count) != 0U)
+    {
+      misaligned++;
+    }
+  }
+  else
+  {
+    otherWrites++;
+  }
+  return diskWrite(dev, lba, data, count);
+}
+
+static uint32_t Random(void)
+{
+  lcg = (lcg * 1103515245U) + 12345U;
+  return lcg >> 8;
+}
+
+static uint8_t PatternByte(uint32_t sequence, uint32_t index)
+{
+  return (uint8_t)((sequence * 31U) + index);
+}
+
+/**
+  * @brief  Store every committed slot
+  */
+static int Drain(LOGCACHE_t *cache, LOGFILE_t *file, uint32_t maxSlots)
+{
+  const uint8_t *slot;
+  uint32_t len;
+
+  while ((maxSlots-- > 0U) && ((slot = LOGCACHE_Peek(cache, &len)) != NULL))
+  {
+    if (LOGFILE_Write(file, slot, len) != 0)
+    {
+      return -1;
+    }
+    LOGCACHE_Release(cache);
+  }
+  return 0;
+}
+
+int main(void)
+{
+  static uint8_t payload[2048];
+  uint8_t *disk = malloc((size_t)DISK_SECTORS * SECTOR_SIZE);
+  uint8_t *slots = malloc((size_t)SLOT_SIZE * SLOT_COUNT);
+  BLOCKDEV_t dev;
+  LOGCACHE_t cache;
+  LOGFILE_t file;
+  RecordHeader_t header;
+  LOGFILE_RawHeader_t raw;
+  uint64_t accepted = 0U;
+  uint64_t logged;
+  uint32_t records = 0U;
+  uint32_t gaps = 0U;
+  uint32_t errors = 0U;
+  uint32_t expected = 0U;
+  uint32_t stalled = 0U;
+  uint32_t offset;
+  uint32_t i;
+  uint32_t j;
+  const uint8_t *data;
+  clock_t start;
+  double seconds;
+
+  if ((disk == NULL) || (slots == NULL) ||
+      (RAMDISK_Init(&dev, disk, SECTOR_SIZE, DISK_SECTORS) != 0) ||
+      (LOGCACHE_Init(&cache, slots, SLOT_SIZE, SLOT_COUNT) != 0))
+  {
+    return EXIT_FAILURE;
+  }
+  diskWrite = dev.write;
+  dev.write = CountingWrite;
+
+  if (LOGFILE_Open(&file, &dev) != 0)
+  {
+    printf("open failed\n");
+    return EXIT_FAILURE;
+  }
+
+  start = clock();
+  for (i = 0; i < RECORDS; i++)
+  {
+    /* Mostly gyro batches (16 samples of 24 bytes), some odd sizes */
+    header.sync = RECORD_SYNC;
+    header.type = 1U;
+    header.reserved = 0U;
+    header.length = (uint16_t)(((Random() % 8U) == 0U) ? (Random() % sizeof(payload)) : 384U);
+    header.sequence = (uint16_t)i;
+    header.timestampUs = (uint64_t)i * 21U;
+    for (j = 0; j < header.length; j++)
+    {
+      payload[j] = PatternByte(i, j);
+    }
+    if (LOGCACHE_Append(&cache, &header, sizeof(header), payload, header.length) >= 0)
+    {
+      accepted += sizeof(header) + header.length;
+    }
+
+    /* The device keeps up except while it stalls */
+    if ((i % STALL_EVERY) == 0U)
+    {
+      stalled = STALL_LENGTH;
+    }
+    if (stalled > 0U)
+    {
+      stalled--;
+    }
+    else if (Drain(&cache, &file, 1U) != 0)
+    {
+      printf("write failed\n");
+      return EXIT_FAILURE;
+    }
+  }
+  (void)LOGCACHE_Commit(&cache);
+  if ((Drain(&cache, &file, SLOT_COUNT) != 0) || (LOGFILE_Close(&file) != 0))
+  {
+    printf("close failed\n");
+    return EXIT_FAILURE;
+  }
+  seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  /* Read the log back */
+  memcpy(&raw, disk, sizeof(raw));
+  logged = ((uint64_t)raw.bytesHigh << 32) | raw.bytesLow;
+  if ((memcmp(raw.magic, LOGFILE_RAW_MAGIC, sizeof(raw.magic)) != 0) || (logged != accepted))
+  {
+    printf("header: %llu bytes logged, %llu accepted\n",
+           (unsigned long long)logged, (unsigned long long)accepted);
+    return EXIT_FAILURE;
+  }
+
+  data = &disk[(size_t)raw.dataLba * raw.sectorSize];
+  for (offset = 0U; offset < logged; offset += sizeof(header) + header.length)
+  {
+    memcpy(&header, &data[offset], sizeof(header));
+    if ((header.sync != RECORD_SYNC) || ((offset + sizeof(header) + header.length) > logged))
+    {
+      printf("bad record at %u\n", (unsigned)offset);
+      errors++;
+      break;
+    }
+    gaps += (uint16_t)(header.sequence - (uint16_t)expected);
+    expected = (uint32_t)header.sequence + 1U;
+    for (j = 0; j < header.length; j++)
+    {
+      if (data[offset + sizeof(header) + j] != PatternByte(header.sequence, j))
+      {
+        errors++;
+        break;
+      }
+    }
+    records++;
+  }
+  gaps += (uint16_t)((uint16_t)RECORDS - (uint16_t)expected);
+
+  printf("%u records logged, %u dropped (cache max %u of %u slots)\n",
+         (unsigned)records, (unsigned)cache.dropped, (unsigned)cache.highWater, (unsigned)SLOT_COUNT);
+  printf("%llu bytes, %u slot writes, %u other writes, %u misaligned\n",
+         (unsigned long long)logged, (unsigned)slotWrites, (unsigned)otherWrites, (unsigned)misaligned);
+  if (seconds > 0.0)
+  {
+    printf("%.1f MB/s through the cache on this host\n", (double)logged / seconds / 1e6);
+  }
+
+  /* Header sector on open and close, the last partial slot as its whole
+     sectors and its padded tail */
+  if ((errors != 0U) || (gaps != cache.dropped) || (cache.dropped == 0U) ||
+      ((records + cache.dropped) != RECORDS) || (misaligned != 0U) || (otherWrites > 4U))
+  {
+    printf("FAILED: %u corrupt records, %u sequence gaps\n", (unsigned)errors, (unsigned)gaps);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  free(disk);
+  free(slots);
+  return EXIT_SUCCESS;
+}
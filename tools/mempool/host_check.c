@@ -0,0 +1,512 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host fuzz and stress check of the fixed-size block pools
+  * @details Runs Peripherals/MEMPOOL/mempool.c on the host:
+  *          - MEMPOOL_Create() argument checks and block size rounding
+  *          - a seeded fuzz of FUZZ_STEPS random allocations, frees, double
+  *            frees, interior and foreign pointers against a model of the
+  *            size classes: every result, every counter of MEMPOOL_GetStats()
+  *            and the contents of every live block must match the model.
+  *            Some blocks are filled with the free tag itself, so the slow
+  *            path of the double free detection runs as well.
+  *          - STRESS_PRODUCERS threads standing for interrupt handlers hand
+  *            stamped blocks to STRESS_CONSUMERS task threads, which check
+  *            the stamp and free them; a block handed out twice, a torn
+  *            stamp, a lost block or an invalid free fails the check.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mempool.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define FUZZ_STEPS          400000U
+#define FUZZ_FREED          16U          /* Recently freed blocks kept for double frees */
+#define FREE_TAG            0x46524545UL /* MEMPOOL_FREE_TAG */
+#define LIVE_MAX            (MEMPOOL_SMALL_BLOCK_COUNT + MEMPOOL_MEDIUM_BLOCK_COUNT + MEMPOOL_LARGE_BLOCK_COUNT)
+#define STRESS_PRODUCERS    4U
+#define STRESS_CONSUMERS    2U
+#define STRESS_BLOCKS       200000U      /* Per producer */
+#define QUEUE_LENGTH        64U
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Block the model knows to be allocated
+ */
+typedef struct
+{
+  uint32_t *block;
+  uint32_t cls;
+  uint32_t seed;
+} Live_t;
+
+/**
+ * @brief   Model of one size class
+ */
+typedef struct
+{
+  uint32_t used;
+  uint32_t peak;
+  uint32_t failures;
+  uint32_t invalid;
+} Model_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const uint32_t classSize[MEMPOOL_CLASS_COUNT] = {
+  MEMPOOL_SMALL_BLOCK_SIZE, MEMPOOL_MEDIUM_BLOCK_SIZE, MEMPOOL_LARGE_BLOCK_SIZE
+};
+static const uint32_t classCount[MEMPOOL_CLASS_COUNT] = {
+  MEMPOOL_SMALL_BLOCK_COUNT, MEMPOOL_MEDIUM_BLOCK_COUNT, MEMPOOL_LARGE_BLOCK_COUNT
+};
+
+static Live_t live[LIVE_MAX];
+static uint32_t liveCount;
+static void *freed[FUZZ_FREED];
+static uint32_t freedNext;
+static Model_t model[MEMPOOL_CLASS_COUNT];
+static uint32_t lcg = 2025U;
+static uint32_t failures;
+
+static pthread_mutex_t queueLock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t *queue[QUEUE_LENGTH];
+static uint32_t queueHead;
+static uint32_t queueCount;
+static atomic_uint producersDone;
+static atomic_uint delivered;
+static atomic_uint torn;
+
+/* Private functions ---------------------------------------------------------*/
+static uint32_t Random(void)
+{
+  lcg = (lcg * 1103515245U) + 12345U;
+  return lcg >> 8;
+}
+
+/**
+  * @brief  Request size: each class and the oversize case about equally often
+  */
+static uint32_t RandomSize(void)
+{
+  const uint32_t pick = Random() % 4U;
+  const uint32_t low = (pick == 0U) ? 0U : (pick == 3U) ? MEMPOOL_LARGE_BLOCK_SIZE + 1U : classSize[pick - 1U] + 1U;
+  const uint32_t high = (pick == 3U) ? MEMPOOL_LARGE_BLOCK_SIZE + 64U : classSize[pick];
+
+  return low + (Random() % (high - low + 1U));
+}
+
+static void Check(int condition, const char *what, uint32_t step)
+{
+  if (!condition)
+  {
+    if (failures < 10U)
+    {
+      printf("FAILED: %s (step %u)\n", what, (unsigned)step);
+    }
+    failures++;
+  }
+}
+
+/**
+  * @brief  Fills a block from a seed; seeds that are multiples of 4 write the free tag
+  */
+static void Fill(uint32_t *block, uint32_t size, uint32_t seed)
+{
+  uint32_t i;
+
+  for (i = 0; i < (size / 4U); i++)
+  {
+    block[i] = ((seed % 4U) == 0U) ? FREE_TAG : (seed * 2654435761U) + i;
+  }
+}
+
+static int Intact(const uint32_t *block, uint32_t size, uint32_t seed)
+{
+  uint32_t i;
+
+  for (i = 0; i < (size / 4U); i++)
+  {
+    if (block[i] != (((seed % 4U) == 0U) ? FREE_TAG : (seed * 2654435761U) + i))
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static int IsLive(const void *block)
+{
+  uint32_t i;
+
+  for (i = 0; i < liveCount; i++)
+  {
+    if (live[i].block == block)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  Statistics of every class against the model
+  */
+static void CheckStats(uint32_t step)
+{
+  MEMPOOL_Stats_t stats;
+  uint32_t cls;
+
+  for (cls = 0; cls < (uint32_t)MEMPOOL_CLASS_COUNT; cls++)
+  {
+    MEMPOOL_GetStats((MEMPOOL_Class_t)cls, &stats);
+    Check((stats.blockSize == classSize[cls]) && (stats.blockCount == classCount[cls]) &&
+          (stats.freeCount == classCount[cls] - model[cls].used) &&
+          (stats.peakUsed == model[cls].peak) && (stats.allocFailures == model[cls].failures) &&
+          (stats.invalidFrees == model[cls].invalid), "statistics match the model", step);
+  }
+}
+
+static void CheckCreate(void)
+{
+  static uint32_t storage[64];
+  MEMPOOL_Pool_t pool;
+
+  Check(MEMPOOL_Create(NULL, "x", storage, 32U, 4U) == HAL_ERROR, "NULL pool rejected", 0U);
+  Check(MEMPOOL_Create(&pool, "x", NULL, 32U, 4U) == HAL_ERROR, "NULL storage rejected", 0U);
+  Check(MEMPOOL_Create(&pool, "x", (uint8_t *)storage + 2, 32U, 4U) == HAL_ERROR,
+        "misaligned storage rejected", 0U);
+  Check(MEMPOOL_Create(&pool, "x", storage, sizeof(MEMPOOL_Block_t) - 1U, 4U) == HAL_ERROR,
+        "block smaller than the header rejected", 0U);
+  Check(MEMPOOL_Create(&pool, "x", storage, 32U, 0U) == HAL_ERROR, "empty pool rejected", 0U);
+
+  /* 21 bytes round up to 24: blocks 6 words apart, all handed out in order */
+  Check(MEMPOOL_Create(&pool, "x", storage, 21U, 4U) == HAL_OK, "pool created", 0U);
+  Check(pool.blockSize == 24U, "block size rounded to words", 0U);
+  Check(MEMPOOL_PoolAlloc(&pool) == (void *)&storage[0], "first block", 0U);
+  Check(MEMPOOL_PoolAlloc(&pool) == (void *)&storage[6], "second block", 0U);
+  Check(MEMPOOL_PoolFree(&pool, &storage[6]) == HAL_OK, "free", 0U);
+  Check(MEMPOOL_PoolFree(&pool, &storage[6]) == HAL_ERROR, "double free below a full pool", 0U);
+  Check(MEMPOOL_PoolFree(&pool, &storage[0]) == HAL_OK, "free", 0U);
+  Check(MEMPOOL_PoolFree(&pool, &storage[0]) == HAL_ERROR, "double free of a full pool", 0U);
+  Check(pool.invalidFrees == 2U, "double frees counted", 0U);
+}
+
+/**
+  * @brief  MEMPOOL_Alloc() of a random size against the model
+  */
+static void FuzzAlloc(uint32_t step)
+{
+  const uint32_t size = RandomSize();
+  uint32_t expected = MEMPOOL_CLASS_COUNT;
+  uint32_t *block;
+  uint32_t cls;
+
+  /* Smallest class that fits and has a block; full ones on the way fail */
+  for (cls = 0; cls < (uint32_t)MEMPOOL_CLASS_COUNT; cls++)
+  {
+    if (size <= classSize[cls])
+    {
+      if (model[cls].used < classCount[cls])
+      {
+        expected = cls;
+        break;
+      }
+      model[cls].failures++;
+    }
+  }
+
+  block = MEMPOOL_Alloc(size);
+  if (expected == MEMPOOL_CLASS_COUNT)
+  {
+    Check(block == NULL, "allocation fails when no class fits or has a block", step);
+    return;
+  }
+
+  Check(block != NULL, "allocation succeeds", step);
+  if (block == NULL)
+  {
+    return;
+  }
+  Check(MEMPOOL_BlockSize(block) == classSize[expected], "block from the smallest free class", step);
+  Check(((uintptr_t)block & 3U) == 0U, "block word aligned", step);
+  Check(!IsLive(block), "block not handed out twice", step);
+
+  model[expected].used++;
+  if (model[expected].used > model[expected].peak)
+  {
+    model[expected].peak = model[expected].used;
+  }
+  live[liveCount].block = block;
+  live[liveCount].cls = expected;
+  live[liveCount].seed = Random();
+  Fill(block, classSize[expected], live[liveCount].seed);
+  liveCount++;
+}
+
+/**
+  * @brief  Frees a random live block after checking its contents
+  */
+static void FuzzFree(uint32_t step)
+{
+  const uint32_t i = Random() % liveCount;
+  const Live_t entry = live[i];
+
+  Check(Intact(entry.block, classSize[entry.cls], entry.seed), "live block contents kept", step);
+  live[i] = live[--liveCount];
+  model[entry.cls].used--;
+  MEMPOOL_Free(entry.block);
+
+  freed[freedNext] = entry.block;
+  freedNext = (freedNext + 1U) % FUZZ_FREED;
+}
+
+/**
+  * @brief  Frees of pointers the pools must reject
+  */
+static void FuzzBadFree(void)
+{
+  static uint32_t foreign[4];
+  const uint32_t kind = Random() % 4U;
+  void *pointer = NULL;
+  uint32_t cls = MEMPOOL_CLASS_LARGE;
+
+  if (kind == 0U)
+  {
+    /* Double free of a block freed lately, unless it was handed out again */
+    pointer = freed[Random() % FUZZ_FREED];
+    if ((pointer == NULL) || IsLive(pointer))
+    {
+      return;
+    }
+    cls = (MEMPOOL_BlockSize(pointer) == MEMPOOL_SMALL_BLOCK_SIZE) ? MEMPOOL_CLASS_SMALL :
+          (MEMPOOL_BlockSize(pointer) == MEMPOOL_MEDIUM_BLOCK_SIZE) ? MEMPOOL_CLASS_MEDIUM :
+          MEMPOOL_CLASS_LARGE;
+  }
+  else if ((kind == 1U) && (liveCount != 0U))
+  {
+    /* Inside a live block: owned by no class, charged to the large one */
+    pointer = (uint8_t *)live[Random() % liveCount].block + 4U;
+  }
+  else if (kind == 2U)
+  {
+    pointer = &foreign[Random() % 4U];
+  }
+
+  MEMPOOL_Free(pointer);
+  if (pointer != NULL)
+  {
+    model[cls].invalid++;
+  }
+}
+
+static void Fuzz(void)
+{
+  uint32_t step;
+
+  MEMPOOL_Init();
+  CheckStats(0U);
+
+  for (step = 1U; (step <= FUZZ_STEPS) && (failures == 0U); step++)
+  {
+    const uint32_t op = Random() % 16U;
+
+    /* Drift between empty and full pools every 20000 steps */
+    if ((op < (((step / 20000U) % 2U == 0U) ? 12U : 4U)) && (liveCount < LIVE_MAX))
+    {
+      FuzzAlloc(step);
+    }
+    else if ((op < 15U) && (liveCount != 0U))
+    {
+      FuzzFree(step);
+    }
+    else
+    {
+      FuzzBadFree();
+    }
+    CheckStats(step);
+  }
+
+  printf("fuzz: %u steps, peak %u/%u/%u blocks, %u/%u/%u failed allocations, %u invalid frees\n",
+         (unsigned)(step - 1U), (unsigned)model[0].peak, (unsigned)model[1].peak, (unsigned)model[2].peak,
+         (unsigned)model[0].failures, (unsigned)model[1].failures, (unsigned)model[2].failures,
+         (unsigned)(model[0].invalid + model[1].invalid + model[2].invalid));
+
+  while (liveCount != 0U)
+  {
+    FuzzFree(step);
+  }
+  CheckStats(step);
+}
+
+/**
+  * @brief  Interrupt handler stand-in: stamps blocks and queues them
+  */
+static void *Producer(void *arg)
+{
+  const uint32_t id = (uint32_t)(uintptr_t)arg;
+  uint32_t seed = id;
+  uint32_t sent = 0U;
+
+  while (sent < STRESS_BLOCKS)
+  {
+    uint32_t *block;
+    uint32_t size;
+
+    seed = (seed * 1103515245U) + 12345U;
+    size = (seed >> 8) % (MEMPOOL_SMALL_BLOCK_SIZE << ((seed >> 20) % 5U)) + 1U;
+    block = MEMPOOL_Alloc(size);
+    if (block == NULL)
+    {
+      sched_yield();
+      continue;
+    }
+
+    /* Stamp the whole block (odd seed, no free tag), then check nobody else wrote it */
+    Fill(block, MEMPOOL_BlockSize(block), (id << 24) | sent | 1U);
+    sched_yield();
+    if (!Intact(block, MEMPOOL_BlockSize(block), (id << 24) | sent | 1U))
+    {
+      atomic_fetch_add(&torn, 1U);
+    }
+
+    pthread_mutex_lock(&queueLock);
+    if (queueCount == QUEUE_LENGTH)
+    {
+      pthread_mutex_unlock(&queueLock);
+      MEMPOOL_Free(block);
+      continue;
+    }
+    queue[(queueHead + queueCount) % QUEUE_LENGTH] = block;
+    queueCount++;
+    pthread_mutex_unlock(&queueLock);
+    sent++;
+  }
+
+  atomic_fetch_add(&producersDone, 1U);
+  return NULL;
+}
+
+/**
+  * @brief  Whether a block still carries one producer stamp from end to end
+  */
+static int Stamped(const uint32_t *block, uint32_t size)
+{
+  uint32_t i;
+
+  for (i = 1U; i < (size / 4U); i++)
+  {
+    if (block[i] != block[0] + i)
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+  * @brief  Task stand-in: checks the stamp of each queued block and frees it
+  */
+static void *Consumer(void *arg)
+{
+  (void)arg;
+
+  for (;;)
+  {
+    const uint32_t done = atomic_load(&producersDone);
+    uint32_t *block = NULL;
+
+    pthread_mutex_lock(&queueLock);
+    if (queueCount != 0U)
+    {
+      block = queue[queueHead];
+      queueHead = (queueHead + 1U) % QUEUE_LENGTH;
+      queueCount--;
+    }
+    pthread_mutex_unlock(&queueLock);
+
+    if (block == NULL)
+    {
+      if (done == STRESS_PRODUCERS)
+      {
+        return NULL;
+      }
+      sched_yield();
+      continue;
+    }
+
+    if (!Stamped(block, MEMPOOL_BlockSize(block)))
+    {
+      atomic_fetch_add(&torn, 1U);
+    }
+    atomic_fetch_add(&delivered, 1U);
+    sched_yield();                      /* Slower than the handlers: pools run dry */
+    MEMPOOL_Free(block);
+  }
+}
+
+static void Stress(void)
+{
+  pthread_t producers[STRESS_PRODUCERS];
+  pthread_t consumers[STRESS_CONSUMERS];
+  MEMPOOL_Stats_t stats;
+  uint32_t invalid = 0U;
+  uint32_t cls;
+  uint32_t i;
+
+  MEMPOOL_Init();
+  for (i = 0; i < STRESS_CONSUMERS; i++)
+  {
+    pthread_create(&consumers[i], NULL, Consumer, NULL);
+  }
+  for (i = 0; i < STRESS_PRODUCERS; i++)
+  {
+    pthread_create(&producers[i], NULL, Producer, (void *)(uintptr_t)(i + 1U));
+  }
+  for (i = 0; i < STRESS_PRODUCERS; i++)
+  {
+    pthread_join(producers[i], NULL);
+  }
+  for (i = 0; i < STRESS_CONSUMERS; i++)
+  {
+    pthread_join(consumers[i], NULL);
+  }
+
+  printf("stress: %u handlers, %u tasks, %u blocks delivered, %u torn\n",
+         (unsigned)STRESS_PRODUCERS, (unsigned)STRESS_CONSUMERS,
+         (unsigned)atomic_load(&delivered), (unsigned)atomic_load(&torn));
+  Check(atomic_load(&delivered) == STRESS_PRODUCERS * STRESS_BLOCKS, "every block delivered", 0U);
+  Check(atomic_load(&torn) == 0U, "no block written by two threads", 0U);
+
+  for (cls = 0; cls < (uint32_t)MEMPOOL_CLASS_COUNT; cls++)
+  {
+    MEMPOOL_GetStats((MEMPOOL_Class_t)cls, &stats);
+    Check(stats.freeCount == stats.blockCount, "every block back in its pool", 0U);
+    invalid += stats.invalidFrees;
+  }
+  Check(invalid == 0U, "no invalid free under stress", 0U);
+  MEMPOOL_Report();
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  CheckCreate();
+  Fuzz();
+  Stress();
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u checks\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,402 @@
+#!/usr/bin/env python
+"""Convert a trained float motion classifier into the int8 C model of
+Peripherals/MOTION (motion_model.c).
+
+The network is the one motion_nn.c runs: a 1 x N convolution with ReLU over
+the [length][channels] gyro feature map, a dense layer to one logit per
+class, softmax. The float model is read from JSON:
+
+    {
+      "name": "motion",
+      "classes": ["idle", "rotate", ...],
+      "input":  {"length": 64, "channels": 4, "decimation": 8},
+      "conv":   {"weights": [filter][kernel][channel], "bias": [filter],
+                 "stride": 2, "padding": 2},
+      "dense":  {"weights": [class][length_out * filters], "bias": [class]},
+      "calibration": [window][length][channel]        (optional)
+    }
+
+Dense inputs are the convolution outputs flattened step major
+(index = step * filters + filter), as TFLite flattens an NHWC tensor.
+
+Quantization is post-training, TFLite style: symmetric per-filter int8
+convolution weights, symmetric per-tensor dense weights, int32 biases and
+asymmetric int8 activations with ranges taken from the calibration windows.
+The integer reference below reproduces the CMSIS-NN arithmetic bit for bit;
+--vectors writes some calibration windows with their expected logits for
+the host check in this directory.
+
+--demo builds a model trained on synthetic gyro motions instead of reading
+one, so the firmware has a working placeholder until a real model exists.
+
+Only the Python standard library is used.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import math
+import random
+import sys
+
+DEMO_CLASSES = ["idle", "rotate", "shake", "tilt"]
+DEMO_RATE_HZ = 760.0 / 8.0
+
+
+def rnd(x):
+    """Round half away from zero, like lroundf() and std::round()."""
+    return int(math.floor(x + 0.5)) if x >= 0 else -int(math.floor(-x + 0.5))
+
+
+def clamp(x, lo, hi):
+    return lo if x < lo else hi if x > hi else x
+
+
+def to_int32(x):
+    x &= 0xFFFFFFFF
+    return x - (1 << 32) if x & 0x80000000 else x
+
+
+# --- Float network ----------------------------------------------------------
+
+def conv_out_length(length, kernel, stride, padding):
+    return (length + 2 * padding - kernel) // stride + 1
+
+
+def float_forward(model, window):
+    conv = model["conv"]
+    dense = model["dense"]
+    stride, padding = conv["stride"], conv["padding"]
+    kernel = len(conv["weights"][0])
+    length = len(window)
+    out_len = conv_out_length(length, kernel, stride, padding)
+    features = []
+    for x in range(out_len):
+        for f, weights in enumerate(conv["weights"]):
+            acc = conv["bias"][f]
+            for k in range(kernel):
+                ix = x * stride - padding + k
+                if 0 <= ix < length:
+                    acc += sum(w * v for w, v in zip(weights[k], window[ix]))
+            features.append(max(acc, 0.0))
+    logits = [b + sum(w * v for w, v in zip(row, features))
+              for row, b in zip(dense["weights"], dense["bias"])]
+    return features, logits
+
+
+def softmax(values):
+    peak = max(values)
+    exps = [math.exp(v - peak) for v in values]
+    total = sum(exps)
+    return [e / total for e in exps]
+
+
+# --- Quantization -----------------------------------------------------------
+
+def quantize_multiplier(real):
+    """Q31 multiplier and left shift with real = mult * 2^(shift - 31)."""
+    if real == 0.0:
+        return 0, 0
+    mantissa, exponent = math.frexp(real)
+    mult = rnd(mantissa * (1 << 31))
+    if mult == (1 << 31):
+        mult //= 2
+        exponent += 1
+    return mult, exponent
+
+
+def activation_params(lo, hi):
+    """Asymmetric int8 scale and zero point covering [lo, hi] and 0."""
+    lo, hi = min(lo, 0.0), max(hi, 0.0)
+    scale = (hi - lo) / 255.0 if hi > lo else 1.0
+    zero_point = clamp(rnd(-128 - lo / scale), -128, 127)
+    return scale, zero_point
+
+
+def quantize(model, windows):
+    conv = model["conv"]
+    dense = model["dense"]
+
+    input_range = max(abs(v) for w in windows for step in w for v in step) or 1.0
+    in_scale = input_range / 127.0
+
+    feature_max = 0.0
+    logit_lo, logit_hi = 0.0, 0.0
+    for window in windows:
+        features, logits = float_forward(model, window)
+        feature_max = max(feature_max, max(features))
+        logit_lo = min(logit_lo, min(logits))
+        logit_hi = max(logit_hi, max(logits))
+    conv_scale, conv_zp = activation_params(0.0, feature_max)
+    dense_scale, dense_zp = activation_params(logit_lo, logit_hi)
+
+    q = {"input_scale": in_scale, "input_zp": 0,
+         "conv_zp": conv_zp, "dense_zp": dense_zp, "dense_scale": dense_scale,
+         "conv_w": [], "conv_b": [], "conv_mult": [], "conv_shift": []}
+
+    for weights, bias in zip(conv["weights"], conv["bias"]):
+        w_max = max(abs(v) for row in weights for v in row) or 1.0
+        w_scale = w_max / 127.0
+        q["conv_w"].append([[clamp(rnd(v / w_scale), -127, 127) for v in row] for row in weights])
+        q["conv_b"].append(rnd(bias / (in_scale * w_scale)))
+        mult, shift = quantize_multiplier(in_scale * w_scale / conv_scale)
+        q["conv_mult"].append(mult)
+        q["conv_shift"].append(shift)
+
+    d_max = max(abs(v) for row in dense["weights"] for v in row) or 1.0
+    d_scale = d_max / 127.0
+    q["dense_w"] = [[clamp(rnd(v / d_scale), -127, 127) for v in row] for row in dense["weights"]]
+    q["dense_b"] = [rnd(b / (conv_scale * d_scale)) for b in dense["bias"]]
+    q["dense_mult"], q["dense_shift"] = quantize_multiplier(conv_scale * d_scale / dense_scale)
+    return q
+
+
+def quantize_input(q, window):
+    return [[clamp(rnd(v / q["input_scale"]) + q["input_zp"], -128, 127) for v in step]
+            for step in window]
+
+
+# --- Integer reference (CMSIS-NN arithmetic) --------------------------------
+
+def divide_by_power_of_two(dividend, exponent):
+    mask = (1 << exponent) - 1
+    remainder = dividend & mask
+    result = dividend >> exponent
+    threshold = (mask >> 1) + (1 if result < 0 else 0)
+    return result + 1 if remainder > threshold else result
+
+
+def requantize(value, mult, shift):
+    value = to_int32(value * (1 << max(shift, 0)))
+    value = to_int32((value * mult + (1 << 30)) >> 31)
+    return divide_by_power_of_two(value, max(-shift, 0))
+
+
+def int_forward(model, q, qin):
+    conv = model["conv"]
+    stride, padding = conv["stride"], conv["padding"]
+    kernel = len(conv["weights"][0])
+    length = len(qin)
+    out_len = conv_out_length(length, kernel, stride, padding)
+    features = []
+    for x in range(out_len):
+        for f, weights in enumerate(q["conv_w"]):
+            acc = q["conv_b"][f]
+            for k in range(kernel):
+                ix = x * stride - padding + k
+                if 0 <= ix < length:
+                    acc += sum(w * (v - q["input_zp"]) for w, v in zip(weights[k], qin[ix]))
+            out = requantize(acc, q["conv_mult"][f], q["conv_shift"][f]) + q["conv_zp"]
+            features.append(clamp(out, q["conv_zp"], 127))
+    logits = []
+    for row, bias in zip(q["dense_w"], q["dense_b"]):
+        acc = bias + sum(w * (v - q["conv_zp"]) for w, v in zip(row, features))
+        out = requantize(acc, q["dense_mult"], q["dense_shift"]) + q["dense_zp"]
+        logits.append(clamp(out, -128, 127))
+    return logits
+
+
+# --- Demo model on synthetic motions ----------------------------------------
+
+def demo_window(rng, label, length):
+    t = [i / DEMO_RATE_HZ for i in range(length)]
+    axes = [[rng.gauss(0.0, 1.0) for _ in t] for _ in range(3)]
+    if label == "rotate":
+        axis, rate = rng.randrange(3), rng.choice([-1, 1]) * rng.uniform(60.0, 300.0)
+        axes[axis] = [v + rate for v in axes[axis]]
+    elif label == "shake":
+        axis, amp, hz = rng.randrange(3), rng.uniform(100.0, 300.0), rng.uniform(4.0, 8.0)
+        phase = rng.uniform(0.0, 2.0 * math.pi)
+        axes[axis] = [v + amp * math.sin(2.0 * math.pi * hz * s + phase) for v, s in zip(axes[axis], t)]
+    elif label == "tilt":
+        axis, peak = rng.randrange(2), rng.choice([-1, 1]) * rng.uniform(50.0, 200.0)
+        width, start = rng.uniform(0.2, 0.4), rng.uniform(0.0, t[-1] - 0.4)
+        axes[axis] = [v + (peak * math.sin(math.pi * (s - start) / width) if start <= s < start + width else 0.0)
+                      for v, s in zip(axes[axis], t)]
+    return [[x, y, z, math.sqrt(x * x + y * y + z * z)] for x, y, z in zip(*axes)]
+
+
+def demo_model(rng, length=64, kernel=5, stride=2, padding=2, samples=60, epochs=40):
+    """Fixed feature filters, dense layer trained by softmax regression."""
+    smooth = [1.0 / kernel] * kernel
+    filters = []
+    for axis in range(3):
+        for sign in (1.0, -1.0):
+            filters.append([[sign * s if c == axis else 0.0 for c in range(4)] for s in smooth])
+    filters.append([[s if c == 3 else 0.0 for c in range(4)] for s in smooth])
+    centre = kernel // 2
+    filters.append([[((1.0 if k == centre else 0.0) - 1.0 / kernel) if c == 3 else 0.0 for c in range(4)]
+                    for k in range(kernel)])
+    model = {
+        "name": "motion_demo",
+        "classes": DEMO_CLASSES,
+        "input": {"length": length, "channels": 4, "decimation": 8},
+        "conv": {"weights": filters, "bias": [0.0] * len(filters), "stride": stride, "padding": padding},
+        "dense": {"weights": [], "bias": []},
+    }
+
+    data = [(demo_window(rng, label, length), index)
+            for index, label in enumerate(DEMO_CLASSES) for _ in range(samples)]
+    rng.shuffle(data)
+    model["dense"] = {"weights": [[0.0]], "bias": [0.0]}
+    features = [(float_forward(model, w)[0], label) for w, label in data]
+    width = len(features[0][0])
+    norm = max(max(f) for f, _ in features) or 1.0
+    weights = [[0.0] * width for _ in DEMO_CLASSES]
+    bias = [0.0] * len(DEMO_CLASSES)
+    rate = 0.5
+    for _ in range(epochs):
+        for f, label in features:
+            x = [v / norm for v in f]
+            probs = softmax([b + sum(w * v for w, v in zip(row, x)) for row, b in zip(weights, bias)])
+            for c, row in enumerate(weights):
+                err = probs[c] - (1.0 if c == label else 0.0)
+                bias[c] -= rate * err
+                for i, v in enumerate(x):
+                    if v:
+                        row[i] -= rate * err * v
+    model["dense"] = {"weights": [[w / norm for w in row] for row in weights], "bias": bias}
+    model["calibration"] = [w for w, _ in data]
+    model["labels"] = [label for _, label in data]
+    return model
+
+
+# --- C output ---------------------------------------------------------------
+
+def c_array(ctype, name, values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join("%d" % v for v in values[i:i + per_line]) + ",")
+    return "static const %s %s[%d] = {\n%s\n};\n" % (ctype, name, len(values), "\n".join(lines))
+
+
+def write_model(path, model, q, source):
+    conv = model["conv"]
+    kernel = len(conv["weights"][0])
+    length = model["input"]["length"]
+    out_len = conv_out_length(length, kernel, conv["stride"], conv["padding"])
+    flat = lambda rows: [v for row in rows for v in row]
+    classes = ", ".join('"%s"' % c for c in model["classes"])
+    with open(path, "w") as out:
+        out.write("""/**
+  ******************************************************************************
+  * @file    motion_model.c
+  * @brief   Motion classifier model
+  * @details Generated by tools/motion_model/export_model.py from
+  *          %s. Do not edit; export the trained model again instead.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "motion_nn.h"
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const classNames[%d] = { %s };
+
+""" % (source, len(model["classes"]), classes))
+        out.write(c_array("int8_t", "convWeights", flat(flat(q["conv_w"]))) + "\n")
+        out.write(c_array("int32_t", "convBias", q["conv_b"], 8) + "\n")
+        out.write(c_array("int32_t", "convMultiplier", q["conv_mult"], 4) + "\n")
+        out.write(c_array("int32_t", "convShift", q["conv_shift"], 8) + "\n")
+        out.write(c_array("int8_t", "denseWeights", flat(q["dense_w"])) + "\n")
+        out.write(c_array("int32_t", "denseBias", q["dense_b"], 8) + "\n")
+        out.write("""/* Exported variables --------------------------------------------------------*/
+const MOTION_NN_Model_t motionModel = {
+  .name = "%s",
+  .classNames = classNames,
+  .classCount = %dU,
+  .inputLength = %dU,
+  .inputChannels = %dU,
+  .decimation = %dU,
+  .inputScale = %.9ef,
+  .inputZeroPoint = %d,
+  .convFilters = %dU,
+  .convKernel = %dU,
+  .convStride = %dU,
+  .convPadding = %dU,
+  .convOutputLength = %dU,
+  .convWeights = convWeights,
+  .convBias = convBias,
+  .convMultiplier = convMultiplier,
+  .convShift = convShift,
+  .convOutputZeroPoint = %d,
+  .denseWeights = denseWeights,
+  .denseBias = denseBias,
+  .denseMultiplier = %d,
+  .denseShift = %d,
+  .denseOutputZeroPoint = %d,
+  .denseOutputScale = %.9ef,
+};
+""" % (model["name"], len(model["classes"]), length, model["input"]["channels"],
+       model["input"]["decimation"], q["input_scale"], q["input_zp"], len(conv["weights"]), kernel,
+       conv["stride"], conv["padding"], out_len, q["conv_zp"], q["dense_mult"], q["dense_shift"],
+       q["dense_zp"], q["dense_scale"]))
+
+
+def write_vectors(path, model, q, windows, count):
+    chosen = windows[:count]
+    inputs, logits, classes = [], [], []
+    for window in chosen:
+        qin = quantize_input(q, window)
+        inputs.extend(v for step in qin for v in step)
+        logits.extend(int_forward(model, q, qin))
+        float_logits = float_forward(model, window)[1]
+        classes.append(float_logits.index(max(float_logits)))
+    with open(path, "w") as out:
+        out.write("/* Generated by export_model.py: inputs, bit exact logits, float model class */\n")
+        out.write("#include <stdint.h>\n\n")
+        out.write("#define VECTOR_COUNT %d\n\n" % len(chosen))
+        out.write(c_array("int8_t", "vectorInputs", inputs))
+        out.write(c_array("int8_t", "vectorLogits", logits))
+        out.write(c_array("uint8_t", "vectorClasses", classes))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("model", nargs="?", help="trained float model, JSON")
+    source.add_argument("--demo", action="store_true", help="train a demo model on synthetic motions")
+    parser.add_argument("-o", "--output", default="Peripherals/MOTION/motion_model.c")
+    parser.add_argument("--vectors", help="also write host check vectors to this C file")
+    parser.add_argument("--vector-count", type=int, default=16)
+    parser.add_argument("--seed", type=int, default=2025)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    if args.demo:
+        model = demo_model(rng)
+        name = "the synthetic demo model (--demo --seed %d)" % args.seed
+    else:
+        with open(args.model) as f:
+            model = json.load(f)
+        name = args.model
+    windows = model.get("calibration")
+    if not windows:
+        sys.exit("the model needs calibration windows")
+
+    q = quantize(model, windows)
+    write_model(args.output, model, q, name)
+
+    predicted = []
+    agree = 0
+    for window in windows:
+        float_logits = float_forward(model, window)[1]
+        int_logits = int_forward(model, q, quantize_input(q, window))
+        predicted.append(int_logits.index(max(int_logits)))
+        agree += float_logits.index(max(float_logits)) == predicted[-1]
+    print("%s: %d/%d calibration windows classified as by the float model"
+          % (args.output, agree, len(windows)))
+    if "labels" in model:
+        correct = sum(p == label for p, label in zip(predicted, model["labels"]))
+        print("int8 accuracy on the synthetic set: %d/%d" % (correct, len(windows)))
+
+    if args.vectors:
+        write_vectors(args.vectors, model, q, windows, args.vector_count)
+        print("%s: %d vectors" % (args.vectors, min(args.vector_count, len(windows))))
+
+
+if __name__ == "__main__":
+    main()
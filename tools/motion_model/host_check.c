@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host check of the motion classifier inference
+  * @details Runs MOTION_NN_Run() on the vectors written by export_model.py
+  *          and compares the logits with the Python integer reference, which
+  *          must match bit for bit. Also reports the arena the firmware
+  *          needs and how often the int8 network agrees with the float one.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "motion_nn.h"
+#include "motion_vectors.c"
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(void)
+{
+  const MOTION_NN_Model_t *model = &motionModel;
+  const uint32_t inputSize = (uint32_t)model->inputLength * model->inputChannels;
+  const uint32_t arenaSize = MOTION_NN_ArenaSize(model);
+  int8_t logits[MOTION_NN_MAX_CLASSES];
+  float32_t probs[MOTION_NN_MAX_CLASSES];
+  uint32_t *arena;
+  uint32_t mismatches = 0U;
+  uint32_t agree = 0U;
+  uint32_t best;
+  uint32_t v;
+  uint32_t i;
+  arm_status status;
+
+  if (MOTION_NN_Check(model) != 0)
+  {
+    printf("model %s does not fit the kernels\n", model->name);
+    return EXIT_FAILURE;
+  }
+  if (sizeof(vectorInputs) != (VECTOR_COUNT * inputSize))
+  {
+    printf("vectors do not match the model\n");
+    return EXIT_FAILURE;
+  }
+
+  arena = malloc(arenaSize);
+  if (arena == NULL)
+  {
+    return EXIT_FAILURE;
+  }
+
+  printf("model %s: %u x %u input, %u classes\n", model->name, (unsigned)model->inputLength,
+         (unsigned)model->inputChannels, (unsigned)model->classCount);
+  printf("arena %u bytes, input %u bytes\n", (unsigned)arenaSize, (unsigned)inputSize);
+
+  for (v = 0; v < VECTOR_COUNT; v++)
+  {
+    status = MOTION_NN_Run(model, &vectorInputs[v * inputSize], arena, arenaSize, logits, probs);
+    if (status != ARM_MATH_SUCCESS)
+    {
+      printf("vector %u: status %d\n", (unsigned)v, (int)status);
+      free(arena);
+      return EXIT_FAILURE;
+    }
+
+    best = 0U;
+    for (i = 0; i < model->classCount; i++)
+    {
+      if (logits[i] != vectorLogits[(v * model->classCount) + i])
+      {
+        printf("vector %u class %u: logit %d, expected %d\n", (unsigned)v, (unsigned)i,
+               logits[i], vectorLogits[(v * model->classCount) + i]);
+        mismatches++;
+      }
+      best = (probs[i] > probs[best]) ? i : best;
+    }
+    agree += (best == vectorClasses[v]) ? 1U : 0U;
+    printf("vector %2u: %-8s p=%.3f\n", (unsigned)v, model->classNames[best], (double)probs[best]);
+  }
+
+  free(arena);
+  printf("%u logit mismatches, %u/%u classified as by the float model\n", (unsigned)mismatches,
+         (unsigned)agree, (unsigned)VECTOR_COUNT);
+  return (mismatches == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
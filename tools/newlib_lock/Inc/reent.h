@@ -0,0 +1,18 @@
+/**
+  ******************************************************************************
+  * @file    reent.h
+  * @brief   Host build stand-in for newlib's <reent.h>
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __REENT_H__
+#define __REENT_H__
+
+struct _reent;
+
+void __malloc_lock(struct _reent *r);
+void __malloc_unlock(struct _reent *r);
+
+#endif /* __REENT_H__ */
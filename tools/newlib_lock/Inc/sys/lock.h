@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @file    lock.h
+  * @brief   Host build stand-in for newlib's <sys/lock.h>
+  * @details The retargetable locking interface of newlib, which glibc does
+  *          not have: the opaque lock type and the hooks newlib_lock.c
+  *          implements.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SYS_LOCK_H__
+#define __SYS_LOCK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct __lock;
+typedef struct __lock *_LOCK_T;
+
+void __retarget_lock_init(_LOCK_T *lock);
+void __retarget_lock_init_recursive(_LOCK_T *lock);
+void __retarget_lock_close(_LOCK_T lock);
+void __retarget_lock_close_recursive(_LOCK_T lock);
+void __retarget_lock_acquire(_LOCK_T lock);
+void __retarget_lock_acquire_recursive(_LOCK_T lock);
+int __retarget_lock_try_acquire(_LOCK_T lock);
+int __retarget_lock_try_acquire_recursive(_LOCK_T lock);
+void __retarget_lock_release(_LOCK_T lock);
+void __retarget_lock_release_recursive(_LOCK_T lock);
+
+extern struct __lock __lock___malloc_recursive_mutex;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SYS_LOCK_H__ */
@@ -0,0 +1,401 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host check of the newlib lock layer
+  * @details Runs Peripherals/RTOS/newlib_lock.c on the FreeRTOS kernel
+  *          itself, built for the host on the POSIX port of tools/common
+  *          (host_freertos), from a check task and the tasks it starts:
+  *          - before the scheduler starts, locks are no-ops and a section
+  *            entered then does not give the mutex when it ends afterwards
+  *          - from handler mode and with the scheduler suspended, acquire
+  *            and release assert, and never give a mutex they did not take
+  *          - try_acquire fails while another task holds the lock
+  *          - STRESS_TASKS tasks enter static, pool and heap locks, nested,
+  *            and update unprotected counters in them: a lost update or two
+  *            tasks inside one lock at once fails the check
+  *          - tasks create and close dynamic locks concurrently; a fresh
+  *            lock handed to two tasks, or a heap lock not freed, fails it
+  *          No mutex may ever be given by a task that does not hold it:
+  *          the link wraps xQueueGiveMutexRecursive() to count the gives
+  *          the kernel refuses.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "newlib_lock.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "sim_core.h"
+#include <sys/lock.h>
+#include <reent.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define STRESS_TASKS       8U
+#define STRESS_ROUNDS      20000U
+#define STRESS_LOCKS       12U          /* More than the pool, some from the heap */
+#define CHURN_ROUNDS       5000U
+#define CHURN_LIVE         3U           /* Locks each churn task keeps open */
+#define TASK_PRIORITY      (tskIDLE_PRIORITY + 1U)   /* One level, taskYIELD() interleaves */
+#define TASK_STACK         configMINIMAL_STACK_SIZE
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   A lock under stress and the data it protects
+ */
+typedef struct
+{
+  _LOCK_T lock;
+  uint32_t counter;                     /* Plain, the lock protects it */
+  atomic_uint inside;                   /* Tasks inside the lock right now */
+} Guarded_t;
+
+/**
+ * @brief   Storage of a statically created task
+ */
+typedef struct
+{
+  StaticTask_t tcb;
+  StackType_t stack[TASK_STACK];
+} TaskMemory_t;
+
+/* Private variables ---------------------------------------------------------*/
+extern struct __lock __lock___env_recursive_mutex;
+extern struct __lock __lock___sfp_recursive_mutex;
+
+/* Separate storage per phase: the idle task may not have reclaimed a
+   deleted task yet when the next phase starts */
+static TaskMemory_t idleTask;
+static TaskMemory_t checkTask;
+static TaskMemory_t holderTask;
+static TaskMemory_t stressTasks[STRESS_TASKS];
+static TaskMemory_t churnTasks[STRESS_TASKS];
+static TaskHandle_t checkHandle;
+
+static Guarded_t guarded[STRESS_LOCKS + 2U];
+static atomic_uint collisions;
+static atomic_uint reused;
+static atomic_int handoff;
+static atomic_uint asserts;
+static atomic_uint giveFailures;
+static uint32_t failures;
+
+/* Private function prototypes -----------------------------------------------*/
+BaseType_t __real_xQueueGiveMutexRecursive(QueueHandle_t xMutex);
+BaseType_t __wrap_xQueueGiveMutexRecursive(QueueHandle_t xMutex);
+
+/* Private functions ---------------------------------------------------------*/
+static void Check(int condition, const char *what)
+{
+  if (!condition)
+  {
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+/**
+  * @brief  configASSERT() of the host configuration: counts, goes on
+  */
+void vAssertCalled(const char *file, int line)
+{
+  (void)file;
+  (void)line;
+  atomic_fetch_add(&asserts, 1U);
+}
+
+/**
+  * @brief  Counts the gives the kernel refuses, from a task not holding it
+  */
+BaseType_t __wrap_xQueueGiveMutexRecursive(QueueHandle_t xMutex)
+{
+  BaseType_t given = __real_xQueueGiveMutexRecursive(xMutex);
+
+  if (given != pdPASS)
+  {
+    atomic_fetch_add(&giveFailures, 1U);
+  }
+  return given;
+}
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize)
+{
+  *ppxIdleTaskTCBBuffer = &idleTask.tcb;
+  *ppxIdleTaskStackBuffer = idleTask.stack;
+  *pulIdleTaskStackSize = TASK_STACK;
+}
+
+static TaskHandle_t Start(TaskFunction_t code, const char *name, void *arg, TaskMemory_t *memory)
+{
+  return xTaskCreateStatic(code, name, TASK_STACK, arg, TASK_PRIORITY, memory->stack, &memory->tcb);
+}
+
+/**
+  * @brief  Tells the check task one more task is done, and ends
+  */
+static void Done(void)
+{
+  xTaskNotifyGive(checkHandle);
+  vTaskDelete(NULL);
+}
+
+/**
+  * @brief  Waits, in the check task, for the given number of Done() calls
+  */
+static void WaitDone(uint32_t tasks)
+{
+  while (tasks > 0U)
+  {
+    tasks -= ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+
+static void WaitFor(int value)
+{
+  while (atomic_load(&handoff) != value)
+  {
+    taskYIELD();
+  }
+}
+
+/**
+  * @brief  Holds the env lock until the check task has tried it
+  */
+static void Holder(void *arg)
+{
+  (void)arg;
+  __retarget_lock_acquire_recursive(&__lock___env_recursive_mutex);
+  atomic_store(&handoff, 1);
+  WaitFor(2);
+  __retarget_lock_release_recursive(&__lock___env_recursive_mutex);
+  atomic_store(&handoff, 3);
+  vTaskDelete(NULL);
+}
+
+/**
+  * @brief  Counter update with a window for another task to interleave
+  */
+static void Update(Guarded_t *g)
+{
+  uint32_t value;
+
+  if (atomic_fetch_add(&g->inside, 1U) != 0U)
+  {
+    atomic_fetch_add(&collisions, 1U);
+  }
+  value = g->counter;
+  taskYIELD();
+  g->counter = value + 1U;
+  atomic_fetch_sub(&g->inside, 1U);
+}
+
+static void Stress(void *arg)
+{
+  uint32_t seed = (uint32_t)(uintptr_t)arg;
+  uint32_t round;
+
+  for (round = 0; round < STRESS_ROUNDS; round++)
+  {
+    Guarded_t *g;
+
+    seed = (seed * 1103515245U) + 12345U;
+    g = &guarded[(seed >> 16) % (STRESS_LOCKS + 2U)];
+
+    if (g->lock == &__lock___malloc_recursive_mutex)
+    {
+      /* The classic pair, nested once as malloc() inside stdio would */
+      __malloc_lock(NULL);
+      __malloc_lock(NULL);
+      Update(g);
+      __malloc_unlock(NULL);
+      __malloc_unlock(NULL);
+    }
+    else if (((seed >> 8) & 3U) == 0U)
+    {
+      while (__retarget_lock_try_acquire_recursive(g->lock) != 0)
+      {
+        taskYIELD();
+      }
+      Update(g);
+      __retarget_lock_release_recursive(g->lock);
+    }
+    else
+    {
+      __retarget_lock_acquire_recursive(g->lock);
+      __retarget_lock_acquire(g->lock);
+      Update(g);
+      __retarget_lock_release(g->lock);
+      __retarget_lock_release_recursive(g->lock);
+    }
+  }
+  Done();
+}
+
+/**
+  * @brief  Creates, enters and closes dynamic locks; a fresh one must be free
+  */
+static void Churn(void *arg)
+{
+  _LOCK_T live[CHURN_LIVE] = {NULL};
+  uint32_t round;
+
+  (void)arg;
+  for (round = 0; round < CHURN_ROUNDS; round++)
+  {
+    const uint32_t slot = round % CHURN_LIVE;
+
+    if (live[slot] != NULL)
+    {
+      __retarget_lock_release(live[slot]);
+      __retarget_lock_close(live[slot]);
+    }
+    __retarget_lock_init(&live[slot]);
+    if ((live[slot] == NULL) || (__retarget_lock_try_acquire(live[slot]) != 0))
+    {
+      atomic_fetch_add(&reused, 1U);
+      live[slot] = NULL;
+    }
+  }
+  for (round = 0; round < CHURN_LIVE; round++)
+  {
+    if (live[round] != NULL)
+    {
+      __retarget_lock_release(live[round]);
+      __retarget_lock_close(live[round]);
+    }
+  }
+  Done();
+}
+
+/**
+  * @brief  Single task: scheduler states, handler mode, try_acquire
+  */
+static void CheckContexts(void)
+{
+  uint32_t count;
+  uint32_t violations;
+
+  /* main() entered it before the start: the section ends here */
+  __retarget_lock_release_recursive(&__lock___sfp_recursive_mutex);
+  Check((atomic_load(&asserts) == 0U) && (atomic_load(&giveFailures) == 0U),
+        "release of a section entered before the start");
+
+  /* Handler mode: every call asserts and is counted */
+  count = atomic_load(&asserts);
+  violations = NEWLIB_LOCK_GetIsrViolations();
+  SIM_SetHandlerMode(1U);
+  __malloc_lock(NULL);
+  __malloc_unlock(NULL);
+  SIM_SetHandlerMode(0U);
+  Check(atomic_load(&asserts) == count + 2U, "handler mode acquire/release assert");
+  Check(NEWLIB_LOCK_GetIsrViolations() == violations + 2U, "handler mode calls counted");
+
+  /* Another task holds the lock: try fails, suspended calls assert */
+  Start(Holder, "holder", NULL, &holderTask);
+  WaitFor(1);
+  Check(__retarget_lock_try_acquire_recursive(&__lock___env_recursive_mutex) != 0,
+        "try_acquire of a lock another task holds");
+  count = atomic_load(&asserts);
+  vTaskSuspendAll();
+  __retarget_lock_acquire_recursive(&__lock___env_recursive_mutex);
+  __retarget_lock_release_recursive(&__lock___env_recursive_mutex);
+  (void)xTaskResumeAll();
+  Check(atomic_load(&asserts) == count + 2U, "acquire/release with the scheduler suspended assert");
+  atomic_store(&handoff, 2);
+  WaitFor(3);
+
+  /* Free again: try succeeds and nests */
+  Check(__retarget_lock_try_acquire_recursive(&__lock___env_recursive_mutex) == 0, "try_acquire of a free lock");
+  Check(__retarget_lock_try_acquire_recursive(&__lock___env_recursive_mutex) == 0, "nested try_acquire");
+  __retarget_lock_release_recursive(&__lock___env_recursive_mutex);
+  __retarget_lock_release_recursive(&__lock___env_recursive_mutex);
+  Check(atomic_load(&giveFailures) == 0U, "no give without the take");
+}
+
+/**
+  * @brief  Check task: contexts, then the stress and churn tasks
+  */
+static void CheckTask(void *arg)
+{
+  uint32_t expected;
+  uint32_t total = 0U;
+  uint32_t count;
+  size_t heapFree;
+  uint32_t i;
+
+  (void)arg;
+  CheckContexts();
+  count = atomic_load(&asserts);
+
+  /* Pool first, then the heap, which heap_4 sets up on the first allocation */
+  vPortFree(pvPortMalloc(1U));
+  heapFree = xPortGetFreeHeapSize();
+  for (i = 0; i < STRESS_LOCKS; i++)
+  {
+    __retarget_lock_init_recursive(&guarded[i].lock);
+    Check(guarded[i].lock != NULL, "dynamic lock created");
+  }
+  guarded[STRESS_LOCKS].lock = &__lock___malloc_recursive_mutex;
+  guarded[STRESS_LOCKS + 1U].lock = &__lock___env_recursive_mutex;
+  Check(xPortGetFreeHeapSize() < heapFree, "locks past the pool from the heap");
+
+  for (i = 0; i < STRESS_TASKS; i++)
+  {
+    Start(Stress, "stress", (void *)(uintptr_t)(i + 1U), &stressTasks[i]);
+  }
+  WaitDone(STRESS_TASKS);
+  for (i = 0; i < STRESS_LOCKS + 2U; i++)
+  {
+    total += guarded[i].counter;
+  }
+  expected = STRESS_TASKS * STRESS_ROUNDS;
+  printf("stress: %u tasks, %u sections, %u counted, %u collisions\n", (unsigned)STRESS_TASKS,
+         (unsigned)expected, (unsigned)total, (unsigned)atomic_load(&collisions));
+  Check((total == expected) && (atomic_load(&collisions) == 0U), "mutual exclusion under stress");
+
+  for (i = 0; i < STRESS_LOCKS; i++)
+  {
+    __retarget_lock_close_recursive(guarded[i].lock);
+  }
+  Check(xPortGetFreeHeapSize() == heapFree, "heap locks freed on close");
+
+  for (i = 0; i < STRESS_TASKS; i++)
+  {
+    Start(Churn, "churn", NULL, &churnTasks[i]);
+  }
+  WaitDone(STRESS_TASKS);
+  printf("churn: %u tasks x %u locks, %u handed out busy, %u heap bytes left\n",
+         (unsigned)STRESS_TASKS, (unsigned)CHURN_ROUNDS, (unsigned)atomic_load(&reused),
+         (unsigned)(heapFree - xPortGetFreeHeapSize()));
+  Check((atomic_load(&reused) == 0U) && (xPortGetFreeHeapSize() == heapFree), "dynamic lock churn");
+
+  Check(atomic_load(&asserts) == count, "no assert from tasks");
+  Check(atomic_load(&giveFailures) == 0U, "no give without the take");
+
+  vTaskEndScheduler();
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  /* Before the start: no-ops, and the section may end after it */
+  __retarget_lock_acquire_recursive(&__lock___sfp_recursive_mutex);
+  Check(__retarget_lock_try_acquire(&__lock___sfp_recursive_mutex) == 0, "try_acquire before the start");
+
+  checkHandle = Start(CheckTask, "check", NULL, &checkTask);
+  vTaskStartScheduler();
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u checks\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
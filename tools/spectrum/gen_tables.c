@@ -0,0 +1,275 @@
+/**
+  ******************************************************************************
+  * @file    gen_tables.c
+  * @brief   Generator of the CMSIS-DSP float FFT tables
+  * @details The CMSIS-DSP sources in Drivers/CMSIS come without
+  *          arm_common_tables.c. This program writes the part of it the
+  *          float transforms use, to stdout, for
+  *          cmake/cmsis/generated/fft_tables_f32.c (Drivers/ is left as
+  *          vendored):
+  *          - twiddleCoef_N, N = 16..4096: cos/sin of 2*pi*i/N, i < N
+  *          - twiddleCoef_rfft_N, N = 32..4096: sin/cos of 2*pi*i/N, i < N/2
+  *          - armBitRevIndexTableN, N = 16..4096
+  *          The bit reversal tables depend on the radix-8 decomposition of
+  *          arm_cfft_f32, so they are measured from it instead of derived:
+  *          the transform of a unit impulse at sample 1 is run without the
+  *          reordering, the phase of each output gives the frequency it
+  *          holds, and the permutation is written as the in-place swaps
+  *          arm_bitreversal_32() performs (float offsets times 4). Tables
+  *          shorter than the length the header declares are padded with
+  *          zero pairs, a swap of element 0 with itself.
+  *
+  *          Every table is guarded the same way as its declaration in
+  *          arm_common_tables.h, so ARM_DSP_CONFIG_TABLES selects them.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include "arm_common_tables.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define MAX_FFT         4096U
+#define VALUES_PER_LINE 8U
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Transform size and the bit reversal table length of the header
+ */
+typedef struct
+{
+  uint16_t n;
+  uint16_t bitRevLength;
+} Size_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const Size_t sizes[] = {
+  {16U, ARMBITREVINDEXTABLE_16_TABLE_LENGTH},
+  {32U, ARMBITREVINDEXTABLE_32_TABLE_LENGTH},
+  {64U, ARMBITREVINDEXTABLE_64_TABLE_LENGTH},
+  {128U, ARMBITREVINDEXTABLE_128_TABLE_LENGTH},
+  {256U, ARMBITREVINDEXTABLE_256_TABLE_LENGTH},
+  {512U, ARMBITREVINDEXTABLE_512_TABLE_LENGTH},
+  {1024U, ARMBITREVINDEXTABLE_1024_TABLE_LENGTH},
+  {2048U, ARMBITREVINDEXTABLE_2048_TABLE_LENGTH},
+  {4096U, ARMBITREVINDEXTABLE_4096_TABLE_LENGTH},
+};
+
+static float32_t twiddle[2U * MAX_FFT];
+static float32_t buffer[2U * MAX_FFT];
+static uint16_t bitRev[2U * MAX_FFT];
+static uint16_t held[MAX_FFT];        /* Frequency held by each output */
+static uint16_t where[MAX_FFT];       /* Output holding each frequency */
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  cos/sin pairs of 2*pi*i/n for i < count, rounded from double
+  */
+static void Twiddles(float32_t *dest, uint32_t n, uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    const double angle = (2.0 * M_PI * (double)i) / (double)n;
+
+    dest[2U * i] = (float32_t)cos(angle);
+    dest[(2U * i) + 1U] = (float32_t)sin(angle);
+  }
+}
+
+/**
+  * @brief  sin/cos pairs of 2*pi*i/n for i < n/2, as the real FFT stage reads them
+  */
+static void RfftTwiddles(float32_t *dest, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < (n / 2U); i++)
+  {
+    const double angle = (2.0 * M_PI * (double)i) / (double)n;
+
+    dest[2U * i] = (float32_t)sin(angle);
+    dest[(2U * i) + 1U] = (float32_t)cos(angle);
+  }
+}
+
+/**
+  * @brief  Measures the output order of arm_cfft_f32 and writes it as swaps
+  * @param  n  Transform size
+  * @retval Number of table entries, 0 on error
+  */
+static uint32_t BitReversal(uint32_t n)
+{
+  const arm_cfft_instance_f32 instance = {(uint16_t)n, twiddle, NULL, 0U};
+  uint32_t entries = 0U;
+  uint32_t i;
+
+  Twiddles(twiddle, n, n);
+  for (i = 0; i < (2U * n); i++)
+  {
+    buffer[i] = 0.0f;
+  }
+  buffer[2] = 1.0f;
+  arm_cfft_f32(&instance, buffer, 0U, 0U);
+
+  /* Output j holds exp(-2*pi*i*k/n) for the frequency k it carries */
+  for (i = 0; i < n; i++)
+  {
+    where[i] = UINT16_MAX;
+  }
+  for (i = 0; i < n; i++)
+  {
+    const double re = buffer[2U * i];
+    const double im = buffer[(2U * i) + 1U];
+    const long k = lround((-atan2(im, re) * (double)n) / (2.0 * M_PI));
+    const uint32_t bin = (uint32_t)((k + (long)n) % (long)n);
+
+    if ((fabs(hypot(re, im) - 1.0) > 1e-3) || (where[bin] != UINT16_MAX))
+    {
+      return 0U;
+    }
+    held[i] = (uint16_t)bin;
+    where[bin] = (uint16_t)i;
+  }
+
+  /* Bring frequency i to output i, in order */
+  for (i = 0; i < n; i++)
+  {
+    const uint32_t from = where[i];
+
+    if (from != i)
+    {
+      bitRev[entries++] = (uint16_t)(i * 8U);
+      bitRev[entries++] = (uint16_t)(from * 8U);
+      held[from] = held[i];
+      where[held[from]] = (uint16_t)from;
+      held[i] = (uint16_t)i;
+      where[i] = (uint16_t)i;
+    }
+  }
+  return entries;
+}
+
+/**
+  * @brief  Prints a float so that it reads back to the same value
+  */
+static void PrintFloat(float32_t value)
+{
+  char text[32];
+  uint32_t i;
+  uint8_t hasPoint = 0U;
+
+  snprintf(text, sizeof(text), "%.9g", (double)value);
+  for (i = 0; text[i] != '\0'; i++)
+  {
+    if ((text[i] == '.') || (text[i] == 'e'))
+    {
+      hasPoint = 1U;
+    }
+  }
+  printf("%s%sf", text, hasPoint ? "" : ".0");
+}
+
+static void PrintFloats(const char *name, const char *guard, const float32_t *values, uint32_t count)
+{
+  uint32_t i;
+
+  printf("#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || defined(%s)\n", guard);
+  printf("const float32_t %s[%u] = {\n", name, (unsigned)count);
+  for (i = 0; i < count; i++)
+  {
+    printf("%s", ((i % VALUES_PER_LINE) == 0U) ? "    " : " ");
+    PrintFloat(values[i]);
+    printf("%s", (i + 1U == count) ? "\n" : (((i + 1U) % VALUES_PER_LINE) == 0U) ? ",\n" : ",");
+  }
+  printf("};\n#endif\n\n");
+}
+
+static void PrintIndices(uint32_t n, uint32_t length, uint32_t entries)
+{
+  uint32_t i;
+
+  printf("#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || "
+         "defined(ARM_TABLE_BITREVIDX_FLT_%u)\n", (unsigned)n);
+  if (entries < length)
+  {
+    printf("/* %u swaps, padded to the declared length */\n", (unsigned)(entries / 2U));
+  }
+  printf("const uint16_t armBitRevIndexTable%u[ARMBITREVINDEXTABLE_%u_TABLE_LENGTH] = {\n",
+         (unsigned)n, (unsigned)n);
+  for (i = 0; i < length; i++)
+  {
+    printf("%s%u", ((i % VALUES_PER_LINE) == 0U) ? "    " : " ", (i < entries) ? (unsigned)bitRev[i] : 0U);
+    printf("%s", (i + 1U == length) ? "\n" : (((i + 1U) % VALUES_PER_LINE) == 0U) ? ",\n" : ",");
+  }
+  printf("};\n#endif\n\n");
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  char name[48];
+  char guard[48];
+  uint32_t s;
+
+  printf("/* ----------------------------------------------------------------------\n"
+         " * Project:      CMSIS DSP Library\n"
+         " * Title:        fft_tables_f32.c\n"
+         " * Description:  Float FFT tables: twiddle factors and bit reversal\n"
+         " *\n"
+         " * Generated by tools/spectrum/gen_tables.c, in place of the\n"
+         " * arm_common_tables.c missing from Drivers/CMSIS. Holds the tables of the\n"
+         " * arm_cfft_f32 and arm_rfft_fast_f32 transforms only; the fixed-point,\n"
+         " * float64, MFCC and fast math tables are not included.\n"
+         " * -------------------------------------------------------------------- */\n\n"
+         "#include \"arm_math_types.h\"\n"
+         "#include \"arm_common_tables.h\"\n\n"
+         "#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FFT_ALLOW_TABLES)\n\n");
+
+  for (s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    const uint32_t n = sizes[s].n;
+
+    Twiddles(twiddle, n, n);
+    snprintf(name, sizeof(name), "twiddleCoef_%u", (unsigned)n);
+    snprintf(guard, sizeof(guard), "ARM_TABLE_TWIDDLECOEF_F32_%u", (unsigned)n);
+    PrintFloats(name, guard, twiddle, 2U * n);
+  }
+
+  for (s = 1; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    const uint32_t n = sizes[s].n;
+
+    RfftTwiddles(twiddle, n);
+    snprintf(name, sizeof(name), "twiddleCoef_rfft_%u", (unsigned)n);
+    snprintf(guard, sizeof(guard), "ARM_TABLE_TWIDDLECOEF_RFFT_F32_%u", (unsigned)n);
+    PrintFloats(name, guard, twiddle, n);
+  }
+
+  for (s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    const uint32_t entries = BitReversal(sizes[s].n);
+
+    if (entries == 0U)
+    {
+      fprintf(stderr, "FAILED: output order of the %u point transform\n", (unsigned)sizes[s].n);
+      return EXIT_FAILURE;
+    }
+    if (entries > sizes[s].bitRevLength)
+    {
+      fprintf(stderr, "FAILED: %u point table needs %u entries, header declares %u\n",
+              (unsigned)sizes[s].n, (unsigned)entries, (unsigned)sizes[s].bitRevLength);
+      return EXIT_FAILURE;
+    }
+    PrintIndices(sizes[s].n, sizes[s].bitRevLength, entries);
+  }
+
+  printf("#endif /* !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_FFT_ALLOW_TABLES) */\n");
+  return EXIT_SUCCESS;
+}
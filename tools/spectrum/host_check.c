@@ -0,0 +1,210 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host check of the spectrum analyzer transform
+  * @details Runs the host CMSIS-DSP build with the generated FFT tables:
+  *          - arm_rfft_fast_f32 against a double precision DFT of random
+  *            data, for every length the analyzer accepts
+  *          - the frame steps of SPECTRUM_Transform() and the scaling of
+  *            SPECTRUM_Publish() on a sine in the middle of a bin plus an
+  *            offset: the bin reads A^2 / 2, its Hann neighbours a quarter
+  *            of that, everything else stays at the float noise floor
+  *          The check fails if a length does not initialize, if the FFT
+  *          error exceeds 1e-5 of the largest bin, or if a power is off.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "arm_math.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define MIN_FFT         256U        /* SPECTRUM_MIN_FFT */
+#define MAX_FFT         4096U       /* SPECTRUM_MAX_FFT */
+#define FFT_TOLERANCE   1e-5        /* Of the largest bin magnitude */
+#define POWER_TOLERANCE 0.01        /* dB */
+#define LEAKAGE_LIMIT   -90.0       /* dB below the sine, past the Hann main lobe */
+#define SINE_AMPLITUDE  3.0
+#define SINE_OFFSET     25.0
+
+/* Private variables ---------------------------------------------------------*/
+static arm_rfft_fast_instance_f32 rfft;
+static float32_t input[MAX_FFT];
+static float32_t frame[MAX_FFT];
+static float32_t fftOut[MAX_FFT];
+static float32_t window[MAX_FFT / 2U + 1U];
+static double reference[MAX_FFT + 2U];
+static uint32_t lcg = 12345U;
+static uint32_t failures;
+
+/* Private functions ---------------------------------------------------------*/
+static float32_t Random(void)
+{
+  lcg = (lcg * 1103515245U) + 12345U;
+  return ((float32_t)(lcg >> 8) / 8388608.0f) - 1.0f;
+}
+
+/**
+  * @brief  DFT of the real input in double, bins 0..n/2 as re/im pairs
+  */
+static void Dft(const float32_t *x, uint32_t n)
+{
+  uint32_t k;
+  uint32_t i;
+
+  for (k = 0; k <= (n / 2U); k++)
+  {
+    double re = 0.0;
+    double im = 0.0;
+
+    for (i = 0; i < n; i++)
+    {
+      /* Reduce k * i first, the angle stays exact */
+      const double angle = (2.0 * M_PI * (double)((k * i) % n)) / (double)n;
+
+      re += (double)x[i] * cos(angle);
+      im -= (double)x[i] * sin(angle);
+    }
+    reference[2U * k] = re;
+    reference[(2U * k) + 1U] = im;
+  }
+}
+
+/**
+  * @brief  arm_rfft_fast_f32 against the DFT
+  * @param  n  Transform length
+  * @retval None
+  */
+static void CheckFft(uint32_t n)
+{
+  double peak = 0.0;
+  double worst = 0.0;
+  uint32_t k;
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    input[i] = Random();
+    frame[i] = input[i];
+  }
+  Dft(input, n);
+  arm_rfft_fast_f32(&rfft, frame, fftOut, 0U);
+
+  /* fftOut[0] is the real DC bin, fftOut[1] the real Nyquist bin */
+  for (k = 0; k <= (n / 2U); k++)
+  {
+    peak = fmax(peak, hypot(reference[2U * k], reference[(2U * k) + 1U]));
+  }
+  worst = fmax(fabs(fftOut[0] - reference[0]), fabs(fftOut[1] - reference[n]));
+  for (k = 1; k < (n / 2U); k++)
+  {
+    worst = fmax(worst, hypot(fftOut[2U * k] - reference[2U * k],
+                              fftOut[(2U * k) + 1U] - reference[(2U * k) + 1U]));
+  }
+
+  printf("%4u points: FFT error %.2e of the largest bin\n", (unsigned)n, worst / peak);
+  if ((worst / peak) > FFT_TOLERANCE)
+  {
+    printf("FAILED: %u point FFT error\n", (unsigned)n);
+    failures++;
+  }
+}
+
+/**
+  * @brief  Window, FFT, bin power and scaling as in spectrum.c
+  * @param  n    Transform length
+  * @param  bin  Bin the sine sits on
+  * @retval None
+  */
+static void CheckPower(uint32_t n, uint32_t bin)
+{
+  const double expected = 10.0 * log10((SINE_AMPLITUDE * SINE_AMPLITUDE) / 2.0);
+  const uint32_t bins = n / 2U;
+  const float32_t windowSum = (float32_t)bins;
+  const float32_t scale = 2.0f / (windowSum * windowSum);
+  double leakage = -300.0;
+  float32_t mean;
+  double db[3];
+  uint32_t k;
+  uint32_t i;
+
+  for (i = 0; i <= (n / 2U); i++)
+  {
+    window[i] = 0.5f - (0.5f * cosf((2.0f * PI * (float32_t)i) / (float32_t)n));
+  }
+  for (i = 0; i < n; i++)
+  {
+    const double angle = (2.0 * M_PI * (double)((bin * i) % n)) / (double)n;
+
+    frame[i] = (float32_t)(SINE_OFFSET + (SINE_AMPLITUDE * sin(angle)));
+  }
+
+  /* SPECTRUM_Transform() */
+  arm_mean_f32(frame, n, &mean);
+  arm_offset_f32(frame, -mean, frame, n);
+  arm_mult_f32(frame, window, frame, n / 2U);
+  for (i = n / 2U; i < n; i++)
+  {
+    frame[i] *= window[n - i];
+  }
+  arm_rfft_fast_f32(&rfft, frame, fftOut, 0U);
+  frame[0] = fftOut[0] * fftOut[0];
+  arm_cmplx_mag_squared_f32(&fftOut[2], &frame[1], bins - 1U);
+
+  /* SPECTRUM_Publish(), one frame averaged */
+  arm_scale_f32(frame, scale, frame, bins);
+  frame[0] *= 0.5f;
+
+  for (i = 0; i < 3U; i++)
+  {
+    db[i] = 10.0 * log10((double)frame[bin - 1U + i] + 1e-30);
+  }
+  for (k = 0; k < bins; k++)
+  {
+    if ((k + 1U < bin) || (k > bin + 1U))
+    {
+      leakage = fmax(leakage, 10.0 * log10((double)frame[k] + 1e-30) - expected);
+    }
+  }
+
+  printf("%4u points: bin %u at %.3f dB (expected %.3f), neighbours %.3f / %.3f dB, "
+         "leakage %.1f dB\n", (unsigned)n, (unsigned)bin, db[1], expected, db[0], db[2], leakage);
+  if ((fabs(db[1] - expected) > POWER_TOLERANCE) ||
+      (fabs(db[0] - (expected - 10.0 * log10(4.0))) > POWER_TOLERANCE) ||
+      (fabs(db[2] - (expected - 10.0 * log10(4.0))) > POWER_TOLERANCE) ||
+      (leakage > LEAKAGE_LIMIT))
+  {
+    printf("FAILED: %u point bin power\n", (unsigned)n);
+    failures++;
+  }
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  uint32_t n;
+
+  for (n = MIN_FFT; n <= MAX_FFT; n *= 2U)
+  {
+    if (arm_rfft_fast_init_f32(&rfft, (uint16_t)n) != ARM_MATH_SUCCESS)
+    {
+      printf("FAILED: arm_rfft_fast_init_f32(%u)\n", (unsigned)n);
+      failures++;
+      continue;
+    }
+    CheckFft(n);
+    CheckPower(n, n / 10U);
+  }
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u checks\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
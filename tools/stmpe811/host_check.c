@@ -0,0 +1,265 @@
+/**
+  ******************************************************************************
+  * @file    host_check.c
+  * @brief   Host trace replay check of the STMPE811 driver
+  * @details Replays finger traces through the register-level model of
+  *          sim_touch.c into Peripherals/STMPE811 and the gesture recognizer:
+  *          a tap, a fast swipe, a slow drag, a long press that the tracking
+  *          index thins out before it moves, and the swipe again with the
+  *          device sampling faster than STMPE811_SAMPLE_PERIOD_US. For each:
+  *          - every stored sample reaches the recognizer, in order
+  *          - the time it is stamped with is within STAMP_TOLERANCE_MS of
+  *            the time the model took it, and never goes backwards
+  *          - the events and their order are the ones of the gesture, and
+  *            DOWN carries the time of the first sample
+  *          The recognizer input is seen through -Wl,--wrap.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_touch.h"
+#include "stmpe811.h"
+#include "cmsis_os.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define STEP_US              100U
+#define SETTLE_MS            50U       /* After the last key frame */
+/* Two sample periods: each sample the tracking index drops inside a batch
+   moves the ones before it a period early. Stamping a whole batch with its
+   read time is off by up to STMPE811_FIFO_THRESHOLD - 1 periods. */
+#define STAMP_TOLERANCE_MS   ((int32_t)((2U * STMPE811_SAMPLE_PERIOD_US) / 1000U) + 1)
+#define MAX_FED              4096U
+#define MAX_EVENTS           256U
+#define MAX_FRAMES           8U
+#define END                  TOUCH_EVENT_SWIPE_DOWN + 1
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief   Finger position at a time; positions in between are interpolated
+ */
+typedef struct
+{
+  uint32_t ms;
+  uint8_t touched;
+  int16_t x;
+  int16_t y;
+} Frame_t;
+
+/**
+ * @brief   A trace, the sample period of the device and the expected events
+ * @details DRAG events are not listed, only whether there are any
+ */
+typedef struct
+{
+  const char *name;
+  uint32_t periodUs;
+  int32_t jitter;             /* Raw ADC noise amplitude */
+  Frame_t frames[MAX_FRAMES];
+  int events[6];              /* Ends with END */
+  uint8_t drags;
+} Trace_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const Trace_t traces[] = {
+  { "tap", STMPE811_SAMPLE_PERIOD_US, 16,
+    { {0U, 1U, 120, 160}, {120U, 1U, 120, 160}, {121U, 0U, 0, 0} },
+    { TOUCH_EVENT_DOWN, TOUCH_EVENT_TAP, TOUCH_EVENT_UP, END }, 0U },
+  { "swipe", STMPE811_SAMPLE_PERIOD_US, 16,
+    { {0U, 1U, 30, 150}, {200U, 1U, 210, 160}, {201U, 0U, 0, 0} },
+    { TOUCH_EVENT_DOWN, TOUCH_EVENT_SWIPE_RIGHT, TOUCH_EVENT_UP, END }, 1U },
+  { "slow drag", STMPE811_SAMPLE_PERIOD_US, 16,
+    { {0U, 1U, 60, 60}, {1200U, 1U, 180, 260}, {1201U, 0U, 0, 0} },
+    { TOUCH_EVENT_DOWN, TOUCH_EVENT_DRAG_END, TOUCH_EVENT_UP, END }, 1U },
+  { "press, then drag", STMPE811_SAMPLE_PERIOD_US, 1,
+    { {0U, 1U, 100, 100}, {600U, 1U, 100, 100}, {900U, 1U, 100, 220}, {901U, 0U, 0, 0} },
+    { TOUCH_EVENT_DOWN, TOUCH_EVENT_DRAG_END, TOUCH_EVENT_UP, END }, 1U },
+  { "swipe, faster device", 1800U, 16,
+    { {0U, 1U, 200, 300}, {250U, 1U, 190, 40}, {251U, 0U, 0, 0} },
+    { TOUCH_EVENT_DOWN, TOUCH_EVENT_SWIPE_UP, TOUCH_EVENT_UP, END }, 1U },
+};
+
+static uint32_t fedMs[MAX_FED];
+static uint32_t fedCount;
+static uint32_t lcg = 811U;
+static uint32_t failures;
+
+/* Private functions ---------------------------------------------------------*/
+void __real_TOUCH_Gesture_Sample(TOUCH_Gesture_t *gesture, int16_t x, int16_t y, uint32_t timestampMs);
+
+/**
+  * @brief  Recognizer input, recorded on the way
+  */
+void __wrap_TOUCH_Gesture_Sample(TOUCH_Gesture_t *gesture, int16_t x, int16_t y, uint32_t timestampMs)
+{
+  if (fedCount < MAX_FED)
+  {
+    fedMs[fedCount] = timestampMs;
+  }
+  fedCount++;
+  __real_TOUCH_Gesture_Sample(gesture, x, y, timestampMs);
+}
+
+static int32_t Noise(int32_t amplitude)
+{
+  lcg = (lcg * 1103515245U) + 12345U;
+  return (amplitude == 0) ? 0 : (int32_t)((lcg >> 16) % (uint32_t)(2 * amplitude + 1)) - amplitude;
+}
+
+static int32_t ToRaw(int32_t pixel, int32_t rawMin, int32_t rawMax, int32_t size)
+{
+  return rawMin + (((pixel * (rawMax - rawMin)) + (size / 2)) / size);
+}
+
+/**
+  * @brief  Finger state at a time of the trace
+  */
+static void Finger(const Trace_t *trace, uint32_t us)
+{
+  uint32_t i;
+
+  for (i = 0; (i + 1U < MAX_FRAMES) && (trace->frames[i + 1U].ms != 0U); i++)
+  {
+    const Frame_t *a = &trace->frames[i];
+    const Frame_t *b = &trace->frames[i + 1U];
+
+    if (us < (b->ms * 1000U))
+    {
+      const int32_t span = (int32_t)((b->ms - a->ms) * 1000U);
+      const int32_t at = (int32_t)(us - (a->ms * 1000U));
+      const int32_t x = a->x + (int32_t)(((int64_t)(b->x - a->x) * at) / span);
+      const int32_t y = a->y + (int32_t)(((int64_t)(b->y - a->y) * at) / span);
+
+      SIM_Finger(a->touched,
+                 ToRaw(x, STMPE811_RAW_X_MIN, STMPE811_RAW_X_MAX, STMPE811_SCREEN_WIDTH) + Noise(trace->jitter),
+                 ToRaw(y, STMPE811_RAW_Y_MIN, STMPE811_RAW_Y_MAX, STMPE811_SCREEN_HEIGHT) + Noise(trace->jitter));
+      return;
+    }
+  }
+  SIM_Finger(0U, 0, 0);
+}
+
+static void Replay(const Trace_t *trace)
+{
+  TOUCH_Event_t events[MAX_EVENTS];
+  uint32_t eventCount = 0U;
+  uint32_t lastMs = 0U;
+  uint32_t drags = 0U;
+  uint32_t endMs = 0U;
+  int32_t worst = 0;
+  uint32_t e = 0U;
+  uint32_t i;
+  uint32_t k;
+
+  SIM_TouchReset(trace->periodUs);
+  if (STMPE811_Init() != HAL_OK)
+  {
+    printf("FAILED: %s: STMPE811_Init()\n", trace->name);
+    failures++;
+    return;
+  }
+  fedCount = 0U;
+
+  for (i = 0; (i < MAX_FRAMES) && ((i == 0U) || (trace->frames[i].ms != 0U)); i++)
+  {
+    endMs = trace->frames[i].ms;
+  }
+  for (i = 0; i < ((endMs + SETTLE_MS) * 1000U); i += STEP_US)
+  {
+    Finger(trace, i);
+    SIM_Run(STEP_US);
+
+    /* The consumer task */
+    while ((eventCount < MAX_EVENTS) &&
+           (osMessageQueueGet(STMPE811_GetEventQueue(), &events[eventCount], NULL, 0U) == osOK))
+    {
+      eventCount++;
+    }
+  }
+
+  /* Every sample, in order, stamped with about the time it was taken */
+  if ((fedCount != SIM_TouchStored()) || (SIM_TouchDropped() != 0U) || (fedCount > MAX_FED))
+  {
+    printf("FAILED: %s: %u samples stored, %u dropped, %u fed\n", trace->name,
+           (unsigned)SIM_TouchStored(), (unsigned)SIM_TouchDropped(), (unsigned)fedCount);
+    failures++;
+    return;
+  }
+  for (k = 0; k < fedCount; k++)
+  {
+    const int32_t error = (int32_t)fedMs[k] - (int32_t)(SIM_TouchSampleUs(k) / 1000U);
+
+    worst = (abs(error) > abs(worst)) ? error : worst;
+    if (fedMs[k] < lastMs)
+    {
+      printf("FAILED: %s: sample %u stamped %u ms, before the previous one\n",
+             trace->name, (unsigned)k, (unsigned)fedMs[k]);
+      failures++;
+    }
+    lastMs = fedMs[k];
+  }
+
+  /* Events, DRAG aside */
+  for (k = 0; k < eventCount; k++)
+  {
+    if (events[k].type == TOUCH_EVENT_DRAG)
+    {
+      drags++;
+      continue;
+    }
+    if (trace->events[e] != (int)events[k].type)
+    {
+      break;
+    }
+    e++;
+  }
+
+  printf("%-22s %3u samples, %3u events, worst stamp error %+d ms\n",
+         trace->name, (unsigned)fedCount, (unsigned)eventCount, (int)worst);
+  if (abs(worst) > STAMP_TOLERANCE_MS)
+  {
+    printf("FAILED: %s: sample stamped %d ms off\n", trace->name, (int)worst);
+    failures++;
+  }
+  if ((k != eventCount) || (trace->events[e] != END) || ((drags != 0U) != (trace->drags != 0U)))
+  {
+    printf("FAILED: %s: events", trace->name);
+    for (k = 0; k < eventCount; k++)
+    {
+      printf(" %s", STMPE811_EventName(events[k].type));
+    }
+    printf("\n");
+    failures++;
+  }
+  if ((eventCount != 0U) && (events[0].timestampMs != fedMs[0]))
+  {
+    printf("FAILED: %s: DOWN at %u ms, first sample at %u ms\n", trace->name,
+           (unsigned)events[0].timestampMs, (unsigned)fedMs[0]);
+    failures++;
+  }
+}
+
+/* Main ----------------------------------------------------------------------*/
+int main(void)
+{
+  uint32_t i;
+
+  /* Away from time 0, so no stamp is clamped */
+  SIM_Run(1000000U);
+
+  for (i = 0; i < (sizeof(traces) / sizeof(traces[0])); i++)
+  {
+    Replay(&traces[i]);
+  }
+
+  if (failures != 0U)
+  {
+    printf("FAILED: %u checks\n", (unsigned)failures);
+    return EXIT_FAILURE;
+  }
+  printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,356 @@
+/**
+  ******************************************************************************
+  * @file    sim_touch.c
+  * @brief   Register-level STMPE811 touch screen model for host builds
+  * @details Implements the I2CBUS_* interface and TIMEBASE_GetUs() for
+  *          Peripherals/STMPE811 on top of the device model described in
+  *          sim_touch.h, and drives the INT pin and TIM2 of sim_core.c.
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sim_touch.h"
+#include "sim_core.h"
+#include "stmpe811.h"
+#include "i2c_bus.h"
+#include "timebase.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines -----------------------------------------------------------*/
+#define SIM_FIFO_DEPTH            128U
+#define SIM_QUEUE_SIZE            4U
+#define SIM_TRACK_MASK            0x70U
+#define SIM_FIFO_STA_TH_TRIG      0x10U
+#define SIM_FIFO_STA_EMPTY        0x20U
+#define SIM_FIFO_STA_FULL         0x40U
+
+/* Private variables ---------------------------------------------------------*/
+static uint64_t nowUs;
+
+static uint8_t regs[0x100];
+static uint16_t fifo[SIM_FIFO_DEPTH][2];
+static uint32_t fifoHead;
+static uint32_t fifoCount;
+static uint32_t periodUs;
+static uint64_t nextSampleUs;
+static uint8_t touched;
+static int32_t fingerX;
+static int32_t fingerY;
+static int32_t lastX;
+static int32_t lastY;
+static uint8_t haveLast;
+static uint32_t stored;
+static uint32_t dropped;
+static uint64_t sampleUs[SIM_MAX_SAMPLES];
+static uint8_t intLine = 1U;
+
+static I2CBUS_Transaction_t *queue[SIM_QUEUE_SIZE];
+static uint32_t queueHead;
+static uint32_t queueCount;
+static uint64_t transferDoneUs;
+
+/* Private functions ---------------------------------------------------------*/
+static int32_t Abs(int32_t value)
+{
+  return (value < 0) ? -value : value;
+}
+
+static void UpdateFlags(void)
+{
+  const uint8_t threshold = regs[STMPE811_REG_FIFO_TH];
+
+  if ((threshold != 0U) && (fifoCount >= threshold))
+  {
+    regs[STMPE811_REG_INT_STA] |= STMPE811_INT_FIFO_TH;
+  }
+}
+
+static void Sample(void)
+{
+  const int32_t track = (int32_t)((regs[STMPE811_REG_TSC_CTRL] & SIM_TRACK_MASK) >> 4);
+  static const int32_t index[8] = { 0, 4, 8, 16, 32, 64, 92, 127 };
+
+  /* Tracking: a sample that moved less than the index on both axes is dropped */
+  if (haveLast && (track != 0) &&
+      (Abs(fingerX - lastX) < index[track]) && (Abs(fingerY - lastY) < index[track]))
+  {
+    return;
+  }
+
+  if (fifoCount == SIM_FIFO_DEPTH)
+  {
+    dropped++;
+    regs[STMPE811_REG_INT_STA] |= STMPE811_INT_FIFO_OFLOW;
+    return;
+  }
+  if (stored >= SIM_MAX_SAMPLES)
+  {
+    printf("FAILED: simulation longer than %u samples\n", (unsigned)SIM_MAX_SAMPLES);
+    exit(EXIT_FAILURE);
+  }
+
+  fifo[(fifoHead + fifoCount) % SIM_FIFO_DEPTH][0] = (uint16_t)fingerX;
+  fifo[(fifoHead + fifoCount) % SIM_FIFO_DEPTH][1] = (uint16_t)fingerY;
+  fifoCount++;
+  sampleUs[stored++] = nowUs;
+  lastX = fingerX;
+  lastY = fingerY;
+  haveLast = 1U;
+  UpdateFlags();
+}
+
+static uint8_t ReadReg(uint8_t reg)
+{
+  switch (reg)
+  {
+    case STMPE811_REG_CHIP_ID:
+      return (uint8_t)(STMPE811_CHIP_ID >> 8);
+    case STMPE811_REG_CHIP_ID + 1U:
+      return (uint8_t)STMPE811_CHIP_ID;
+    case STMPE811_REG_TSC_CTRL:
+      return (uint8_t)((regs[reg] & 0x7FU) | (touched ? STMPE811_TSC_CTRL_TOUCHED : 0U));
+    case STMPE811_REG_FIFO_STA:
+      return (uint8_t)(((fifoCount == 0U) ? SIM_FIFO_STA_EMPTY : 0U) |
+                       ((fifoCount == SIM_FIFO_DEPTH) ? SIM_FIFO_STA_FULL : 0U) |
+                       ((fifoCount >= regs[STMPE811_REG_FIFO_TH]) ? SIM_FIFO_STA_TH_TRIG : 0U));
+    case STMPE811_REG_FIFO_SIZE:
+      return (uint8_t)fifoCount;
+    default:
+      return regs[reg];
+  }
+}
+
+static void WriteReg(uint8_t reg, uint8_t value)
+{
+  if (reg == STMPE811_REG_INT_STA)
+  {
+    regs[reg] &= (uint8_t)~value;
+    UpdateFlags();
+    return;
+  }
+  if ((reg == STMPE811_REG_FIFO_STA) && ((value & STMPE811_FIFO_STA_RESET) != 0U))
+  {
+    fifoHead = 0U;
+    fifoCount = 0U;
+  }
+  if ((reg == STMPE811_REG_SYS_CTRL1) && ((value & STMPE811_SYS_CTRL1_SOFT_RESET) != 0U))
+  {
+    memset(regs, 0, sizeof(regs));
+    regs[STMPE811_REG_SYS_CTRL2] = 0x0FU;
+    fifoHead = 0U;
+    fifoCount = 0U;
+    return;
+  }
+  regs[reg] = value;
+}
+
+/**
+  * @brief  Register access of one transaction: a TSC_DATA read pops samples
+  */
+static void Access(uint8_t reg, I2CBUS_Direction_t direction, uint8_t *data, uint16_t length)
+{
+  uint16_t i;
+
+  for (i = 0; i < length; i++)
+  {
+    if ((direction == I2CBUS_READ) && (reg == STMPE811_REG_TSC_DATA))
+    {
+      const uint32_t byte = i % STMPE811_SAMPLE_BYTES;
+      const uint16_t x = (fifoCount != 0U) ? fifo[fifoHead][0] : 0U;
+      const uint16_t y = (fifoCount != 0U) ? fifo[fifoHead][1] : 0U;
+
+      data[i] = (byte == 0U) ? (uint8_t)(x >> 4) :
+                (byte == 1U) ? (uint8_t)(((x & 0x0FU) << 4) | (y >> 8)) :
+                (byte == 2U) ? (uint8_t)y : 0x40U;
+      if ((byte == (STMPE811_SAMPLE_BYTES - 1U)) && (fifoCount != 0U))
+      {
+        fifoHead = (fifoHead + 1U) % SIM_FIFO_DEPTH;
+        fifoCount--;
+      }
+      continue;
+    }
+
+    if (direction == I2CBUS_READ)
+    {
+      data[i] = ReadReg(reg);
+    }
+    else
+    {
+      WriteReg(reg, data[i]);
+    }
+    reg++;
+  }
+}
+
+static void StartNext(void)
+{
+  if (queueCount != 0U)
+  {
+    const I2CBUS_Transaction_t *transaction = queue[queueHead];
+    const uint32_t bytes = 1U + transaction->regSize + transaction->length +
+                           ((transaction->direction == I2CBUS_READ) ? 1U : 0U);
+
+    transferDoneUs = nowUs + ((((uint64_t)bytes * 9U) + 2U) * 1000000U + SIM_I2C_HZ - 1U) / SIM_I2C_HZ;
+  }
+}
+
+static void IntUpdate(void)
+{
+  const uint8_t active = ((regs[STMPE811_REG_INT_CTRL] & STMPE811_INT_CTRL_GLOBAL) != 0U) &&
+                         ((regs[STMPE811_REG_INT_STA] & regs[STMPE811_REG_INT_EN]) != 0U);
+  const uint8_t level = active ? 0U : 1U;
+
+  SIM_GPIOA.IDR = level ? TP_INT1_Pin : 0U;
+  if (!level && intLine && SIM_IrqEnabled(EXTI15_10_IRQn, NULL))
+  {
+    intLine = level;
+    STMPE811_IrqHandler();
+  }
+  intLine = level;
+}
+
+/* Exported functions --------------------------------------------------------*/
+void SIM_TouchReset(uint32_t period)
+{
+  if (queueCount != 0U)
+  {
+    printf("FAILED: device reset with a transaction on the bus\n");
+    exit(EXIT_FAILURE);
+  }
+  memset(regs, 0, sizeof(regs));
+  regs[STMPE811_REG_SYS_CTRL2] = 0x0FU;
+  fifoHead = 0U;
+  fifoCount = 0U;
+  periodUs = period;
+  touched = 0U;
+  haveLast = 0U;
+  stored = 0U;
+  dropped = 0U;
+  intLine = 1U;
+  SIM_CoreReset();
+  SIM_GPIOA.IDR = TP_INT1_Pin;
+}
+
+void SIM_Finger(uint8_t down, int32_t rawX, int32_t rawY)
+{
+  fingerX = rawX;
+  fingerY = rawY;
+  if (down && !touched)
+  {
+    /* First sample after the touch detect delay and one acquisition */
+    nextSampleUs = nowUs + periodUs;
+    haveLast = 0U;
+  }
+  if ((down != 0U) != (touched != 0U))
+  {
+    regs[STMPE811_REG_INT_STA] |= STMPE811_INT_TOUCH_DET;
+  }
+  touched = (down != 0U) ? 1U : 0U;
+}
+
+void SIM_Run(uint64_t us)
+{
+  const uint64_t end = nowUs + us;
+
+  while (nowUs < end)
+  {
+    nowUs++;
+    SIM_TIM2.CNT = (uint32_t)nowUs;
+
+    if (touched && ((regs[STMPE811_REG_TSC_CTRL] & STMPE811_TSC_CTRL_EN) != 0U) && (nowUs >= nextSampleUs))
+    {
+      Sample();
+      nextSampleUs += periodUs;
+    }
+
+    if ((queueCount != 0U) && (nowUs >= transferDoneUs))
+    {
+      I2CBUS_Transaction_t *transaction = queue[queueHead];
+
+      queueHead = (queueHead + 1U) % SIM_QUEUE_SIZE;
+      queueCount--;
+      Access((uint8_t)transaction->reg, transaction->direction, transaction->data, transaction->length);
+      StartNext();
+      transaction->status = HAL_OK;
+      if (transaction->callback != NULL)
+      {
+        transaction->callback(transaction);
+      }
+    }
+
+    IntUpdate();
+  }
+}
+
+uint64_t SIM_NowUs(void)
+{
+  return nowUs;
+}
+
+uint32_t SIM_TouchStored(void)
+{
+  return stored;
+}
+
+uint64_t SIM_TouchSampleUs(uint32_t index)
+{
+  return (index < stored) ? sampleUs[index] : 0U;
+}
+
+uint32_t SIM_TouchDropped(void)
+{
+  return dropped;
+}
+
+/* Bus -----------------------------------------------------------------------*/
+HAL_StatusTypeDef I2CBUS_Submit(I2CBUS_Transaction_t *transaction)
+{
+  if ((transaction->address != STMPE811_I2C_ADDRESS) || (queueCount == SIM_QUEUE_SIZE))
+  {
+    return HAL_ERROR;
+  }
+  transaction->status = HAL_BUSY;
+  queue[(queueHead + queueCount) % SIM_QUEUE_SIZE] = transaction;
+  queueCount++;
+  if (queueCount == 1U)
+  {
+    StartNext();
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef I2CBUS_MemRead(uint8_t address, uint8_t reg, uint8_t *data, uint16_t length, uint32_t timeoutMs)
+{
+  (void)timeoutMs;
+  if (address != STMPE811_I2C_ADDRESS)
+  {
+    return HAL_ERROR;
+  }
+  Access(reg, I2CBUS_READ, data, length);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef I2CBUS_MemWrite(uint8_t address, uint8_t reg, const uint8_t *data, uint16_t length,
+                                  uint32_t timeoutMs)
+{
+  uint8_t copy[16];
+
+  (void)timeoutMs;
+  if ((address != STMPE811_I2C_ADDRESS) || (length > sizeof(copy)))
+  {
+    return HAL_ERROR;
+  }
+  memcpy(copy, data, length);
+  Access(reg, I2CBUS_WRITE, copy, length);
+  return HAL_OK;
+}
+
+/* Timebase ------------------------------------------------------------------*/
+uint64_t TIMEBASE_GetUs(void)
+{
+  return nowUs;
+}
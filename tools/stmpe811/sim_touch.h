@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file    sim_touch.h
+  * @brief   Register-level STMPE811 touch screen model for host builds
+  * @details Stands behind I2CBUS_Submit(), I2CBUS_MemRead() and
+  *          I2CBUS_MemWrite(): register reads auto-increment, the TSC data
+  *          register does not and pops one 4-byte sample per read, so the
+  *          driver runs unchanged against it.
+  *          - a finger set with SIM_Finger() is sampled every sample period
+  *            of the model while the touch screen block is enabled; the
+  *            tracking index of TSC_CTRL drops samples that moved less
+  *            than it on both axes, as the device does
+  *          - 128-sample FIFO with threshold and overflow flags, INT_STA
+  *            with write-one-to-clear, FIFO reset through FIFO_STA
+  *          - the INT line is low while an enabled flag is set; a falling
+  *            edge with EXTI15_10 enabled runs STMPE811_IrqHandler()
+  *          - a queued transaction completes after its time on the bus at
+  *            400 kHz, the blocking helpers complete at once
+  *          Every stored sample keeps the time it was taken, so a check can
+  *          compare what the driver stamps it with.
+  *
+  *          Time is virtual and only moves in SIM_Run().
+  * @version 1.0
+  * @date    2025-04-15
+  ******************************************************************************
+  */
+
+#ifndef __SIM_TOUCH_H__
+#define __SIM_TOUCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define SIM_I2C_HZ                400000U
+#define SIM_MAX_SAMPLES           65536U    /* Stored samples kept */
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+ * @brief   Powers the device up again
+ * @details Clears the registers, the FIFO, the sample log and EXTI15_10;
+ *          exits if a transaction is still on the bus
+ * @param   periodUs  Time between two samples of the model
+ * @retval  None
+ */
+void SIM_TouchReset(uint32_t periodUs);
+
+/**
+ * @brief   Places or lifts the finger
+ * @param   touched  Non-zero while the panel is pressed
+ * @param   rawX     ADC value of the position
+ * @param   rawY     ADC value of the position
+ * @retval  None
+ */
+void SIM_Finger(uint8_t touched, int32_t rawX, int32_t rawY);
+
+/**
+ * @brief   Advances the virtual clock
+ * @param   us  Microseconds to run
+ * @retval  None
+ */
+void SIM_Run(uint64_t us);
+
+/**
+ * @brief   Current virtual time
+ * @param   None
+ * @retval  Microseconds since the start
+ */
+uint64_t SIM_NowUs(void);
+
+/**
+ * @brief   Number of samples stored in the FIFO since the reset
+ * @param   None
+ * @retval  Sample count, the FIFO order
+ */
+uint32_t SIM_TouchStored(void);
+
+/**
+ * @brief   Time a stored sample was taken
+ * @param   index  Sample, in FIFO order
+ * @retval  Microseconds, 0 for a sample not stored
+ */
+uint64_t SIM_TouchSampleUs(uint32_t index);
+
+/**
+ * @brief   Samples lost because the FIFO was full
+ * @param   None
+ * @retval  Sample count
+ */
+uint32_t SIM_TouchDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SIM_TOUCH_H__ */